@@ -34,6 +34,10 @@ SOFTWARE.
 // Comscicalc includes
 #include "comscicalc.h"
 #include "display.h"
+#include "flash_log.h"
+#include "key_decoder.h"
+#include "latency_trace.h"
+#include "snapshot.h"
 #include "uart_logger.h"
 
 // C includes
@@ -42,6 +46,8 @@ SOFTWARE.
 // Hardware dependent includes
 #if defined(RP2040)
 #include "rp2040_utils.h"
+#elif defined(POSIX_SIM)
+#include "posix_utils.h"
 #endif
 
 // FreeRTOS includes
@@ -49,17 +55,145 @@ SOFTWARE.
 #include "event_groups.h"
 #include "queue.h"
 #include "semphr.h"
+#include "stream_buffer.h"
 #include "task.h"
 
 //! Display state - holding shared variables between calc core thread and
 //! display thread
 displayState_t displayState;
-//! Queue for handling UART input
-QueueHandle_t uartReceiveQueue;
+//! Stream buffer for handling UART input
+StreamBufferHandle_t uartReceiveStream;
+//! Mailbox with input events for the calculator core task
+QueueHandle_t calcInputQueue;
+//! Mailbox with input events for the menu, run by the display task
+QueueHandle_t menuInputQueue;
+//! Consumer that the input dispatcher currently routes keys to
+static volatile inputConsumer_t activeInputConsumer = inputConsumer_CALC;
+//! Semaphore protecting the routing of keys, so that the consumer can't
+//! change between a key being routed and it being sent.
+static xSemaphoreHandle inputRouteSemaphore;
 //! Semaphore protecting the display state
 xSemaphoreHandle displayStateSemaphore;
 //! Event group which triggers a display update.
 EventGroupHandle_t displayTriggerEvent;
+//! Handle of the display task, notified by the EVE interrupt.
+TaskHandle_t displayTaskHandle = NULL;
+//! Handle of the solver task, notified when the input has changed.
+static TaskHandle_t calcSolverTaskHandle = NULL;
+//! Semaphore protecting the calculator state, shared between the calculator
+//! core task and the solver task.
+static xSemaphoreHandle calcStateSemaphore;
+//! Calculator state. Edited by the calculator core task, solved by the
+//! solver task.
+static calcCoreState_t calcState;
+//! Generation of the calculator input. Bumped before every edit, so that
+//! a solve of an older generation can be cancelled and discarded.
+static volatile uint32_t solveGeneration = 0;
+//! Flash log holding the persisted calculator state
+static flashLog_t snapshotLog;
+//! True if the snapshot log could be mounted
+static bool snapshotLogMounted = false;
+//! Last snapshot written to, or restored from, flash
+static calcSnapshot_t savedSnapshot;
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+//! Storage for the UART input stream buffer. One byte is needed on top of
+//! the size, as per xStreamBufferCreateStatic.
+static uint8_t uartReceiveStreamStorage[UART_RECEIVE_STREAM_SIZE + 1];
+//! Storage for the UART input stream buffer struct
+static StaticStreamBuffer_t uartReceiveStreamBuffer;
+//! Storage for the input mailboxes
+static uint8_t
+    calcInputQueueStorage[INPUT_EVENT_QUEUE_LEN * sizeof(inputEvent_t)];
+static uint8_t
+    menuInputQueueStorage[INPUT_EVENT_QUEUE_LEN * sizeof(inputEvent_t)];
+static StaticQueue_t calcInputQueueBuffer;
+static StaticQueue_t menuInputQueueBuffer;
+//! Storage for the display state semaphore
+static StaticSemaphore_t displayStateSemaphoreBuffer;
+//! Storage for the calculator state semaphore
+static StaticSemaphore_t calcStateSemaphoreBuffer;
+//! Storage for the input route semaphore
+static StaticSemaphore_t inputRouteSemaphoreBuffer;
+//! Storage for the display trigger event group
+static StaticEventGroup_t displayTriggerEventBuffer;
+//! Storage for the task control blocks
+static StaticTask_t inputTaskBuffer;
+static StaticTask_t displayTaskBuffer;
+static StaticTask_t calcCoreTaskBuffer;
+static StaticTask_t calcSolverTaskBuffer;
+#if defined(LOG_DEFERRED)
+static StaticTask_t loggerTaskBuffer;
+#endif
+static StaticTask_t idleTaskBuffer;
+static StaticTask_t timerTaskBuffer;
+//! Task stacks
+static StackType_t inputTaskStack[INPUT_TASK_STACK_SIZE];
+static StackType_t displayTaskStack[DISPLAY_TASK_STACK_SIZE];
+static StackType_t calcCoreTaskStack[CALC_CORE_TASK_STACK_SIZE];
+static StackType_t calcSolverTaskStack[CALC_SOLVER_TASK_STACK_SIZE];
+#if defined(LOG_DEFERRED)
+static StackType_t loggerTaskStack[LOGGER_TASK_STACK_SIZE];
+#endif
+static StackType_t idleTaskStack[configMINIMAL_STACK_SIZE];
+static StackType_t timerTaskStack[configTIMER_TASK_STACK_DEPTH];
+
+#if !defined(MCU_STATIC_RAM_BYTES)
+#define MCU_STATIC_RAM_BYTES 0
+#endif
+
+#if defined(LOG_DEFERRED)
+//! Number of logger tasks
+#define NUM_LOGGER_TASKS 1
+#else
+#define NUM_LOGGER_TASKS 0
+#endif
+
+//! Task stacks, in bytes
+#define STATIC_RAM_STACK_BYTES                                                 \
+    (sizeof(StackType_t) *                                                     \
+     (MAIN_TASK_STACK_SIZE + INPUT_TASK_STACK_SIZE + DISPLAY_TASK_STACK_SIZE + \
+      CALC_CORE_TASK_STACK_SIZE + CALC_SOLVER_TASK_STACK_SIZE +                \
+      NUM_LOGGER_TASKS * LOGGER_TASK_STACK_SIZE + configMINIMAL_STACK_SIZE +   \
+      configTIMER_TASK_STACK_DEPTH))
+//! Task control blocks and kernel objects, in bytes
+#define STATIC_RAM_KERNEL_BYTES                                                \
+    ((7 + NUM_LOGGER_TASKS) * sizeof(StaticTask_t) +                           \
+     sizeof(uartReceiveStreamStorage) + sizeof(StaticStreamBuffer_t) +         \
+     sizeof(calcInputQueueStorage) + sizeof(menuInputQueueStorage) +           \
+     2 * sizeof(StaticQueue_t) + 3 * sizeof(StaticSemaphore_t) +               \
+     sizeof(StaticEventGroup_t))
+//! Calculator state, with its entry pool and allocator tables, in bytes
+#define STATIC_RAM_CALC_BYTES (sizeof(calcState))
+//! Persisted state, in bytes
+#define STATIC_RAM_PERSIST_BYTES (sizeof(flashLog_t) + sizeof(calcSnapshot_t))
+//! All statically allocated RAM, in bytes
+#define STATIC_RAM_BYTES                                                       \
+    (STATIC_RAM_STACK_BYTES + STATIC_RAM_KERNEL_BYTES +                        \
+     STATIC_RAM_CALC_BYTES + LOG_RING_BYTES + STATIC_RAM_PERSIST_BYTES +       \
+     MCU_STATIC_RAM_BYTES)
+
+_Static_assert(STATIC_RAM_BYTES <= STATIC_RAM_BUDGET,
+               "Statically allocated RAM exceeds STATIC_RAM_BUDGET");
+
+// Memory for the idle task, required by FreeRTOS for static allocation
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer,
+                                   StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize) {
+    *ppxIdleTaskTCBBuffer = &idleTaskBuffer;
+    *ppxIdleTaskStackBuffer = idleTaskStack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+// Memory for the timer task, required by FreeRTOS for static allocation
+void vApplicationGetTimerTaskMemory(StaticTask_t **ppxTimerTaskTCBBuffer,
+                                    StackType_t **ppxTimerTaskStackBuffer,
+                                    uint32_t *pulTimerTaskStackSize) {
+    *ppxTimerTaskTCBBuffer = &timerTaskBuffer;
+    *ppxTimerTaskStackBuffer = timerTaskStack;
+    *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
 
 // Timer ISR
 void Timer1HzIntHandler(void) {
@@ -69,241 +203,586 @@ void Timer1HzIntHandler(void) {
 
 // Timer ISR
 void Timer60HzIntHandler(void) {
-    // For now, empty ISR
+    // Set the vsync event. The display task uses this to render at most
+    // one frame per tick.
+    xEventGroupSetBitsFromISR(displayTriggerEvent, DISPLAY_EVENT_VSYNC, NULL);
+}
+
+// GPIO ISR
+void EveIntHandler(void) {
+    // The co-processor has emptied its command FIFO. Wake the display task
+    // if it is waiting for it.
+    if (displayTaskHandle != NULL) {
+        vTaskNotifyGiveIndexedFromISR(displayTaskHandle,
+                                      DISPLAY_NOTIFY_EVE_INDEX, NULL);
+    }
+}
+
+//! Size of the chunks the input task reads from the input stream
+#define INPUT_CHUNK_SIZE 32
+
+/**
+ * @brief Chunk of input read from the UART stream buffer
+ */
+typedef struct inputChunk {
+    //! Received chars
+    char buf[INPUT_CHUNK_SIZE];
+    //! Number of valid chars in buf
+    size_t len;
+    //! Index of the next char to consume
+    size_t idx;
+} inputChunk_t;
+
+/**
+ * @brief Get the next input char. Chars are taken from the chunk,
+ * and a new chunk is read from the stream buffer when it is empty.
+ * @param pChunk Pointer to the input chunk
+ * @param pChar Pointer to where the char is written
+ * @param timeout Ticks to wait if no input is available
+ * @return True if a char was read, false on timeout
+ */
+static bool getInputChar(inputChunk_t *pChunk, char *pChar,
+                         TickType_t timeout) {
+    if (pChunk->idx >= pChunk->len) {
+        pChunk->len = xStreamBufferReceive(uartReceiveStream, pChunk->buf,
+                                           INPUT_CHUNK_SIZE, timeout);
+        pChunk->idx = 0;
+        if (pChunk->len == 0) {
+            return false;
+        }
+    }
+    *pChar = pChunk->buf[pChunk->idx++];
+    return true;
+}
+
+bool isMenuKey(const keyEvent_t *pKey) {
+    // Pasted text is only added as input, never used as commands.
+    return pKey->type == keyType_CHAR && pKey->modifiers == 0 &&
+           !pKey->pasted && (pKey->c == 't' || pKey->c == 'T');
+}
+
+/**
+ * @brief Send a key event to the mailbox of the active consumer. If the
+ * mailbox is full the consumer is behind, so wait for it rather than
+ * dropping keys.
+ * @param pEvent Pointer to the event
+ * @return Nothing
+ * @note The consumer is read, and the event sent to the menu, while
+ * holding inputRouteSemaphore. exitMenuInput drains the menu mailbox
+ * under the same semaphore, so no key can be left behind in it.
+ */
+static void routeInputEvent(const inputEvent_t *pEvent) {
+    while (1) {
+        xSemaphoreTake(inputRouteSemaphore, portMAX_DELAY);
+        if (activeInputConsumer == inputConsumer_CALC) {
+            if (isMenuKey(&pEvent->key)) {
+                // The keys after this one belong to the menu. Switching
+                // here, rather than in the calculator task, keeps that
+                // exact even if more keys are already buffered.
+                activeInputConsumer = inputConsumer_MENU;
+            }
+            xSemaphoreGive(inputRouteSemaphore);
+            // Only this task hands the input to the menu, so the
+            // calculator can be waited on without holding the semaphore.
+            xQueueSend(calcInputQueue, pEvent, portMAX_DELAY);
+            return;
+        }
+        // Don't block on the menu mailbox while holding the semaphore, as
+        // exitMenuInput needs it to drain the mailbox.
+        bool sent = xQueueSend(menuInputQueue, pEvent, 0) == pdTRUE;
+        xSemaphoreGive(inputRouteSemaphore);
+        if (sent) {
+            // The menu is run by the display task, which waits on the event
+            // group rather than the mailbox.
+            xEventGroupSetBits(displayTriggerEvent, DISPLAY_EVENT_MENU_INPUT);
+            return;
+        }
+        // The menu is behind. Give it a tick before trying again.
+        vTaskDelay(1);
+    }
+}
+
+void exitMenuInput(void) {
+    inputEvent_t event = {.type = inputEventType_MENU_EXIT};
+    // Switch and drain in one go, so that the input task can't route
+    // another key to the menu in between.
+    xSemaphoreTake(inputRouteSemaphore, portMAX_DELAY);
+    // The exit event goes first, so that the calculator picks up the new
+    // number format before any keys typed after closing the menu.
+    xQueueSend(calcInputQueue, &event, portMAX_DELAY);
+    while (xQueueReceive(menuInputQueue, &event, 0) == pdTRUE) {
+        xQueueSend(calcInputQueue, &event, portMAX_DELAY);
+    }
+    activeInputConsumer = inputConsumer_CALC;
+    xSemaphoreGive(inputRouteSemaphore);
 }
 
 /**
- * @brief Task that handles the calculator core functions.
- * the other threads.
+ * @brief Task that reads the UART input and decodes it into key events.
+ * Every key is decoded once, here, and routed to the mailbox of the
+ * consumer that is active: the calculator or the menu.
  * @param p Pointer to task arguments
  * @return Nothing
  */
-static void calcCoreTask(void *p) {
-    // Create the calculator state variable
-    calcCoreState_t calcState;
+static void inputTask(void *p) {
+    // Input is read from the stream buffer in chunks
+    inputChunk_t inputChunk = {.len = 0, .idx = 0};
+    // Decoder turning the input into key events
+    keyDecoder_t keyDecoder;
+    keyDecoder_init(&keyDecoder);
+    while (1) {
+        char receiveChar = 0;
+        if (!getInputChar(&inputChunk, &receiveChar,
+                          (TickType_t)portMAX_DELAY)) {
+            continue;
+        }
+        LATENCY_TRACE_MARK(tracePoint_INPUT_DEQUEUE);
+        inputEvent_t event = {.type = inputEventType_KEY};
+        // Escape sequences are decoded as their bytes arrive, so there is
+        // never any waiting for the rest of a sequence.
+        if (!keyDecoder_feed(&keyDecoder, receiveChar, &event.key)) {
+            continue;
+        }
+        routeInputEvent(&event);
+    }
+}
 
-    // Initialize the calculator core
-    if (calc_coreInit(&calcState) != calc_funStatus_SUCCESS) {
-        // There is an error with the calculator state.
-        while (1)
-            ;
+/**
+ * @brief Count the number of entries in the calculator input list
+ * @param pCalcState Pointer to the calculator state
+ * @return Number of entries
+ */
+static uint8_t countInputEntries(calcCoreState_t *pCalcState) {
+    uint8_t numEntries = 0;
+    inputListEntry_t *pEntry = pCalcState->pListEntrypoint;
+    while (pEntry != NULL) {
+        numEntries++;
+        pEntry = pEntry->pNext;
     }
+    return numEntries;
+}
 
-    // TODO: Initialize based on what was saved in flash
-    // For now though, just initialize to decimal base.
+#if defined(LATENCY_TRACE)
+//! Size of the buffer holding the formatted run time stats
+#define RUN_TIME_STATS_BUF_SIZE 512
 
-    calcState.numberFormat.inputBase = inputBase_DEC;
-    calcState.numberFormat.numBits = 64;
-    calcState.numberFormat.sign = false;
+/**
+ * @brief Dump the latency histograms and the FreeRTOS run time stats
+ * over the serial link.
+ * @return Nothing
+ */
+static void dumpTrace(void) {
+    static char runTimeStats[RUN_TIME_STATS_BUF_SIZE];
+    latencyTrace_dump();
+    // Note: vTaskGetRunTimeStats doesn't check the buffer size, so it needs
+    // room for about 40 bytes per task.
+    vTaskGetRunTimeStats(runTimeStats);
+    loggerImmediate(LOGGER_LEVEL_ERROR, "RUN TIME STATS [us]\r\n%s",
+                    runTimeStats);
+}
+#endif
 
-    // Boolean to check if we should keep waiting for the menu to exit.
-    bool inMenu = false;
-    while (1) {
-        // Wait for UART data to be available in the queue
-        if (uartReceiveQueue != 0) {
-
-            // Read out data from the UART queue while there is data in there
-            // The do-while loop here is to enable the task to sleep while
-            // it's waiting on the input.
-            do {
-                char receiveChar = 0;
-                calc_funStatus_t addRemoveStatus;
-                if (xQueueReceive(uartReceiveQueue, &receiveChar,
-                                  (TickType_t)portMAX_DELAY)) {
-                    // TODO: Check that we're in a state to add chars to the
-                    // calc core. The option here could be if we're in
-                    // the menu for example.
-
-                    if (receiveChar == 127) {
-                        addRemoveStatus = calc_removeInput(&calcState);
-                    } else {
-                        // Check if 91 was received, which for USB
-                        // is an escape key for some reason?
-                        // Also check if there's anything else in the queue
-
-                        if (receiveChar == 27) {
-                            // Escape char. We expect two more chars in there,
-                            // but don't wait around for it
-                            char escapeSeq[3] = {0};
-                            for (int i = 0; i < 2; i++) {
-                                xQueueReceive(uartReceiveQueue, &(escapeSeq[i]),
-                                              (TickType_t)10);
-                            }
-
-                            escapeSeq[2] = '\0';
-                            if (strcmp(escapeSeq, "[A") == 0) {
-                                // Up
-                            }
-                            if (strcmp(escapeSeq, "[B") == 0) {
-                                // Down
-                            }
-                            if (strcmp(escapeSeq, "[C") == 0) {
-                                // Forward/right
-                                if (calcState.cursorPosition > 0) {
-                                    calcState.cursorPosition -= 1;
-                                }
-                            }
-                            if (strcmp(escapeSeq, "[D") == 0) {
-                                // Backward/left
-                                if (calcState.pListEntrypoint != NULL) {
-                                    // Only increase if we have an actual entry point
-                                    calcState.cursorPosition += 1;    
-                                }
-                            }
-                            // Here there's a USB espace char, and something
-                            // else in the queue C (right), D(left), A (up) or ?
-                            // (down)
-                        }
-                        if (receiveChar == 'i' || receiveChar == 'I') {
-                            // Update the input base.
-                            calcState.numberFormat.inputBase += 1;
-                            if (calcState.numberFormat.inputBase > 2) {
-                                calcState.numberFormat.inputBase = 0;
-                            }
-                            calc_updateBase(&calcState);
-                        }
-                        if (receiveChar == 'm' || receiveChar == 'M') {
-                            // Update the input format (int, float, fixed)
-                            uint8_t inputFormat =
-                                calcState.numberFormat.inputFormat;
-                            inputFormat += 1;
-                            if (inputFormat >= INPUT_FMT_RESERVED) {
-                                inputFormat = 0;
-                            }
-                            calc_updateInputFormat(&calcState, inputFormat);
-                        }
-                        if (receiveChar == 'o' || receiveChar == 'O') {
-                            // Update the output format (int, float, fixed)
-                            uint8_t outputFormat =
-                                calcState.numberFormat.outputFormat;
-                            outputFormat += 1;
-                            if (outputFormat >= INPUT_FMT_RESERVED) {
-                                outputFormat = 0;
-                            }
-                            calc_updateOutputFormat(&calcState, outputFormat);
-                        }
-                        if (receiveChar == 't' || receiveChar == 'T') {
-                            // Placeholder menu state.
-                            inMenu = true;
-                        }
-
-                        // The add input contains valuable checks.
-                        addRemoveStatus =
-                            calc_addInput(&calcState, receiveChar);
-                    }
-                    // Check if the input wasn't accepted
-                    if (addRemoveStatus == calc_funStatus_UNKNOWN_INPUT) {
-                        // For now, do nothing here. Might trigger something
-                        // later on Could be kind of cool to blink the button
-                        // red or something.
-                    }
-                    // Check if there was an issue with adding/removing input
-                    else if (addRemoveStatus != calc_funStatus_SUCCESS) {
-                        // There was an issue with adding or removing
-                        // input.
-                        // TODO: call the error collection instead.
-                        // while(1);
-                    }
+/**
+ * @brief Apply a key event to the calculator state
+ * @param pCalcState Pointer to the calculator state
+ * @param pEvent Pointer to the key event
+ * @param pInMenu Set to true if the key opens the menu
+ * @return Nothing
+ */
+static void handleKeyEvent(calcCoreState_t *pCalcState, keyEvent_t *pEvent,
+                           bool *pInMenu) {
+    calc_funStatus_t addRemoveStatus = calc_funStatus_SUCCESS;
+    // The cursor position counts the entries from the end of the input.
+    switch (pEvent->type) {
+    case keyType_BACKSPACE:
+        addRemoveStatus = calc_removeInput(pCalcState);
+        break;
+    case keyType_DELETE:
+        // Remove the entry after the cursor.
+        if (pCalcState->cursorPosition > 0) {
+            pCalcState->cursorPosition -= 1;
+            addRemoveStatus = calc_removeInput(pCalcState);
+        }
+        break;
+    case keyType_RIGHT:
+        // Forward/right
+        if (pCalcState->cursorPosition > 0) {
+            pCalcState->cursorPosition -= 1;
+        }
+        break;
+    case keyType_LEFT:
+        // Backward/left
+        if (pCalcState->pListEntrypoint != NULL) {
+            // Only increase if we have an actual entry point
+            pCalcState->cursorPosition += 1;
+        }
+        break;
+    case keyType_HOME:
+        pCalcState->cursorPosition = countInputEntries(pCalcState);
+        break;
+    case keyType_END:
+        pCalcState->cursorPosition = 0;
+        break;
+    case keyType_CHAR:
+        if (pEvent->modifiers & KEY_MOD_CTRL) {
+            // Emacs style Home and End
+            if (pEvent->c == 'a') {
+                pCalcState->cursorPosition = countInputEntries(pCalcState);
+            } else if (pEvent->c == 'e') {
+                pCalcState->cursorPosition = 0;
+            }
+#if defined(LATENCY_TRACE)
+            if (pEvent->c == 't') {
+                dumpTrace();
+            }
+#endif
+            break;
+        }
+        if (pEvent->modifiers != 0) {
+            break;
+        }
+        // Pasted text is only added as input, never used as commands.
+        if (!pEvent->pasted) {
+            char c = pEvent->c;
+            if (c == 'i' || c == 'I') {
+                // Update the input base.
+                pCalcState->numberFormat.inputBase += 1;
+                if (pCalcState->numberFormat.inputBase > 2) {
+                    pCalcState->numberFormat.inputBase = 0;
                 }
-            } while (uxQueueMessagesWaiting(uartReceiveQueue) > 0);
-
-            // Call the solver
-            calc_funStatus_t solveStatus = calc_solver(&calcState);
-
-            // Here, all the results needed for the display task is available
-            // Therefore, obtain the semaphore and start writing to the
-            // displayState struct
-
-            // All input has been read, ready to solve the current state of the
-            // input buffer. Reset the result to 0 to have a clean slate.
-            // calcState.result = 0;
-            if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY) ==
-                pdTRUE) {
-                if (inMenu) {
-                    displayState.inMenu = true;
+                calc_updateBase(pCalcState);
+            }
+            if (c == 'm' || c == 'M') {
+                // Update the input format (int, float, fixed)
+                uint8_t inputFormat = pCalcState->numberFormat.inputFormat;
+                inputFormat += 1;
+                if (inputFormat >= INPUT_FMT_RESERVED) {
+                    inputFormat = 0;
+                }
+                calc_updateInputFormat(pCalcState, inputFormat);
+            }
+            if (c == 'o' || c == 'O') {
+                // Update the output format (int, float, fixed)
+                uint8_t outputFormat = pCalcState->numberFormat.outputFormat;
+                outputFormat += 1;
+                if (outputFormat >= INPUT_FMT_RESERVED) {
+                    outputFormat = 0;
                 }
-                // Set the output buffer to all null terminators.
-                memset(displayState.printedInputBuffer, 0,
-                       MAX_PRINTED_BUFFER_LEN);
-
-                displayState.syntaxIssueIndex = -1;
-                displayState.printStatus = calc_printBuffer(
-                    &calcState, displayState.printedInputBuffer,
-                    MAX_PRINTED_BUFFER_LEN, &displayState.syntaxIssueIndex);
+                calc_updateOutputFormat(pCalcState, outputFormat);
+            }
+        }
+        if (isMenuKey(pEvent)) {
+            // The input dispatcher routes the following keys to the menu.
+            *pInMenu = true;
+        }
+        // The add input contains valuable checks.
+        addRemoveStatus = calc_addInput(pCalcState, pEvent->c);
+        break;
+    default:
+        // Up, down, enter, escape and paste markers are not used here.
+        break;
+    }
+    // Check if the input wasn't accepted
+    if (addRemoveStatus == calc_funStatus_UNKNOWN_INPUT) {
+        // For now, do nothing here. Might trigger something
+        // later on Could be kind of cool to blink the button
+        // red or something.
+    }
+    // Check if there was an issue with adding/removing input
+    else if (addRemoveStatus != calc_funStatus_SUCCESS) {
+        // There was an issue with adding or removing
+        // input.
+        // TODO: call the error collection instead.
+        // while(1);
+    }
+}
+
+/**
+ * @brief Solver cancel function. Cancels the solve if the input has
+ * been edited since the solve started.
+ * @param pArg Pointer to the generation being solved
+ * @return True if the solve should be cancelled
+ */
+static bool solveSuperseded(void *pArg) {
+    return *(uint32_t *)pArg != solveGeneration;
+}
+
+#if defined(LOG_DEFERRED)
+/**
+ * @brief Task that prints the deferred log messages. Runs at the lowest
+ * priority, so that printing never holds up the other tasks.
+ * @param p Pointer to task arguments
+ * @return Nothing
+ */
+static void loggerTask(void *p) {
+    while (1) {
+        loggerFlush();
+        vTaskDelay(LOGGER_FLUSH_TICKS);
+    }
+}
+#endif
+
+/**
+ * @brief Persist a snapshot of the calculator state, if it has changed
+ * since the last one persisted.
+ * @param pSnapshot Pointer to the snapshot
+ * @return Nothing
+ */
+static void persistSnapshot(const calcSnapshot_t *pSnapshot) {
+    if (!snapshotLogMounted ||
+        memcmp(pSnapshot, &savedSnapshot, sizeof(calcSnapshot_t)) == 0) {
+        return;
+    }
+    if (flashLog_append(&snapshotLog, pSnapshot)) {
+        memcpy(&savedSnapshot, pSnapshot, sizeof(calcSnapshot_t));
+    } else {
+        logger(LOGGER_LEVEL_ERROR, "Could not persist state.\r\n");
+    }
+}
+
+/**
+ * @brief Task that solves the calculator input. This runs at a lower
+ * priority than the calculator core task, so that typing is never held
+ * up by solving. A solve is started as soon as the input has changed, and
+ * is cancelled if the input is edited again before it is done. The state
+ * is persisted once no new input has arrived for SNAPSHOT_DEBOUNCE_TICKS.
+ * @param p Pointer to task arguments
+ * @return Nothing
+ */
+static void calcSolverTask(void *p) {
+    uint32_t generation = 0;
+    // Snapshot of the last solve, waiting to be persisted
+    calcSnapshot_t pendingSnapshot;
+    bool snapshotPending = false;
+    while (1) {
+        // Wait for the calculator core task to signal new input. If there
+        // is a snapshot waiting, persist it once the input has settled.
+        TickType_t timeout =
+            snapshotPending ? SNAPSHOT_DEBOUNCE_TICKS : portMAX_DELAY;
+        if (ulTaskNotifyTake(pdTRUE, timeout) == 0) {
+            persistSnapshot(&pendingSnapshot);
+            snapshotPending = false;
+            continue;
+        }
+
+        if (xSemaphoreTake(calcStateSemaphore, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+        // The generation can't change while the state is held.
+        generation = solveGeneration;
+        calcState.pSolverCancelFun = solveSuperseded;
+        calcState.pSolverCancelArg = &generation;
+        LATENCY_TRACE_MARK(tracePoint_SOLVE_START);
+        calc_funStatus_t solveStatus = calc_solver(&calcState);
+        LATENCY_TRACE_MARK(tracePoint_SOLVE_END);
+        SUBRESULT_INT result = calcState.result;
+        calcSnapshot_t snapshot;
+        bool snapshotValid =
+            snapshot_capture(&calcState, &snapshot) == calc_funStatus_SUCCESS;
+        xSemaphoreGive(calcStateSemaphore);
+
+        if (solveStatus == calc_funStatus_SOLVE_CANCELLED) {
+            // A newer edit is on its way, which will trigger a new solve.
+            continue;
+        }
+
+        if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY) == pdTRUE) {
+            // Only publish the result if it belongs to the input that is
+            // currently displayed.
+            bool current = generation == solveGeneration;
+            if (current) {
                 displayState.solveStatus = solveStatus;
                 if (solveStatus == calc_solveStatus_SUCCESS) {
-                    displayState.result = calcState.result;
+                    displayState.result = result;
                 }
-                if (displayState.printStatus ==
-                    calc_funStatus_INPUT_LIST_NULL) {
-                    // If there is no result due to the input list being 0,
-                    // that means that there wasn't any input chars. So set the
-                    // result to 0
+                if (solveStatus == calc_funStatus_INPUT_LIST_NULL) {
+                    // No input chars, so the result is 0.
                     displayState.result = 0;
                 }
-                displayState.cursorLoc = calc_getCursorLocation(&calcState);
-                memcpy(&(displayState.inputOptions), &(calcState.numberFormat),
-                       sizeof(numberFormat_t));
-                // Give the semaphore back
-                xSemaphoreGive(displayStateSemaphore);
             }
-            xEventGroupSetBits(displayTriggerEvent, DISPLAY_EVENT_NEW_DATA);
-
-            while (inMenu) {
-                // We have given the display trigger event.
-                // We need to just hold tight here and wait for
-                // the user to exit the menu.
-
-                // Wait for the menu exit event:
-                uint32_t eventbits =
-                    xEventGroupWaitBits(displayTriggerEvent, DISPLAY_EXIT_MENU,
-                                        pdTRUE, pdFALSE, portMAX_DELAY);
-                // Check if we can unlock this task
-                if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY)) {
-                    // Copy the display state to the local state to get out of
-                    // the menu
-                    inMenu = displayState.inMenu;
-                    // Copy over any changes made to the input state:
-                    if (calcState.numberFormat.fixedPointDecimalPlace !=
-                        displayState.inputOptions.fixedPointDecimalPlace) {
-                        // TODO: Update the fixed point decimal place from the
-                        // calcState POV
-                    }
-                    if (calcState.numberFormat.inputBase !=
-                        displayState.inputOptions.inputBase) {
-                        calcState.numberFormat.inputBase =
-                            displayState.inputOptions.inputBase;
-                        calc_updateBase(&calcState);
-                    }
-                    if (calcState.numberFormat.inputFormat !=
-                        displayState.inputOptions.inputFormat) {
-                        calc_updateInputFormat(
-                            &calcState, displayState.inputOptions.inputFormat);
-                    }
-                    if (calcState.numberFormat.numBits !=
-                        displayState.inputOptions.numBits) {
-                        // TODO: Make an update function.
-                    }
-                    if (calcState.numberFormat.outputFormat !=
-                        displayState.inputOptions.outputFormat) {
-                        calc_updateOutputFormat(
-                            &calcState, displayState.inputOptions.outputFormat);
-                    }
-                    if (calcState.numberFormat.sign !=
-                        displayState.inputOptions.sign) {
-                        // TODO: make update function.
-                    }
-                    // Just copy the number format just in case.
-                    memcpy(&(calcState.numberFormat),
-                           &(displayState.inputOptions),
-                           sizeof(numberFormat_t));
-                    xSemaphoreGive(displayStateSemaphore);
-                }
+            snapshot.fontIdx = displayState.fontIdx;
+            xSemaphoreGive(displayStateSemaphore);
+            if (current) {
+                LATENCY_TRACE_MARK(tracePoint_DISPLAY_HANDOFF);
+                xEventGroupSetBits(displayTriggerEvent,
+                                   DISPLAY_EVENT_NEW_DATA);
+            }
+        }
+
+        // Writing to flash is slow, and wears it, so the snapshot is only
+        // persisted once a burst of input is over.
+        if (snapshotValid) {
+            memcpy(&pendingSnapshot, &snapshot, sizeof(calcSnapshot_t));
+            snapshotPending = true;
+        }
+    }
+}
+
+/**
+ * @brief Copy the number format changed in the menu over to the calculator
+ * state. Must be called with the calculator state held.
+ * @return Nothing
+ */
+static void applyMenuOptions(void) {
+    if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY) != pdTRUE) {
+        return;
+    }
+    if (calcState.numberFormat.fixedPointDecimalPlace !=
+        displayState.inputOptions.fixedPointDecimalPlace) {
+        // TODO: Update the fixed point decimal place from the
+        // calcState POV
+    }
+    if (calcState.numberFormat.inputBase !=
+        displayState.inputOptions.inputBase) {
+        calcState.numberFormat.inputBase = displayState.inputOptions.inputBase;
+        calc_updateBase(&calcState);
+    }
+    if (calcState.numberFormat.inputFormat !=
+        displayState.inputOptions.inputFormat) {
+        calc_updateInputFormat(&calcState,
+                               displayState.inputOptions.inputFormat);
+    }
+    if (calcState.numberFormat.numBits != displayState.inputOptions.numBits) {
+        // TODO: Make an update function.
+    }
+    if (calcState.numberFormat.outputFormat !=
+        displayState.inputOptions.outputFormat) {
+        calc_updateOutputFormat(&calcState,
+                                displayState.inputOptions.outputFormat);
+    }
+    if (calcState.numberFormat.sign != displayState.inputOptions.sign) {
+        // TODO: make update function.
+    }
+    // Just copy the number format just in case.
+    memcpy(&(calcState.numberFormat), &(displayState.inputOptions),
+           sizeof(numberFormat_t));
+    xSemaphoreGive(displayStateSemaphore);
+}
+
+/**
+ * @brief Task that handles the calculator core functions. Input events
+ * are received from the calculator mailbox, filled by the input task.
+ * @param p Pointer to task arguments
+ * @return Nothing
+ */
+static void calcCoreTask(void *p) {
+    // The calculator state has been set up, and possibly restored from
+    // flash, by initCalcState before this task was created.
+    while (1) {
+        inputEvent_t event;
+        // Wait for input to be routed to the calculator
+        if (xQueueReceive(calcInputQueue, &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        // Supersede any solve in flight before taking the calculator
+        // state, so that the solver lets go of it as soon as possible.
+        solveGeneration++;
+        xSemaphoreTake(calcStateSemaphore, portMAX_DELAY);
+
+        // Set if one of the keys opened the menu
+        bool inMenu = false;
+        // Handle all events that are available before printing.
+        do {
+            if (event.type == inputEventType_MENU_EXIT) {
+                applyMenuOptions();
+            } else {
+                handleKeyEvent(&calcState, &event.key, &inMenu);
+            }
+        } while (xQueueReceive(calcInputQueue, &event, 0) == pdTRUE);
+
+        // Here, the echoed input is available for the display task.
+        // The result follows from the solver task when it is ready.
+        if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY) == pdTRUE) {
+            if (inMenu) {
+                displayState.inMenu = true;
             }
+            // Set the output buffer to all null terminators.
+            memset(displayState.printedInputBuffer, 0, MAX_PRINTED_BUFFER_LEN);
+
+            displayState.syntaxIssueIndex = -1;
+            displayState.printStatus = calc_printBuffer(
+                &calcState, displayState.printedInputBuffer,
+                MAX_PRINTED_BUFFER_LEN, &displayState.syntaxIssueIndex);
+            LATENCY_TRACE_MARK(tracePoint_INPUT_PRINTED);
+            if (displayState.printStatus == calc_funStatus_INPUT_LIST_NULL) {
+                // If there is no result due to the input list being 0,
+                // that means that there wasn't any input chars. So set the
+                // result to 0
+                displayState.result = 0;
+            }
+            displayState.cursorLoc = calc_getCursorLocation(&calcState);
+            memcpy(&(displayState.inputOptions), &(calcState.numberFormat),
+                   sizeof(numberFormat_t));
+            // Give the semaphore back
+            xSemaphoreGive(displayStateSemaphore);
         }
+        xSemaphoreGive(calcStateSemaphore);
+        LATENCY_TRACE_MARK(tracePoint_DISPLAY_HANDOFF);
+        xEventGroupSetBits(displayTriggerEvent, DISPLAY_EVENT_NEW_DATA);
+        // Hand the new input over to the solver
+        xTaskNotifyGive(calcSolverTaskHandle);
     }
 }
 
+/**
+ * @brief Set the calculator state to the defaults.
+ * @return Nothing
+ */
+static void defaultCalcState(void) {
+    if (calc_coreInit(&calcState) != calc_funStatus_SUCCESS) {
+        // There is an error with the calculator state.
+        while (1)
+            ;
+    }
+    calcState.numberFormat.inputBase = inputBase_DEC;
+    calcState.numberFormat.numBits = 64;
+    calcState.numberFormat.sign = false;
+}
+
+/**
+ * @brief Initialize the calculator and display state, restoring the
+ * latest snapshot from flash if there is one. Must be called before the
+ * tasks are created, so that the first frame shows the restored state.
+ * @return Nothing
+ */
+static void initCalcState(void) {
+    defaultCalcState();
+    memset(&savedSnapshot, 0, sizeof(calcSnapshot_t));
+
+    // Finding the latest snapshot takes a bounded number of flash reads.
+    snapshotLogMounted = flashLog_init(&snapshotLog, getPersistFlash(),
+                                       sizeof(calcSnapshot_t));
+    if (snapshotLogMounted && flashLog_read(&snapshotLog, &savedSnapshot)) {
+        if (snapshot_restore(&calcState, &savedSnapshot) ==
+            calc_funStatus_SUCCESS) {
+            // A snapshot from another build may name a font that isn't in
+            // this one, which would then be saved again after every solve.
+            if (savedSnapshot.fontIdx < MAX_LEN_FONT_LIBRARY_TABLE &&
+                pFontLibraryTable[savedSnapshot.fontIdx] != NULL) {
+                displayState.fontIdx = savedSnapshot.fontIdx;
+            } else {
+                displayState.fontIdx = 0;
+            }
+            logger(LOGGER_LEVEL_INFO, "Restored %u tokens from flash.\r\n",
+                   savedSnapshot.numTokens);
+        } else {
+            // Snapshot from an incompatible version, start over.
+            defaultCalcState();
+        }
+    }
+
+    // Show the state from the first frame.
+    displayState.syntaxIssueIndex = -1;
+    displayState.printStatus = calc_printBuffer(
+        &calcState, displayState.printedInputBuffer, MAX_PRINTED_BUFFER_LEN,
+        &displayState.syntaxIssueIndex);
+    displayState.cursorLoc = calc_getCursorLocation(&calcState);
+    displayState.result = calcState.solved ? calcState.result : 0;
+    memcpy(&(displayState.inputOptions), &(calcState.numberFormat),
+           sizeof(numberFormat_t));
+}
+
 /**
  * @brief Initialize the FT810 EVE driver and SPI interface
  * @return Nothing
@@ -314,6 +793,10 @@ static void initDisplay(void) {
     EVE_init();
     while (EVE_busy())
         ;
+    // Raise INTn whenever the co-processor command FIFO runs empty.
+    // This lets the display task sleep while a display list is executed.
+    EVE_memWrite32(REG_INT_MASK, EVE_INT_CMDEMPTY);
+    EVE_memWrite8(REG_INT_EN, 1);
 }
 
 void displayTestThread(void *p) {
@@ -342,23 +825,82 @@ void displayTestThread(void *p) {
 // This is a simple thread that is responsible
 // to start other threads, and init the hardware
 void mainThread(void *p) {
-    // Create the queue for the UART receive queue:
-    uartReceiveQueue = xQueueCreate(100, sizeof(char));
-    if (uartReceiveQueue == NULL) {
+    // Create the stream buffer for the UART input. A trigger level of 1
+    // wakes the reader as soon as anything is available.
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    uartReceiveStream = xStreamBufferCreateStatic(
+        UART_RECEIVE_STREAM_SIZE, 1, uartReceiveStreamStorage,
+        &uartReceiveStreamBuffer);
+#else
+    uartReceiveStream = xStreamBufferCreate(UART_RECEIVE_STREAM_SIZE, 1);
+#endif
+    if (uartReceiveStream == NULL) {
+        while (1)
+            ;
+    }
+
+    // Create the mailboxes that the input task routes key events to.
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    calcInputQueue =
+        xQueueCreateStatic(INPUT_EVENT_QUEUE_LEN, sizeof(inputEvent_t),
+                           calcInputQueueStorage, &calcInputQueueBuffer);
+    menuInputQueue =
+        xQueueCreateStatic(INPUT_EVENT_QUEUE_LEN, sizeof(inputEvent_t),
+                           menuInputQueueStorage, &menuInputQueueBuffer);
+#else
+    calcInputQueue = xQueueCreate(INPUT_EVENT_QUEUE_LEN, sizeof(inputEvent_t));
+    menuInputQueue = xQueueCreate(INPUT_EVENT_QUEUE_LEN, sizeof(inputEvent_t));
+#endif
+    if (calcInputQueue == NULL || menuInputQueue == NULL) {
         while (1)
             ;
     }
 
     // Create the binary semaphore to protect the display state
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    displayStateSemaphore =
+        xSemaphoreCreateBinaryStatic(&displayStateSemaphoreBuffer);
+#else
     displayStateSemaphore = xSemaphoreCreateBinary();
+#endif
     if (displayStateSemaphore == NULL) {
         while (1)
             ;
     }
 
+    // Create the binary semaphore to protect the calculator state
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    calcStateSemaphore =
+        xSemaphoreCreateBinaryStatic(&calcStateSemaphoreBuffer);
+#else
+    calcStateSemaphore = xSemaphoreCreateBinary();
+#endif
+    if (calcStateSemaphore == NULL) {
+        while (1)
+            ;
+    }
+    xSemaphoreGive(calcStateSemaphore);
+
+    // Create the binary semaphore to protect the routing of input
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    inputRouteSemaphore =
+        xSemaphoreCreateBinaryStatic(&inputRouteSemaphoreBuffer);
+#else
+    inputRouteSemaphore = xSemaphoreCreateBinary();
+#endif
+    if (inputRouteSemaphore == NULL) {
+        while (1)
+            ;
+    }
+    xSemaphoreGive(inputRouteSemaphore);
+
     // Create the synchronization event between the calculator task
     // and the display task
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    displayTriggerEvent = xEventGroupCreateStatic(&displayTriggerEventBuffer);
+#else
     displayTriggerEvent = xEventGroupCreate();
+#endif
 
     // Initialize UART.
     // NOTE: This is MCU specific, so the initUart function must be
@@ -396,28 +938,104 @@ void mainThread(void *p) {
     logger(LOGGER_LEVEL_DEBUG, "DEBUG: DISPLAYED INIT'D\r\n");
     // Initialize the displaystate variable
     initDisplayState(&displayState);
+    // Initialize the calculator state, restored from flash if possible
+    initCalcState();
+
+#if defined(LOG_DEFERRED)
+    // Create the task that prints the log. Until now, log messages have
+    // been kept in the log ring.
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xTaskCreateStatic(loggerTask, "LOGGER", LOGGER_TASK_STACK_SIZE, (void *)1,
+                      tskIDLE_PRIORITY, loggerTaskStack, &loggerTaskBuffer);
+#else
+    xTaskCreate(loggerTask,             // Function that implements the task.
+                "LOGGER",               // Text name for the task.
+                LOGGER_TASK_STACK_SIZE, // Stack size in words, not bytes.
+                (void *)1,              // Parameter passed into the task.
+                tskIDLE_PRIORITY,       // Lowest priority.
+                NULL);
+#endif
+#endif
 
-    TaskHandle_t screenTaskHandle = NULL;
     TaskHandle_t calcCoreTaskHandle = NULL;
     // Create the task that handles the display
-    xTaskCreate(displayTask,          // Function that implements the task.
-                "DISPLAY",            // Text name for the task.
-                700,                  // Stack size in words, not bytes.
-                (void *)1,            // Parameter passed into the task.
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    displayTaskHandle = xTaskCreateStatic(
+        displayTask, "DISPLAY", DISPLAY_TASK_STACK_SIZE, (void *)1,
+        tskIDLE_PRIORITY + 1, displayTaskStack, &displayTaskBuffer);
+#else
+    xTaskCreate(displayTask,             // Function that implements the task.
+                "DISPLAY",               // Text name for the task.
+                DISPLAY_TASK_STACK_SIZE, // Stack size in words, not bytes.
+                (void *)1,               // Parameter passed into the task.
                 tskIDLE_PRIORITY + 1, // Priority at which the task is created.
-                &screenTaskHandle // Used to pass out the created task's handle.
+                &displayTaskHandle    // Used to pass out the created task's
+                                      // handle.
     );
+#endif
     logger(LOGGER_LEVEL_DEBUG, "DEBUG: DISPLAY TASK CREATED\r\n");
+    // Create the task that solves the calculator input. This is created
+    // before the calculator core task, which notifies it.
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    calcSolverTaskHandle = xTaskCreateStatic(
+        calcSolverTask, "CALCSOLVER", CALC_SOLVER_TASK_STACK_SIZE, (void *)1,
+        tskIDLE_PRIORITY, calcSolverTaskStack, &calcSolverTaskBuffer);
+#else
+    xTaskCreate(
+        calcSolverTask,              // Function that implements the task.
+        "CALCSOLVER",                // Text name for the task.
+        CALC_SOLVER_TASK_STACK_SIZE, // Stack size in words, not bytes.
+        (void *)1,                   // Parameter passed into the task.
+        tskIDLE_PRIORITY,      // Lower priority than the input and display
+        &calcSolverTaskHandle // Used to pass out the created task's handle.
+    );
+#endif
+    logger(LOGGER_LEVEL_DEBUG, "DEBUG: CALC SOLVER TASK CREATED\r\n");
     // Create the task that handles the calculator core.
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    calcCoreTaskHandle = xTaskCreateStatic(
+        calcCoreTask, "CALCCORE", CALC_CORE_TASK_STACK_SIZE, (void *)1,
+        tskIDLE_PRIORITY + 1, calcCoreTaskStack, &calcCoreTaskBuffer);
+#else
     xTaskCreate(
-        calcCoreTask,       // Function that implements the task.
-        "CALCCORE",         // Text name for the task.
-        2000,               // Stack size in words, not bytes.
-        (void *)1,          // Parameter passed into the task.
-        tskIDLE_PRIORITY,   // Slightly higher priority than display task
+        calcCoreTask,              // Function that implements the task.
+        "CALCCORE",                // Text name for the task.
+        CALC_CORE_TASK_STACK_SIZE, // Stack size in words, not bytes.
+        (void *)1,                 // Parameter passed into the task.
+        tskIDLE_PRIORITY + 1,      // Same priority as the display task
         &calcCoreTaskHandle // Used to pass out the created task's handle.
     );
+#endif
     logger(LOGGER_LEVEL_DEBUG, "DEBUG: CALC CORE TASK CREATED\r\n");
+    // Create the task that dispatches the input to the calculator core
+    // task and the menu.
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    xTaskCreateStatic(inputTask, "INPUT", INPUT_TASK_STACK_SIZE, (void *)1,
+                      tskIDLE_PRIORITY + 1, inputTaskStack, &inputTaskBuffer);
+#else
+    xTaskCreate(inputTask,             // Function that implements the task.
+                "INPUT",               // Text name for the task.
+                INPUT_TASK_STACK_SIZE, // Stack size in words, not bytes.
+                (void *)1,             // Parameter passed into the task.
+                tskIDLE_PRIORITY + 1,  // Same priority as the core task
+                NULL);
+#endif
+    logger(LOGGER_LEVEL_DEBUG, "DEBUG: INPUT TASK CREATED\r\n");
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    logger(LOGGER_LEVEL_DEBUG,
+           "DEBUG: STATIC RAM: stacks %u, kernel %u, calc %u, log %u, "
+           "persist %u, mcu %u, total %u of %u bytes\r\n",
+           STATIC_RAM_STACK_BYTES, STATIC_RAM_KERNEL_BYTES,
+           STATIC_RAM_CALC_BYTES, LOG_RING_BYTES, STATIC_RAM_PERSIST_BYTES,
+           MCU_STATIC_RAM_BYTES, STATIC_RAM_BYTES, STATIC_RAM_BUDGET);
+#endif
+
+    // Now that the display task exists, enable the EVE interrupt.
+    // NOTE: This is MCU specific.
+    if (!initDisplayInterrupt()) {
+        while (1)
+            ;
+    }
 
     // Start by giving the semaphore, as the semaphore needs to initialize once
     xSemaphoreGive(displayStateSemaphore);
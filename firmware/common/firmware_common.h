@@ -24,6 +24,7 @@ SOFTWARE.
 #ifndef FIRMWARE_COMMON_H_
 #define FIRMWARE_COMMON_H_
 // Standard libraries
+#include <stdbool.h>
 #include <stdint.h>
 
 // FreeRTOS includes
@@ -31,13 +32,98 @@ SOFTWARE.
 #include "event_groups.h"
 #include "queue.h"
 #include "semphr.h"
+#include "stream_buffer.h"
 
-//! Queue for handling UART input
-extern QueueHandle_t uartReceiveQueue;
+// Comscicalc includes
+#include "key_decoder.h"
+
+//! Size of the UART input stream buffer, in bytes
+#define UART_RECEIVE_STREAM_SIZE 256
+//! Number of input events each consumer mailbox can hold
+#define INPUT_EVENT_QUEUE_LEN 32
+//! Ticks without new input before the calculator state is persisted
+#define SNAPSHOT_DEBOUNCE_TICKS (20 / portTICK_PERIOD_MS)
+
+//! Multiplier of the task stack sizes. Hosted builds, e.g. the POSIX
+//! simulator, run the tasks as threads and need larger stacks.
+#if !defined(TASK_STACK_SCALE)
+#define TASK_STACK_SCALE 1
+#endif
+//! Stack size of the main task, in words
+#define MAIN_TASK_STACK_SIZE (200 * TASK_STACK_SCALE)
+//! Stack size of the input dispatcher task, in words
+#define INPUT_TASK_STACK_SIZE (300 * TASK_STACK_SCALE)
+//! Stack size of the display task, in words
+#define DISPLAY_TASK_STACK_SIZE (700 * TASK_STACK_SCALE)
+//! Stack size of the calculator core task, in words
+#define CALC_CORE_TASK_STACK_SIZE (1000 * TASK_STACK_SCALE)
+//! Stack size of the solver task, in words
+#define CALC_SOLVER_TASK_STACK_SIZE (2000 * TASK_STACK_SCALE)
+//! Stack size of the logger task, in words
+#define LOGGER_TASK_STACK_SIZE (400 * TASK_STACK_SCALE)
+//! Ticks between flushes of the deferred log ring
+#define LOGGER_FLUSH_TICKS (20 / portTICK_PERIOD_MS)
+//! Budget for statically allocated RAM, in bytes. Only checked when
+//! configSUPPORT_STATIC_ALLOCATION is set.
+#define STATIC_RAM_BUDGET (64 * 1024)
+//! Stream buffer for handling UART input
+extern StreamBufferHandle_t uartReceiveStream;
+//! Mailbox with input events for the calculator core task
+extern QueueHandle_t calcInputQueue;
+//! Mailbox with input events for the menu, run by the display task
+extern QueueHandle_t menuInputQueue;
 //! Semaphore protecting the display state
 extern xSemaphoreHandle displayStateSemaphore;
 //! Event group which triggers a display update.
 extern EventGroupHandle_t displayTriggerEvent;
+//! Handle of the display task, notified by the EVE interrupt.
+extern TaskHandle_t displayTaskHandle;
+
+/**
+ * @brief Type of an event in the input mailboxes
+ */
+typedef enum inputEventType {
+    //! A decoded key, see inputEvent_t.key
+    inputEventType_KEY = 0,
+    //! The menu was closed. The number format might have been changed.
+    inputEventType_MENU_EXIT,
+} inputEventType_t;
+
+/**
+ * @brief Event routed to one of the input consumers
+ */
+typedef struct inputEvent {
+    //! Type of event
+    inputEventType_t type;
+    //! The key, if type is inputEventType_KEY
+    keyEvent_t key;
+} inputEvent_t;
+
+/**
+ * @brief Consumers that input events can be routed to
+ */
+typedef enum inputConsumer {
+    //! The calculator core task, via calcInputQueue
+    inputConsumer_CALC = 0,
+    //! The menu, via menuInputQueue
+    inputConsumer_MENU,
+} inputConsumer_t;
+
+/**
+ * @brief Check if a key opens the menu. The input dispatcher routes the
+ * keys following it to the menu.
+ * @param pKey Pointer to the key event
+ * @return True if the key opens the menu
+ */
+bool isMenuKey(const keyEvent_t *pKey);
+
+/**
+ * @brief Hand the input back to the calculator once the menu is closed.
+ * Keys that are still in the menu mailbox are forwarded to the calculator,
+ * after an inputEventType_MENU_EXIT event.
+ * @return Nothing
+ */
+void exitMenuInput(void);
 
 /**
  * @brief Main thread. Calls init functions and starts
@@ -66,4 +152,10 @@ void Timer1HzIntHandler(void);
  */
 void Timer60HzIntHandler(void);
 
+/**
+ * @brief ISR for the FT81x INTn line
+ * @return Nothing
+ */
+void EveIntHandler(void);
+
 #endif // FIRMWARE_COMMON_H_
\ No newline at end of file
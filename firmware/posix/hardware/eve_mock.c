@@ -0,0 +1,191 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Mock of the FT81x EVE driver. See eve_mock.h.
+ * The co-processor is modelled as executing commands instantly, so it's
+ * never busy and never raises an interrupt.
+ */
+
+// Standard library
+#include <stdbool.h>
+#include <string.h>
+
+#include "eve_mock.h"
+#include "posix_utils.h"
+
+//! Maximum number of words recorded in one burst
+#define BURST_MAX_WORDS (EVE_FIFO_SIZE / 4)
+
+//! Words of the burst being built
+static uint32_t burstWords[BURST_MAX_WORDS];
+//! Number of words in the burst being built, including dropped ones
+static uint32_t burstLen = 0;
+//! True while a burst is being built
+static bool inBurst = false;
+//! Time the current burst was started, in us
+static uint32_t burstStartUs = 0;
+//! Recorded statistics
+static eveMockStats_t stats;
+//! File bursts are written to, or NULL
+static FILE *pTraceFile = NULL;
+
+/**
+ * @brief Add a word to the current burst.
+ * @param word Word to add.
+ */
+static void burstWord(uint32_t word) {
+    if (burstLen < BURST_MAX_WORDS) {
+        burstWords[burstLen] = word;
+    }
+    burstLen++;
+    stats.cmdBytes += 4;
+}
+
+/**
+ * @brief Add a buffer to the current burst, padded to whole words.
+ * @param pData Pointer to the data.
+ * @param len Length of the data, in bytes.
+ */
+static void burstData(const uint8_t *pData, uint32_t len) {
+    for (uint32_t i = 0; i < len; i += 4) {
+        uint32_t word = 0;
+        uint32_t n = (len - i < 4) ? len - i : 4;
+        memcpy(&word, &pData[i], n);
+        burstWord(word);
+    }
+}
+
+/**
+ * @brief Count a co-processor command outside of a burst.
+ * @param len Length of the command, in bytes.
+ */
+static void singleCommand(uint32_t len) {
+    stats.numCommands++;
+    stats.cmdBytes += len;
+}
+
+void EVE_init_spi(void) {}
+
+uint8_t EVE_init(void) {
+    memset(&stats, 0, sizeof(stats));
+    return E_OK;
+}
+
+uint8_t EVE_busy(void) { return E_OK; }
+
+uint8_t EVE_memRead8(uint32_t ft_address) {
+    // Interrupt flags are read and cleared, nothing is ever pending.
+    return 0;
+}
+
+void EVE_memWrite8(uint32_t ft_address, uint8_t ft_data) {
+    stats.memBytes += 1;
+}
+
+void EVE_memWrite32(uint32_t ft_address, uint32_t ft_data) {
+    stats.memBytes += 4;
+}
+
+void EVE_memWrite_sram_buffer(uint32_t ft_address, const uint8_t *p_data,
+                              uint32_t len) {
+    stats.memBytes += len;
+}
+
+void EVE_cmd_dl(uint32_t command) { singleCommand(4); }
+
+void EVE_cmd_inflate(uint32_t ptr, const uint8_t *p_data, uint32_t len) {
+    // Command, pointer and the deflated data, padded to whole words
+    singleCommand(8 + ((len + 3) & ~3U));
+    stats.memBytes += len;
+}
+
+void EVE_start_cmd_burst(void) {
+    inBurst = true;
+    burstLen = 0;
+    burstStartUs = getRunTimeCounterValue();
+}
+
+void EVE_end_cmd_burst(void) {
+    if (!inBurst) {
+        return;
+    }
+    inBurst = false;
+    uint32_t timeUs = getRunTimeCounterValue() - burstStartUs;
+    uint32_t bytes = burstLen * 4;
+    stats.numBursts++;
+    stats.burstTimeUs += timeUs;
+    if (timeUs > stats.maxBurstTimeUs) {
+        stats.maxBurstTimeUs = timeUs;
+    }
+    if (bytes > stats.maxBurstBytes) {
+        stats.maxBurstBytes = bytes;
+    }
+    if (pTraceFile != NULL) {
+        fprintf(pTraceFile, "%u %u", (unsigned)burstStartUs, (unsigned)timeUs);
+        uint32_t recorded = burstLen < BURST_MAX_WORDS ? burstLen
+                                                       : BURST_MAX_WORDS;
+        for (uint32_t i = 0; i < recorded; i++) {
+            fprintf(pTraceFile, " %08x", (unsigned)burstWords[i]);
+        }
+        fprintf(pTraceFile, "\n");
+    }
+}
+
+void EVE_cmd_dl_burst(uint32_t command) {
+    stats.numCommands++;
+    if (command == CMD_SWAP) {
+        stats.numFrames++;
+    }
+    burstWord(command);
+}
+
+void EVE_color_rgb_burst(uint32_t color) {
+    stats.numCommands++;
+    burstWord(DL_COLOR_RGB | (color & 0x00FFFFFF));
+}
+
+void EVE_cmd_text_burst(int16_t xc0, int16_t yc0, uint16_t font,
+                        uint16_t options, const char *p_text) {
+    stats.numCommands++;
+    burstWord(CMD_TEXT);
+    burstWord(((uint32_t)(uint16_t)yc0 << 16) | (uint16_t)xc0);
+    burstWord(((uint32_t)options << 16) | font);
+    // The string, including the null terminator
+    burstData((const uint8_t *)p_text, strlen(p_text) + 1);
+}
+
+void EVE_cmd_setfont2_burst(uint32_t font, uint32_t ptr, uint32_t firstchar) {
+    stats.numCommands++;
+    burstWord(CMD_SETFONT2);
+    burstWord(font);
+    burstWord(ptr);
+    burstWord(firstchar);
+}
+
+void eveMock_setTraceFile(FILE *pFile) { pTraceFile = pFile; }
+
+void eveMock_getStats(eveMockStats_t *pStats) {
+    memcpy(pStats, &stats, sizeof(eveMockStats_t));
+}
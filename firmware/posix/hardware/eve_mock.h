@@ -0,0 +1,82 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Mock of the FT81x EVE driver for the POSIX simulator. It implements the
+ * EVE functions used by the firmware, without a display. The command
+ * bursts that make up each frame are recorded, so that frame generation
+ * can be measured on the host.
+ */
+
+#ifndef EVE_MOCK_H_
+#define EVE_MOCK_H_
+
+// Standard library
+#include <stdint.h>
+#include <stdio.h>
+
+// EVE driver, for the function prototypes and register definitions
+#include "EVE.h"
+
+/**
+ * @brief Statistics of the recorded EVE traffic
+ */
+typedef struct eveMockStats {
+    //! Number of command bursts
+    uint32_t numBursts;
+    //! Number of frames, i.e. CMD_SWAP commands
+    uint32_t numFrames;
+    //! Number of co-processor commands, in bursts or not
+    uint32_t numCommands;
+    //! Bytes written to the command FIFO
+    uint64_t cmdBytes;
+    //! Bytes written to RAM_G and registers
+    uint64_t memBytes;
+    //! Largest burst, in bytes
+    uint32_t maxBurstBytes;
+    //! Total time spent building bursts, in us
+    uint64_t burstTimeUs;
+    //! Longest time spent building a burst, in us
+    uint32_t maxBurstTimeUs;
+} eveMockStats_t;
+
+/**
+ * @brief Init the SPI interface. Declared by the EVE target on hardware.
+ */
+void EVE_init_spi(void);
+
+/**
+ * @brief Write every burst to a file, one line per burst with a
+ * timestamp and the command words in hex.
+ * @param pFile File to write to, or NULL to stop.
+ */
+void eveMock_setTraceFile(FILE *pFile);
+
+/**
+ * @brief Get the statistics of the recorded EVE traffic.
+ * @param pStats Pointer to where the statistics are written.
+ */
+void eveMock_getStats(eveMockStats_t *pStats);
+
+#endif /* EVE_MOCK_H_ */
@@ -0,0 +1,301 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * This file includes function mappings used by firmware_common,
+ * for the FreeRTOS POSIX port host simulator.
+ */
+
+// Standard library
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "posix_utils.h"
+
+// Comscicalc includes
+#include "flash_emulator.h"
+#include "latency_trace.h"
+#include "uart_logger.h"
+
+// Firmware common functions
+#include "firmware_common.h"
+
+// FreeRTOS
+#include "FreeRTOS.h"
+#include "stream_buffer.h"
+#include "task.h"
+#include "timers.h"
+
+//! Number of chars read from the input before they are pushed to the
+//! stream buffer
+#define SIM_INPUT_CHUNK_SIZE 32
+
+//! Options of the simulation
+static simOptions_t simOptions = {
+    .pInputPath = NULL,
+    .keyDelayMs = 0,
+    .pFlashPath = NULL,
+    .pEveTracePath = NULL,
+};
+//! File descriptor of the input
+static int inputFd = STDIN_FILENO;
+//! Terminal settings to restore at exit, if stdin is a terminal
+static struct termios savedTermios;
+static bool termiosSaved = false;
+//! Emulated flash
+static flashEmulator_t persistFlash;
+static bool persistFlashOpen = false;
+//! Timers standing in for the RP2040 repeating timers
+static TimerHandle_t timer1Hz;
+static TimerHandle_t timer60Hz;
+
+void simSetOptions(const simOptions_t *pOptions) {
+    memcpy(&simOptions, pOptions, sizeof(simOptions_t));
+}
+
+/**
+ * @brief Restore the terminal settings.
+ */
+static void restoreTerminal(void) {
+    if (termiosSaved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedTermios);
+    }
+}
+
+/**
+ * @brief Print the report of the simulation on stdout.
+ * @param numKeys Number of input chars.
+ * @param elapsedUs Time from the first input until the display settled.
+ */
+static void printReport(uint32_t numKeys, uint32_t elapsedUs) {
+    eveMockStats_t stats;
+    eveMock_getStats(&stats);
+    printf("keys: %u\n", numKeys);
+    printf("elapsed_us: %u\n", elapsedUs);
+    printf("frames: %u\n", stats.numFrames);
+    printf("bursts: %u\n", stats.numBursts);
+    printf("commands: %u\n", stats.numCommands);
+    printf("cmd_bytes: %llu\n", (unsigned long long)stats.cmdBytes);
+    printf("mem_bytes: %llu\n", (unsigned long long)stats.memBytes);
+    printf("max_burst_bytes: %u\n", stats.maxBurstBytes);
+    printf("mean_burst_us: %llu\n",
+           stats.numBursts == 0
+               ? 0ULL
+               : (unsigned long long)(stats.burstTimeUs / stats.numBursts));
+    printf("max_burst_us: %u\n", stats.maxBurstTimeUs);
+    fflush(stdout);
+#if defined(LATENCY_TRACE)
+    latencyTrace_dump();
+#endif
+#if defined(LOG_DEFERRED)
+    while (loggerFlush())
+        ;
+#endif
+}
+
+/**
+ * @brief Task reading the input, standing in for the USB read task.
+ * @param p Pointer to task arguments
+ * @return Nothing
+ */
+static void simInputTask(void *p) {
+    uint32_t numKeys = 0;
+    uint32_t firstKeyUs = 0;
+    while (1) {
+        // Blocking in a system call would stall the scheduler, so poll
+        // and give the other tasks a tick in between.
+        struct pollfd pfd = {.fd = inputFd, .events = POLLIN};
+        if (poll(&pfd, 1, 0) <= 0) {
+            vTaskDelay(1);
+            continue;
+        }
+        char chunk[SIM_INPUT_CHUNK_SIZE];
+        size_t maxLen = simOptions.keyDelayMs > 0 ? 1 : sizeof(chunk);
+        ssize_t len = read(inputFd, chunk, maxLen);
+        if (len < 0 && errno == EINTR) {
+            continue;
+        }
+        if (len <= 0) {
+            // End of input
+            break;
+        }
+        if (numKeys == 0) {
+            firstKeyUs = getRunTimeCounterValue();
+        }
+        LATENCY_TRACE_MARK(tracePoint_INPUT_RECEIVE);
+        for (ssize_t i = 0; i < len; i++) {
+            if (chunk[i] == '\b') {
+                // Same as on target: backspace is sent as 127.
+                chunk[i] = 127;
+            }
+        }
+        size_t sent = 0;
+        while (sent < (size_t)len) {
+            sent += xStreamBufferSend(uartReceiveStream, &chunk[sent],
+                                      len - sent, portMAX_DELAY);
+        }
+        numKeys += len;
+        if (simOptions.keyDelayMs > 0) {
+            vTaskDelay(pdMS_TO_TICKS(simOptions.keyDelayMs));
+        }
+    }
+
+    // Wait for the solver and display to settle, i.e. no new frames.
+    eveMockStats_t stats;
+    uint32_t numFrames;
+    uint32_t settledUs;
+    do {
+        eveMock_getStats(&stats);
+        numFrames = stats.numFrames;
+        settledUs = getRunTimeCounterValue();
+        vTaskDelay(pdMS_TO_TICKS(SIM_SETTLE_MS));
+        eveMock_getStats(&stats);
+    } while (stats.numFrames != numFrames);
+
+    printReport(numKeys, numKeys == 0 ? 0 : settledUs - firstKeyUs);
+    exit(0);
+}
+
+static void timer1HzCallback(TimerHandle_t xTimer) { Timer1HzIntHandler(); }
+
+static void timer60HzCallback(TimerHandle_t xTimer) { Timer60HzIntHandler(); }
+
+bool mcuInit(void) {
+    if (simOptions.pEveTracePath != NULL) {
+        FILE *pTraceFile = fopen(simOptions.pEveTracePath, "w");
+        if (pTraceFile == NULL) {
+            fprintf(stderr, "Could not open %s\n", simOptions.pEveTracePath);
+            return false;
+        }
+        eveMock_setTraceFile(pTraceFile);
+    }
+    return true;
+}
+
+bool initUart(void) {
+    if (simOptions.pInputPath != NULL) {
+        inputFd = open(simOptions.pInputPath, O_RDONLY);
+        if (inputFd < 0) {
+            fprintf(stderr, "Could not open %s\n", simOptions.pInputPath);
+            return false;
+        }
+    } else if (isatty(STDIN_FILENO)) {
+        // Deliver keys as they are typed, without echo, like a serial
+        // terminal.
+        struct termios raw;
+        tcgetattr(STDIN_FILENO, &savedTermios);
+        termiosSaved = true;
+        atexit(restoreTerminal);
+        raw = savedTermios;
+        raw.c_lflag &= ~(ICANON | ECHO);
+        tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+    }
+
+    TaskHandle_t simInputTaskHandle = NULL;
+    xTaskCreate(simInputTask,              // Function that implements the task.
+                "SIM_INPUT_TASK",          // Text name for the task.
+                SIM_INPUT_TASK_STACK_SIZE, // Stack size in words, not bytes.
+                (void *)1,                 // Parameter passed into the task.
+                tskIDLE_PRIORITY + 1, // Priority at which the task is created.
+                &simInputTaskHandle   // Used to pass out the created task's
+                                      // handle.
+    );
+    return simInputTaskHandle != NULL;
+}
+
+bool initSpi(void) { return true; }
+
+bool initTimer(void) {
+    // Software timers stand in for the 1 Hz and 60 Hz hardware timers.
+    timer1Hz = xTimerCreate("TIMER_1HZ", pdMS_TO_TICKS(1000), pdTRUE, NULL,
+                            timer1HzCallback);
+    timer60Hz = xTimerCreate("TIMER_60HZ", pdMS_TO_TICKS(1000 / 60), pdTRUE,
+                             NULL, timer60HzCallback);
+    return timer1Hz != NULL && timer60Hz != NULL;
+}
+
+bool initDisplayInterrupt(void) { return true; }
+
+uint32_t getRunTimeCounterValue(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+}
+
+void startTimer(void) {
+    xTimerStart(timer1Hz, 0);
+    xTimerStart(timer60Hz, 0);
+}
+
+/**
+ * @brief Open the emulated flash. Without a flash file in the options, a
+ * temporary file is used, so each run starts from erased flash.
+ * @return True if the flash was opened.
+ */
+static bool openPersistFlash(void) {
+    if (simOptions.pFlashPath != NULL) {
+        return flashEmulator_open(&persistFlash, simOptions.pFlashPath,
+                                  PERSIST_FLASH_SECTORS,
+                                  PERSIST_FLASH_SECTOR_SIZE,
+                                  PERSIST_FLASH_PAGE_SIZE);
+    }
+    char tmpPath[] = "/tmp/comscicalc_flash_XXXXXX";
+    int fd = mkstemp(tmpPath);
+    if (fd < 0) {
+        return false;
+    }
+    // Remove the empty file so the emulator creates it erased
+    close(fd);
+    unlink(tmpPath);
+    bool opened =
+        flashEmulator_open(&persistFlash, tmpPath, PERSIST_FLASH_SECTORS,
+                           PERSIST_FLASH_SECTOR_SIZE, PERSIST_FLASH_PAGE_SIZE);
+    // The file stays open, and is removed once the simulator exits
+    unlink(tmpPath);
+    return opened;
+}
+
+const flashDevice_t *getPersistFlash(void) {
+    if (!persistFlashOpen) {
+        persistFlashOpen = openPersistFlash();
+        if (!persistFlashOpen) {
+            return NULL;
+        }
+    }
+    return &persistFlash.device;
+}
+
+void UARTvprintf(const char *pcString, va_list vaArgP) {
+    vfprintf(stderr, pcString, vaArgP);
+}
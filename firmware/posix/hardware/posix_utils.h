@@ -0,0 +1,129 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * This file includes function mappings used by firmware_common,
+ * for the FreeRTOS POSIX port host simulator. Input is read from stdin or
+ * a script file, the display is a mock of the EVE driver, and the flash is
+ * emulated in a file.
+ */
+
+#ifndef POSIX_UTILS_H_
+#define POSIX_UTILS_H_
+
+// Standard library
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Comscicalc includes
+#include "eve_mock.h"
+#include "flash_log.h"
+
+//! Stack size of the input task, in words
+#define SIM_INPUT_TASK_STACK_SIZE configMINIMAL_STACK_SIZE
+//! Number of emulated flash sectors used to persist the state
+#define PERSIST_FLASH_SECTORS 8
+//! Size of an emulated flash sector
+#define PERSIST_FLASH_SECTOR_SIZE 4096
+//! Size of an emulated flash page
+#define PERSIST_FLASH_PAGE_SIZE 256
+//! Time without input or frames before the simulation ends, in ms
+#define SIM_SETTLE_MS 500
+
+/**
+ * @brief Options of the simulation
+ */
+typedef struct simOptions {
+    //! Script file to read the input from, or NULL for stdin
+    const char *pInputPath;
+    //! Delay between each input char, in ms. 0 sends the input in chunks.
+    uint32_t keyDelayMs;
+    //! File backing the emulated flash, or NULL for a temporary file
+    const char *pFlashPath;
+    //! File to write the EVE command bursts to, or NULL
+    const char *pEveTracePath;
+} simOptions_t;
+
+/**
+ * @brief Set the options of the simulation. Must be called before the
+ * scheduler is started.
+ * @param pOptions Pointer to the options. Copied.
+ */
+void simSetOptions(const simOptions_t *pOptions);
+
+/**
+ * @brief Init the simulator
+ */
+bool mcuInit(void);
+
+/**
+ * @brief Init the input, and start the task reading it. Once the input
+ * ends and the display has settled, a report is printed on stdout and the
+ * simulator exits.
+ */
+bool initUart(void);
+
+/**
+ * @brief Init the offboard SPI. Nothing to do in the simulator.
+ */
+bool initSpi(void);
+
+/**
+ * @brief Init the timers used for cursor blinking and vsync.
+ */
+bool initTimer(void);
+
+/**
+ * @brief Init the EVE interrupt. The mock is never busy, so nothing to do.
+ */
+bool initDisplayInterrupt(void);
+
+/**
+ * @brief Get the run time stats counter, which is the host monotonic clock.
+ * @return Time in us
+ */
+uint32_t getRunTimeCounterValue(void);
+
+/**
+ * @brief Start the timers used for cursor blinking and vsync.
+ */
+void startTimer(void);
+
+/**
+ * @brief Get the flash device used to persist the calculator state.
+ * @return Pointer to the emulated flash device, or NULL if the backing file
+ * could not be opened.
+ */
+const flashDevice_t *getPersistFlash(void);
+
+/**
+ * @brief printf function used for logging in the simulator. Logs go to
+ * stderr, so they don't mix with the report on stdout.
+ * @param pcString Pointer string, must be null terminated.
+ * @param vaArgP String formatting string
+ */
+void UARTvprintf(const char *pcString, va_list vaArgP);
+
+#endif /* POSIX_UTILS_H_ */
@@ -0,0 +1,108 @@
+/*
+MIT License
+
+Copyright (c) 2023 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// C
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Freertos:
+#include "FreeRTOS.h"
+#include "task.h"
+
+// Comscicalc entry points
+#include "firmware_common.h"
+
+// POSIX simulator
+#include "posix_utils.h"
+
+/**
+ * @brief This hook is called by FreeRTOS when a malloc fails.
+ */
+void vApplicationMallocFailedHook(void) {
+    fprintf(stderr, "Malloc failed\n");
+    abort();
+}
+
+/**
+ * @brief Print the usage of the simulator.
+ * @param pName Name of the executable.
+ */
+static void printUsage(const char *pName) {
+    fprintf(stderr,
+            "Usage: %s [-i input] [-d key delay ms] [-f flash file] "
+            "[-t eve trace file]\n"
+            "Runs the calculator firmware with input from stdin, or the "
+            "input file,\nand prints a report once the input has ended.\n"
+            "Without -f, the flash starts out erased and is discarded at "
+            "exit.\n",
+            pName);
+}
+
+/*
+ * RUNTIME START
+ */
+int main(int argc, char **argv) {
+    simOptions_t options = {
+        .pInputPath = NULL,
+        .keyDelayMs = 0,
+        .pFlashPath = NULL,
+        .pEveTracePath = NULL,
+    };
+    int opt;
+    while ((opt = getopt(argc, argv, "i:d:f:t:h")) != -1) {
+        switch (opt) {
+        case 'i':
+            options.pInputPath = optarg;
+            break;
+        case 'd':
+            options.keyDelayMs = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'f':
+            options.pFlashPath = optarg;
+            break;
+        case 't':
+            options.pEveTracePath = optarg;
+            break;
+        default:
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    simSetOptions(&options);
+
+    // Init the simulated hardware
+    if (!mcuInit()) {
+        return 1;
+    }
+
+    // Start the main thread
+    TaskHandle_t mainThreadHandle = NULL;
+    xTaskCreate(mainThread, "MAIN_TASK", MAIN_TASK_STACK_SIZE, (void *)1,
+                tskIDLE_PRIORITY, &mainThreadHandle);
+
+    // Start scheduler. The simulator exits from the input task.
+    vTaskStartScheduler();
+    return 0;
+}
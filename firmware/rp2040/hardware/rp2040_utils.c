@@ -33,11 +33,14 @@ SOFTWARE.
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 // Header
 #include "rp2040_utils.h"
 
 // Hardware specific
+#include "hardware/flash.h"
+#include "hardware/sync.h"
 #include "hardware/uart.h"
 #include "pin_map.h"
 
@@ -50,6 +53,7 @@ SOFTWARE.
 //#include "pico/stdio_usb.h"
 
 // comscicalc
+#include "latency_trace.h"
 #include "uart_logger.h"
 
 // FW common, used for callback linking.
@@ -58,6 +62,7 @@ SOFTWARE.
 // FreeRTOS:
 #include "FreeRTOS.h"
 #include "queue.h"
+#include "stream_buffer.h"
 
 // Globally defined timer handlers.
 repeating_timer_t rtA;
@@ -65,7 +70,17 @@ repeating_timer_t rtB;
 
 // STDIO event and defined
 EventGroupHandle_t usbReadEvent;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+//! Storage for the USB read event group
+static StaticEventGroup_t usbReadEventBuffer;
+//! Storage for the USB read task control block
+static StaticTask_t usbReadTaskBuffer;
+//! Stack of the USB read task
+static StackType_t usbReadTaskStack[USB_READ_TASK_STACK_SIZE];
+#endif
 #define USB_NEW_DATA_IN 1 << 0
+//! Number of chars read from USB before they are pushed to the stream buffer
+#define USB_READ_CHUNK_SIZE 32
 
 // Wrapped timer callback
 bool Timer1HzIntHandlerWrapper(repeating_timer_t *rt) {
@@ -79,6 +94,13 @@ bool Timer60HzIntHandlerWrapper(repeating_timer_t *rt) {
     return true; // Keep the timer going
 }
 
+// Wrapped GPIO callback
+void gpioIntHandlerWrapper(uint gpio, uint32_t events) {
+    if (gpio == FT81X_INTn_PIN) {
+        EveIntHandler();
+    }
+}
+
 void usbReadTask(void *p) {
 
     // Read the buffer until it's empty:
@@ -91,28 +113,35 @@ void usbReadTask(void *p) {
         uint32_t eventbits = xEventGroupWaitBits(
             usbReadEvent, USB_NEW_DATA_IN, pdTRUE, pdFALSE, portMAX_DELAY);
         if (eventbits & USB_NEW_DATA_IN) {
-            // read the buffer and add to the queue
+            LATENCY_TRACE_MARK(tracePoint_INPUT_RECEIVE);
+            // Read the buffer in chunks and add them to the stream buffer
             int rxChar = PICO_ERROR_TIMEOUT;
             do {
-                rxChar = getchar_timeout_us(100); // Read the input character
-
-                // Put it into the uartReceiveQueue
-                if (rxChar != PICO_ERROR_TIMEOUT) {
+                char chunk[USB_READ_CHUNK_SIZE];
+                size_t len = 0;
+                while (len < USB_READ_CHUNK_SIZE) {
+                    rxChar = getchar_timeout_us(100); // Read the input character
+                    if (rxChar == PICO_ERROR_TIMEOUT) {
+                        break;
+                    }
                     // hooray, there is a character in the rx buffer
                     // which is now read!
-                    // Push that to the queue.
-                    // But first, convert it to an 8 bit char
+                    // Convert it to an 8 bit char
                     char c = (char)rxChar;
                     if (c == '\b') {
                         // Hack: If a backspace is sent, then replace it with
                         // 127 which is backspace here.
                         c = 127;
                     }
-                    if (!xQueueSendToBack(uartReceiveQueue, (void *)&c,
-                                          (TickType_t)0)) {
-                        while (1)
-                            ;
-                    }
+                    chunk[len++] = c;
+                }
+                // Push the chunk to the stream buffer. If it's full, block
+                // until the calculator has consumed enough. While blocked,
+                // the USB buffer fills up and the host is held back.
+                size_t sent = 0;
+                while (sent < len) {
+                    sent += xStreamBufferSend(uartReceiveStream, &chunk[sent],
+                                              len - sent, portMAX_DELAY);
                 }
             } while (rxChar != PICO_ERROR_TIMEOUT);
         }
@@ -145,18 +174,28 @@ bool initUart(void) {
     gpio_set_function(UART0_RX_PIN, GPIO_FUNC_UART);
 
     // Create the event group
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    usbReadEvent = xEventGroupCreateStatic(&usbReadEventBuffer);
+#else
     usbReadEvent = xEventGroupCreate();
+#endif
 
     // Start the UART read task:
     TaskHandle_t usbReadTaskHandle = NULL;
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    usbReadTaskHandle = xTaskCreateStatic(
+        usbReadTask, "USB_READ_TASK", USB_READ_TASK_STACK_SIZE, (void *)1,
+        tskIDLE_PRIORITY + 1, usbReadTaskStack, &usbReadTaskBuffer);
+#else
     xTaskCreate(
-        usbReadTask,          // Function that implements the task.
-        "USB_READ_TASK",      // Text name for the task.
-        300,                  // Stack size in words, not bytes.
-        (void *)1,            // Parameter passed into the task.
-        tskIDLE_PRIORITY + 1, // Priority at which the task is created.
-        &usbReadTaskHandle    // Used to pass out the created task's handle.
+        usbReadTask,              // Function that implements the task.
+        "USB_READ_TASK",          // Text name for the task.
+        USB_READ_TASK_STACK_SIZE, // Stack size in words, not bytes.
+        (void *)1,                // Parameter passed into the task.
+        tskIDLE_PRIORITY + 1,     // Priority at which the task is created.
+        &usbReadTaskHandle // Used to pass out the created task's handle.
     );
+#endif
 
     // Set the USB callback:
     stdio_set_chars_available_callback((void *)stdio_callback, NULL);
@@ -175,8 +214,59 @@ bool initTimer(void) {
     add_repeating_timer_us(16666, Timer60HzIntHandlerWrapper, NULL, &rtB);
 }
 
+uint32_t getRunTimeCounterValue(void) { return time_us_32(); }
+
+bool initDisplayInterrupt(void) {
+    // The FT81x INTn line is open drain and active low.
+    gpio_init(FT81X_INTn_PIN);
+    gpio_set_dir(FT81X_INTn_PIN, GPIO_IN);
+    gpio_pull_up(FT81X_INTn_PIN);
+    gpio_set_irq_enabled_with_callback(FT81X_INTn_PIN, GPIO_IRQ_EDGE_FALL,
+                                       true, gpioIntHandlerWrapper);
+    return true;
+}
+
 void startTimer(void) {}
 
+//! Offset of the persisted state from the start of flash
+#define PERSIST_FLASH_OFFSET                                                   \
+    (PICO_FLASH_SIZE_BYTES - PERSIST_FLASH_SECTORS * FLASH_SECTOR_SIZE)
+
+static bool persistFlashRead(void *pCtx, uint32_t addr, void *pBuf,
+                             uint32_t len) {
+    // Flash is memory mapped, so just copy it out.
+    memcpy(pBuf, (const void *)(XIP_BASE + PERSIST_FLASH_OFFSET + addr), len);
+    return true;
+}
+
+static bool persistFlashProgram(void *pCtx, uint32_t addr, const void *pBuf,
+                                uint32_t len) {
+    // Nothing can execute from flash while it is programmed.
+    uint32_t interrupts = save_and_disable_interrupts();
+    flash_range_program(PERSIST_FLASH_OFFSET + addr, pBuf, len);
+    restore_interrupts(interrupts);
+    return true;
+}
+
+static bool persistFlashErase(void *pCtx, uint32_t addr) {
+    uint32_t interrupts = save_and_disable_interrupts();
+    flash_range_erase(PERSIST_FLASH_OFFSET + addr, FLASH_SECTOR_SIZE);
+    restore_interrupts(interrupts);
+    return true;
+}
+
+static const flashDevice_t persistFlash = {
+    .sectorSize = FLASH_SECTOR_SIZE,
+    .pageSize = FLASH_PAGE_SIZE,
+    .numSectors = PERSIST_FLASH_SECTORS,
+    .pRead = persistFlashRead,
+    .pProgram = persistFlashProgram,
+    .pErase = persistFlashErase,
+    .pCtx = NULL,
+};
+
+const flashDevice_t *getPersistFlash(void) { return &persistFlash; }
+
 void out_char_driver(char c, void *arg) {
     ((stdio_driver_t *)arg)->out_chars(&c, 1);
 }
@@ -33,6 +33,19 @@ SOFTWARE.
 // RP2040 stdlib
 #include "pico/stdlib.h"
 
+// Comscicalc includes
+#include "flash_log.h"
+
+//! Stack size of the USB read task, in words
+#define USB_READ_TASK_STACK_SIZE 300
+//! Number of flash sectors at the end of flash used to persist the state
+#define PERSIST_FLASH_SECTORS 8
+//! RAM statically allocated by the RP2040 specific code, in bytes.
+//! Only valid when configSUPPORT_STATIC_ALLOCATION is set.
+#define MCU_STATIC_RAM_BYTES                                                   \
+    (USB_READ_TASK_STACK_SIZE * sizeof(StackType_t) + sizeof(StaticTask_t) +   \
+     sizeof(StaticEventGroup_t))
+
 /**
  * @brief Init the RP2040 HW
  */
@@ -54,6 +67,28 @@ bool initSpi(void);
  */
 bool initTimer(void);
 
+/**
+ * @brief Init the GPIO interrupt on the FT81x INTn pin.
+ * @note Must be called after the display task has been created, since the
+ * interrupt notifies that task.
+ */
+bool initDisplayInterrupt(void);
+
+/**
+ * @brief Get the run time stats counter, which is the 1 MHz timer.
+ * @return Time in us
+ */
+uint32_t getRunTimeCounterValue(void);
+
+/**
+ * @brief Get the flash device used to persist the calculator state.
+ * @note This is the last PERSIST_FLASH_SECTORS sectors of the flash.
+ * Programming and erasing stalls execution from flash, and is done with
+ * interrupts disabled.
+ * @return Pointer to the flash device
+ */
+const flashDevice_t *getPersistFlash(void);
+
 /**
  * @brief Start the HW timer used for cursor blinking etc.
  */
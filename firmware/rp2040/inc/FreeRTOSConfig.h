@@ -65,7 +65,13 @@
            // than the number of bytes in a size_t.
 
 /* Memory allocation related definitions. */
+// STATIC_ALLOCATION selects the static allocation profile, where all tasks
+// and kernel objects are created from statically allocated memory.
+#if defined(STATIC_ALLOCATION)
+#define configSUPPORT_STATIC_ALLOCATION 1
+#else
 #define configSUPPORT_STATIC_ALLOCATION 0
+#endif
 #define configSUPPORT_DYNAMIC_ALLOCATION                                       \
     1 // Get FreeRTOS to allocation task memory
 #define configAPPLICATION_ALLOCATED_HEAP 0
@@ -78,9 +84,24 @@
 #define configUSE_DAEMON_TASK_STARTUP_HOOK 0
 
 /* Run time and task stats gathering related definitions. */
+// LATENCY_TRACE enables the trace facility and run time stats along with
+// the latency trace points.
+#if defined(LATENCY_TRACE)
+#define configGENERATE_RUN_TIME_STATS 1
+#define configUSE_TRACE_FACILITY 1
+#define configUSE_STATS_FORMATTING_FUNCTIONS 1
+// The run time counter is the free running 1 MHz timer, which is always on.
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE() getRunTimeCounterValue()
+#if !defined(__ASSEMBLER__)
+#include <stdint.h>
+uint32_t getRunTimeCounterValue(void);
+#endif
+#else
 #define configGENERATE_RUN_TIME_STATS 0
 #define configUSE_TRACE_FACILITY 0
 #define configUSE_STATS_FORMATTING_FUNCTIONS 0
+#endif
 
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES 0
@@ -88,8 +88,17 @@ int main() {
 #else
     // Start the main thread
     TaskHandle_t mainThreadHandle = NULL;
-    xTaskCreate(mainThread, "MAIN_TASK", 200, (void *)1, tskIDLE_PRIORITY,
-                &mainThreadHandle);
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+    static StaticTask_t mainThreadBuffer;
+    static StackType_t mainThreadStack[MAIN_TASK_STACK_SIZE];
+    mainThreadHandle =
+        xTaskCreateStatic(mainThread, "MAIN_TASK", MAIN_TASK_STACK_SIZE,
+                          (void *)1, tskIDLE_PRIORITY, mainThreadStack,
+                          &mainThreadBuffer);
+#else
+    xTaskCreate(mainThread, "MAIN_TASK", MAIN_TASK_STACK_SIZE, (void *)1,
+                tskIDLE_PRIORITY, &mainThreadHandle);
+#endif
 #endif
     // Start scheduler
     vTaskStartScheduler();
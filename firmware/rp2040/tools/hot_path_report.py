@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+# Written by Oskar von Heideken
+# Copyright, 2023
+
+"""
+Report where the CALC_HOT functions ended up, using the GNU ld map file.
+
+Lists every input section placed by CALC_HOT, and checks that those
+sections and the given symbols are in SRAM rather than in XIP flash.
+Exits with a non-zero status if anything is left in flash, so it can
+be used as a post build check.
+
+Usage: hot_path_report.py <map file> [symbol ...]
+"""
+
+import argparse
+import re
+import sys
+
+# RP2040 memory map
+FLASH_START = 0x10000000
+SRAM_START = 0x20000000
+SRAM_END = 0x20042000
+
+# Section that CALC_HOT places functions in (comscicalc_common.h)
+HOT_SECTION = ".time_critical.comscicalc"
+
+INPUT_SECTION_RE = re.compile(
+    r"^ (\.\S+)(?:\s+(0x[0-9a-f]+)\s+(0x[0-9a-f]+)\s+(.+))?$")
+ADDR_LINE_RE = re.compile(r"^\s+(0x[0-9a-f]+)\s+(0x[0-9a-f]+)\s+(.+)$")
+SYMBOL_RE = re.compile(r"^\s+(0x[0-9a-f]+)\s+([A-Za-z_]\w*)$")
+
+
+def region(addr):
+    if SRAM_START <= addr < SRAM_END:
+        return "SRAM"
+    if addr >= FLASH_START and addr < SRAM_START:
+        return "FLASH"
+    return "OTHER"
+
+
+def parse_map(path):
+    """
+    Parse the memory map part of a GNU ld map file.
+    Returns a list of (section, address, size, object) for the input
+    sections, and a dict of symbol name to address.
+    """
+    sections = []
+    symbols = {}
+    in_memory_map = False
+    pending = None
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip("\n")
+            if line.startswith("Linker script and memory map"):
+                in_memory_map = True
+                continue
+            if not in_memory_map:
+                continue
+            if pending is not None:
+                # Long section names put the address on the next line.
+                m = ADDR_LINE_RE.match(line)
+                if m:
+                    sections.append((pending, int(m.group(1), 16),
+                                     int(m.group(2), 16), m.group(3)))
+                pending = None
+                continue
+            m = INPUT_SECTION_RE.match(line)
+            if m:
+                if m.group(2) is None:
+                    pending = m.group(1)
+                else:
+                    sections.append((m.group(1), int(m.group(2), 16),
+                                     int(m.group(3), 16), m.group(4)))
+                continue
+            m = SYMBOL_RE.match(line)
+            if m:
+                symbols[m.group(2)] = int(m.group(1), 16)
+    return sections, symbols
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("map_file", help="Map file written by the linker")
+    parser.add_argument("symbols", nargs="*",
+                        help="Functions that must be placed in SRAM")
+    args = parser.parse_args()
+
+    sections, symbols = parse_map(args.map_file)
+    ok = True
+
+    hot = [s for s in sections if s[0].startswith(HOT_SECTION) and s[2] > 0]
+    print("CALC_HOT sections:")
+    total = 0
+    for name, addr, size, obj in hot:
+        where = region(addr)
+        total += size
+        print("  0x%08x %6u %-5s %s" % (addr, size, where, obj))
+        if where != "SRAM":
+            ok = False
+    print("  %u bytes in %u sections" % (total, len(hot)))
+    if not hot:
+        print("  No CALC_HOT sections found. Is CALC_HOT_IN_SRAM set?")
+        ok = False
+
+    if args.symbols:
+        print("Hot path functions:")
+    for name in args.symbols:
+        if name not in symbols:
+            print("  %-28s not found" % name)
+            ok = False
+            continue
+        addr = symbols[name]
+        where = region(addr)
+        print("  %-28s 0x%08x %s" % (name, addr, where))
+        if where != "SRAM":
+            ok = False
+
+    if not ok:
+        print("Hot path placement check FAILED")
+        return 1
+    print("Hot path placement check passed")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -57,6 +57,15 @@ SOFTWARE.
 #include <stdio.h>
 #include <string.h>
 
+/* ----------------- DEFINES ----------------- */
+#if defined(CALC_COUNTERS)
+//! Add n to a work counter of a calculator state, see calcCounters_t
+#define CALC_COUNT(pCalcCoreState, counter, n)                                \
+    ((pCalcCoreState)->counters.counter += (n))
+#else
+#define CALC_COUNT(pCalcCoreState, counter, n) ((void)0)
+#endif
+
 /* ------------- GLOBAL VARIABLES ------------ */
 const uint8_t baseToRadix[3] = {
     10, // inputBase_DEC
@@ -65,43 +74,121 @@ const uint8_t baseToRadix[3] = {
 };
 /* ---- CALCULATOR CORE HELPER FUNCTIONS ----- */
 
-// Temporary list containing the allocated pointers
-#define ALLOC_TABLE_SZ 400
-uint32_t allocatedPointers[ALLOC_TABLE_SZ] = {0};
+#if defined(CALC_ENTRY_POOL_SIZE)
+/**
+ * @brief Take an entry from the fixed pool.
+ * @param pAllocator Pointer to the allocator of the calculator state.
+ * @return Pointer to the entry, or NULL if the pool is exhausted.
+ */
+static CALC_HOT inputListEntry_t *entryPoolTake(calcAllocator_t *pAllocator) {
+    if (pAllocator->numFreeEntries == 0) {
+        return NULL;
+    }
+    return pAllocator->pFreeEntries[--pAllocator->numFreeEntries];
+}
+
+/**
+ * @brief Give an entry back to the fixed pool.
+ * @param pAllocator Pointer to the allocator of the calculator state.
+ * @param ptr Pointer to the entry.
+ */
+static CALC_HOT void entryPoolGive(calcAllocator_t *pAllocator,
+                                   inputListEntry_t *ptr) {
+    pAllocator->pFreeEntries[pAllocator->numFreeEntries++] = ptr;
+}
+#endif
+
+/**
+ * @brief Initialize the allocator of a calculator state.
+ * @param pAllocator Pointer to the allocator.
+ * @return Nothing
+ */
+static void allocatorInit(calcAllocator_t *pAllocator) {
+    for (int i = 0; i < CALC_ALLOC_TABLE_SIZE; i++) {
+        pAllocator->pAllocated[i] = NULL;
+    }
+#if defined(CALC_ENTRY_POOL_SIZE)
+    for (uint16_t i = 0; i < CALC_ENTRY_POOL_SIZE; i++) {
+        pAllocator->pFreeEntries[i] = &pAllocator->entryPool[i];
+    }
+    pAllocator->numFreeEntries = CALC_ENTRY_POOL_SIZE;
+#endif
+}
 
 /**
  * @brief Malloc wrapper to help debug memory leaks
+ * @param pCalcCoreState Pointer to the calculator state to allocate for.
  * @param size Size of malloc
  * @return Pointer that malloc allocates
+ * @note If CALC_ENTRY_POOL_SIZE is defined, entries are taken from a
+ * fixed pool instead of the heap, and NULL is returned when it runs out.
  */
-inputListEntry_t *overloaded_malloc(size_t size) {
-    void *ptr = malloc(size);
+CALC_HOT inputListEntry_t *overloaded_malloc(calcCoreState_t *pCalcCoreState,
+                                             size_t size) {
+    calcAllocator_t *pAllocator = &pCalcCoreState->allocator;
+#if defined(CALC_ENTRY_POOL_SIZE)
+    // Only list entries are allocated through here.
+    if (size > sizeof(inputListEntry_t)) {
+        logger(LOGGER_LEVEL_ERROR, "Entry pool: size %i too large\r\n", size);
+        return NULL;
+    }
+    inputListEntry_t *ptr = entryPoolTake(pAllocator);
+    if (ptr == NULL) {
+        // Running out of entries is expected for very long input,
+        // so let the caller handle this.
+        logger(LOGGER_LEVEL_ERROR, "Entry pool exhausted\r\n");
+        return NULL;
+    }
+#else
+    inputListEntry_t *ptr = malloc(size);
     if (ptr == NULL) {
         logger(LOGGER_LEVEL_ERROR, "Malloc returned NULL");
         while (1)
             ;
     }
+#endif
     logger(LOGGER_LEVEL_INFO, "[allocated] : 0x%08x\r\n", ptr);
     // Loop through until an empty place is found
     uint32_t i = 0;
-    while (allocatedPointers[i] != 0) {
+    while (i < CALC_ALLOC_TABLE_SIZE && pAllocator->pAllocated[i] != NULL) {
         i++;
     }
-    allocatedPointers[i] = (uint32_t)ptr;
+    if (i == CALC_ALLOC_TABLE_SIZE) {
+        logger(LOGGER_LEVEL_ERROR, "Allocation table full\r\n");
+#if defined(CALC_ENTRY_POOL_SIZE)
+        entryPoolGive(pAllocator, ptr);
+#else
+        free(ptr);
+#endif
+        return NULL;
+    }
+    pAllocator->pAllocated[i] = ptr;
+    CALC_COUNT(pCalcCoreState, numAllocations, 1);
+    CALC_COUNT(pCalcCoreState, numLiveEntries, 1);
+#if defined(CALC_COUNTERS)
+    if (pCalcCoreState->counters.numLiveEntries >
+        pCalcCoreState->counters.peakLiveEntries) {
+        pCalcCoreState->counters.peakLiveEntries =
+            pCalcCoreState->counters.numLiveEntries;
+    }
+#endif
     return ptr;
 }
 
 /**
  * @brief Free wrapper to help debug memory leaks
+ * @param pCalcCoreState Pointer to the calculator state owning the entry.
  * @param ptr Pointer to memory being free'd
  */
-void overloaded_free(inputListEntry_t *ptr) {
+CALC_HOT void overloaded_free(calcCoreState_t *pCalcCoreState,
+                              inputListEntry_t *ptr) {
+    calcAllocator_t *pAllocator = &pCalcCoreState->allocator;
     logger(LOGGER_LEVEL_INFO, "[free] : 0x%08x\r\n", ptr);
     bool okToFree = false;
-    for (int i = 0; i < ALLOC_TABLE_SZ; i++) {
-        if (allocatedPointers[i] == (uint32_t)ptr) {
+    for (int i = 0; i < CALC_ALLOC_TABLE_SIZE; i++) {
+        if (pAllocator->pAllocated[i] == ptr) {
             okToFree = true;
-            allocatedPointers[i] = 0;
+            pAllocator->pAllocated[i] = NULL;
             break;
         }
     }
@@ -112,7 +199,13 @@ void overloaded_free(inputListEntry_t *ptr) {
         while (1)
             ;
     }
+#if defined(CALC_ENTRY_POOL_SIZE)
+    entryPoolGive(pAllocator, ptr);
+#else
     free(ptr);
+#endif
+    CALC_COUNT(pCalcCoreState, numFrees, 1);
+    CALC_COUNT(pCalcCoreState, numLiveEntries, -1);
 }
 
 /**
@@ -122,7 +215,7 @@ void overloaded_free(inputListEntry_t *ptr) {
  * @return True if char is numerical within that base. Otherwise false.
  *
  */
-static bool charIsNumerical(inputBase_t base, char c) {
+static CALC_HOT bool charIsNumerical(inputBase_t base, char c) {
     if (base == inputBase_DEC) {
         if (('0' <= c) && (c <= '9')) {
             return true;
@@ -146,7 +239,7 @@ static bool charIsNumerical(inputBase_t base, char c) {
  * @param c Character to check.
  * @return True if char is in the operator table. Otherwise false.
  */
-static bool charIsOperator(char c) {
+static CALC_HOT bool charIsOperator(char c) {
     // Loop through the operator array and check if the operator is in there.
     // Not a nice way to do it, but the array is fairly small.
     for (uint8_t i = 0; i < NUM_OPERATORS; i++) {
@@ -162,7 +255,7 @@ static bool charIsOperator(char c) {
  * @param c Character to check.
  * @return True if char is opening or closing bracket. Otherwise false.
  */
-static bool charIsBracket(char c) {
+static CALC_HOT bool charIsBracket(char c) {
     if ((c == '(') || (c == ')')) {
         return true;
     }
@@ -175,7 +268,7 @@ static bool charIsBracket(char c) {
  * @return True if char is accepted input, but not operator or numerical.
  * Otherwise false.
  */
-static bool charIsOther(char c) {
+static CALC_HOT bool charIsOther(char c) {
     if ((c == ',') || (c == '.')) {
         return true;
     }
@@ -187,7 +280,7 @@ static bool charIsOther(char c) {
  * @param c Character which to fetch related operator entry.
  * @return Pointer to operator entry if found, otherwise NULL.
  */
-static const operatorEntry_t *getOperator(char c) {
+static CALC_HOT const operatorEntry_t *getOperator(char c) {
     // Loop through the operator array and check if the operator is in there.
     // Not a nice way to do it, but the array is fairly small.
     for (uint8_t i = 0; i < NUM_OPERATORS; i++) {
@@ -226,10 +319,13 @@ getInputListEntry(calcCoreState_t *calcCoreState,
         // Find the pointer to the last list entry
         while (pListEntry->pNext != NULL) {
             pListEntry = pListEntry->pNext;
+            CALC_COUNT(calcCoreState, numListSteps, 1);
         }
 
         // Prevent wrap-around issues
         if (((int8_t)cursorPosition) < 0) {
+            // Like any cursor past the start, there is no entry before it.
+            *ppInputListAtCursor = NULL;
             return inputModStatus_CURSOR_VALUE_LARGER_THAN_LIST_ENTRY;
         }
 
@@ -238,6 +334,7 @@ getInputListEntry(calcCoreState_t *calcCoreState,
             // Check if there is a previous entry
             if (pListEntry != NULL) {
                 pListEntry = pListEntry->pPrevious;
+                CALC_COUNT(calcCoreState, numListSteps, 1);
             } else {
                 // If there isn't then return the number
                 // of steps taken in this list.
@@ -274,9 +371,9 @@ calc_funStatus_t calc_coreInit(calcCoreState_t *pCalcCoreState) {
     if (pCalcCoreState == NULL) {
         return calc_funStatus_CALC_CORE_STATE_NULL;
     }
-    for (int i = 0; i < 100; i++) {
-        allocatedPointers[i] = 0;
-    }
+    // Every state has its own allocator, so initializing one state never
+    // touches the entries of another.
+    allocatorInit(&pCalcCoreState->allocator);
 
     // Initialize the cursor to 0
     pCalcCoreState->cursorPosition = 0;
@@ -293,6 +390,15 @@ calc_funStatus_t calc_coreInit(calcCoreState_t *pCalcCoreState) {
     // Set the result to 0 and solved to false
     pCalcCoreState->result = 0;
     pCalcCoreState->solved = false;
+
+    // The solver can't be cancelled unless a function is set
+    pCalcCoreState->pSolverCancelFun = NULL;
+    pCalcCoreState->pSolverCancelArg = NULL;
+    // No result cache unless one is attached
+    pCalcCoreState->pCacheLookupFun = NULL;
+    pCalcCoreState->pCacheStoreFun = NULL;
+    pCalcCoreState->pCacheArg = NULL;
+    memset(&pCalcCoreState->counters, 0, sizeof(calcCounters_t));
     pCalcCoreState->numberFormat.inputFormat = INPUT_FMT_INT;
     pCalcCoreState->numberFormat.outputFormat = INPUT_FMT_INT;
     pCalcCoreState->numberFormat.sign = false;
@@ -317,13 +423,15 @@ calc_funStatus_t calc_coreBufferTeardown(calcCoreState_t *pCalcCoreState) {
         // Find the first entry, if this isn't it.
         while ((pListEntry->pPrevious) != NULL) {
             pListEntry = (inputListEntry_t *)(pListEntry->pPrevious);
+            CALC_COUNT(pCalcCoreState, numListSteps, 1);
         }
 
         // Go from start to finish and free all entries
         while (pListEntry != NULL) {
             // Free the list entry
             inputListEntry_t *pNext = (inputListEntry_t *)pListEntry->pNext;
-            overloaded_free(pListEntry);
+            CALC_COUNT(pCalcCoreState, numListSteps, 1);
+            overloaded_free(pCalcCoreState, pListEntry);
             pCalcCoreState->allocCounter--;
             pListEntry = pNext;
         }
@@ -333,8 +441,8 @@ calc_funStatus_t calc_coreBufferTeardown(calcCoreState_t *pCalcCoreState) {
     return calc_funStatus_SUCCESS;
 }
 
-calc_funStatus_t calc_addInput(calcCoreState_t *pCalcCoreState,
-                               char inputChar) {
+CALC_HOT calc_funStatus_t calc_addInput(calcCoreState_t *pCalcCoreState,
+                                        char inputChar) {
 
     // Check pointer to calculator core state
     if (pCalcCoreState == NULL) {
@@ -354,7 +462,7 @@ calc_funStatus_t calc_addInput(calcCoreState_t *pCalcCoreState,
 
     // Allocate a new entry
     inputListEntry_t *pNewListEntry =
-        overloaded_malloc(sizeof(inputListEntry_t));
+        overloaded_malloc(pCalcCoreState, sizeof(inputListEntry_t));
     if (pNewListEntry == NULL) {
         return calc_funStatus_ALLOCATE_ERROR;
     }
@@ -409,7 +517,7 @@ calc_funStatus_t calc_addInput(calcCoreState_t *pCalcCoreState,
     } else {
         // Unknown input. Free and return
         if (pNewListEntry != NULL) {
-            overloaded_free(pNewListEntry);
+            overloaded_free(pCalcCoreState, pNewListEntry);
             pCalcCoreState->allocCounter--;
         }
         return calc_funStatus_UNKNOWN_INPUT;
@@ -444,7 +552,7 @@ calc_funStatus_t calc_addInput(calcCoreState_t *pCalcCoreState,
     return calc_funStatus_SUCCESS;
 }
 
-calc_funStatus_t calc_removeInput(calcCoreState_t *pCalcCoreState) {
+CALC_HOT calc_funStatus_t calc_removeInput(calcCoreState_t *pCalcCoreState) {
     // Check pointer to calculator core state
     if (pCalcCoreState == NULL) {
         return calc_funStatus_CALC_CORE_STATE_NULL;
@@ -481,81 +589,71 @@ calc_funStatus_t calc_removeInput(calcCoreState_t *pCalcCoreState) {
         pCalcCoreState->pListEntrypoint = pCurrentListEntry->pNext;
     }
 
-    overloaded_free(pCurrentListEntry);
+    overloaded_free(pCalcCoreState, pCurrentListEntry);
     pCalcCoreState->allocCounter--;
 
     return calc_funStatus_SUCCESS;
 }
 
 /**
- * @brief Functions that find the deepest point between two list entries.
- * @param ppStart Pointer to pointer to start of list.
- * @param ppEnd Pointer to pointer to end of list.
- * @return Status of finding the deepest point.
- *   -1 if deepest point cannot be found, otherwise 0.
+ * @brief Find the first expression closed by a depth decrease.
+ * @param pCalcCoreState Pointer to the calculator state, for the counters.
+ * @param ppStart Pointer to pointer to where to start looking. Returns the
+ * depth increase opening the expression.
+ * @param ppEnd Pointer to pointer returning the depth decrease closing the
+ * expression, or NULL if there is none left.
+ * @param pDepth Pointer to the depth where the search starts. Returns the
+ * depth after the expression has been solved.
+ * @return Status of finding the expression.
+ *   -1 if the depth doesn't match up, otherwise 0.
  *
- * Pointers to pointers seturns the pointer to the
- * start and end of the deepest point.
- * Works by increasing a counter when the depth increases,
- * and for each consecutive depth increase updates the start
- * pointer, until a depth decrease is found.
- * It always returns the first deepest point.
- * From that starting point, it then locates the next
- * depth decrease, which would be the end.
+ * Nothing changes depth between the first depth decrease and the depth
+ * increase just before it, so that expression can be solved right away.
+ * Solving it leaves the entries before it as they are, so the next search
+ * can start from its result, and finding every expression takes one pass
+ * over the list instead of one pass per expression.
+ * If there is no depth decrease left, ppStart is left as is.
  */
-int8_t findDeepestPoint(inputListEntry_t **ppStart, inputListEntry_t **ppEnd) {
-    // Counter to keep track of the current depth.
-    int currentDepth = 0;
-    int deepestDepth = 0;
-
-    // Local variables to keep track of the start and end point.
-    // Set the start and end points to start and end of the buffer,
-    inputListEntry_t *pStart = *ppStart;
-    inputListEntry_t *pEnd = *ppEnd;
-    inputListEntry_t *pIter = *ppStart;
-
-    // Loop until the end of the list has been found
-    while (pIter != NULL) {
-        if (GET_DEPTH_FLAG(pIter->entry.typeFlag) == DEPTH_CHANGE_INCREASE) {
-            // Increase in depth. Increase the current depth
-            currentDepth++;
-
-            if (currentDepth > deepestDepth) {
-                // This is the new deepest point
-                deepestDepth = currentDepth;
-                pStart = pIter;
-            }
-        } else if (GET_DEPTH_FLAG(pIter->entry.typeFlag) ==
+static CALC_HOT int8_t findClosedExpression(calcCoreState_t *pCalcCoreState,
+                                            inputListEntry_t **ppStart,
+                                            inputListEntry_t **ppEnd,
+                                            int *pDepth) {
+    // Loop through to the next decrease, or end of the list.
+    inputListEntry_t *pEnd = *ppStart;
+    while (pEnd != NULL) {
+        if (GET_DEPTH_FLAG(pEnd->entry.typeFlag) == DEPTH_CHANGE_INCREASE) {
+            (*pDepth)++;
+        } else if (GET_DEPTH_FLAG(pEnd->entry.typeFlag) ==
                    DEPTH_CHANGE_DECREASE) {
-            // Decrease in depth
-            currentDepth--;
+            break;
         }
-        pIter = pIter->pNext;
+        pEnd = pEnd->pNext;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
     }
-
-    // If the depth doesn't match up, this cannot be solved.
-    if (currentDepth != 0) {
+    *ppEnd = pEnd;
+    if (pEnd == NULL) {
+        // If the depth doesn't match up, this cannot be solved.
+        return *pDepth == 0 ? 0 : -1;
+    }
+    if (*pDepth == 0) {
+        // Nothing to close.
         return -1;
     }
 
-    // Set the pointer to the end to the pointer to the start
-    pEnd = pStart;
-    // ... and loop through to the next decrease, or end of the list.
-    while (pEnd != NULL) {
-        if (GET_DEPTH_FLAG(pEnd->entry.typeFlag) == DEPTH_CHANGE_DECREASE) {
-            break;
-        }
-        pEnd = pEnd->pNext;
+    // The decrease closes the closest increase before it, which exists
+    // since the depth is above 0.
+    inputListEntry_t *pStart = pEnd;
+    while (GET_DEPTH_FLAG(pStart->entry.typeFlag) != DEPTH_CHANGE_INCREASE) {
+        pStart = pStart->pPrevious;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
     }
-
-    // Record the values and return
+    (*pDepth)--;
     *ppStart = pStart;
-    *ppEnd = pEnd;
     return 0;
 }
 
-void convertResult(char *pString, SUBRESULT_INT result,
-                   numberFormat_t *pNumberFormat, uint8_t base) {
+CALC_HOT void convertResult(char *pString, SUBRESULT_INT result,
+                            numberFormat_t *pNumberFormat, uint8_t base) {
     // NULL check on pointer
     if (pString == NULL) {
         return;
@@ -818,6 +916,99 @@ void convertResult(char *pString, SUBRESULT_INT result,
     }
 }
 
+/**
+ * @brief Converts the characters of a number to a subresult.
+ * @param pString Null terminated number, e.g. "12.5".
+ * @param inputBase Base the number was entered in.
+ * @param inputFormat Format to convert the number to.
+ * @param pNumberFormat Pointer to the number format of the calculator.
+ * @param pSubresult Pointer to where the converted number is written.
+ * @return calc_funStatus_INPUT_BASE_ERROR if the base is unknown, otherwise
+ * calc_funStatus_SUCCESS.
+ */
+static CALC_HOT calc_funStatus_t
+convertNumberString(const char *pString, inputBase_t inputBase,
+                    inputFormat_t inputFormat, numberFormat_t *pNumberFormat,
+                    SUBRESULT_INT *pSubresult) {
+    bool sign = pNumberFormat->sign;
+    char *endPtr = NULL;
+    if (inputBase == inputBase_DEC) {
+        if (inputFormat == INPUT_FMT_INT) {
+            // Convert string to int.
+            // TBD: I think this should work with shorter strings as
+            // well
+            if (sign) {
+                *pSubresult = strtoll(pString, &endPtr, 10);
+            } else {
+                *pSubresult = strtoull(pString, &endPtr, 10);
+            }
+        } else if (inputFormat == INPUT_FMT_FLOAT) {
+            if (pNumberFormat->numBits == 32) {
+                float tempFloat = strtof(pString, &endPtr);
+                memcpy(pSubresult, &tempFloat, sizeof(float));
+            }
+            if (pNumberFormat->numBits == 64) {
+                double tempFloat = strtod(pString, &endPtr);
+                memcpy(pSubresult, &tempFloat, sizeof(double));
+            }
+        } else if (inputFormat == INPUT_FMT_FIXED) {
+            // Use function to convert to fixed point with radix 10
+            *pSubresult =
+                strtofp(pString, sign,
+                        getEffectiveFixedPointDecimalPlace(pNumberFormat), 10);
+        }
+    } else if (inputBase == inputBase_HEX) {
+        if (inputFormat == INPUT_FMT_INT) {
+            if (sign) {
+                *pSubresult = strtoll(pString, &endPtr, 16);
+            } else {
+                *pSubresult = strtoull(pString, &endPtr, 16);
+            }
+        } else if (inputFormat == INPUT_FMT_FLOAT) {
+            // Floats have no specific format in hex, so just
+            // read out as int, but note the difference between 32 and
+            // 64 bits
+            if (pNumberFormat->numBits == 32) {
+                *pSubresult = strtoul(pString, &endPtr, 16);
+            } else if (pNumberFormat->numBits == 64) {
+                *pSubresult = strtoull(pString, &endPtr, 16);
+            }
+        } else if (inputFormat == INPUT_FMT_FIXED) {
+            *pSubresult =
+                strtofp(pString, sign,
+                        getEffectiveFixedPointDecimalPlace(pNumberFormat), 16);
+        }
+
+    } else if (inputBase == inputBase_BIN) {
+        if (inputFormat == INPUT_FMT_INT) {
+            // Convert string to int.
+            // TBD: I think this should work with shorter strings as
+            // well
+            if (sign) {
+                *pSubresult = strtoll(pString, &endPtr, 2);
+            } else {
+                *pSubresult = strtoull(pString, &endPtr, 2);
+            }
+        } else if (inputFormat == INPUT_FMT_FLOAT) {
+            // Floats have no specific format in binary, so just
+            // read out as int, but note the difference between 32 and
+            // 64 bits
+            if (pNumberFormat->numBits == 32) {
+                *pSubresult = strtoul(pString, &endPtr, 2);
+            } else if (pNumberFormat->numBits == 64) {
+                *pSubresult = strtoull(pString, &endPtr, 2);
+            }
+        } else if (inputFormat == INPUT_FMT_FIXED) {
+            *pSubresult =
+                strtofp(pString, sign,
+                        getEffectiveFixedPointDecimalPlace(pNumberFormat), 2);
+        }
+    } else {
+        return calc_funStatus_INPUT_BASE_ERROR;
+    }
+    return calc_funStatus_SUCCESS;
+}
+
 /**
  * @brief Converts an input list containing chars, and converts all chars to
  * appropriate format
@@ -828,7 +1019,7 @@ void convertResult(char *pString, SUBRESULT_INT result,
  * The conversion from char to int will reduce the length of the list, where
  * e.g. '1'->'2'->'3' will be converted to 123 (from 3 entries to 1).
  */
-static calc_funStatus_t
+static CALC_HOT calc_funStatus_t
 copyAndConvertList(calcCoreState_t *pCalcCoreState,
                    inputListEntry_t **ppSolverListStart) {
 
@@ -844,7 +1035,8 @@ copyAndConvertList(calcCoreState_t *pCalcCoreState,
     while (pCurrentListEntry != NULL) {
 
         // Allocate a new entry
-        pNewListEntry = overloaded_malloc(sizeof(inputListEntry_t));
+        pNewListEntry = overloaded_malloc(pCalcCoreState,
+                                          sizeof(inputListEntry_t));
         if (pNewListEntry == NULL) {
             return calc_funStatus_ALLOCATE_ERROR;
         }
@@ -880,6 +1072,7 @@ copyAndConvertList(calcCoreState_t *pCalcCoreState,
                 // Count how manu number and decimal entries there are
                 numberOfNumberEntries += 1;
                 pTmpEntry = pTmpEntry->pNext;
+                CALC_COUNT(pCalcCoreState, numListSteps, 1);
 
                 if (pTmpEntry == NULL) {
                     break;
@@ -904,6 +1097,7 @@ copyAndConvertList(calcCoreState_t *pCalcCoreState,
                 *pCurrentChar++ = pCurrentListEntry->entry.c;
 
                 pCurrentListEntry = pCurrentListEntry->pNext;
+                CALC_COUNT(pCalcCoreState, numListSteps, 1);
 
                 if (pCurrentListEntry == NULL) {
                     break;
@@ -914,107 +1108,21 @@ copyAndConvertList(calcCoreState_t *pCalcCoreState,
             // Now that we have a string to work with, based on the input
             // format and base, we can convert using the UNIX string-to-X
             // functions.
-            char *endPtr = NULL;
-            if (inputBase == inputBase_DEC) {
-                if (inputFormat == INPUT_FMT_INT) {
-                    // Convert string to int.
-                    // TBD: I think this should work with shorter strings as
-                    // well
-                    if (sign) {
-                        pNewListEntry->entry.subresult =
-                            strtoll(pCurrentString, &endPtr, 10);
-                    } else {
-                        pNewListEntry->entry.subresult =
-                            strtoull(pCurrentString, &endPtr, 10);
-                    }
-                } else if (inputFormat == INPUT_FMT_FLOAT) {
-                    if (pCalcCoreState->numberFormat.numBits == 32) {
-                        float tempFloat = strtof(pCurrentString, &endPtr);
-                        memcpy(&(pNewListEntry->entry.subresult), &tempFloat,
-                               sizeof(float));
-                    }
-                    if (pCalcCoreState->numberFormat.numBits == 64) {
-                        double tempFloat = strtod(pCurrentString, &endPtr);
-                        memcpy(&(pNewListEntry->entry.subresult), &tempFloat,
-                               sizeof(double));
-                    }
-                } else if (inputFormat == INPUT_FMT_FIXED) {
-                    // Use function to convert to fixed point with radix 10
-                    pNewListEntry->entry.subresult =
-                        strtofp(pCurrentString, sign,
-                                getEffectiveFixedPointDecimalPlace(
-                                    &(pCalcCoreState->numberFormat)),
-                                10);
-                }
-            } else if (inputBase == inputBase_HEX) {
-                if (inputFormat == INPUT_FMT_INT) {
-                    if (sign) {
-                        pNewListEntry->entry.subresult =
-                            strtoll(pCurrentString, &endPtr, 16);
-                    } else {
-                        pNewListEntry->entry.subresult =
-                            strtoull(pCurrentString, &endPtr, 16);
-                    }
-                } else if (inputFormat == INPUT_FMT_FLOAT) {
-                    // Floats have no specific format in hex, so just
-                    // read out as int, but note the difference between 32 and
-                    // 64 bits
-                    if (pCalcCoreState->numberFormat.numBits == 32) {
-                        pNewListEntry->entry.subresult =
-                            strtoul(pCurrentString, &endPtr, 16);
-                    } else if (pCalcCoreState->numberFormat.numBits == 64) {
-                        pNewListEntry->entry.subresult =
-                            strtoull(pCurrentString, &endPtr, 16);
-                    }
-                } else if (inputFormat == INPUT_FMT_FIXED) {
-                    pNewListEntry->entry.subresult =
-                        strtofp(pCurrentString, sign,
-                                getEffectiveFixedPointDecimalPlace(
-                                    &(pCalcCoreState->numberFormat)),
-                                16);
-                }
-
-            } else if (inputBase == inputBase_BIN) {
-                if (inputFormat == INPUT_FMT_INT) {
-                    // Convert string to int.
-                    // TBD: I think this should work with shorter strings as
-                    // well
-                    if (sign) {
-                        pNewListEntry->entry.subresult =
-                            strtoll(pCurrentString, &endPtr, 2);
-                    } else {
-                        pNewListEntry->entry.subresult =
-                            strtoull(pCurrentString, &endPtr, 2);
-                    }
-                } else if (inputFormat == INPUT_FMT_FLOAT) {
-                    // Floats have no specific format in binary, so just
-                    // read out as int, but note the difference between 32 and
-                    // 64 bits
-                    if (pCalcCoreState->numberFormat.numBits == 32) {
-                        pNewListEntry->entry.subresult =
-                            strtoul(pCurrentString, &endPtr, 2);
-                    } else if (pCalcCoreState->numberFormat.numBits == 64) {
-                        pNewListEntry->entry.subresult =
-                            strtoull(pCurrentString, &endPtr, 2);
-                    }
-                } else if (inputFormat == INPUT_FMT_FIXED) {
-                    pNewListEntry->entry.subresult =
-                        strtofp(pCurrentString, sign,
-                                getEffectiveFixedPointDecimalPlace(
-                                    &(pCalcCoreState->numberFormat)),
-                                2);
-                }
-            } else {
-                free(pCurrentString);
-                return calc_funStatus_INPUT_BASE_ERROR;
-            }
+            calc_funStatus_t convertStatus = convertNumberString(
+                pCurrentString, inputBase, inputFormat,
+                &(pCalcCoreState->numberFormat),
+                &(pNewListEntry->entry.subresult));
             // Free the string
             free(pCurrentString);
+            if (convertStatus != calc_funStatus_SUCCESS) {
+                return convertStatus;
+            }
 
         } else {
             // Not a number input, therefore move on to the next entry directly
             if (pCurrentListEntry != NULL) {
                 pCurrentListEntry = pCurrentListEntry->pNext;
+                CALC_COUNT(pCalcCoreState, numListSteps, 1);
             } else {
                 break;
             }
@@ -1033,6 +1141,7 @@ copyAndConvertList(calcCoreState_t *pCalcCoreState,
 
 /**
  * @brief Function to count arguments between pointers
+ * @param pCalcCoreState Pointer to the calculator state, for the counters.
  * @param pStart Pointer to start of list
  * @param pEnd Pointer to end of list.
  * @return The number of arguments. 0 if anything went wrong.
@@ -1041,7 +1150,8 @@ copyAndConvertList(calcCoreState_t *pCalcCoreState,
  * is divided by comma ',' and if no comma present then there is only
  * one argument.
  */
-uint8_t countArgs(inputListEntry_t *pStart, inputListEntry_t *pEnd) {
+CALC_HOT uint8_t countArgs(calcCoreState_t *pCalcCoreState,
+                           inputListEntry_t *pStart, inputListEntry_t *pEnd) {
 
     if (pStart == NULL) {
         return 0;
@@ -1057,19 +1167,22 @@ uint8_t countArgs(inputListEntry_t *pStart, inputListEntry_t *pEnd) {
             count++;
         }
         pStart = pStart->pNext;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
     }
     return count;
 }
 
 /**
  * @brief Function to read out operator function arguments to array.
+ * @param pCalcCoreState Pointer to the calculator state, for the counters.
  * @param pArgs Pointer to argument destination. Needs to be pre-allocated.
  * @param numArgs Number of arguments that should be read out.
  * @param pStart Pointer to start of list
  * @return 0 if OK, otherwise -1
  */
-int8_t readOutArgs(inputType_t *pArgs, int8_t numArgs, inputListEntry_t *pStart,
-                   inputListEntry_t *pEnd) {
+CALC_HOT int8_t readOutArgs(calcCoreState_t *pCalcCoreState,
+                            inputType_t *pArgs, int8_t numArgs,
+                            inputListEntry_t *pStart, inputListEntry_t *pEnd) {
     // pArgs must have been allocated
     if (pStart == NULL) {
         return -1;
@@ -1091,6 +1204,7 @@ int8_t readOutArgs(inputType_t *pArgs, int8_t numArgs, inputListEntry_t *pStart,
             readArgs++;
         }
         pStart = pStart->pNext;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
     }
     return 0;
 }
@@ -1112,10 +1226,10 @@ int8_t readOutArgs(inputType_t *pArgs, int8_t numArgs, inputListEntry_t *pStart,
  * TODO: Save the location of an error.
  */
 
-static int solveExpression(calcCoreState_t *pCalcCoreState,
-                           inputListEntry_t **ppResult,
-                           inputListEntry_t **ppExprStart,
-                           inputListEntry_t *pExprEnd) {
+static CALC_HOT int solveExpression(calcCoreState_t *pCalcCoreState,
+                                    inputListEntry_t **ppResult,
+                                    inputListEntry_t **ppExprStart,
+                                    inputListEntry_t *pExprEnd) {
 
     // Quick sanity check so that the start of the expression isn't NULL
     inputListEntry_t *pExprStart = *ppExprStart;
@@ -1175,8 +1289,8 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
             if (pExprEnd->pNext != NULL) {
                 ((inputListEntry_t *)(pExprEnd->pNext))->pPrevious = pEnd;
             }
-            overloaded_free(pExprStart);
-            overloaded_free(pExprEnd);
+            overloaded_free(pCalcCoreState, pExprStart);
+            overloaded_free(pCalcCoreState, pExprEnd);
             pExprEnd = pEnd;
             pCalcCoreState->allocCounter -= 2;
 
@@ -1193,6 +1307,9 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
     // pTmpStart and pTmpEnd. Loop until there is a single entry left.
     bool noOperatorsLeft = false;
     inputListEntry_t *pResult = NULL;
+    // The operator solved last. The operators left of it all have lower
+    // priority, so the next one of the same priority is looked for from it.
+    inputListEntry_t *pLastOp = NULL;
     while (!noOperatorsLeft) {
         logger(LOGGER_LEVEL_INFO, "pTmpStart = 0x%08x, pTmpEnd = 0x%08x\r\n",
                pStart, pEnd);
@@ -1201,7 +1318,31 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
         inputListEntry_t *pHigestPrioOp = NULL;
         inputListEntry_t *pCurrentEntry = pStart;
         uint8_t highestOpPrio = 255;
-        while (pCurrentEntry != pEnd) {
+        if (pLastOp != NULL && pLastOp != pEnd) {
+            // Only when there is none of the same priority left is the whole
+            // expression searched again, so each priority is one pass.
+            highestOpPrio =
+                ((operatorEntry_t *)(pLastOp->pFunEntry))->solvPrio;
+            pCurrentEntry = pLastOp->pNext;
+            CALC_COUNT(pCalcCoreState, numListSteps, 1);
+            while (pCurrentEntry != NULL && pCurrentEntry != pEnd) {
+                if ((GET_INPUT_TYPE(pCurrentEntry->entry.typeFlag) ==
+                     INPUT_TYPE_OPERATOR) &&
+                    (((operatorEntry_t *)(pCurrentEntry->pFunEntry))
+                         ->solvPrio == highestOpPrio)) {
+                    pHigestPrioOp = pCurrentEntry;
+                    break;
+                }
+                pCurrentEntry = pCurrentEntry->pNext;
+                CALC_COUNT(pCalcCoreState, numListSteps, 1);
+            }
+            if (pHigestPrioOp == NULL) {
+                pCurrentEntry = pStart;
+                highestOpPrio = 255;
+            }
+        }
+        bool searchAll = pHigestPrioOp == NULL;
+        while (searchAll && pCurrentEntry != pEnd) {
             if (GET_INPUT_TYPE(pCurrentEntry->entry.typeFlag) ==
                 INPUT_TYPE_OPERATOR) {
                 // This entry is an operator. Find the priority.
@@ -1214,6 +1355,7 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
                 }
             }
             pCurrentEntry = pCurrentEntry->pNext;
+            CALC_COUNT(pCalcCoreState, numListSteps, 1);
             if (pCurrentEntry == NULL) {
                 // If the new list entry points to NULL then break the loop
                 break;
@@ -1237,6 +1379,14 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
                        "ERROR: Pointer(s) before or after operator are NULL\n");
                 return calc_solveStatus_OPERATOR_POINTER_ERROR;
             }
+            if (pHigestPrioOp == pStart) {
+                // The operator has no left hand side in the expression, e.g.
+                // "4(/4)". The entry before it is outside of the expression,
+                // and may be the start of the list, so it must not be freed.
+                logger(LOGGER_LEVEL_ERROR,
+                       "ERROR: Operator at the start of the expression\n");
+                return calc_solveStatus_OPERATOR_POINTER_ERROR;
+            }
             if ((GET_INPUT_TYPE(pNextEntry->entry.typeFlag) !=
                  INPUT_TYPE_NUMBER) ||
                 (GET_INPUT_TYPE(pPrevEntry->entry.typeFlag) !=
@@ -1279,6 +1429,7 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
 
             // Solve the operation and save the results to the operator
             // subresults.
+            CALC_COUNT(pCalcCoreState, numOperatorCalls, 1);
             int8_t calcStatus = (*pFun)(&(pHigestPrioOp->entry.subresult),
                                         pCalcCoreState->numberFormat, 2, pArgs);
             if (calcStatus < 0) {
@@ -1312,8 +1463,8 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
                    pHigestPrioOp->pPrevious);
             logger(LOGGER_LEVEL_INFO, "pHigestOrderOp->pNext : 0x%08x\r\n",
                    pHigestPrioOp->pNext);
-            overloaded_free(pPrevEntry);
-            overloaded_free(pNextEntry);
+            overloaded_free(pCalcCoreState, pPrevEntry);
+            overloaded_free(pCalcCoreState, pNextEntry);
             pCalcCoreState->allocCounter -= 2;
 
             // Check if we just erased the starting point. If so the repoint
@@ -1340,6 +1491,7 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
             }
 
             pResult = pHigestPrioOp;
+            pLastOp = pHigestPrioOp;
         } else {
             // No operator was found, but that's OK, it could be a single
             // expression, or something going into a multi-input depth
@@ -1360,7 +1512,8 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
     if (solveOuterOperator) {
         // But wait, there's more!
         // Still need to solve the outer operator!
-        uint8_t numArgsInBuffer = countArgs(pExprStart, pExprEnd);
+        uint8_t numArgsInBuffer =
+            countArgs(pCalcCoreState, pExprStart, pExprEnd);
         logger(LOGGER_LEVEL_INFO, "Number of args: %i\r\n", numArgsInBuffer);
 
         if (GET_INPUT_TYPE(pExprStart->entry.typeFlag) == INPUT_TYPE_OPERATOR) {
@@ -1393,9 +1546,10 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
                        "Arguments could not be allocated!\r\n");
                 return calc_solveStatus_ALLOCATION_ERROR;
             }
-            if (readOutArgs(pArgs, numArgsInBuffer, pExprStart, pExprEnd) !=
-                0) {
+            if (readOutArgs(pCalcCoreState, pArgs, numArgsInBuffer,
+                            pExprStart, pExprEnd) != 0) {
                 logger(LOGGER_LEVEL_ERROR, "Error: Incorrect arguments.\r\n");
+                free(pArgs);
                 return calc_solveStatus_INVALID_ARGS;
             }
             inputFormat_t inputFormat =
@@ -1406,6 +1560,7 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
                 (function_operator
                      *)(((operatorEntry_t *)(pExprStart->pFunEntry))->pFun);
 
+            CALC_COUNT(pCalcCoreState, numOperatorCalls, 1);
             int8_t calcStatus =
                 (*pFun)(&(pExprStart->entry.subresult),
                         pCalcCoreState->numberFormat, numArgsInBuffer, pArgs);
@@ -1418,12 +1573,13 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
             // Free the rest of the buffer, and repoint the buffers if needed.
             while (pExprStart->pNext != NULL && pExprStart->pNext != pExprEnd) {
                 inputListEntry_t *pNextEntry = pExprStart->pNext;
+                CALC_COUNT(pCalcCoreState, numListSteps, 1);
                 // Before pNextEntry can be freed, the surrounding pointers
                 // must be repointed.
                 pExprStart->pNext = pNextEntry->pNext;
                 ((inputListEntry_t *)(pNextEntry->pNext))->pPrevious =
                     pExprStart;
-                overloaded_free(pNextEntry);
+                overloaded_free(pCalcCoreState, pNextEntry);
                 pCalcCoreState->allocCounter--;
             }
             pExprStart->pNext = pExprEnd->pNext;
@@ -1434,7 +1590,7 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
                     ((inputListEntry_t *)(pExprEnd->pNext))->pPrevious =
                         pExprStart;
                 }
-                overloaded_free(pExprEnd);
+                overloaded_free(pCalcCoreState, pExprEnd);
                 pCalcCoreState->allocCounter--;
             }
             // Construct a new typeflag for the result.
@@ -1457,13 +1613,62 @@ static int solveExpression(calcCoreState_t *pCalcCoreState,
     logger(LOGGER_LEVEL_INFO, "Returning. \r\n");
     return calc_solveStatus_SUCCESS;
 }
-calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
+uint64_t calc_inputHash(const calcCoreState_t *pCalcCoreState) {
+    // FNV-1a, fed with the fields of each entry the solver reads.
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    const inputListEntry_t *pEntry = pCalcCoreState->pListEntrypoint;
+    while (pEntry != NULL) {
+        uint8_t token[3] = {(uint8_t)pEntry->entry.c, pEntry->entry.typeFlag,
+                            pEntry->inputBase};
+        for (int i = 0; i < 3; i++) {
+            hash ^= token[i];
+            hash *= 0x100000001b3ULL;
+        }
+        pEntry = pEntry->pNext;
+    }
+    return hash;
+}
+
+calc_funStatus_t calc_resetCounters(calcCoreState_t *pCalcCoreState) {
+    if (pCalcCoreState == NULL) {
+        return calc_funStatus_CALC_CORE_STATE_NULL;
+    }
+    // The live entries are a level rather than a count, so they are kept.
+    uint32_t numLiveEntries = pCalcCoreState->counters.numLiveEntries;
+    memset(&pCalcCoreState->counters, 0, sizeof(calcCounters_t));
+    pCalcCoreState->counters.numLiveEntries = numLiveEntries;
+    pCalcCoreState->counters.peakLiveEntries = numLiveEntries;
+    return calc_funStatus_SUCCESS;
+}
+
+CALC_HOT calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
     pCalcCoreState->solved = false;
 
+    // With a result cache attached, an input that has been solved before,
+    // in the same number format, isn't solved again.
+    bool useCache = pCalcCoreState->pCacheLookupFun != NULL &&
+                    pCalcCoreState->pCacheStoreFun != NULL &&
+                    pCalcCoreState->pListEntrypoint != NULL;
+    uint64_t cacheKey = 0;
+    if (useCache) {
+        cacheKey = calc_inputHash(pCalcCoreState);
+        SUBRESULT_INT cachedResult = 0;
+        calc_funStatus_t cachedStatus = calc_funStatus_SUCCESS;
+        if (pCalcCoreState->pCacheLookupFun(
+                pCalcCoreState->pCacheArg, cacheKey,
+                &pCalcCoreState->numberFormat, &cachedResult, &cachedStatus)) {
+            if (cachedStatus == calc_funStatus_SUCCESS) {
+                pCalcCoreState->result = cachedResult;
+            }
+            return cachedStatus;
+        }
+    }
+
     // Local variables to keep track while the solver is
     // at work. Should be copied to core state when done.
     SUBRESULT_INT result = 0;
     bool solved = false;
+    // Depth where the search for the next expression starts.
     int depth = 0;
     bool overflow = false;
 
@@ -1473,9 +1678,11 @@ calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
     inputListEntry_t *pSolverListStart = NULL;
     logger(LOGGER_LEVEL_INFO, "Copy and convert list.\r\n");
     copyAndConvertList(pCalcCoreState, &pSolverListStart);
-    // Loop through and find the deepest point of the buffer
+    // The expressions are solved from the innermost, in the order they are
+    // closed, and the search for the next one starts from the last result.
     inputListEntry_t *pStart = pSolverListStart;
     inputListEntry_t *pEnd = NULL;
+    inputListEntry_t *pSearchStart = pSolverListStart;
 
     // Do a NULL check on the start:
     if (pStart == NULL) {
@@ -1487,19 +1694,32 @@ calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
     // Loop until the pointers are back at start and end
     calc_funStatus_t returnStatus = calc_funStatus_SUCCESS;
     while (!solved) {
-        // Find the deepest calculation
-        pStart = pSolverListStart;
+        // Check if the caller wants to abandon this solve, e.g. because
+        // the input has changed since.
+        if (pCalcCoreState->pSolverCancelFun != NULL &&
+            pCalcCoreState->pSolverCancelFun(
+                pCalcCoreState->pSolverCancelArg)) {
+            logger(LOGGER_LEVEL_INFO, "Solve cancelled.\r\n");
+            returnStatus = calc_funStatus_SOLVE_CANCELLED;
+            break;
+        }
+        // Find the next innermost calculation
+        pStart = pSearchStart;
         pEnd = NULL;
-        if (findDeepestPoint(&pStart, &pEnd) < 0) {
+        if (findClosedExpression(pCalcCoreState, &pStart, &pEnd, &depth) <
+            0) {
             // There was an error in finding the bracket.
             logger(LOGGER_LEVEL_INFO,
-                   "Could not find the deepest point between 0x%08x and "
-                   "0x%08x\r\n",
-                   pStart, pEnd);
+                   "Could not find the next expression after 0x%08x\r\n",
+                   pSearchStart);
             returnStatus = calc_funStatus_SOLVE_INCOMPLETE;
             break;
         }
-        // The deepest calculation is now between pStart and pEnd.
+        if (pEnd == NULL) {
+            // No brackets left, so what is left is one expression.
+            pStart = pSolverListStart;
+        }
+        // The innermost calculation is now between pStart and pEnd.
         // This is in the form of:
         // [bracket/function/operator/none][expression][bracket/none]
         // The expression can consist of however many operators,
@@ -1523,9 +1743,16 @@ calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
                    "Start of the expression same as start of list\r\n");
             startOfExpressionSameAsStartOfList = true;
         }
+        uint8_t allocCounterBefore = pCalcCoreState->allocCounter;
         if (solveExpression(pCalcCoreState, &pResult, &pStart, pEnd) < 0) {
             logger(LOGGER_LEVEL_ERROR, "ERROR: Could not solve expression\r\n");
             returnStatus = calc_funStatus_SOLVE_INCOMPLETE;
+            // The list may not have changed, so trying again could loop
+            // forever. Whatever is left is freed below.
+            if (startOfExpressionSameAsStartOfList) {
+                pSolverListStart = pStart;
+            }
+            break;
         }
         if (startOfExpressionSameAsStartOfList) {
             // The start of the list was free'd. Repoint.
@@ -1547,8 +1774,15 @@ calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
                    pResult->entry.subresult);
             pCalcCoreState->result = pResult->entry.subresult;
             solved = true;
+        } else if (pCalcCoreState->allocCounter == allocCounterBefore) {
+            // Every expression solved shrinks the list. If it didn't, e.g.
+            // for ")^(", the next round would find the same expression.
+            logger(LOGGER_LEVEL_ERROR, "ERROR: Solver made no progress\r\n");
+            returnStatus = calc_funStatus_SOLVE_INCOMPLETE;
+            break;
         } else {
             logger(LOGGER_LEVEL_INFO, "next \r\n");
+            pSearchStart = pResult;
         }
         logger(LOGGER_LEVEL_INFO, "Done with expression\r\n");
     }
@@ -1558,12 +1792,13 @@ calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
     while (pSolverListStart != NULL) {
         logger(LOGGER_LEVEL_INFO, "In free loop\r\n");
         inputListEntry_t *pNext = pSolverListStart->pNext;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
         logger(LOGGER_LEVEL_INFO, "pNext = 0x%x\r\n", (uint32_t)pNext);
         if (pCalcCoreState->allocCounter == 0) {
             return -1;
         }
         if (pSolverListStart != NULL) {
-            overloaded_free(pSolverListStart);
+            overloaded_free(pCalcCoreState, pSolverListStart);
             pCalcCoreState->allocCounter--;
         } else {
             break;
@@ -1571,10 +1806,286 @@ calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState) {
         pSolverListStart = pNext;
     }
 
+    // A cancelled solve says nothing about the input, so don't keep it.
+    if (useCache && returnStatus != calc_funStatus_SOLVE_CANCELLED) {
+        SUBRESULT_INT storedResult = returnStatus == calc_funStatus_SUCCESS
+                                         ? pCalcCoreState->result
+                                         : 0;
+        pCalcCoreState->pCacheStoreFun(pCalcCoreState->pCacheArg, cacheKey,
+                                       &pCalcCoreState->numberFormat,
+                                       storedResult, returnStatus);
+    }
+
     logger(LOGGER_LEVEL_INFO, "Returning. \r\n");
     return returnStatus;
 }
 
+/**
+ * @brief Push a value to the value stack of calc_evalString.
+ * @param pState Pointer to the evaluation state.
+ * @param value Value to push.
+ * @return Status of the push.
+ */
+static CALC_HOT calc_funStatus_t evalPushValue(calcEvalState_t *pState,
+                                               SUBRESULT_INT value) {
+    if (pState->numValues == CALC_EVAL_STACK_SIZE) {
+        return calc_funStatus_ALLOCATE_ERROR;
+    }
+    inputType_t *pValue = &pState->values[pState->numValues++];
+    pValue->c = 0;
+    pValue->typeFlag =
+        CONSTRUCT_TYPEFLAG(pState->numberFormat.sign,
+                           pState->numberFormat.inputFormat, SUBRESULT_TYPE_INT,
+                           DEPTH_CHANGE_KEEP, INPUT_TYPE_NUMBER);
+    pValue->subresult = value;
+    return calc_funStatus_SUCCESS;
+}
+
+/**
+ * @brief Push a frame to the operator stack of calc_evalString.
+ * @param pState Pointer to the evaluation state.
+ * @param pOp Pointer to the operator, or NULL for an opening bracket.
+ * @return Status of the push.
+ */
+static CALC_HOT calc_funStatus_t evalPushFrame(calcEvalState_t *pState,
+                                               const operatorEntry_t *pOp) {
+    if (pState->numFrames == CALC_EVAL_STACK_SIZE) {
+        return calc_funStatus_ALLOCATE_ERROR;
+    }
+    calcEvalFrame_t *pFrame = &pState->frames[pState->numFrames++];
+    pFrame->pOp = pOp;
+    pFrame->argStart = pState->numValues;
+    pFrame->numArgs = 1;
+    return calc_funStatus_SUCCESS;
+}
+
+/**
+ * @brief Solve the binary operators on top of the operator stack.
+ * @param pState Pointer to the evaluation state.
+ * @param solvPrio Only operators with this or a higher priority, i.e. a
+ * lower or equal solvPrio, are solved. Stops at brackets and functions.
+ * @return Status of the solve.
+ */
+static CALC_HOT calc_funStatus_t evalSolveBinary(calcEvalState_t *pState,
+                                                 uint8_t solvPrio) {
+    while (pState->numFrames > 0) {
+        const operatorEntry_t *pOp = pState->frames[pState->numFrames - 1].pOp;
+        if (pOp == NULL || pOp->bIncDepth || pOp->solvPrio > solvPrio) {
+            break;
+        }
+        if (pState->numValues < 2) {
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        pState->numFrames--;
+        inputType_t *pArgs = &pState->values[pState->numValues - 2];
+        SUBRESULT_INT result = 0;
+        if (((function_operator *)pOp->pFun)(&result, pState->numberFormat, 2,
+                                             pArgs) < 0) {
+            logger(LOGGER_LEVEL_ERROR, "ERROR: Calculation not solvable");
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        pArgs[0].subresult = result;
+        pState->numValues--;
+    }
+    return calc_funStatus_SUCCESS;
+}
+
+/**
+ * @brief Close the innermost bracket or depth increasing operator.
+ * @param pState Pointer to the evaluation state.
+ * @return Status of the solve.
+ */
+static CALC_HOT calc_funStatus_t evalCloseFrame(calcEvalState_t *pState) {
+    calc_funStatus_t status = evalSolveBinary(pState, UINT8_MAX);
+    if (status != calc_funStatus_SUCCESS) {
+        return status;
+    }
+    if (pState->numFrames == 0) {
+        // More closing than opening brackets.
+        return calc_funStatus_SOLVE_INCOMPLETE;
+    }
+    calcEvalFrame_t *pFrame = &pState->frames[--pState->numFrames];
+    if (pFrame->pOp == NULL) {
+        // Plain bracket, the value is already on the stack.
+        return calc_funStatus_SUCCESS;
+    }
+    // Same argument checks as solveExpression.
+    int8_t operatorNumArgs = pFrame->pOp->numArgs;
+    if (operatorNumArgs == 0 ||
+        (operatorNumArgs > 0 && pFrame->numArgs != operatorNumArgs)) {
+        return calc_funStatus_SOLVE_INCOMPLETE;
+    }
+    // The status of depth increasing operators isn't checked by the solver
+    // either.
+    SUBRESULT_INT result = 0;
+    ((function_operator *)pFrame->pOp->pFun)(
+        &result, pState->numberFormat, pFrame->numArgs,
+        &pState->values[pFrame->argStart]);
+    pState->numValues = pFrame->argStart;
+    return evalPushValue(pState, result);
+}
+
+/**
+ * @brief Convert the number being read and push it to the value stack.
+ * @param pState Pointer to the evaluation state.
+ * @return Status of the conversion.
+ */
+static CALC_HOT calc_funStatus_t evalEndNumber(calcEvalState_t *pState) {
+    pState->number[pState->numberLen] = '\0';
+    pState->numberLen = 0;
+    SUBRESULT_INT value = 0;
+    calc_funStatus_t status = convertNumberString(
+        pState->number, pState->numberFormat.inputBase,
+        pState->numberFormat.inputFormat, &pState->numberFormat, &value);
+    if (status != calc_funStatus_SUCCESS) {
+        return status;
+    }
+    pState->expectOperand = false;
+    return evalPushValue(pState, value);
+}
+
+/**
+ * @brief Feed one character to calc_evalString.
+ * @param pState Pointer to the evaluation state.
+ * @param c Character, known to be accepted by calc_addInput.
+ * @return Status of the evaluation so far.
+ */
+static CALC_HOT calc_funStatus_t evalChar(calcEvalState_t *pState, char c) {
+    // Numbers are a number character followed by number characters and
+    // decimal points, just as in copyAndConvertList.
+    if (charIsNumerical(pState->numberFormat.inputBase, c) ||
+        (pState->numberLen > 0 && c == '.')) {
+        if (pState->numberLen == 0 && !pState->expectOperand) {
+            // A number directly after a closing bracket.
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        if (pState->numberLen == CALC_EVAL_MAX_NUMBER_LEN) {
+            return calc_funStatus_ALLOCATE_ERROR;
+        }
+        pState->number[pState->numberLen++] = c;
+        return calc_funStatus_SUCCESS;
+    }
+    calc_funStatus_t status = calc_funStatus_SUCCESS;
+    if (pState->numberLen > 0) {
+        status = evalEndNumber(pState);
+        if (status != calc_funStatus_SUCCESS) {
+            return status;
+        }
+    }
+
+    if (c == OPENING_BRACKET) {
+        if (!pState->expectOperand) {
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        return evalPushFrame(pState, NULL);
+    }
+    if (c == CLOSING_BRACKET) {
+        if (pState->expectOperand) {
+            // Empty brackets, or an operator missing its argument.
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        return evalCloseFrame(pState);
+    }
+    if (c == ',') {
+        if (pState->expectOperand) {
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        status = evalSolveBinary(pState, UINT8_MAX);
+        if (status != calc_funStatus_SUCCESS) {
+            return status;
+        }
+        // Arguments are only accepted by depth increasing operators.
+        if (pState->numFrames == 0 ||
+            pState->frames[pState->numFrames - 1].pOp == NULL) {
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        pState->frames[pState->numFrames - 1].numArgs++;
+        pState->expectOperand = true;
+        return calc_funStatus_SUCCESS;
+    }
+    if (c == '.') {
+        // Decimal point without a number in front.
+        return calc_funStatus_SOLVE_INCOMPLETE;
+    }
+
+    const operatorEntry_t *pOp = getOperator(c);
+    if (pOp->bIncDepth) {
+        if (!pState->expectOperand) {
+            return calc_funStatus_SOLVE_INCOMPLETE;
+        }
+        return evalPushFrame(pState, pOp);
+    }
+    if (pState->expectOperand) {
+        return calc_funStatus_SOLVE_INCOMPLETE;
+    }
+    status = evalSolveBinary(pState, pOp->solvPrio);
+    if (status != calc_funStatus_SUCCESS) {
+        return status;
+    }
+    pState->expectOperand = true;
+    return evalPushFrame(pState, pOp);
+}
+
+CALC_HOT calc_funStatus_t calc_evalString(const char *pString, size_t length,
+                                          numberFormat_t numberFormat,
+                                          SUBRESULT_INT *pResult) {
+    calcEvalState_t state;
+    return calc_evalStringScratch(&state, pString, length, numberFormat,
+                                  pResult);
+}
+
+CALC_HOT calc_funStatus_t calc_evalStringScratch(calcEvalState_t *pScratch,
+                                                 const char *pString,
+                                                 size_t length,
+                                                 numberFormat_t numberFormat,
+                                                 SUBRESULT_INT *pResult) {
+    if (pString == NULL || length == 0) {
+        return calc_funStatus_INPUT_LIST_NULL;
+    }
+    if (pScratch == NULL || pResult == NULL) {
+        return calc_funStatus_UNKNOWN_PARAMETER;
+    }
+    pScratch->numberFormat = numberFormat;
+    pScratch->numValues = 0;
+    pScratch->numFrames = 0;
+    pScratch->numberLen = 0;
+    pScratch->expectOperand = true;
+
+    calc_funStatus_t status = calc_funStatus_SUCCESS;
+    for (size_t i = 0; i < length; i++) {
+        char c = pString[i];
+        // Characters rejected by calc_addInput take precedence over any
+        // syntax error, so keep checking after the evaluation has failed.
+        // The unused operator table entries have no function.
+        if (!charIsNumerical(numberFormat.inputBase, c) &&
+            !(charIsOperator(c) && getOperator(c)->pFun != NULL) &&
+            !charIsBracket(c) && !charIsOther(c)) {
+            return calc_funStatus_UNKNOWN_INPUT;
+        }
+        if (status == calc_funStatus_SUCCESS) {
+            status = evalChar(pScratch, c);
+        }
+    }
+    if (status == calc_funStatus_SUCCESS && pScratch->numberLen > 0) {
+        status = evalEndNumber(pScratch);
+    }
+    if (status == calc_funStatus_SUCCESS && pScratch->expectOperand) {
+        status = calc_funStatus_SOLVE_INCOMPLETE;
+    }
+    if (status == calc_funStatus_SUCCESS) {
+        status = evalSolveBinary(pScratch, UINT8_MAX);
+    }
+    if (status == calc_funStatus_SUCCESS &&
+        (pScratch->numFrames != 0 || pScratch->numValues != 1)) {
+        // Unclosed brackets.
+        status = calc_funStatus_SOLVE_INCOMPLETE;
+    }
+    if (status == calc_funStatus_SUCCESS) {
+        *pResult = pScratch->values[0].subresult;
+    }
+    return status;
+}
+
 /**
  * @brief Function to add the syntax issue position to a pointer
  * @param pSyntaxIssuePos Pointer to syntax issue variable
@@ -1591,10 +2102,12 @@ void calc_recordSyntaxIssuePos(int16_t *pSyntaxIssuePos,
 
 /**
  * @brief Function to return the depth at the current pointer
+ * @param pCalcCoreState Pointer to the calculator state, for the counters.
  * @param pSyntaxIssuePos Pointer to syntax issue variable
  * @param numCharsWritten Number of characters that the issue is at.
  */
-int calc_findDepthOfPointer(inputListEntry_t *pCurrentListEntry) {
+int calc_findDepthOfPointer(calcCoreState_t *pCalcCoreState,
+                            inputListEntry_t *pCurrentListEntry) {
     int depth = 0;
     // Loop until the entry is NULL
     while (pCurrentListEntry != NULL) {
@@ -1620,18 +2133,24 @@ int calc_findDepthOfPointer(inputListEntry_t *pCurrentListEntry) {
             }
         }
         pCurrentListEntry = pCurrentListEntry->pPrevious;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
     }
     return depth;
 }
 
-calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
-                                  char *pResString, uint16_t stringLen,
-                                  int16_t *pSyntaxIssuePos) {
+CALC_HOT calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
+                                           char *pResString, uint16_t stringLen,
+                                           int16_t *pSyntaxIssuePos) {
 
     // Check pointer to calculator core state
     if (pCalcCoreState == NULL) {
         return calc_funStatus_CALC_CORE_STATE_NULL;
     }
+    // Check the string entry
+    if (pResString == NULL) {
+        return calc_funStatus_STRING_BUFFER_ERROR;
+    }
+
     inputListEntry_t *pCurrentListEntry = pCalcCoreState->pListEntrypoint;
 
     // Check pointer to input list
@@ -1639,11 +2158,6 @@ calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
         return calc_funStatus_INPUT_LIST_NULL;
     }
 
-    // Check the string entry
-    if (pResString == NULL) {
-        return calc_funStatus_STRING_BUFFER_ERROR;
-    }
-
     // Make a local variable of the string entry to iterate on.
     char *pString = pResString;
 
@@ -1761,7 +2275,8 @@ calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
                 // If it's an opening bracket, the previous
                 // entry must be either nothing, a comma, or an
                 // operator.
-                int depth = calc_findDepthOfPointer(pCurrentListEntry);
+                int depth =
+                    calc_findDepthOfPointer(pCalcCoreState, pCurrentListEntry);
 
                 if (pCurrentListEntry->pPrevious != NULL) {
                     if (previousInputType == INPUT_TYPE_NUMBER) {
@@ -1810,7 +2325,8 @@ calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
                     // bracket was due to a depth increasing function, or an
                     // opening bracket.
                     bool inDepthIncreasingFunction = false;
-                    int depth = calc_findDepthOfPointer(pCurrentListEntry);
+                    int depth =
+                    calc_findDepthOfPointer(pCalcCoreState, pCurrentListEntry);
                     inputListEntry_t *pTmpListEntry =
                         pCurrentListEntry->pPrevious;
                     while (pTmpListEntry != NULL) {
@@ -1834,6 +2350,7 @@ calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
                             }
                         }
                         pTmpListEntry = pTmpListEntry->pPrevious;
+                        CALC_COUNT(pCalcCoreState, numListSteps, 1);
                     }
                     if (previousInputType != INPUT_TYPE_NUMBER || depth > 0) {
                         inputListEntry_t *pTmpListEntry =
@@ -1868,11 +2385,12 @@ calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
 
         previousInputType = currentInputType;
         pCurrentListEntry = pCurrentListEntry->pNext;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
     }
     return calc_funStatus_SUCCESS;
 }
 
-uint8_t calc_getCursorLocation(calcCoreState_t *pCalcCoreState) {
+CALC_HOT uint8_t calc_getCursorLocation(calcCoreState_t *pCalcCoreState) {
     // Check pointer to calculator core state
     if (pCalcCoreState == NULL) {
         return calc_funStatus_CALC_CORE_STATE_NULL;
@@ -1887,6 +2405,7 @@ uint8_t calc_getCursorLocation(calcCoreState_t *pCalcCoreState) {
     // Get the end of the list
     while (pCurrentListEntry->pNext != NULL) {
         pCurrentListEntry = pCurrentListEntry->pNext;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
     }
 
     // Start going backwards for the length of the cursor, and
@@ -1936,6 +2455,7 @@ uint8_t calc_getCursorLocation(calcCoreState_t *pCalcCoreState) {
             numChars += 1;
         }
         pCurrentListEntry = pCurrentListEntry->pPrevious;
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
         cursorCounter++;
     }
     return numChars;
@@ -2022,6 +2542,7 @@ void calc_updateBase(calcCoreState_t *pCalcCoreState) {
                 // The previous entry was a number, set the current entry
                 // to previous entry to go backwards
                 pCurrentEntry = pCurrentEntry->pPrevious;
+                CALC_COUNT(pCalcCoreState, numListSteps, 1);
             } else {
                 // If the previous entry wasn't a number, then break here.
                 break;
@@ -2047,6 +2568,7 @@ void calc_updateBase(calcCoreState_t *pCalcCoreState) {
             pTempCharBuffer[charCount++] = pTempInputEntry->entry.c;
             // Move on to the next entry
             pTempInputEntry = pTempInputEntry->pNext;
+            CALC_COUNT(pCalcCoreState, numListSteps, 1);
             if (pTempInputEntry == NULL) {
                 break;
             }
@@ -2094,7 +2616,26 @@ void calc_updateBase(calcCoreState_t *pCalcCoreState) {
     inputListEntry_t *pStartOfNewList = NULL;
     inputListEntry_t *pNewListEntry = NULL;
     while (pTempCharBuffer[charCounter] != '\0') {
-        pNewListEntry = overloaded_malloc(sizeof(inputListEntry_t));
+        pNewListEntry = overloaded_malloc(pCalcCoreState,
+                                          sizeof(inputListEntry_t));
+        if (pNewListEntry == NULL) {
+            // Out of memory. Free the new entries made so far, and leave
+            // the number in its old base.
+            logger(LOGGER_LEVEL_ERROR, "ERROR: CONVERT Could not allocate\r\n");
+            if (pCurrentEntry->pPrevious != NULL) {
+                ((inputListEntry_t *)pCurrentEntry->pPrevious)->pNext =
+                    pCurrentEntry;
+            }
+            while (charCounter > 0) {
+                inputListEntry_t *pTmpListEntry = pStartOfNewList;
+                pStartOfNewList = pStartOfNewList->pNext;
+                CALC_COUNT(pCalcCoreState, numListSteps, 1);
+                overloaded_free(pCalcCoreState, pTmpListEntry);
+                pCalcCoreState->allocCounter--;
+                charCounter--;
+            }
+            return;
+        }
         pCalcCoreState->allocCounter++;
         if (pStartOfNewList == NULL) {
             // Save the first new list entry that we allocate
@@ -2146,7 +2687,8 @@ void calc_updateBase(calcCoreState_t *pCalcCoreState) {
         inputListEntry_t *pTmpListEntry = pCurrentEntry;
         // Move pointer to the next entry
         pCurrentEntry = pCurrentEntry->pNext;
-        overloaded_free(pTmpListEntry);
+        CALC_COUNT(pCalcCoreState, numListSteps, 1);
+        overloaded_free(pCalcCoreState, pTmpListEntry);
         pCalcCoreState->allocCounter--;
         // If the new current entry is NULL, then break
         if (pCurrentEntry == NULL) {
@@ -2187,9 +2729,11 @@ calc_funStatus_t calc_updateInputFormat(calcCoreState_t *pCalcCoreState,
     if (pCurrentListEntry != NULL) {
         inputModStatus_t listState =
             getInputListEntry(pCalcCoreState, &pCurrentListEntry);
-        // Check if the current list entry is numerical
-        if (GET_INPUT_TYPE(pCurrentListEntry->entry.typeFlag) ==
-            INPUT_TYPE_NUMBER) {
+        // Check if the current list entry is numerical. With the cursor
+        // at the start of the list there is no entry before it.
+        if (pCurrentListEntry != NULL &&
+            GET_INPUT_TYPE(pCurrentListEntry->entry.typeFlag) ==
+                INPUT_TYPE_NUMBER) {
             // Conversion at numerical input is not allowed.
             return calc_funStatus_FORMAT_ERROR;
         }
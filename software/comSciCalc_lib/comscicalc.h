@@ -29,6 +29,14 @@ SOFTWARE.
  * -------------------------------------------*/
 #define OPENING_BRACKET '('
 #define CLOSING_BRACKET ')'
+#ifndef CALC_EVAL_STACK_SIZE
+//! Depth of the value and operator stacks used by calc_evalString
+#define CALC_EVAL_STACK_SIZE 32
+#endif
+#ifndef CALC_EVAL_MAX_NUMBER_LEN
+//! Longest number, in characters, accepted by calc_evalString
+#define CALC_EVAL_MAX_NUMBER_LEN 80
+#endif
 
 /* -------------------------------------------
  * ----------------- MACROS ------------------
@@ -97,6 +105,8 @@ enum calc_funStatus {
     calc_funStatus_UNKNOWN_PARAMETER = 11,
     //! Error: Format error (format is e.g. int, float, fixed)
     calc_funStatus_FORMAT_ERROR = 12,
+    //! Warning: The solver was cancelled through pSolverCancelFun.
+    calc_funStatus_SOLVE_CANCELLED = 13,
 };
 
 /**
@@ -181,6 +191,74 @@ typedef struct inputListEntry {
     void *pFunEntry;
 } inputListEntry_t;
 
+/*
+ * CALC_ENTRY_POOL_SIZE: If defined, list entries are taken from a fixed
+ * pool of this many entries instead of the heap. The input list and the
+ * copy made while solving both take entries from the pool. Each calculator
+ * state has its own pool.
+ */
+#if defined(CALC_ENTRY_POOL_SIZE)
+//! RAM used by the fixed pool of list entries of one calculator state, in
+//! bytes.
+#define CALC_ENTRY_POOL_BYTES (CALC_ENTRY_POOL_SIZE * sizeof(inputListEntry_t))
+//! Size of the table tracking the allocated entries
+#define CALC_ALLOC_TABLE_SIZE CALC_ENTRY_POOL_SIZE
+#else
+//! List entries are allocated from the heap, so no static RAM is used.
+#define CALC_ENTRY_POOL_BYTES 0
+//! Size of the table tracking the allocated entries
+#define CALC_ALLOC_TABLE_SIZE 400
+#endif
+
+/**
+ * @brief Allocator context of a calculator state. Each calculator state
+ * owns one, so that states never share any mutable data, and can be used
+ * from different threads at the same time.
+ */
+typedef struct calcAllocator {
+    /**
+     * @param pAllocated Table of the allocated entries, used to catch
+     * frees of entries that weren't allocated. Unused slots are NULL.
+     */
+    inputListEntry_t *pAllocated[CALC_ALLOC_TABLE_SIZE];
+#if defined(CALC_ENTRY_POOL_SIZE)
+    /**
+     * @param entryPool Fixed pool that all list entries are taken from.
+     */
+    inputListEntry_t entryPool[CALC_ENTRY_POOL_SIZE];
+    /**
+     * @param pFreeEntries Stack of pointers to the free entries in the pool.
+     */
+    inputListEntry_t *pFreeEntries[CALC_ENTRY_POOL_SIZE];
+    /**
+     * @param numFreeEntries Number of free entries on the stack.
+     */
+    uint16_t numFreeEntries;
+#endif
+} calcAllocator_t;
+
+/**
+ * @brief Counters of the work done on a calculator state. They only count
+ * if the library is built with CALC_COUNTERS defined, and are otherwise
+ * left at 0, so that the firmware doesn't pay for them.
+ * @note Call calc_resetCounters before a call, to read the work of that call
+ * alone afterwards.
+ */
+typedef struct calcCounters {
+    //! Number of list entries allocated
+    uint32_t numAllocations;
+    //! Number of list entries freed
+    uint32_t numFrees;
+    //! Number of steps taken from one list entry to another
+    uint32_t numListSteps;
+    //! Number of operator functions called by the solver
+    uint32_t numOperatorCalls;
+    //! Number of list entries allocated right now. Not reset.
+    uint32_t numLiveEntries;
+    //! Most list entries allocated at once
+    uint32_t peakLiveEntries;
+} calcCounters_t;
+
 /**
  * @brief Struct holding the calculator core state.
  */
@@ -215,8 +293,95 @@ typedef struct calcCoreState {
      * @param numberFormat The current number format.
      */
     numberFormat_t numberFormat;
+
+    /**
+     * @param pSolverCancelFun Optional function polled by the solver before
+     * each expression. If it returns true, the solve is abandoned and
+     * calc_funStatus_SOLVE_CANCELLED is returned. NULL if not used.
+     */
+    bool (*pSolverCancelFun)(void *pArg);
+
+    /**
+     * @param pSolverCancelArg Argument passed to pSolverCancelFun.
+     */
+    void *pSolverCancelArg;
+
+    /**
+     * @param pCacheLookupFun Optional result cache, asked by the solver
+     * before solving. Returns true, and writes the result and status of an
+     * earlier solve, if the key and number format were solved before. NULL
+     * if not used. See result_cache.h.
+     */
+    bool (*pCacheLookupFun)(void *pArg, uint64_t key,
+                            const numberFormat_t *pNumberFormat,
+                            SUBRESULT_INT *pResult, calc_funStatus_t *pStatus);
+
+    /**
+     * @param pCacheStoreFun Called by the solver with the result and status
+     * of each solve that missed the cache. NULL if not used.
+     */
+    void (*pCacheStoreFun)(void *pArg, uint64_t key,
+                           const numberFormat_t *pNumberFormat,
+                           SUBRESULT_INT result, calc_funStatus_t status);
+
+    /**
+     * @param pCacheArg Argument passed to the cache functions.
+     */
+    void *pCacheArg;
+
+    /**
+     * @param counters Work done on this state, see calcCounters_t.
+     */
+    calcCounters_t counters;
+
+    /**
+     * @param allocator Allocator of the list entries of this state.
+     * @note The pool holds pointers into itself, so a calcCoreState_t
+     * must not be copied while it holds any entries.
+     */
+    calcAllocator_t allocator;
 } calcCoreState_t;
 
+/**
+ * @brief Entry on the operator stack of calc_evalString.
+ */
+typedef struct calcEvalFrame {
+    //! Operator of the frame, or NULL for an opening bracket.
+    const operatorEntry_t *pOp;
+    //! Index of the first argument on the value stack. Depth increasing
+    //! operators only.
+    uint8_t argStart;
+    //! Number of arguments seen so far. Depth increasing operators only.
+    uint8_t numArgs;
+} calcEvalFrame_t;
+
+/**
+ * @brief Scratch state of calc_evalString.
+ *
+ * Binary operators are solved as soon as an operator with the same or
+ * lower priority follows, which gives the same order as the solver picking
+ * the first operator with the highest priority. Brackets and depth
+ * increasing operators stay on the operator stack until closed.
+ */
+typedef struct calcEvalState {
+    //! Number format to evaluate in.
+    numberFormat_t numberFormat;
+    //! Value stack. Arguments of a function are consecutive entries.
+    inputType_t values[CALC_EVAL_STACK_SIZE];
+    //! Number of entries on the value stack.
+    uint8_t numValues;
+    //! Operator stack.
+    calcEvalFrame_t frames[CALC_EVAL_STACK_SIZE];
+    //! Number of entries on the operator stack.
+    uint8_t numFrames;
+    //! Characters of the number being read, null terminated.
+    char number[CALC_EVAL_MAX_NUMBER_LEN + 1];
+    //! Number of characters in number.
+    uint8_t numberLen;
+    //! True if the next token must be a number, bracket or function.
+    bool expectOperand;
+} calcEvalState_t;
+
 /* -------------------------------------------
  * ----------- FUNCTION PROTOTYPES -----------
  * -------------------------------------------*/
@@ -267,6 +432,26 @@ calc_funStatus_t calc_removeInput(calcCoreState_t *pCalcCoreState);
 calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
                                   char *pResString, uint16_t stringLen,
                                   int16_t *pSyntaxIssuePos);
+/**
+ * @brief Hash of the input of a calculator state.
+ *
+ * Covers the character, type and base of every entry, i.e. everything
+ * the solver reads from the input, but not the cursor or the number
+ * format. Used as the key of the result cache.
+ * @param pCalcCoreState Pointer to an allocated core state variable.
+ * @return 64 bit FNV-1a hash of the input.
+ */
+uint64_t calc_inputHash(const calcCoreState_t *pCalcCoreState);
+
+/**
+ * @brief Reset the work counters of a calculator state, e.g. before a call
+ * whose work is to be measured. The peak of live entries starts over from
+ * the entries allocated now.
+ * @param pCalcCoreState Pointer to an allocated core state variable.
+ * @return Status of the reset.
+ */
+calc_funStatus_t calc_resetCounters(calcCoreState_t *pCalcCoreState);
+
 /**
  * @brief Tries to solve the current buffer.
  *
@@ -277,6 +462,44 @@ calc_funStatus_t calc_printBuffer(calcCoreState_t *pCalcCoreState,
  */
 calc_funStatus_t calc_solver(calcCoreState_t *pCalcCoreState);
 
+/**
+ * @brief Evaluates a string without going through a calculator state.
+ *
+ * The string is tokenized and evaluated in a single pass, using fixed size
+ * stacks instead of the input list, so nothing is allocated. Operator
+ * priorities, number conversion and the returned status are the same as
+ * for adding the string with calc_addInput and calling calc_solver. Input
+ * which the solver only accepts by accident, such as an operator left
+ * dangling inside brackets, is reported as calc_funStatus_SOLVE_INCOMPLETE.
+ * @param pString Pointer to the input. Doesn't need to be null terminated.
+ * @param length Number of characters in the input.
+ * @param numberFormat Number format to evaluate in, incl. the input base.
+ * @param pResult Pointer to where the result is written on success.
+ * @return Status of the evaluation. calc_funStatus_ALLOCATE_ERROR if the
+ * input nests deeper than CALC_EVAL_STACK_SIZE or has a number longer than
+ * CALC_EVAL_MAX_NUMBER_LEN.
+ */
+calc_funStatus_t calc_evalString(const char *pString, size_t length,
+                                 numberFormat_t numberFormat,
+                                 SUBRESULT_INT *pResult);
+
+/**
+ * @brief Same as calc_evalString, but with caller provided scratch state.
+ *
+ * Lets callers that evaluate many strings, e.g. one worker thread each,
+ * keep the scratch state in memory of their own instead of on the stack.
+ * @param pScratch Pointer to the scratch state. Not shared between threads.
+ * @param pString Pointer to the input. Doesn't need to be null terminated.
+ * @param length Number of characters in the input.
+ * @param numberFormat Number format to evaluate in, incl. the input base.
+ * @param pResult Pointer to where the result is written on success.
+ * @return Status of the evaluation, see calc_evalString.
+ */
+calc_funStatus_t calc_evalStringScratch(calcEvalState_t *pScratch,
+                                        const char *pString, size_t length,
+                                        numberFormat_t numberFormat,
+                                        SUBRESULT_INT *pResult);
+
 /**
  * @brief Get the offset from the end of the buffer.
  *
@@ -31,6 +31,19 @@ SOFTWARE.
 //! Maximum length of the operator string
 #define OPERATOR_STRING_MAX_LEN 10
 
+/**
+ * @brief Placement of the keystroke and solve hot path.
+ * On the RP2040 code normally executes from QSPI flash through the XIP cache,
+ * which is shared with FreeRTOS and the pico SDK. With CALC_HOT_IN_SRAM, the
+ * functions marked CALC_HOT are copied to SRAM at boot instead, the same way
+ * as the SDK's __not_in_flash_func. This is a no-op on other builds.
+ */
+#if defined(RP2040) && defined(CALC_HOT_IN_SRAM)
+#define CALC_HOT __attribute__((section(".time_critical.comscicalc")))
+#else
+#define CALC_HOT
+#endif
+
 /**
  * @defgroup entryFlagDefs Defines for entry flags
  * @{
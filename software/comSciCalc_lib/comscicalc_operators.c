@@ -233,8 +233,9 @@ const operatorEntry_t operators[NUM_OPERATORS] = {
      .numArgs = 0,
      .pFun = NULL}};
 
-SUBRESULT_INT promoteOrder(SUBRESULT_INT subresult, uint8_t currentOrder,
-                           uint8_t higherOrder, numberFormat_t numberFormat) {
+CALC_HOT SUBRESULT_INT promoteOrder(SUBRESULT_INT subresult,
+                                    uint8_t currentOrder, uint8_t higherOrder,
+                                    numberFormat_t numberFormat) {
     SUBRESULT_INT result = subresult;
     if (higherOrder == INPUT_FMT_FLOAT) {
         if (currentOrder == INPUT_FMT_INT) {
@@ -311,8 +312,8 @@ SUBRESULT_INT promoteOrder(SUBRESULT_INT subresult, uint8_t currentOrder,
  * @param numberFormat Global number format.
  * @return The format that all arguments have been promoted to.
  */
-uint8_t processInputArgs(inputType_t *pArgs, uint8_t numArgs,
-                         numberFormat_t numberFormat) {
+CALC_HOT uint8_t processInputArgs(inputType_t *pArgs, uint8_t numArgs,
+                                  numberFormat_t numberFormat) {
     // First, go through all arguments and find the higest order
     // format.
     uint8_t higestOrderFormat = INPUT_FMT_INT;
@@ -338,8 +339,8 @@ uint8_t processInputArgs(inputType_t *pArgs, uint8_t numArgs,
 /* ------ CALCULATOR OPERATOR FUNCTIONS ------ */
 
 // Calculator operator functions to be used in "operators" table
-int8_t calc_add(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_add(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                         int num_args, inputType_t *pArgs) {
 
     // Only expecting two variable arguments here
     if (num_args != 2) {
@@ -388,8 +389,9 @@ int8_t calc_add(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_subtract(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                     int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_subtract(SUBRESULT_INT *pResult,
+                              numberFormat_t numberFormat, int num_args,
+                              inputType_t *pArgs) {
     // Only expecting two variable arguments here
     if (num_args != 2) {
         return incorrect_args;
@@ -420,8 +422,9 @@ int8_t calc_subtract(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_multiply(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                     int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_multiply(SUBRESULT_INT *pResult,
+                              numberFormat_t numberFormat, int num_args,
+                              inputType_t *pArgs) {
     // Only expecting two variable arguments here
     if (num_args != 2) {
         return incorrect_args;
@@ -480,8 +483,8 @@ int8_t calc_multiply(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_divide(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                   int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_divide(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                            int num_args, inputType_t *pArgs) {
     // Only expecting two variable arguments here
     if (num_args != 2) {
         return incorrect_args;
@@ -513,8 +516,8 @@ int8_t calc_divide(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_and(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_and(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                         int num_args, inputType_t *pArgs) {
     if (pArgs == NULL) {
         return incorrect_args;
     }
@@ -532,8 +535,8 @@ int8_t calc_and(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_nand(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                 int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_nand(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                          int num_args, inputType_t *pArgs) {
     // NAND is a bit special. If it's treated as NOT(AND(a,b)), the NOT
     // will invert all the bits.
     // In general, we'd want to count the number of bits going in, based off the
@@ -577,8 +580,8 @@ int8_t calc_nand(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_or(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-               int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_or(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                        int num_args, inputType_t *pArgs) {
     if (pArgs == NULL) {
         return incorrect_args;
     }
@@ -596,8 +599,8 @@ int8_t calc_or(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_xor(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_xor(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                         int num_args, inputType_t *pArgs) {
     if (pArgs == NULL) {
         return incorrect_args;
     }
@@ -615,8 +618,8 @@ int8_t calc_xor(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_not(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_not(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                         int num_args, inputType_t *pArgs) {
     // Only expecting one variable arguments here
     if (num_args != 1) {
         return incorrect_args;
@@ -645,18 +648,20 @@ int8_t calc_not(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
     return function_solved;
 }
 
-int8_t calc_leftshift(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                      int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_leftshift(SUBRESULT_INT *pResult,
+                               numberFormat_t numberFormat, int num_args,
+                               inputType_t *pArgs) {
     return function_solved;
 }
 
-int8_t calc_rightshift(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                       int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_rightshift(SUBRESULT_INT *pResult,
+                                numberFormat_t numberFormat, int num_args,
+                                inputType_t *pArgs) {
     return function_solved;
 }
 
-int8_t calc_sum(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
-                int num_args, inputType_t *pArgs) {
+CALC_HOT int8_t calc_sum(SUBRESULT_INT *pResult, numberFormat_t numberFormat,
+                         int num_args, inputType_t *pArgs) {
 
     if (pArgs == NULL) {
         return incorrect_args;
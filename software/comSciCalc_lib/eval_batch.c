@@ -0,0 +1,320 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Batch evaluation on a work-stealing thread pool. See eval_batch.h.
+ *
+ * Each worker owns a range [next, end) of the expressions, guarded by a
+ * lock of its own. The owner takes EVAL_BATCH_CHUNK expressions at a time
+ * from the front, and thieves take the back half, so the lock is almost
+ * never contended.
+ *
+ * The worker threads are started by calc_evalPoolInit and sleep on the
+ * start condition between batches, so a batch doesn't pay for starting
+ * and joining threads.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "eval_batch.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Size of a cache line, workers are aligned to this to not share lines
+#define EVAL_BATCH_CACHE_LINE 64
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief One worker of the pool.
+ */
+typedef struct batchWorker {
+    //! Lock guarding next and end
+    pthread_mutex_t lock;
+    //! Next expression the worker will evaluate
+    size_t next;
+    //! One past the last expression of the worker
+    size_t end;
+    //! Scratch state of the evaluator, only used by this worker
+    calcEvalState_t scratch;
+    //! Pool the worker belongs to
+    calcEvalPool_t *pPool;
+    //! Index of the worker in the pool
+    uint16_t idx;
+    //! Thread running the worker. Not used for worker 0.
+    pthread_t thread;
+} __attribute__((aligned(EVAL_BATCH_CACHE_LINE))) batchWorker_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Take the next chunk from the range of a worker.
+ * @param pWorker Pointer to the worker.
+ * @param pStart Pointer to where the start of the chunk is written.
+ * @param pEnd Pointer to where the end of the chunk is written.
+ * @return True if a chunk was taken, false if the range is empty.
+ */
+static bool takeOwn(batchWorker_t *pWorker, size_t *pStart, size_t *pEnd) {
+    bool taken = false;
+    pthread_mutex_lock(&pWorker->lock);
+    if (pWorker->next < pWorker->end) {
+        *pStart = pWorker->next;
+        *pEnd = pWorker->end - pWorker->next > EVAL_BATCH_CHUNK
+                    ? pWorker->next + EVAL_BATCH_CHUNK
+                    : pWorker->end;
+        pWorker->next = *pEnd;
+        taken = true;
+    }
+    pthread_mutex_unlock(&pWorker->lock);
+    return taken;
+}
+
+/**
+ * @brief Steal the back half of the range of another worker.
+ *
+ * The stolen range becomes the range of the thief, so it can in turn be
+ * stolen from.
+ * @param pWorker Pointer to the thief, which must have an empty range.
+ * @return True if anything was stolen, false if all ranges are empty.
+ */
+static bool steal(batchWorker_t *pWorker) {
+    calcEvalPool_t *pPool = pWorker->pPool;
+    for (uint16_t i = 1; i < pPool->numWorkers; i++) {
+        batchWorker_t *pVictim =
+            &pPool->pWorkers[(pWorker->idx + i) % pPool->numWorkers];
+        size_t start = 0;
+        size_t end = 0;
+        pthread_mutex_lock(&pVictim->lock);
+        if (pVictim->next < pVictim->end) {
+            size_t half = (pVictim->end - pVictim->next + 1) / 2;
+            end = pVictim->end;
+            start = end - half;
+            pVictim->end = start;
+        }
+        pthread_mutex_unlock(&pVictim->lock);
+        if (start != end) {
+            pthread_mutex_lock(&pWorker->lock);
+            pWorker->next = start;
+            pWorker->end = end;
+            pthread_mutex_unlock(&pWorker->lock);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Evaluate expressions of the current batch until there are none
+ * left.
+ * @param pWorker Pointer to the worker.
+ */
+static void evalBatchRanges(batchWorker_t *pWorker) {
+    calcEvalPool_t *pPool = pWorker->pPool;
+    size_t start;
+    size_t end;
+    while (true) {
+        if (!takeOwn(pWorker, &start, &end)) {
+            if (!steal(pWorker)) {
+                break;
+            }
+            // Take a chunk of the stolen range on the next lap.
+            continue;
+        }
+        for (size_t i = start; i < end; i++) {
+            pPool->pResults[i] = 0;
+            pPool->pStatuses[i] = calc_evalStringScratch(
+                &pWorker->scratch, pPool->pExprs[i].pString,
+                pPool->pExprs[i].length, pPool->numberFormat,
+                &pPool->pResults[i]);
+        }
+    }
+}
+
+/**
+ * @brief Worker thread. Waits for a batch to be started, evaluates it
+ * together with the other workers, and waits for the next one.
+ * @param pArg Pointer to the batchWorker_t
+ * @return NULL
+ */
+static void *batchWorkerThread(void *pArg) {
+    batchWorker_t *pWorker = (batchWorker_t *)pArg;
+    calcEvalPool_t *pPool = pWorker->pPool;
+    uint64_t lastBatchNum = 0;
+    pthread_mutex_lock(&pPool->lock);
+    while (true) {
+        while (!pPool->stop && pPool->batchNum == lastBatchNum) {
+            pthread_cond_wait(&pPool->startCond, &pPool->lock);
+        }
+        if (pPool->stop) {
+            break;
+        }
+        lastBatchNum = pPool->batchNum;
+        pthread_mutex_unlock(&pPool->lock);
+
+        evalBatchRanges(pWorker);
+
+        pthread_mutex_lock(&pPool->lock);
+        if (--pPool->numBusy == 0) {
+            pthread_cond_signal(&pPool->doneCond);
+        }
+    }
+    pthread_mutex_unlock(&pPool->lock);
+    return NULL;
+}
+
+/**
+ * @brief Stop and join the worker threads 1 to numWorkers - 1.
+ * @param pPool Pointer to the pool.
+ */
+static void stopWorkerThreads(calcEvalPool_t *pPool) {
+    pthread_mutex_lock(&pPool->lock);
+    pPool->stop = true;
+    pthread_cond_broadcast(&pPool->startCond);
+    pthread_mutex_unlock(&pPool->lock);
+    for (uint16_t i = 1; i < pPool->numWorkers; i++) {
+        pthread_join(pPool->pWorkers[i].thread, NULL);
+    }
+}
+
+calc_funStatus_t calc_evalPoolInit(calcEvalPool_t *pPool,
+                                   uint16_t numThreads) {
+    if (numThreads == 0) {
+        long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+        numThreads = numCpus > 0 ? (uint16_t)numCpus : 1;
+    }
+    if (numThreads > EVAL_BATCH_MAX_THREADS) {
+        numThreads = EVAL_BATCH_MAX_THREADS;
+    }
+
+    memset(pPool, 0, sizeof(calcEvalPool_t));
+    if (posix_memalign((void **)&pPool->pWorkers, EVAL_BATCH_CACHE_LINE,
+                       numThreads * sizeof(batchWorker_t)) != 0) {
+        pPool->pWorkers = NULL;
+        return calc_funStatus_ALLOCATE_ERROR;
+    }
+    pthread_mutex_init(&pPool->lock, NULL);
+    pthread_mutex_init(&pPool->batchLock, NULL);
+    pthread_cond_init(&pPool->startCond, NULL);
+    pthread_cond_init(&pPool->doneCond, NULL);
+    for (uint16_t i = 0; i < numThreads; i++) {
+        batchWorker_t *pWorker = &pPool->pWorkers[i];
+        pthread_mutex_init(&pWorker->lock, NULL);
+        pWorker->next = 0;
+        pWorker->end = 0;
+        pWorker->pPool = pPool;
+        pWorker->idx = i;
+    }
+    // The calling thread is worker 0. If a thread can't be started, the
+    // pool makes do with the workers started so far.
+    pPool->numWorkers = 1;
+    for (uint16_t i = 1; i < numThreads; i++) {
+        if (pthread_create(&pPool->pWorkers[i].thread, NULL,
+                           batchWorkerThread, &pPool->pWorkers[i]) != 0) {
+            break;
+        }
+        pPool->numWorkers++;
+    }
+    for (uint16_t i = pPool->numWorkers; i < numThreads; i++) {
+        pthread_mutex_destroy(&pPool->pWorkers[i].lock);
+    }
+    return calc_funStatus_SUCCESS;
+}
+
+void calc_evalPoolFree(calcEvalPool_t *pPool) {
+    if (pPool->pWorkers == NULL) {
+        return;
+    }
+    stopWorkerThreads(pPool);
+    for (uint16_t i = 0; i < pPool->numWorkers; i++) {
+        pthread_mutex_destroy(&pPool->pWorkers[i].lock);
+    }
+    pthread_cond_destroy(&pPool->doneCond);
+    pthread_cond_destroy(&pPool->startCond);
+    pthread_mutex_destroy(&pPool->batchLock);
+    pthread_mutex_destroy(&pPool->lock);
+    free(pPool->pWorkers);
+    pPool->pWorkers = NULL;
+    pPool->numWorkers = 0;
+}
+
+calc_funStatus_t calc_evalBatch(calcEvalPool_t *pPool,
+                                const calcExprSpan_t *pExprs, size_t numExprs,
+                                numberFormat_t numberFormat,
+                                SUBRESULT_INT *pResults,
+                                calc_funStatus_t *pStatuses) {
+    if (pPool == NULL || pPool->pWorkers == NULL) {
+        return calc_funStatus_UNKNOWN_PARAMETER;
+    }
+    if (numExprs == 0) {
+        return calc_funStatus_SUCCESS;
+    }
+    if (pExprs == NULL) {
+        return calc_funStatus_INPUT_LIST_NULL;
+    }
+    if (pResults == NULL || pStatuses == NULL) {
+        return calc_funStatus_UNKNOWN_PARAMETER;
+    }
+
+    pthread_mutex_lock(&pPool->batchLock);
+    // No point in more workers than chunks. The rest are left idle.
+    size_t numChunks = (numExprs + EVAL_BATCH_CHUNK - 1) / EVAL_BATCH_CHUNK;
+    uint16_t numActive = pPool->numWorkers;
+    if (numActive > numChunks) {
+        numActive = (uint16_t)numChunks;
+    }
+    // Split the expressions evenly. The worker threads are asleep, and
+    // see these once woken up under the pool lock.
+    pPool->pExprs = pExprs;
+    pPool->pResults = pResults;
+    pPool->pStatuses = pStatuses;
+    pPool->numberFormat = numberFormat;
+    for (uint16_t i = 0; i < pPool->numWorkers; i++) {
+        batchWorker_t *pWorker = &pPool->pWorkers[i];
+        pWorker->next = i < numActive ? numExprs * i / numActive : 0;
+        pWorker->end = i < numActive ? numExprs * (i + 1) / numActive : 0;
+    }
+
+    if (numActive > 1) {
+        pthread_mutex_lock(&pPool->lock);
+        pPool->numBusy = pPool->numWorkers - 1;
+        pPool->batchNum++;
+        pthread_cond_broadcast(&pPool->startCond);
+        pthread_mutex_unlock(&pPool->lock);
+    }
+    evalBatchRanges(&pPool->pWorkers[0]);
+    if (numActive > 1) {
+        pthread_mutex_lock(&pPool->lock);
+        while (pPool->numBusy > 0) {
+            pthread_cond_wait(&pPool->doneCond, &pPool->lock);
+        }
+        pthread_mutex_unlock(&pPool->lock);
+    }
+    pthread_mutex_unlock(&pPool->batchLock);
+    return calc_funStatus_SUCCESS;
+}
@@ -0,0 +1,143 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef EVAL_BATCH_H_
+#define EVAL_BATCH_H_
+
+/*
+ * Evaluation of large arrays of independent expressions, spread over a
+ * pool of worker threads. The pool is started once and reused for every
+ * batch. Uses POSIX threads, so host builds only.
+ */
+
+// Standard library
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Calculator core
+#include "comscicalc.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Number of expressions a worker takes from its own range at a time
+#define EVAL_BATCH_CHUNK 64
+
+//! Maximum number of worker threads, incl. the calling thread
+#define EVAL_BATCH_MAX_THREADS 64
+
+/**
+ * @brief One expression of a batch.
+ *
+ * The expression doesn't need to be null terminated, so spans can point
+ * straight into a larger buffer, e.g. a file with one expression per line.
+ */
+typedef struct calcExprSpan {
+    //! Pointer to the first character of the expression
+    const char *pString;
+    //! Number of characters in the expression
+    size_t length;
+} calcExprSpan_t;
+
+struct batchWorker;
+
+/**
+ * @brief A pool of workers that batches are evaluated on.
+ */
+typedef struct calcEvalPool {
+    //! Workers, aligned to cache lines. Worker 0 is the calling thread.
+    struct batchWorker *pWorkers;
+    uint16_t numWorkers;
+    //! Lock guarding the fields below, and the condition variables
+    pthread_mutex_t lock;
+    //! Signalled when a batch is started, or the pool is freed
+    pthread_cond_t startCond;
+    //! Signalled when the last worker thread is done with a batch
+    pthread_cond_t doneCond;
+    //! Number of the current batch, bumped to start the worker threads
+    uint64_t batchNum;
+    //! Number of worker threads still evaluating the current batch
+    uint16_t numBusy;
+    //! Set to stop the worker threads
+    bool stop;
+    //! Lock serializing batches from different threads
+    pthread_mutex_t batchLock;
+    //! Expressions, results and statuses of the current batch
+    const calcExprSpan_t *pExprs;
+    SUBRESULT_INT *pResults;
+    calc_funStatus_t *pStatuses;
+    numberFormat_t numberFormat;
+} calcEvalPool_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Initialize a pool and start its worker threads.
+ * @param pPool Pointer to the pool.
+ * @param numThreads Number of workers, incl. the thread calling
+ * calc_evalBatch, or 0 for one per online CPU. Limited to
+ * EVAL_BATCH_MAX_THREADS.
+ * @return calc_funStatus_ALLOCATE_ERROR if the workers couldn't be
+ * allocated, otherwise success. If some threads couldn't be started, the
+ * pool runs with the ones that could.
+ */
+calc_funStatus_t calc_evalPoolInit(calcEvalPool_t *pPool,
+                                   uint16_t numThreads);
+
+/**
+ * @brief Stop the worker threads of a pool and free it. No batch may be
+ * running on it.
+ * @param pPool Pointer to the pool.
+ */
+void calc_evalPoolFree(calcEvalPool_t *pPool);
+
+/**
+ * @brief Evaluate an array of expressions on a work-stealing thread pool.
+ *
+ * The expressions are split evenly between the workers. A worker that
+ * runs out of expressions steals the back half of the remaining range of
+ * another worker, so a few slow expressions don't leave the other workers
+ * idle. Each worker keeps its own calc_evalStringScratch state, and the
+ * calling thread is one of the workers. Batches on the same pool from
+ * different threads are evaluated one at a time.
+ * @param pPool Pointer to the pool, from calc_evalPoolInit.
+ * @param pExprs Pointer to the expressions.
+ * @param numExprs Number of expressions.
+ * @param numberFormat Number format to evaluate all expressions in.
+ * @param pResults Pointer to numExprs results. Results of expressions
+ * that failed are set to 0.
+ * @param pStatuses Pointer to numExprs statuses, as from calc_evalString.
+ * @return calc_funStatus_INPUT_LIST_NULL if there are expressions but
+ * pExprs is NULL, calc_funStatus_UNKNOWN_PARAMETER if another pointer is
+ * missing, otherwise success. The status of each expression is written to
+ * pStatuses.
+ */
+calc_funStatus_t calc_evalBatch(calcEvalPool_t *pPool,
+                                const calcExprSpan_t *pExprs, size_t numExprs,
+                                numberFormat_t numberFormat,
+                                SUBRESULT_INT *pResults,
+                                calc_funStatus_t *pStatuses);
+
+#endif /* EVAL_BATCH_H_ */
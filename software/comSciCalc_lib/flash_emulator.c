@@ -0,0 +1,151 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * File backed NOR flash emulator. See flash_emulator.h.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <string.h>
+
+#include "flash_emulator.h"
+
+/* ------------- FUNCTION DEFINITIONS ------------- */
+
+/**
+ * @brief Check that an access is inside the flash and aligned.
+ * @param pDevice Pointer to the flash device.
+ * @param addr Address of the access.
+ * @param len Length of the access.
+ * @param align Required alignment of address and length.
+ * @return True if the access is valid.
+ */
+static bool accessIsValid(const flashDevice_t *pDevice, uint32_t addr,
+                          uint32_t len, uint32_t align) {
+    uint32_t size = pDevice->numSectors * pDevice->sectorSize;
+    return (addr % align == 0) && (len % align == 0) && (addr <= size) &&
+           (len <= size - addr);
+}
+
+static bool emulatorRead(void *pCtx, uint32_t addr, void *pBuf,
+                         uint32_t len) {
+    flashEmulator_t *pEmulator = pCtx;
+    if (!accessIsValid(&pEmulator->device, addr, len, 1)) {
+        return false;
+    }
+    if (fseek(pEmulator->pFile, addr, SEEK_SET) != 0) {
+        return false;
+    }
+    return fread(pBuf, 1, len, pEmulator->pFile) == len;
+}
+
+static bool emulatorProgram(void *pCtx, uint32_t addr, const void *pBuf,
+                            uint32_t len) {
+    flashEmulator_t *pEmulator = pCtx;
+    uint32_t pageSize = pEmulator->device.pageSize;
+    if (!accessIsValid(&pEmulator->device, addr, len, pageSize)) {
+        return false;
+    }
+    const uint8_t *pData = pBuf;
+    uint8_t page[FLASH_LOG_MAX_SLOT_SIZE];
+    if (pageSize > sizeof(page)) {
+        return false;
+    }
+    for (uint32_t offset = 0; offset < len; offset += pageSize) {
+        if (!emulatorRead(pCtx, addr + offset, page, pageSize)) {
+            return false;
+        }
+        // NOR flash can only clear bits
+        for (uint32_t i = 0; i < pageSize; i++) {
+            page[i] &= pData[offset + i];
+        }
+        if (fseek(pEmulator->pFile, addr + offset, SEEK_SET) != 0 ||
+            fwrite(page, 1, pageSize, pEmulator->pFile) != pageSize) {
+            return false;
+        }
+    }
+    pEmulator->programCount++;
+    return fflush(pEmulator->pFile) == 0;
+}
+
+static bool emulatorErase(void *pCtx, uint32_t addr) {
+    flashEmulator_t *pEmulator = pCtx;
+    uint32_t sectorSize = pEmulator->device.sectorSize;
+    if (!accessIsValid(&pEmulator->device, addr, sectorSize, sectorSize)) {
+        return false;
+    }
+    if (fseek(pEmulator->pFile, addr, SEEK_SET) != 0) {
+        return false;
+    }
+    for (uint32_t i = 0; i < sectorSize; i++) {
+        if (fputc(0xFF, pEmulator->pFile) == EOF) {
+            return false;
+        }
+    }
+    pEmulator->eraseCount[addr / sectorSize]++;
+    return fflush(pEmulator->pFile) == 0;
+}
+
+bool flashEmulator_open(flashEmulator_t *pEmulator, const char *pPath,
+                        uint32_t numSectors, uint32_t sectorSize,
+                        uint32_t pageSize) {
+    if (pEmulator == NULL || pPath == NULL ||
+        numSectors > FLASH_EMULATOR_MAX_SECTORS || pageSize == 0 ||
+        sectorSize % pageSize != 0) {
+        return false;
+    }
+    memset(pEmulator, 0, sizeof(flashEmulator_t));
+    pEmulator->device.sectorSize = sectorSize;
+    pEmulator->device.pageSize = pageSize;
+    pEmulator->device.numSectors = numSectors;
+    pEmulator->device.pRead = emulatorRead;
+    pEmulator->device.pProgram = emulatorProgram;
+    pEmulator->device.pErase = emulatorErase;
+    pEmulator->device.pCtx = pEmulator;
+
+    pEmulator->pFile = fopen(pPath, "r+b");
+    if (pEmulator->pFile != NULL) {
+        return true;
+    }
+    // New flash, starts out erased.
+    pEmulator->pFile = fopen(pPath, "w+b");
+    if (pEmulator->pFile == NULL) {
+        return false;
+    }
+    for (uint32_t i = 0; i < numSectors * sectorSize; i++) {
+        if (fputc(0xFF, pEmulator->pFile) == EOF) {
+            flashEmulator_close(pEmulator);
+            return false;
+        }
+    }
+    return fflush(pEmulator->pFile) == 0;
+}
+
+void flashEmulator_close(flashEmulator_t *pEmulator) {
+    if (pEmulator != NULL && pEmulator->pFile != NULL) {
+        fclose(pEmulator->pFile);
+        pEmulator->pFile = NULL;
+    }
+}
@@ -0,0 +1,85 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef FLASH_EMULATOR_H_
+#define FLASH_EMULATOR_H_
+
+/*
+ * File backed NOR flash emulator for the host, used to test the flash log
+ * without hardware. Programming can only clear bits, erasing sets a whole
+ * sector to 0xFF, and operations must be page/sector aligned, like on the
+ * RP2040. The number of erases of each sector is counted.
+ */
+
+// Standard library
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "flash_log.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Maximum number of emulated sectors
+#define FLASH_EMULATOR_MAX_SECTORS 64
+
+/**
+ * @brief State of the flash emulator
+ */
+typedef struct flashEmulator {
+    //! Backing file
+    FILE *pFile;
+    //! Flash device, pointing to this emulator
+    flashDevice_t device;
+    //! Number of erases per sector
+    uint32_t eraseCount[FLASH_EMULATOR_MAX_SECTORS];
+    //! Number of program operations
+    uint32_t programCount;
+} flashEmulator_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Open an emulated flash backed by a file.
+ *
+ * If the file doesn't exist, it's created as erased flash. Otherwise, the
+ * content is kept, which emulates a power cycle.
+ * @param pEmulator Pointer to the emulator state.
+ * @param pPath Path to the backing file.
+ * @param numSectors Number of sectors.
+ * @param sectorSize Size of a sector, in bytes.
+ * @param pageSize Size of a program page, in bytes.
+ * @return False if the file could not be opened.
+ */
+bool flashEmulator_open(flashEmulator_t *pEmulator, const char *pPath,
+                        uint32_t numSectors, uint32_t sectorSize,
+                        uint32_t pageSize);
+
+/**
+ * @brief Close an emulated flash. The backing file is kept.
+ * @param pEmulator Pointer to the emulator state.
+ */
+void flashEmulator_close(flashEmulator_t *pEmulator);
+
+#endif /* FLASH_EMULATOR_H_ */
@@ -0,0 +1,291 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Wear levelled log of fixed size records in NOR flash.
+ * See flash_log.h.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <stddef.h>
+#include <string.h>
+
+#include "flash_log.h"
+
+/* ----------------- DEFINES ----------------- */
+//! Magic of a sector header
+#define SECTOR_MAGIC 0x43534C47
+//! Magic of a slot header
+#define SLOT_MAGIC 0xA55A
+//! Value of erased flash
+#define ERASED_WORD 0xFFFFFFFF
+
+/**
+ * @brief Header at the start of each sector
+ */
+typedef struct sectorHeader {
+    //! SECTOR_MAGIC
+    uint32_t magic;
+    //! Incremented for every sector taken into use
+    uint32_t sequence;
+} sectorHeader_t;
+
+/**
+ * @brief Header at the start of each slot
+ */
+typedef struct slotHeader {
+    //! SLOT_MAGIC. An erased slot reads 0xFFFF here.
+    uint16_t magic;
+    //! Size of the record
+    uint16_t size;
+    //! CRC32 of the record
+    uint32_t crc;
+} slotHeader_t;
+
+/* ------------- FUNCTION DEFINITIONS ------------- */
+
+/**
+ * @brief Calculate the CRC32 (IEEE 802.3) of a buffer.
+ * @param pBuf Pointer to the buffer.
+ * @param len Length of the buffer.
+ * @return The CRC.
+ */
+static uint32_t crc32(const uint8_t *pBuf, uint32_t len) {
+    uint32_t crc = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= pBuf[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Round up to a multiple of the page size.
+ * @param pDevice Pointer to the flash device.
+ * @param size Size to round up.
+ * @return Rounded up size.
+ */
+static uint32_t roundToPage(const flashDevice_t *pDevice, uint32_t size) {
+    return ((size + pDevice->pageSize - 1) / pDevice->pageSize) *
+           pDevice->pageSize;
+}
+
+/**
+ * @brief Get the address of a slot.
+ * @param pLog Pointer to the log state.
+ * @param sector Sector index.
+ * @param slot Slot index.
+ * @return Address of the slot.
+ */
+static uint32_t slotAddress(const flashLog_t *pLog, uint32_t sector,
+                            uint32_t slot) {
+    // The sector header takes up the first page
+    return sector * pLog->pDevice->sectorSize + pLog->pDevice->pageSize +
+           slot * pLog->slotSize;
+}
+
+/**
+ * @brief Check if a slot is unwritten.
+ * @param pLog Pointer to the log state.
+ * @param sector Sector index.
+ * @param slot Slot index.
+ * @param pErased Set to true if the slot is erased.
+ * @return False if the read failed.
+ */
+static bool slotIsErased(const flashLog_t *pLog, uint32_t sector,
+                         uint32_t slot, bool *pErased) {
+    uint32_t word;
+    const flashDevice_t *pDevice = pLog->pDevice;
+    if (!pDevice->pRead(pDevice->pCtx, slotAddress(pLog, sector, slot), &word,
+                        sizeof(word))) {
+        return false;
+    }
+    *pErased = (word == ERASED_WORD);
+    return true;
+}
+
+/**
+ * @brief Read and check a slot.
+ * @param pLog Pointer to the log state.
+ * @param sector Sector index.
+ * @param slot Slot index.
+ * @param pRecord Pointer to where the record is written.
+ * @return True if the slot holds a valid record.
+ */
+static bool readSlot(const flashLog_t *pLog, uint32_t sector, uint32_t slot,
+                     void *pRecord) {
+    const flashDevice_t *pDevice = pLog->pDevice;
+    uint32_t addr = slotAddress(pLog, sector, slot);
+    slotHeader_t header;
+    if (!pDevice->pRead(pDevice->pCtx, addr, &header, sizeof(header))) {
+        return false;
+    }
+    if (header.magic != SLOT_MAGIC || header.size != pLog->recordSize) {
+        return false;
+    }
+    if (!pDevice->pRead(pDevice->pCtx, addr + sizeof(header), pRecord,
+                        pLog->recordSize)) {
+        return false;
+    }
+    return crc32(pRecord, pLog->recordSize) == header.crc;
+}
+
+bool flashLog_init(flashLog_t *pLog, const flashDevice_t *pDevice,
+                   uint32_t recordSize) {
+    if (pLog == NULL || pDevice == NULL || pDevice->numSectors < 2) {
+        return false;
+    }
+    pLog->pDevice = pDevice;
+    pLog->recordSize = recordSize;
+    pLog->slotSize = roundToPage(pDevice, sizeof(slotHeader_t) + recordSize);
+    if (pLog->slotSize > FLASH_LOG_MAX_SLOT_SIZE ||
+        pLog->slotSize + pDevice->pageSize > pDevice->sectorSize) {
+        return false;
+    }
+    pLog->slotsPerSector =
+        (pDevice->sectorSize - pDevice->pageSize) / pLog->slotSize;
+    pLog->activeSector = -1;
+    pLog->sequence = 0;
+    pLog->nextSlot = 0;
+
+    // Find the newest sector from the headers
+    for (uint32_t sector = 0; sector < pDevice->numSectors; sector++) {
+        sectorHeader_t header;
+        if (!pDevice->pRead(pDevice->pCtx, sector * pDevice->sectorSize,
+                            &header, sizeof(header))) {
+            return false;
+        }
+        if (header.magic != SECTOR_MAGIC) {
+            continue;
+        }
+        // Compare as a difference to handle the sequence wrapping.
+        if (pLog->activeSector < 0 ||
+            (int32_t)(header.sequence - pLog->sequence) > 0) {
+            pLog->activeSector = sector;
+            pLog->sequence = header.sequence;
+        }
+    }
+    if (pLog->activeSector < 0) {
+        // Empty log
+        return true;
+    }
+
+    // Slots are written in order, so binary search for the first free one.
+    uint32_t low = 0;
+    uint32_t high = pLog->slotsPerSector;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        bool erased;
+        if (!slotIsErased(pLog, pLog->activeSector, mid, &erased)) {
+            return false;
+        }
+        if (erased) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    pLog->nextSlot = low;
+    return true;
+}
+
+bool flashLog_read(flashLog_t *pLog, void *pRecord) {
+    if (pLog == NULL || pRecord == NULL || pLog->activeSector < 0) {
+        return false;
+    }
+    // Walk back from the latest record, over at most the active sector and
+    // the one before it.
+    uint32_t sector = pLog->activeSector;
+    uint32_t slot = pLog->nextSlot;
+    for (uint8_t i = 0; i < 2; i++) {
+        while (slot > 0) {
+            slot--;
+            if (readSlot(pLog, sector, slot, pRecord)) {
+                return true;
+            }
+        }
+        // Move on to the previous sector, if it's the one before this.
+        uint32_t numSectors = pLog->pDevice->numSectors;
+        sector = (sector + numSectors - 1) % numSectors;
+        sectorHeader_t header;
+        if (!pLog->pDevice->pRead(pLog->pDevice->pCtx,
+                                  sector * pLog->pDevice->sectorSize, &header,
+                                  sizeof(header)) ||
+            header.magic != SECTOR_MAGIC ||
+            header.sequence != pLog->sequence - 1) {
+            break;
+        }
+        slot = pLog->slotsPerSector;
+    }
+    return false;
+}
+
+bool flashLog_append(flashLog_t *pLog, const void *pRecord) {
+    if (pLog == NULL || pRecord == NULL) {
+        return false;
+    }
+    const flashDevice_t *pDevice = pLog->pDevice;
+    uint8_t buf[FLASH_LOG_MAX_SLOT_SIZE];
+
+    if (pLog->activeSector < 0 || pLog->nextSlot >= pLog->slotsPerSector) {
+        // Take the next sector into use. This is the only erase, and it
+        // goes round robin over all the sectors.
+        uint32_t sector = 0;
+        uint32_t sequence = 0;
+        if (pLog->activeSector >= 0) {
+            sector = (pLog->activeSector + 1) % pDevice->numSectors;
+            sequence = pLog->sequence + 1;
+        }
+        if (!pDevice->pErase(pDevice->pCtx, sector * pDevice->sectorSize)) {
+            return false;
+        }
+        sectorHeader_t header = {.magic = SECTOR_MAGIC, .sequence = sequence};
+        memset(buf, 0xFF, pDevice->pageSize);
+        memcpy(buf, &header, sizeof(header));
+        if (!pDevice->pProgram(pDevice->pCtx, sector * pDevice->sectorSize,
+                               buf, pDevice->pageSize)) {
+            return false;
+        }
+        pLog->activeSector = sector;
+        pLog->sequence = sequence;
+        pLog->nextSlot = 0;
+    }
+
+    slotHeader_t header = {
+        .magic = SLOT_MAGIC,
+        .size = pLog->recordSize,
+        .crc = crc32(pRecord, pLog->recordSize),
+    };
+    memset(buf, 0xFF, pLog->slotSize);
+    memcpy(buf, &header, sizeof(header));
+    memcpy(&buf[sizeof(header)], pRecord, pLog->recordSize);
+    uint32_t addr = slotAddress(pLog, pLog->activeSector, pLog->nextSlot);
+    // The slot is taken even if programming fails, since it may have been
+    // partly written.
+    pLog->nextSlot++;
+    return pDevice->pProgram(pDevice->pCtx, addr, buf, pLog->slotSize);
+}
@@ -0,0 +1,127 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef FLASH_LOG_H_
+#define FLASH_LOG_H_
+
+/*
+ * Wear levelled log of fixed size records in NOR flash.
+ *
+ * The log is spread over a number of sectors. Each sector starts with a
+ * header holding a sequence number, followed by slots that each hold one
+ * record. Records are appended to the next free slot, so a record is
+ * written without erasing. When the active sector is full, the next sector
+ * is erased and takes over, round robin, so all sectors wear evenly.
+ *
+ * At start up, the newest sector is found from the sector headers, and the
+ * next free slot by a binary search. Finding the latest record takes a
+ * bounded number of reads, independent of how long the log has been used.
+ */
+
+// Standard library
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ----------------- DEFINES ----------------- */
+
+//! Largest slot supported, i.e. record plus slot header, in bytes
+#define FLASH_LOG_MAX_SLOT_SIZE 512
+
+/**
+ * @brief Flash device the log is stored in.
+ *
+ * Addresses are offsets from the start of the region used by the log.
+ * Program operations are page aligned and a multiple of the page size,
+ * and can only clear bits. Erase sets a sector to 0xFF.
+ */
+typedef struct flashDevice {
+    //! Size of an erase sector, in bytes
+    uint32_t sectorSize;
+    //! Size of a program page, in bytes
+    uint32_t pageSize;
+    //! Number of sectors used by the log
+    uint32_t numSectors;
+    //! Read len bytes at addr
+    bool (*pRead)(void *pCtx, uint32_t addr, void *pBuf, uint32_t len);
+    //! Program len bytes at addr
+    bool (*pProgram)(void *pCtx, uint32_t addr, const void *pBuf,
+                     uint32_t len);
+    //! Erase the sector starting at addr
+    bool (*pErase)(void *pCtx, uint32_t addr);
+    //! Context passed to the functions above
+    void *pCtx;
+} flashDevice_t;
+
+/**
+ * @brief State of a mounted flash log
+ */
+typedef struct flashLog {
+    //! The flash device
+    const flashDevice_t *pDevice;
+    //! Size of the records, in bytes
+    uint32_t recordSize;
+    //! Size of a slot, i.e. record and slot header rounded up to pages
+    uint32_t slotSize;
+    //! Number of slots in a sector
+    uint32_t slotsPerSector;
+    //! Active sector, or -1 if the log is empty
+    int32_t activeSector;
+    //! Sequence number of the active sector
+    uint32_t sequence;
+    //! Next free slot in the active sector
+    uint32_t nextSlot;
+} flashLog_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Mount a flash log. Nothing is written.
+ * @param pLog Pointer to the log state.
+ * @param pDevice Pointer to the flash device.
+ * @param recordSize Size of the records, in bytes.
+ * @return False if the parameters don't fit the device, or reading failed.
+ */
+bool flashLog_init(flashLog_t *pLog, const flashDevice_t *pDevice,
+                   uint32_t recordSize);
+
+/**
+ * @brief Read the latest valid record.
+ *
+ * If the latest record is corrupt, e.g. due to power loss while it was
+ * written, the one before it is returned.
+ * @param pLog Pointer to the log state.
+ * @param pRecord Pointer to where the record is written.
+ * @return False if there is no valid record.
+ */
+bool flashLog_read(flashLog_t *pLog, void *pRecord);
+
+/**
+ * @brief Append a record to the log.
+ * @param pLog Pointer to the log state.
+ * @param pRecord Pointer to the record.
+ * @return False if the flash could not be written.
+ */
+bool flashLog_append(flashLog_t *pLog, const void *pRecord);
+
+#endif /* FLASH_LOG_H_ */
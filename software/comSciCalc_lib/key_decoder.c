@@ -0,0 +1,217 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "key_decoder.h"
+
+/* ----------------- DEFINES ----------------- */
+#define KEY_ESC 27
+#define KEY_DEL 127
+
+//! CSI parameters for bracketed paste
+#define PASTE_START_PARAM 200
+#define PASTE_END_PARAM 201
+
+/* ------------- FUNCTION DEFINITIONS ------------- */
+
+/**
+ * @brief Set up a key event
+ * @param pEvent Pointer to the event
+ * @param type Type of key
+ * @param c Char of the key, 0 if not a char
+ * @param modifiers Bitmask of KEY_MOD_x
+ * @return Always true, so it can be returned from keyDecoder_feed.
+ */
+static bool setEvent(keyEvent_t *pEvent, keyType_t type, char c,
+                     uint8_t modifiers) {
+    pEvent->type = type;
+    pEvent->c = c;
+    pEvent->modifiers = modifiers;
+    pEvent->pasted = false;
+    return true;
+}
+
+/**
+ * @brief Find the key type of a final byte shared by CSI and SS3
+ * @param final Final byte of the sequence
+ * @return The key type, or keyType_UNKNOWN
+ */
+static keyType_t finalToKeyType(char final) {
+    switch (final) {
+    case 'A':
+        return keyType_UP;
+    case 'B':
+        return keyType_DOWN;
+    case 'C':
+        return keyType_RIGHT;
+    case 'D':
+        return keyType_LEFT;
+    case 'H':
+        return keyType_HOME;
+    case 'F':
+        return keyType_END;
+    default:
+        return keyType_UNKNOWN;
+    }
+}
+
+/**
+ * @brief Find the key type of a "ESC [ <n> ~" sequence
+ * @param param The numeric parameter
+ * @return The key type, or keyType_UNKNOWN
+ */
+static keyType_t tildeToKeyType(uint16_t param) {
+    switch (param) {
+    case 1:
+    case 7:
+        return keyType_HOME;
+    case 4:
+    case 8:
+        return keyType_END;
+    case 3:
+        return keyType_DELETE;
+    case PASTE_START_PARAM:
+        return keyType_PASTE_START;
+    case PASTE_END_PARAM:
+        return keyType_PASTE_END;
+    default:
+        return keyType_UNKNOWN;
+    }
+}
+
+/**
+ * @brief Decode a byte received outside of an escape sequence
+ * @param pDecoder Pointer to the decoder
+ * @param byte Received byte
+ * @param pEvent Pointer to the event
+ * @param modifiers Modifiers to apply, KEY_MOD_ALT if preceded by ESC
+ * @return True if an event was written
+ */
+static bool decodeGround(keyDecoder_t *pDecoder, char byte, keyEvent_t *pEvent,
+                         uint8_t modifiers) {
+    if (byte == KEY_ESC) {
+        pDecoder->state = keyDecoderState_ESC;
+        return false;
+    }
+    if (pDecoder->inPaste) {
+        // Pasted text is never interpreted as keys.
+        setEvent(pEvent, keyType_CHAR, byte, 0);
+        pEvent->pasted = true;
+        return true;
+    }
+    if (byte == KEY_DEL || byte == '\b') {
+        return setEvent(pEvent, keyType_BACKSPACE, 0, modifiers);
+    }
+    if (byte == '\r' || byte == '\n') {
+        return setEvent(pEvent, keyType_ENTER, 0, modifiers);
+    }
+    if ((uint8_t)byte < ' ') {
+        // Ctrl-A is 1, Ctrl-B is 2 and so forth.
+        return setEvent(pEvent, keyType_CHAR, byte + 'a' - 1,
+                        modifiers | KEY_MOD_CTRL);
+    }
+    return setEvent(pEvent, keyType_CHAR, byte, modifiers);
+}
+
+void keyDecoder_init(keyDecoder_t *pDecoder) {
+    memset(pDecoder, 0, sizeof(keyDecoder_t));
+    pDecoder->state = keyDecoderState_GROUND;
+}
+
+bool keyDecoder_feed(keyDecoder_t *pDecoder, char byte, keyEvent_t *pEvent) {
+    switch (pDecoder->state) {
+    case keyDecoderState_GROUND:
+        return decodeGround(pDecoder, byte, pEvent, 0);
+
+    case keyDecoderState_ESC:
+        if (byte == '[') {
+            pDecoder->state = keyDecoderState_CSI;
+            memset(pDecoder->params, 0, sizeof(pDecoder->params));
+            pDecoder->paramIdx = 0;
+            return false;
+        }
+        if (byte == 'O') {
+            pDecoder->state = keyDecoderState_SS3;
+            return false;
+        }
+        if (byte == KEY_ESC) {
+            // The first ESC was a lone ESC. The second one starts
+            // a new sequence, so stay in this state.
+            return setEvent(pEvent, keyType_ESCAPE, 0, 0);
+        }
+        // ESC followed by a char is Alt-<char>
+        pDecoder->state = keyDecoderState_GROUND;
+        return decodeGround(pDecoder, byte, pEvent, KEY_MOD_ALT);
+
+    case keyDecoderState_CSI:
+        if (byte >= '0' && byte <= '9') {
+            if (pDecoder->paramIdx < KEY_DECODER_MAX_PARAMS) {
+                uint16_t *pParam = &pDecoder->params[pDecoder->paramIdx];
+                *pParam = *pParam * 10 + (byte - '0');
+            }
+            return false;
+        }
+        if (byte == ';') {
+            pDecoder->paramIdx++;
+            return false;
+        }
+        if (byte < 0x40 || byte > 0x7E) {
+            // Intermediate bytes. Keep reading until the final byte.
+            return false;
+        }
+        // Final byte. The second parameter holds the modifiers + 1.
+        pDecoder->state = keyDecoderState_GROUND;
+        uint8_t modifiers = 0;
+        if (pDecoder->paramIdx > 0 && pDecoder->params[1] > 1) {
+            modifiers = (pDecoder->params[1] - 1) &
+                        (KEY_MOD_SHIFT | KEY_MOD_ALT | KEY_MOD_CTRL);
+        }
+        keyType_t type = keyType_UNKNOWN;
+        if (byte == '~') {
+            type = tildeToKeyType(pDecoder->params[0]);
+        } else {
+            type = finalToKeyType(byte);
+        }
+        if (type == keyType_PASTE_START) {
+            pDecoder->inPaste = true;
+        } else if (type == keyType_PASTE_END) {
+            pDecoder->inPaste = false;
+        }
+        return setEvent(pEvent, type, 0, modifiers);
+
+    case keyDecoderState_SS3:
+        pDecoder->state = keyDecoderState_GROUND;
+        return setEvent(pEvent, finalToKeyType(byte), 0, 0);
+
+    default:
+        // Should never happen, start over.
+        keyDecoder_init(pDecoder);
+        return false;
+    }
+}
@@ -0,0 +1,141 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef KEY_DECODER_H_
+#define KEY_DECODER_H_
+
+/*
+ * Resumable decoder for ANSI/VT100 terminal input.
+ * Bytes are fed one at a time as they arrive, and a key event
+ * is produced once a key has been fully received. The decoder
+ * never waits for more input, so it can be fed from any chunk size.
+ */
+
+// Standard library
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ----------------- DEFINES ----------------- */
+
+//! Max number of numeric parameters in a CSI sequence
+#define KEY_DECODER_MAX_PARAMS 2
+
+/**
+ * @defgroup key_modifiers Key modifiers
+ * Bits set in keyEvent_t.modifiers
+ * @{
+ */
+#define KEY_MOD_SHIFT (1 << 0)
+#define KEY_MOD_ALT (1 << 1)
+#define KEY_MOD_CTRL (1 << 2)
+/**@}*/
+
+/**
+ * @brief Type of a decoded key
+ */
+typedef enum keyType {
+    //! Printable char, or a Ctrl/Alt-modified char. See keyEvent_t.c
+    keyType_CHAR = 0,
+    keyType_UP,
+    keyType_DOWN,
+    keyType_RIGHT,
+    keyType_LEFT,
+    keyType_HOME,
+    keyType_END,
+    keyType_DELETE,
+    keyType_BACKSPACE,
+    keyType_ENTER,
+    keyType_ESCAPE,
+    //! Start of bracketed paste. Chars up to keyType_PASTE_END are pasted.
+    keyType_PASTE_START,
+    keyType_PASTE_END,
+    //! A well formed escape sequence that isn't handled.
+    keyType_UNKNOWN,
+} keyType_t;
+
+/**
+ * @brief Decoded key event
+ */
+typedef struct keyEvent {
+    //! Type of key
+    keyType_t type;
+    //! The char, if type is keyType_CHAR. Ctrl-chars give the lower case
+    //! letter, e.g. Ctrl-A gives 'a' with KEY_MOD_CTRL set.
+    char c;
+    //! Bitmask of KEY_MOD_x
+    uint8_t modifiers;
+    //! True if the char was received as part of a bracketed paste.
+    bool pasted;
+} keyEvent_t;
+
+/**
+ * @brief Decoder states
+ */
+typedef enum keyDecoderState {
+    keyDecoderState_GROUND = 0,
+    //! ESC received
+    keyDecoderState_ESC,
+    //! ESC [ received, reading parameters
+    keyDecoderState_CSI,
+    //! ESC O received
+    keyDecoderState_SS3,
+} keyDecoderState_t;
+
+/**
+ * @brief State of the key decoder
+ */
+typedef struct keyDecoder {
+    //! Current state
+    keyDecoderState_t state;
+    //! Numeric parameters of the current CSI sequence
+    uint16_t params[KEY_DECODER_MAX_PARAMS];
+    //! Index of the parameter currently read
+    uint8_t paramIdx;
+    //! True while inside a bracketed paste
+    bool inPaste;
+} keyDecoder_t;
+
+/* ---------- FUNCTION PROTOTYPES ---------- */
+
+/**
+ * @brief Initialize the key decoder
+ * @param pDecoder Pointer to the decoder
+ * @return Nothing
+ */
+void keyDecoder_init(keyDecoder_t *pDecoder);
+
+/**
+ * @brief Feed one byte to the decoder
+ * @param pDecoder Pointer to the decoder
+ * @param byte Received byte
+ * @param pEvent Pointer to where the event is written.
+ * @return True if a key event was written to pEvent, false if more bytes are
+ * needed.
+ * @note A lone ESC can't be told apart from the start of a sequence without
+ * a timeout, so it is reported when the next byte arrives. ESC followed by
+ * a char is reported as that char with KEY_MOD_ALT.
+ */
+bool keyDecoder_feed(keyDecoder_t *pDecoder, char byte, keyEvent_t *pEvent);
+
+#endif /* KEY_DECODER_H_ */
@@ -0,0 +1,212 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Latency tracing. See latency_trace.h.
+ *
+ * Trace points can be marked from several tasks, so the bookkeeping is
+ * done in a FreeRTOS critical section on target.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <stddef.h>
+#include <string.h>
+
+#include "latency_trace.h"
+#include "uart_logger.h"
+
+#if defined(RP2040)
+#include "FreeRTOS.h"
+#include "pico/stdlib.h"
+#include "task.h"
+#define TRACE_ENTER_CRITICAL() taskENTER_CRITICAL()
+#define TRACE_EXIT_CRITICAL() taskEXIT_CRITICAL()
+#elif defined(POSIX_SIM)
+// Host clock, but the trace points are hit from FreeRTOS tasks.
+#include "FreeRTOS.h"
+#include "task.h"
+#include <time.h>
+#define TRACE_ENTER_CRITICAL() taskENTER_CRITICAL()
+#define TRACE_EXIT_CRITICAL() taskEXIT_CRITICAL()
+#else
+#include <time.h>
+#define TRACE_ENTER_CRITICAL()
+#define TRACE_EXIT_CRITICAL()
+#endif
+
+/* ------------- GLOBAL VARIABLES ------------ */
+
+/**
+ * @brief Definition of a stage
+ */
+typedef struct traceStageDef {
+    //! Point starting the stage
+    tracePoint_t from;
+    //! Point ending the stage
+    tracePoint_t to;
+    //! Name printed in the dump
+    const char *pName;
+} traceStageDef_t;
+
+//! Stage definitions, indexed by traceStage_t
+static const traceStageDef_t stageDefs[traceStage_NUM] = {
+    [traceStage_INPUT_QUEUE] = {tracePoint_INPUT_RECEIVE,
+                                tracePoint_INPUT_DEQUEUE, "input queue"},
+    [traceStage_EDIT] = {tracePoint_INPUT_DEQUEUE, tracePoint_INPUT_PRINTED,
+                         "edit"},
+    [traceStage_HANDOFF] = {tracePoint_INPUT_PRINTED,
+                            tracePoint_DISPLAY_HANDOFF, "handoff"},
+    [traceStage_DISPLAY_WAKE] = {tracePoint_DISPLAY_HANDOFF,
+                                 tracePoint_DISPLAY_WAKE, "display wake"},
+    [traceStage_RENDER] = {tracePoint_DISPLAY_WAKE, tracePoint_DISPLAY_SWAP,
+                           "render"},
+    [traceStage_SOLVE] = {tracePoint_SOLVE_START, tracePoint_SOLVE_END,
+                          "solve"},
+    [traceStage_KEY_TO_PHOTON] = {tracePoint_INPUT_RECEIVE,
+                                  tracePoint_DISPLAY_SWAP, "key to photon"},
+};
+
+//! Histograms, indexed by traceStage_t
+static latencyHistogram_t histograms[traceStage_NUM];
+//! Start time of each stage in progress
+static uint32_t stageStart[traceStage_NUM];
+//! True if the stage is in progress
+static bool stageActive[traceStage_NUM];
+//! Clock function, NULL if the default clock is used
+static uint32_t (*pTraceClock)(void) = NULL;
+
+/* ------------- FUNCTION DEFINITIONS ------------- */
+
+/**
+ * @brief Default clock.
+ * @return Free running time in us.
+ */
+static uint32_t defaultClock(void) {
+#if defined(RP2040)
+    return time_us_32();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+}
+
+/**
+ * @brief Get the histogram bucket of a latency.
+ * @param latency Latency in us
+ * @return Bucket index
+ */
+static uint8_t latencyToBucket(uint32_t latency) {
+    uint8_t bucket = 0;
+    while (latency > 1 && bucket < LATENCY_TRACE_NUM_BUCKETS - 1) {
+        latency >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * @brief Add a sample to a histogram.
+ * @param pHist Pointer to the histogram
+ * @param latency Latency in us
+ */
+static void addSample(latencyHistogram_t *pHist, uint32_t latency) {
+    pHist->buckets[latencyToBucket(latency)]++;
+    if (pHist->count == 0 || latency < pHist->min) {
+        pHist->min = latency;
+    }
+    if (latency > pHist->max) {
+        pHist->max = latency;
+    }
+    pHist->count++;
+    pHist->sum += latency;
+}
+
+void latencyTrace_setClock(uint32_t (*pClockFun)(void)) {
+    pTraceClock = pClockFun;
+}
+
+void latencyTrace_reset(void) {
+    TRACE_ENTER_CRITICAL();
+    memset(histograms, 0, sizeof(histograms));
+    memset(stageActive, 0, sizeof(stageActive));
+    TRACE_EXIT_CRITICAL();
+}
+
+void latencyTrace_mark(tracePoint_t point) {
+    uint32_t now = (pTraceClock != NULL) ? pTraceClock() : defaultClock();
+    TRACE_ENTER_CRITICAL();
+    for (uint8_t i = 0; i < traceStage_NUM; i++) {
+        // End stages first, so that a point that both ends and starts
+        // stages never measures itself.
+        if (stageDefs[i].to == point && stageActive[i]) {
+            addSample(&histograms[i], now - stageStart[i]);
+            stageActive[i] = false;
+        }
+    }
+    for (uint8_t i = 0; i < traceStage_NUM; i++) {
+        if (stageDefs[i].from == point && !stageActive[i]) {
+            stageStart[i] = now;
+            stageActive[i] = true;
+        }
+    }
+    TRACE_EXIT_CRITICAL();
+}
+
+const latencyHistogram_t *latencyTrace_getHistogram(traceStage_t stage) {
+    if (stage >= traceStage_NUM) {
+        return NULL;
+    }
+    return &histograms[stage];
+}
+
+void latencyTrace_dump(void) {
+    // Copy the histograms so that printing isn't done in the critical
+    // section.
+    latencyHistogram_t hist[traceStage_NUM];
+    TRACE_ENTER_CRITICAL();
+    memcpy(hist, histograms, sizeof(histograms));
+    TRACE_EXIT_CRITICAL();
+
+    // The dump is requested explicitly, so print it at error level to
+    // have it show whenever the logger is enabled.
+    loggerImmediate(LOGGER_LEVEL_ERROR, "LATENCY TRACE [us]\r\n");
+    for (uint8_t i = 0; i < traceStage_NUM; i++) {
+        uint32_t mean = 0;
+        if (hist[i].count > 0) {
+            mean = (uint32_t)(hist[i].sum / hist[i].count);
+        }
+        loggerImmediate(LOGGER_LEVEL_ERROR,
+                        "%s: n=%u min=%u mean=%u max=%u\r\n",
+                        stageDefs[i].pName, hist[i].count, hist[i].min, mean,
+                        hist[i].max);
+        for (uint8_t b = 0; b < LATENCY_TRACE_NUM_BUCKETS; b++) {
+            if (hist[i].buckets[b] != 0) {
+                loggerImmediate(LOGGER_LEVEL_ERROR, "  >=%u: %u\r\n",
+                                b == 0 ? 0 : (1u << b), hist[i].buckets[b]);
+            }
+        }
+    }
+}
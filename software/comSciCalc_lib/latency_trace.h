@@ -0,0 +1,156 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef LATENCY_TRACE_H_
+#define LATENCY_TRACE_H_
+
+/*
+ * Latency tracing of the input pipeline, from a key being received
+ * until the frame showing it has been swapped in on the display.
+ * Trace points are marked with timestamps, and the time between
+ * pairs of points (stages) is collected in log2 histograms.
+ *
+ * Marking is compiled in with LATENCY_TRACE_MARK when LATENCY_TRACE
+ * is defined, and compiles to nothing otherwise.
+ */
+
+// Standard library
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ----------------- DEFINES ----------------- */
+
+//! Number of histogram buckets. Bucket n holds latencies in
+//! [2^n, 2^(n+1)) us, bucket 0 also holds 0 us and the last bucket
+//! holds everything above.
+#define LATENCY_TRACE_NUM_BUCKETS 20
+
+#if defined(LATENCY_TRACE)
+//! Mark a trace point
+#define LATENCY_TRACE_MARK(point) latencyTrace_mark(point)
+#else
+#define LATENCY_TRACE_MARK(point)
+#endif
+
+/**
+ * @brief Trace points in the input pipeline
+ */
+typedef enum tracePoint {
+    //! Input received from USB/UART
+    tracePoint_INPUT_RECEIVE = 0,
+    //! Input read from the stream buffer by the calculator core task
+    tracePoint_INPUT_DEQUEUE,
+    //! Input applied and printed with calc_printBuffer
+    tracePoint_INPUT_PRINTED,
+    //! Display state handed over to the display task
+    tracePoint_DISPLAY_HANDOFF,
+    //! Display task woken up to render a frame
+    tracePoint_DISPLAY_WAKE,
+    //! Display list swapped in
+    tracePoint_DISPLAY_SWAP,
+    //! Start of calc_solver
+    tracePoint_SOLVE_START,
+    //! End of calc_solver
+    tracePoint_SOLVE_END,
+    //! Number of trace points, not a trace point
+    tracePoint_NUM,
+} tracePoint_t;
+
+/**
+ * @brief Stages measured between two trace points
+ */
+typedef enum traceStage {
+    //! Receive to dequeue
+    traceStage_INPUT_QUEUE = 0,
+    //! Dequeue to printed, i.e. decoding and editing
+    traceStage_EDIT,
+    //! Printed to handed off to the display task
+    traceStage_HANDOFF,
+    //! Handed off to display task woken up
+    traceStage_DISPLAY_WAKE,
+    //! Display task woken up to display list swapped
+    traceStage_RENDER,
+    //! Duration of calc_solver
+    traceStage_SOLVE,
+    //! Receive to display list swapped, end to end
+    traceStage_KEY_TO_PHOTON,
+    //! Number of stages, not a stage
+    traceStage_NUM,
+} traceStage_t;
+
+/**
+ * @brief Latency histogram for one stage
+ */
+typedef struct latencyHistogram {
+    //! Number of samples in each bucket
+    uint32_t buckets[LATENCY_TRACE_NUM_BUCKETS];
+    //! Number of samples
+    uint32_t count;
+    //! Smallest sample, in us
+    uint32_t min;
+    //! Largest sample, in us
+    uint32_t max;
+    //! Sum of all samples, in us
+    uint64_t sum;
+} latencyHistogram_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Set the clock used for timestamps.
+ * @param pClockFun Function returning a free running time in us. NULL
+ * restores the default clock, which is the RP2040 timer on target and
+ * clock_gettime on host.
+ */
+void latencyTrace_setClock(uint32_t (*pClockFun)(void));
+
+/**
+ * @brief Clear all histograms and pending stages.
+ */
+void latencyTrace_reset(void);
+
+/**
+ * @brief Mark a trace point.
+ *
+ * A stage starts when its first point is marked, and ends and is added to
+ * its histogram when its last point is marked. If the first point is marked
+ * again before the stage has ended, the earlier timestamp is kept, so
+ * coalesced input is measured from the first key.
+ * @param point The trace point.
+ */
+void latencyTrace_mark(tracePoint_t point);
+
+/**
+ * @brief Get the histogram of a stage.
+ * @param stage The stage.
+ * @return Pointer to the histogram, or NULL if the stage is invalid.
+ */
+const latencyHistogram_t *latencyTrace_getHistogram(traceStage_t stage);
+
+/**
+ * @brief Print all histograms with the logger.
+ */
+void latencyTrace_dump(void);
+
+#endif /* LATENCY_TRACE_H_ */
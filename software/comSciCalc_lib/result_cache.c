@@ -0,0 +1,264 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Sharded LRU result cache. See result_cache.h.
+ *
+ * The top bits of the key pick the shard, and the low bits the bucket
+ * within the shard. Each shard is a fixed array of entries, chained into
+ * buckets and into a doubly linked LRU order by index. Nothing is
+ * allocated after init: a full shard reuses its least recently used
+ * entry.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <stdlib.h>
+#include <string.h>
+
+#include "result_cache.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Index meaning no entry
+#define RESULT_CACHE_NONE UINT32_MAX
+
+//! Shard of a key, from the top bits
+#define SHARD_OF(key) ((key) >> 60 & (RESULT_CACHE_SHARDS - 1))
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Compare two number formats.
+ * @param pA Pointer to the first format.
+ * @param pB Pointer to the second format.
+ * @return True if they would solve the same input the same way.
+ */
+static bool sameFormat(const numberFormat_t *pA, const numberFormat_t *pB) {
+    return pA->numBits == pB->numBits && pA->inputFormat == pB->inputFormat &&
+           pA->outputFormat == pB->outputFormat && pA->sign == pB->sign &&
+           pA->inputBase == pB->inputBase &&
+           pA->fixedPointDecimalPlace == pB->fixedPointDecimalPlace;
+}
+
+/**
+ * @brief Find an entry of a shard.
+ * @param pShard Pointer to the shard, locked.
+ * @param key Key of the entry.
+ * @param pNumberFormat Pointer to the number format of the entry.
+ * @return Index of the entry, or RESULT_CACHE_NONE.
+ */
+static uint32_t findEntry(const resultCacheShard_t *pShard, uint64_t key,
+                          const numberFormat_t *pNumberFormat) {
+    uint32_t idx = pShard->pBuckets[key & pShard->bucketMask];
+    while (idx != RESULT_CACHE_NONE) {
+        const resultCacheEntry_t *pEntry = &pShard->pEntries[idx];
+        if (pEntry->key == key &&
+            sameFormat(&pEntry->numberFormat, pNumberFormat)) {
+            break;
+        }
+        idx = pEntry->bucketNext;
+    }
+    return idx;
+}
+
+/**
+ * @brief Take an entry out of the LRU order.
+ * @param pShard Pointer to the shard, locked.
+ * @param idx Index of the entry.
+ */
+static void lruUnlink(resultCacheShard_t *pShard, uint32_t idx) {
+    resultCacheEntry_t *pEntry = &pShard->pEntries[idx];
+    if (pEntry->lruPrev != RESULT_CACHE_NONE) {
+        pShard->pEntries[pEntry->lruPrev].lruNext = pEntry->lruNext;
+    } else {
+        pShard->lruHead = pEntry->lruNext;
+    }
+    if (pEntry->lruNext != RESULT_CACHE_NONE) {
+        pShard->pEntries[pEntry->lruNext].lruPrev = pEntry->lruPrev;
+    } else {
+        pShard->lruTail = pEntry->lruPrev;
+    }
+}
+
+/**
+ * @brief Make an entry the most recently used one.
+ * @param pShard Pointer to the shard, locked.
+ * @param idx Index of the entry, not in the LRU order.
+ */
+static void lruPushFront(resultCacheShard_t *pShard, uint32_t idx) {
+    resultCacheEntry_t *pEntry = &pShard->pEntries[idx];
+    pEntry->lruPrev = RESULT_CACHE_NONE;
+    pEntry->lruNext = pShard->lruHead;
+    if (pShard->lruHead != RESULT_CACHE_NONE) {
+        pShard->pEntries[pShard->lruHead].lruPrev = idx;
+    } else {
+        pShard->lruTail = idx;
+    }
+    pShard->lruHead = idx;
+}
+
+/**
+ * @brief Take an entry out of its bucket.
+ * @param pShard Pointer to the shard, locked.
+ * @param idx Index of the entry.
+ */
+static void bucketUnlink(resultCacheShard_t *pShard, uint32_t idx) {
+    uint32_t *pLink =
+        &pShard->pBuckets[pShard->pEntries[idx].key & pShard->bucketMask];
+    while (*pLink != idx) {
+        pLink = &pShard->pEntries[*pLink].bucketNext;
+    }
+    *pLink = pShard->pEntries[idx].bucketNext;
+}
+
+calc_funStatus_t resultCache_init(calcResultCache_t *pCache,
+                                  uint32_t capacity) {
+    if (pCache == NULL) {
+        return calc_funStatus_UNKNOWN_PARAMETER;
+    }
+    memset(pCache, 0, sizeof(calcResultCache_t));
+    uint32_t shardCapacity =
+        (capacity + RESULT_CACHE_SHARDS - 1) / RESULT_CACHE_SHARDS;
+    if (shardCapacity == 0) {
+        shardCapacity = 1;
+    }
+    // Power of two buckets, at least one per entry
+    uint32_t numBuckets = 1;
+    while (numBuckets < shardCapacity) {
+        numBuckets <<= 1;
+    }
+    for (int i = 0; i < RESULT_CACHE_SHARDS; i++) {
+        pthread_mutex_init(&pCache->shards[i].lock, NULL);
+    }
+    for (int i = 0; i < RESULT_CACHE_SHARDS; i++) {
+        resultCacheShard_t *pShard = &pCache->shards[i];
+        pShard->pEntries = malloc(shardCapacity * sizeof(resultCacheEntry_t));
+        pShard->pBuckets = malloc(numBuckets * sizeof(uint32_t));
+        if (pShard->pEntries == NULL || pShard->pBuckets == NULL) {
+            resultCache_free(pCache);
+            return calc_funStatus_ALLOCATE_ERROR;
+        }
+        memset(pShard->pBuckets, 0xFF, numBuckets * sizeof(uint32_t));
+        pShard->capacity = shardCapacity;
+        pShard->bucketMask = numBuckets - 1;
+        pShard->lruHead = RESULT_CACHE_NONE;
+        pShard->lruTail = RESULT_CACHE_NONE;
+    }
+    return calc_funStatus_SUCCESS;
+}
+
+void resultCache_free(calcResultCache_t *pCache) {
+    for (int i = 0; i < RESULT_CACHE_SHARDS; i++) {
+        resultCacheShard_t *pShard = &pCache->shards[i];
+        free(pShard->pEntries);
+        free(pShard->pBuckets);
+        pShard->pEntries = NULL;
+        pShard->pBuckets = NULL;
+        pShard->capacity = 0;
+        pShard->numEntries = 0;
+        pthread_mutex_destroy(&pShard->lock);
+    }
+}
+
+void resultCache_attach(calcResultCache_t *pCache,
+                        calcCoreState_t *pCalcCoreState) {
+    if (pCache == NULL) {
+        pCalcCoreState->pCacheLookupFun = NULL;
+        pCalcCoreState->pCacheStoreFun = NULL;
+    } else {
+        pCalcCoreState->pCacheLookupFun = resultCache_lookup;
+        pCalcCoreState->pCacheStoreFun = resultCache_store;
+    }
+    pCalcCoreState->pCacheArg = pCache;
+}
+
+bool resultCache_lookup(void *pArg, uint64_t key,
+                        const numberFormat_t *pNumberFormat,
+                        SUBRESULT_INT *pResult, calc_funStatus_t *pStatus) {
+    calcResultCache_t *pCache = (calcResultCache_t *)pArg;
+    resultCacheShard_t *pShard = &pCache->shards[SHARD_OF(key)];
+    pthread_mutex_lock(&pShard->lock);
+    uint32_t idx = findEntry(pShard, key, pNumberFormat);
+    if (idx == RESULT_CACHE_NONE) {
+        pShard->misses++;
+        pthread_mutex_unlock(&pShard->lock);
+        return false;
+    }
+    pShard->hits++;
+    *pResult = pShard->pEntries[idx].result;
+    *pStatus = pShard->pEntries[idx].status;
+    if (pShard->lruHead != idx) {
+        lruUnlink(pShard, idx);
+        lruPushFront(pShard, idx);
+    }
+    pthread_mutex_unlock(&pShard->lock);
+    return true;
+}
+
+void resultCache_store(void *pArg, uint64_t key,
+                       const numberFormat_t *pNumberFormat,
+                       SUBRESULT_INT result, calc_funStatus_t status) {
+    calcResultCache_t *pCache = (calcResultCache_t *)pArg;
+    resultCacheShard_t *pShard = &pCache->shards[SHARD_OF(key)];
+    pthread_mutex_lock(&pShard->lock);
+    // Another state may have stored the same solve since the lookup.
+    uint32_t idx = findEntry(pShard, key, pNumberFormat);
+    if (idx != RESULT_CACHE_NONE) {
+        lruUnlink(pShard, idx);
+    } else {
+        if (pShard->numEntries < pShard->capacity) {
+            idx = pShard->numEntries++;
+        } else {
+            idx = pShard->lruTail;
+            lruUnlink(pShard, idx);
+            bucketUnlink(pShard, idx);
+            pShard->evictions++;
+        }
+        resultCacheEntry_t *pEntry = &pShard->pEntries[idx];
+        pEntry->key = key;
+        pEntry->numberFormat = *pNumberFormat;
+        uint32_t *pBucket = &pShard->pBuckets[key & pShard->bucketMask];
+        pEntry->bucketNext = *pBucket;
+        *pBucket = idx;
+    }
+    pShard->pEntries[idx].result = result;
+    pShard->pEntries[idx].status = status;
+    lruPushFront(pShard, idx);
+    pthread_mutex_unlock(&pShard->lock);
+}
+
+void resultCache_getStats(calcResultCache_t *pCache,
+                          resultCacheStats_t *pStats) {
+    memset(pStats, 0, sizeof(resultCacheStats_t));
+    for (int i = 0; i < RESULT_CACHE_SHARDS; i++) {
+        resultCacheShard_t *pShard = &pCache->shards[i];
+        pthread_mutex_lock(&pShard->lock);
+        pStats->hits += pShard->hits;
+        pStats->misses += pShard->misses;
+        pStats->evictions += pShard->evictions;
+        pStats->numEntries += pShard->numEntries;
+        pthread_mutex_unlock(&pShard->lock);
+    }
+}
@@ -0,0 +1,179 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef RESULT_CACHE_H_
+#define RESULT_CACHE_H_
+
+/*
+ * Result cache shared between calculator states. Inputs that have been
+ * solved before, in the same number format, are answered from the cache
+ * without copying or solving the input list. Uses POSIX threads, so host
+ * builds only.
+ */
+
+// Standard library
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Calculator core
+#include "comscicalc.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Number of shards, each with a lock and LRU order of its own
+#define RESULT_CACHE_SHARDS 16
+
+//! Size of a cache line, shards are aligned to this to not share lines
+#define RESULT_CACHE_LINE 64
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief One cached solve.
+ */
+typedef struct resultCacheEntry {
+    //! Hash of the input, from calc_inputHash
+    uint64_t key;
+    //! Number format the input was solved in
+    numberFormat_t numberFormat;
+    //! Result, if status is success
+    SUBRESULT_INT result;
+    //! Status of the solve
+    calc_funStatus_t status;
+    //! Next entry of the same bucket
+    uint32_t bucketNext;
+    //! Neighbours in the LRU order, towards the most and least recent
+    uint32_t lruPrev;
+    uint32_t lruNext;
+} resultCacheEntry_t;
+
+/**
+ * @brief One shard of the cache, holding the keys that map to it.
+ */
+typedef struct resultCacheShard {
+    //! Lock guarding everything in the shard
+    pthread_mutex_t lock;
+    //! Entries, of which numEntries are used
+    resultCacheEntry_t *pEntries;
+    uint32_t numEntries;
+    uint32_t capacity;
+    //! First entry of each bucket
+    uint32_t *pBuckets;
+    uint32_t bucketMask;
+    //! Most and least recently used entries
+    uint32_t lruHead;
+    uint32_t lruTail;
+    //! Counters
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+} __attribute__((aligned(RESULT_CACHE_LINE))) resultCacheShard_t;
+
+/**
+ * @brief A result cache.
+ */
+typedef struct calcResultCache {
+    resultCacheShard_t shards[RESULT_CACHE_SHARDS];
+} calcResultCache_t;
+
+/**
+ * @brief Counters of a result cache, summed over all shards.
+ */
+typedef struct resultCacheStats {
+    //! Lookups answered from the cache
+    uint64_t hits;
+    //! Lookups that had to be solved
+    uint64_t misses;
+    //! Entries dropped to make room for new ones
+    uint64_t evictions;
+    //! Entries in the cache
+    uint64_t numEntries;
+} resultCacheStats_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Initialize a result cache.
+ * @param pCache Pointer to the cache.
+ * @param capacity Maximum number of entries, split evenly over the shards.
+ * @return calc_funStatus_ALLOCATE_ERROR if the entries couldn't be
+ * allocated, otherwise success.
+ */
+calc_funStatus_t resultCache_init(calcResultCache_t *pCache,
+                                  uint32_t capacity);
+
+/**
+ * @brief Free the entries of a result cache. Calculator states must be
+ * detached before.
+ * @param pCache Pointer to the cache.
+ */
+void resultCache_free(calcResultCache_t *pCache);
+
+/**
+ * @brief Attach a result cache to a calculator state, so that calc_solver
+ * uses it. Any number of states, on any number of threads, can share one
+ * cache. calc_coreInit detaches the cache again.
+ * @param pCache Pointer to the cache, or NULL to detach.
+ * @param pCalcCoreState Pointer to the calculator state.
+ */
+void resultCache_attach(calcResultCache_t *pCache,
+                        calcCoreState_t *pCalcCoreState);
+
+/**
+ * @brief Look up an earlier solve. A hit makes the entry the most recently
+ * used one of its shard.
+ * @param pArg Pointer to the calcResultCache_t.
+ * @param key Hash of the input, from calc_inputHash.
+ * @param pNumberFormat Pointer to the number format of the solve.
+ * @param pResult Pointer to where the result is written on a hit.
+ * @param pStatus Pointer to where the status is written on a hit.
+ * @return True on a hit.
+ */
+bool resultCache_lookup(void *pArg, uint64_t key,
+                        const numberFormat_t *pNumberFormat,
+                        SUBRESULT_INT *pResult, calc_funStatus_t *pStatus);
+
+/**
+ * @brief Store a solve, evicting the least recently used entry of the
+ * shard if it's full.
+ * @param pArg Pointer to the calcResultCache_t.
+ * @param key Hash of the input, from calc_inputHash.
+ * @param pNumberFormat Pointer to the number format of the solve.
+ * @param result Result of the solve.
+ * @param status Status of the solve.
+ */
+void resultCache_store(void *pArg, uint64_t key,
+                       const numberFormat_t *pNumberFormat,
+                       SUBRESULT_INT result, calc_funStatus_t status);
+
+/**
+ * @brief Read the counters of a result cache.
+ * @param pCache Pointer to the cache.
+ * @param pStats Pointer to where the counters are written.
+ */
+void resultCache_getStats(calcResultCache_t *pCache,
+                          resultCacheStats_t *pStats);
+
+#endif /* RESULT_CACHE_H_ */
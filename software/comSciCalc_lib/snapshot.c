@@ -0,0 +1,135 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Snapshot of the calculator state. See snapshot.h.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <stddef.h>
+#include <string.h>
+
+#include "comscicalc_common.h"
+#include "snapshot.h"
+
+/* ----------------- DEFINES ----------------- */
+//! Token format: bits 0-1 hold the input base
+#define TOKEN_FMT_BASE(tokenFormat) ((tokenFormat)&0x3)
+//! Token format: inputBase_NONE is stored as 3
+#define TOKEN_FMT_BASE_NONE 0x3
+//! Token format: bits 2-3 hold the input format
+#define TOKEN_FMT_FORMAT(tokenFormat) (((tokenFormat) >> 2) & 0x3)
+//! Token format: bit 4 holds the sign
+#define TOKEN_FMT_SIGN(tokenFormat) (((tokenFormat) >> 4) & 0x1)
+#define CONSTRUCT_TOKEN_FMT(base, format, sign)                                \
+    (((sign)&0x1) << 4 | ((format)&0x3) << 2 | ((base)&0x3))
+
+/* ------------- FUNCTION DEFINITIONS ------------- */
+
+calc_funStatus_t snapshot_capture(calcCoreState_t *pCalcCoreState,
+                                  calcSnapshot_t *pSnapshot) {
+    if (pCalcCoreState == NULL) {
+        return calc_funStatus_CALC_CORE_STATE_NULL;
+    }
+    if (pSnapshot == NULL) {
+        return calc_funStatus_STRING_BUFFER_ERROR;
+    }
+    // Clear everything, including padding, so that snapshots can be
+    // compared with memcmp.
+    memset(pSnapshot, 0, sizeof(calcSnapshot_t));
+    pSnapshot->version = SNAPSHOT_VERSION;
+    numberFormat_t *pFormat = &pCalcCoreState->numberFormat;
+    pSnapshot->numBits = pFormat->numBits;
+    pSnapshot->inputFormat = pFormat->inputFormat;
+    pSnapshot->outputFormat = pFormat->outputFormat;
+    pSnapshot->sign = pFormat->sign;
+    pSnapshot->inputBase = pFormat->inputBase;
+    pSnapshot->fixedPointDecimalPlace = pFormat->fixedPointDecimalPlace;
+    pSnapshot->cursorPosition = pCalcCoreState->cursorPosition;
+    pSnapshot->solved = pCalcCoreState->solved;
+    pSnapshot->result = pCalcCoreState->result;
+
+    uint8_t numTokens = 0;
+    inputListEntry_t *pEntry = pCalcCoreState->pListEntrypoint;
+    while (pEntry != NULL) {
+        if (numTokens >= SNAPSHOT_MAX_TOKENS) {
+            return calc_funStatus_STRING_BUFFER_ERROR;
+        }
+        uint8_t typeFlag = pEntry->entry.typeFlag;
+        pSnapshot->tokens[numTokens] = pEntry->entry.c;
+        pSnapshot->tokenFormat[numTokens] =
+            CONSTRUCT_TOKEN_FMT(pEntry->inputBase, GET_FMT_TYPE(typeFlag),
+                                typeFlag >> 7);
+        numTokens++;
+        pEntry = pEntry->pNext;
+    }
+    pSnapshot->numTokens = numTokens;
+    return calc_funStatus_SUCCESS;
+}
+
+calc_funStatus_t snapshot_restore(calcCoreState_t *pCalcCoreState,
+                                  const calcSnapshot_t *pSnapshot) {
+    if (pCalcCoreState == NULL) {
+        return calc_funStatus_CALC_CORE_STATE_NULL;
+    }
+    if (pSnapshot == NULL) {
+        return calc_funStatus_STRING_BUFFER_ERROR;
+    }
+    if (pSnapshot->version != SNAPSHOT_VERSION ||
+        pSnapshot->numTokens > SNAPSHOT_MAX_TOKENS) {
+        return calc_funStatus_FORMAT_ERROR;
+    }
+
+    // Replay the tokens with the format they were entered in. The cursor
+    // is kept at the end while replaying.
+    numberFormat_t *pFormat = &pCalcCoreState->numberFormat;
+    pCalcCoreState->cursorPosition = 0;
+    for (uint8_t i = 0; i < pSnapshot->numTokens; i++) {
+        uint8_t tokenFormat = pSnapshot->tokenFormat[i];
+        uint8_t base = TOKEN_FMT_BASE(tokenFormat);
+        pFormat->inputBase =
+            (base == TOKEN_FMT_BASE_NONE) ? inputBase_NONE : base;
+        pFormat->inputFormat = TOKEN_FMT_FORMAT(tokenFormat);
+        pFormat->sign = TOKEN_FMT_SIGN(tokenFormat);
+        calc_funStatus_t status =
+            calc_addInput(pCalcCoreState, pSnapshot->tokens[i]);
+        if (status != calc_funStatus_SUCCESS) {
+            calc_coreBufferTeardown(pCalcCoreState);
+            pCalcCoreState->pListEntrypoint = NULL;
+            return status;
+        }
+    }
+
+    pFormat->numBits = pSnapshot->numBits;
+    pFormat->inputFormat = pSnapshot->inputFormat;
+    pFormat->outputFormat = pSnapshot->outputFormat;
+    pFormat->sign = pSnapshot->sign;
+    pFormat->inputBase = pSnapshot->inputBase;
+    pFormat->fixedPointDecimalPlace = pSnapshot->fixedPointDecimalPlace;
+    pCalcCoreState->cursorPosition = pSnapshot->cursorPosition;
+    pCalcCoreState->solved = pSnapshot->solved;
+    pCalcCoreState->result = pSnapshot->result;
+    return calc_funStatus_SUCCESS;
+}
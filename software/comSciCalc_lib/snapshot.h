@@ -0,0 +1,107 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef SNAPSHOT_H_
+#define SNAPSHOT_H_
+
+/*
+ * Compact, versioned snapshot of the calculator state, i.e. the number
+ * format, the input tokens and the result, so that it can be stored in
+ * flash and restored at start up.
+ */
+
+// Standard library
+#include <stdint.h>
+
+// Calculator core
+#include "comscicalc.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Snapshot layout version. Increment whenever calcSnapshot_t changes.
+#define SNAPSHOT_VERSION 1
+
+//! Maximum number of tokens in a snapshot
+#define SNAPSHOT_MAX_TOKENS 100
+
+/**
+ * @brief Snapshot of the calculator state.
+ *
+ * Fields are fixed width so the layout doesn't depend on enum sizes.
+ */
+typedef struct calcSnapshot {
+    //! SNAPSHOT_VERSION
+    uint16_t version;
+    //! numberFormat_t fields
+    uint8_t numBits;
+    uint8_t inputFormat;
+    uint8_t outputFormat;
+    uint8_t sign;
+    int8_t inputBase;
+    uint8_t fixedPointDecimalPlace;
+    //! Font index of the display
+    uint8_t fontIdx;
+    //! Cursor position, 0 is rightmost
+    uint8_t cursorPosition;
+    //! Number of tokens
+    uint8_t numTokens;
+    //! True if result is valid
+    uint8_t solved;
+    //! Result of the expression
+    SUBRESULT_INT result;
+    //! Input characters, in order
+    char tokens[SNAPSHOT_MAX_TOKENS];
+    //! Base, format and sign of each token, see snapshot.c
+    uint8_t tokenFormat[SNAPSHOT_MAX_TOKENS];
+} calcSnapshot_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Capture a snapshot of the calculator core.
+ *
+ * The font index is not part of the core, and is left as 0 for the
+ * caller to fill in.
+ * @param pCalcCoreState Pointer to the calculator core state.
+ * @param pSnapshot Pointer to the snapshot to write.
+ * @return calc_funStatus_STRING_BUFFER_ERROR if there are more than
+ * SNAPSHOT_MAX_TOKENS tokens, otherwise success.
+ */
+calc_funStatus_t snapshot_capture(calcCoreState_t *pCalcCoreState,
+                                  calcSnapshot_t *pSnapshot);
+
+/**
+ * @brief Restore a snapshot into the calculator core.
+ *
+ * The core must be initialized and have an empty input list. On failure,
+ * the input list is left empty.
+ * @param pCalcCoreState Pointer to the calculator core state.
+ * @param pSnapshot Pointer to the snapshot.
+ * @return calc_funStatus_FORMAT_ERROR if the snapshot version doesn't
+ * match, otherwise the status of adding the tokens.
+ */
+calc_funStatus_t snapshot_restore(calcCoreState_t *pCalcCoreState,
+                                  const calcSnapshot_t *pSnapshot);
+
+#endif /* SNAPSHOT_H_ */
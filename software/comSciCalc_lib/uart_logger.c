@@ -26,15 +26,29 @@ SOFTWARE.
  * This file implements a UART logger if TIVAWARE is defined,
  * otherwise it uses the normal stdout to print.
  *
- * It's also implemented to be thread safe when using FreeRTOS, using
- * a critical section. There are pros and cons to this approach, with
- * the alternative being using a semaphore instead. However, the semaphore
- * needs to be initialized and given, and a critical section can just be local
- * to this file, which makes it nice.
+ * Levels above LOG_LEVEL are removed at compile time by the logger macro,
+ * so only enabled messages reach this file.
+ *
+ * If LOG_DEFERRED is defined, messages are not formatted when logged.
+ * A record with the format string, a timestamp and the raw arguments is
+ * written to a ring buffer, which loggerFlush formats and prints later on.
+ * This keeps the slow formatting and printing out of time critical tasks.
+ *
+ * The ring is a bounded multi-producer queue where each record carries a
+ * sequence number, so writers never wait on each other or on the reader.
+ * Claiming a record is a compare-and-swap. The Cortex-M0+ has no exclusive
+ * access instructions, so on target that is a short critical section.
  */
 
 // Standard library
 #include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+
+#if !defined(LOG_LEVEL)
+// LOG_LEVEL has not been defined, so uart_logger.h disables the logger.
+#warning "WARNING: LOGGER NOT USED"
+#endif
 
 // Logger header
 #include "uart_logger.h"
@@ -48,45 +62,498 @@ SOFTWARE.
 #include "renesas_utils.h"
 #include "task.h"
 #elif defined(RP2040)
+#include "FreeRTOS.h"
 #include "rp2040_utils.h"
+#include "task.h"
+#elif defined(POSIX_SIM)
+#include "FreeRTOS.h"
+#include "posix_utils.h"
+#include "task.h"
 #else
 #include <stdio.h>
+#include <time.h>
+#endif
+
+#if (defined(TIVAWARE) || defined(EK_RA4M3) || defined(COMSCICALC_CM_V0)) ||   \
+    defined(RP2040) || defined(POSIX_SIM)
+//! Set if the logger prints over UART, with FreeRTOS available.
+#define LOGGER_UART
 #endif
 
-void logger(int8_t log_level, char *msg, ...) {
-#if defined(LOG_LEVEL)
-    // 0 is the highest prio log level.
-    // Only print statements that are at or under the
-    // LOG_LEVEL, given by the build.
+/**
+ * @brief Print a formatted string on the log output.
+ * @param msg Format string.
+ * @param vaArgP Arguments.
+ */
+static void loggerVPrint(const char *msg, va_list vaArgP) {
+#if defined(LOGGER_UART)
+    // Print using UART instead
+    UARTvprintf(msg, vaArgP);
 #else
-    // LOG_LEVEL has not been defined, always ignore then.
-#define LOG_LEVEL LOGGER_LEVEL_NONE
-#warning "WARNING: LOGGER NOT USED"
-#endif // defined(LOG_LEVEL)
+    vprintf(msg, vaArgP);
+#endif
+}
+
+#if defined(LOG_DEFERRED)
+/* ------------- DEFERRED LOG RING ------------- */
+
+#if (LOG_RING_SIZE & (LOG_RING_SIZE - 1)) != 0
+#error "LOG_RING_SIZE must be a power of 2"
+#endif
+
+/*
+ * Each record holds a sequence number for the position it is used for.
+ * To let the ring start out zeroed, the index of the record is subtracted
+ * from the sequence number before it's stored.
+ * For position pos, in record pos % LOG_RING_SIZE:
+ * - Free to write: sequence == pos
+ * - Written: sequence == pos + 1
+ * - Read, i.e. free for the next lap: sequence == pos + LOG_RING_SIZE
+ */
+
+//! The deferred log ring
+static logRecord_t logRing[LOG_RING_SIZE];
+//! Next position to write
+static volatile uint32_t ringHead = 0;
+//! Next position to read. Only used by the reader.
+static uint32_t ringTail = 0;
+//! Number of records dropped since the last flush, due to the ring being full
+static volatile uint32_t ringDropped = 0;
+
+/**
+ * @brief Type of a conversion in a format string
+ */
+typedef enum logArgType {
+    logArg_INT = 0,
+    logArg_LONG,
+    logArg_LONG_LONG,
+    logArg_SIZE,
+    logArg_POINTER,
+    logArg_DOUBLE,
+    logArg_STRING,
+    //! %%, which doesn't take an argument
+    logArg_PERCENT,
+    //! Not supported, the rest of the format string is printed as is
+    logArg_INVALID,
+} logArgType_t;
+
+/**
+ * @brief Get the current time for the timestamp.
+ * @return Time in us
+ */
+static uint32_t loggerTimestamp(void) {
+#if defined(RP2040)
+    return time_us_32();
+#elif defined(POSIX_SIM)
+    return getRunTimeCounterValue();
+#elif defined(LOGGER_UART)
+    return xTaskGetTickCount() * portTICK_PERIOD_MS * 1000;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000);
+#endif
+}
+
+/**
+ * @brief Move the ring head from pos to pos + 1, if it still is pos.
+ * @param pos Expected head position.
+ * @return True if the head was moved, i.e. the record was claimed.
+ */
+static bool ringClaim(uint32_t pos) {
+#if defined(LOGGER_UART)
+    bool claimed = false;
+    taskENTER_CRITICAL();
+    if (ringHead == pos) {
+        ringHead = pos + 1;
+        claimed = true;
+    }
+    taskEXIT_CRITICAL();
+    return claimed;
+#else
+    return __atomic_compare_exchange_n(&ringHead, &pos, pos + 1, false,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * @brief Count a dropped record.
+ */
+static void ringCountDrop(void) {
+#if defined(LOGGER_UART)
+    taskENTER_CRITICAL();
+    ringDropped++;
+    taskEXIT_CRITICAL();
+#else
+    __atomic_fetch_add(&ringDropped, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ * @brief Parse a conversion specification in a format string.
+ * @param pFmt Pointer to the char after the '%'.
+ * @param pType Set to the type of the argument.
+ * @return Pointer to the conversion char, e.g. the 'x' in "%08x".
+ */
+static const char *parseConversion(const char *pFmt, logArgType_t *pType) {
+    *pType = logArg_INT;
+    // Flags, width and precision
+    while (strchr("-+ #0123456789.", *pFmt) != NULL && *pFmt != '\0') {
+        pFmt++;
+    }
+    // Length modifiers
+    if (*pFmt == 'h') {
+        pFmt++;
+        if (*pFmt == 'h') {
+            pFmt++;
+        }
+    } else if (*pFmt == 'l') {
+        pFmt++;
+        *pType = logArg_LONG;
+        if (*pFmt == 'l') {
+            pFmt++;
+            *pType = logArg_LONG_LONG;
+        }
+    } else if (*pFmt == 'z') {
+        pFmt++;
+        *pType = logArg_SIZE;
+    }
+    switch (*pFmt) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+    case 'c':
+        break;
+    case 'p':
+        *pType = logArg_POINTER;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+        *pType = logArg_DOUBLE;
+        break;
+    case 's':
+        *pType = logArg_STRING;
+        break;
+    case '%':
+        *pType = logArg_PERCENT;
+        break;
+    default:
+        *pType = logArg_INVALID;
+        break;
+    }
+    return pFmt;
+}
+
+/**
+ * @brief Get the size of a packed argument.
+ * @param type Type of the argument, not a string.
+ * @return Size in bytes.
+ */
+static size_t argSize(logArgType_t type) {
+    switch (type) {
+    case logArg_LONG:
+        return sizeof(long);
+    case logArg_LONG_LONG:
+        return sizeof(long long);
+    case logArg_SIZE:
+        return sizeof(size_t);
+    case logArg_POINTER:
+        return sizeof(void *);
+    case logArg_DOUBLE:
+        return sizeof(double);
+    default:
+        return sizeof(int);
+    }
+}
+
+/**
+ * @brief Pack the arguments of a format string into a payload.
+ * @param pPayload Pointer to the payload.
+ * @param pFmt Format string.
+ * @param vaArgP Arguments.
+ * @return Number of bytes used. Packing stops at the first argument
+ * that doesn't fit.
+ */
+static uint8_t packArgs(uint8_t *pPayload, const char *pFmt, va_list vaArgP) {
+    uint8_t len = 0;
+    while (*pFmt != '\0') {
+        if (*pFmt++ != '%') {
+            continue;
+        }
+        logArgType_t type;
+        pFmt = parseConversion(pFmt, &type);
+        if (type == logArg_INVALID) {
+            break;
+        }
+        pFmt++;
+        if (type == logArg_PERCENT) {
+            continue;
+        }
+        if (type == logArg_STRING) {
+            const char *pStr = va_arg(vaArgP, const char *);
+            if (pStr == NULL) {
+                pStr = "(null)";
+            }
+            size_t strLen = strlen(pStr);
+            if (len + 1 > LOG_RING_PAYLOAD_SIZE) {
+                break;
+            }
+            // Truncate the string to what fits
+            size_t maxStrLen = (size_t)(LOG_RING_PAYLOAD_SIZE - len - 1);
+            if (strLen > maxStrLen) {
+                strLen = maxStrLen;
+            }
+            memcpy(&pPayload[len], pStr, strLen);
+            len += strLen;
+            pPayload[len++] = '\0';
+            continue;
+        }
+        size_t size = argSize(type);
+        if (len + size > LOG_RING_PAYLOAD_SIZE) {
+            break;
+        }
+        switch (type) {
+        case logArg_LONG: {
+            long value = va_arg(vaArgP, long);
+            memcpy(&pPayload[len], &value, size);
+            break;
+        }
+        case logArg_LONG_LONG: {
+            long long value = va_arg(vaArgP, long long);
+            memcpy(&pPayload[len], &value, size);
+            break;
+        }
+        case logArg_SIZE: {
+            size_t value = va_arg(vaArgP, size_t);
+            memcpy(&pPayload[len], &value, size);
+            break;
+        }
+        case logArg_POINTER: {
+            void *value = va_arg(vaArgP, void *);
+            memcpy(&pPayload[len], &value, size);
+            break;
+        }
+        case logArg_DOUBLE: {
+            double value = va_arg(vaArgP, double);
+            memcpy(&pPayload[len], &value, size);
+            break;
+        }
+        default: {
+            int value = va_arg(vaArgP, int);
+            memcpy(&pPayload[len], &value, size);
+            break;
+        }
+        }
+        len += size;
+    }
+    return len;
+}
+
+/**
+ * @brief Print a formatted string on the log output.
+ * @param msg Format string.
+ */
+static void loggerPrint(const char *msg, ...) {
+    va_list vaArgP;
+    va_start(vaArgP, msg);
+    loggerVPrint(msg, vaArgP);
+    va_end(vaArgP);
+}
+
+/**
+ * @brief Format and print a record.
+ * @param pRecord Pointer to the record.
+ */
+static void printRecord(const logRecord_t *pRecord) {
+    const char *pFmt = pRecord->pFmt;
+    const uint8_t *pPayload = pRecord->payload;
+    uint8_t idx = 0;
+    loggerPrint("[%u] ", pRecord->timestamp);
+    while (*pFmt != '\0') {
+        // Print the text up to the next conversion
+        const char *pPercent = strchr(pFmt, '%');
+        if (pPercent == NULL) {
+            loggerPrint("%s", pFmt);
+            break;
+        }
+        if (pPercent != pFmt) {
+            loggerPrint("%.*s", (int)(pPercent - pFmt), pFmt);
+        }
+        logArgType_t type;
+        const char *pConv = parseConversion(pPercent + 1, &type);
+        if (type == logArg_INVALID) {
+            // Print the rest as is
+            loggerPrint("%s", pPercent);
+            break;
+        }
+        pFmt = pConv + 1;
+        // Copy the conversion, e.g. "%08x", to print the argument with
+        char spec[16] = {0};
+        size_t specLen = pFmt - pPercent;
+        if (specLen >= sizeof(spec)) {
+            specLen = sizeof(spec) - 1;
+        }
+        memcpy(spec, pPercent, specLen);
+        if (type == logArg_PERCENT) {
+            loggerPrint("%%");
+            continue;
+        }
+        if (type == logArg_STRING) {
+            if (idx >= pRecord->len) {
+                loggerPrint("<?>");
+                continue;
+            }
+            const char *pStr = (const char *)&pPayload[idx];
+            loggerPrint(spec, pStr);
+            idx += strlen(pStr) + 1;
+            continue;
+        }
+        size_t size = argSize(type);
+        if (idx + size > pRecord->len) {
+            // The argument didn't fit in the record
+            loggerPrint("<?>");
+            continue;
+        }
+        switch (type) {
+        case logArg_LONG: {
+            long value;
+            memcpy(&value, &pPayload[idx], size);
+            loggerPrint(spec, value);
+            break;
+        }
+        case logArg_LONG_LONG: {
+            long long value;
+            memcpy(&value, &pPayload[idx], size);
+            loggerPrint(spec, value);
+            break;
+        }
+        case logArg_SIZE: {
+            size_t value;
+            memcpy(&value, &pPayload[idx], size);
+            loggerPrint(spec, value);
+            break;
+        }
+        case logArg_POINTER: {
+            void *value;
+            memcpy(&value, &pPayload[idx], size);
+            loggerPrint(spec, value);
+            break;
+        }
+        case logArg_DOUBLE: {
+            double value;
+            memcpy(&value, &pPayload[idx], size);
+            loggerPrint(spec, value);
+            break;
+        }
+        default: {
+            int value;
+            memcpy(&value, &pPayload[idx], size);
+            loggerPrint(spec, value);
+            break;
+        }
+        }
+        idx += size;
+    }
+}
+
+void loggerWrite(int8_t log_level, const char *msg, ...) {
+    uint32_t timestamp = loggerTimestamp();
+    logRecord_t *pRecord;
+    uint32_t pos;
+    // Claim the record at the head
+    do {
+        pos = ringHead;
+        pRecord = &logRing[pos & (LOG_RING_SIZE - 1)];
+        uint32_t index = pos & (LOG_RING_SIZE - 1);
+        if (pRecord->sequence + index != pos) {
+            // The reader hasn't caught up, so the ring is full.
+            ringCountDrop();
+            return;
+        }
+    } while (!ringClaim(pos));
+
+    pRecord->timestamp = timestamp;
+    pRecord->pFmt = msg;
+    pRecord->level = log_level;
+    va_list vaArgP;
+    va_start(vaArgP, msg);
+    pRecord->len = packArgs(pRecord->payload, msg, vaArgP);
+    va_end(vaArgP);
+    // Publish the record once it has been written
+    __sync_synchronize();
+    pRecord->sequence = pos + 1 - (pos & (LOG_RING_SIZE - 1));
+}
+
+bool loggerFlush(void) {
+    bool printed = false;
+    while (1) {
+        uint32_t index = ringTail & (LOG_RING_SIZE - 1);
+        logRecord_t *pRecord = &logRing[index];
+        if (pRecord->sequence + index != ringTail + 1) {
+            // Nothing more to read
+            break;
+        }
+        __sync_synchronize();
+        printRecord(pRecord);
+        printed = true;
+        // Hand the record back to the writers for the next lap.
+        __sync_synchronize();
+        pRecord->sequence = ringTail + LOG_RING_SIZE - index;
+        ringTail++;
+    }
+    if (ringDropped != 0) {
+        uint32_t dropped = ringDropped;
+        loggerPrint("[%u log records dropped]\r\n", dropped);
+        // Writers may have dropped more in the meantime, which are reported
+        // on the next flush.
+#if defined(LOGGER_UART)
+        taskENTER_CRITICAL();
+        ringDropped -= dropped;
+        taskEXIT_CRITICAL();
+#else
+        __atomic_fetch_sub(&ringDropped, dropped, __ATOMIC_RELAXED);
+#endif
+        printed = true;
+    }
+    return printed;
+}
+
+#else
+void loggerWrite(int8_t log_level, const char *msg, ...) {
+    // The logger macro already filters, but this may be called directly.
     if (log_level > LOG_LEVEL) {
         return;
     }
-#if (defined(TIVAWARE) || defined(EK_RA4M3) || defined(COMSCICALC_CM_V0)) ||   \
-    defined(RP2040)
 #if defined(TIVAWARE)
     // Enter critical section, only if non-ISR UART is used.
     // taskENTER_CRITICAL();
 #endif
 
-    // Print using UART instead
     va_list vaArgP;
     va_start(vaArgP, msg);
-    UARTvprintf(msg, vaArgP);
+    loggerVPrint(msg, vaArgP);
     va_end(vaArgP);
 
 #if defined(TIVAWARE)
     // Exit critical section, only if non-ISR UART is used.
     // taskEXIT_CRITICAL();
 #endif
-#else
-    va_list argp;
-    va_start(argp, msg);
-    vprintf(msg, argp);
-    va_end(argp);
-#endif //(defined(TIVAWARE) || defined(EK_RA4M3) || defined(COMSCICALC_CM_V0))
+}
+#endif // defined(LOG_DEFERRED)
+
+void loggerWriteImmediate(int8_t log_level, const char *msg, ...) {
+    if (log_level > LOG_LEVEL) {
+        return;
+    }
+    va_list vaArgP;
+    va_start(vaArgP, msg);
+    loggerVPrint(msg, vaArgP);
+    va_end(vaArgP);
 }
@@ -25,6 +25,7 @@ SOFTWARE.
 #ifndef UART_LOGGER_H_
 #define UART_LOGGER_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 
 //! Disable logger
@@ -36,18 +37,110 @@ SOFTWARE.
 //! Debug logger level. Prints when LOGGER_LEVEL is defined as >= 2
 #define LOGGER_LEVEL_DEBUG (0x02)
 
+#if !defined(LOG_LEVEL)
+//! LOG_LEVEL has not been defined, so the logger is not used.
+#define LOG_LEVEL LOGGER_LEVEL_NONE
+#endif
+
+#if defined(LOG_DEFERRED)
+//! Number of records in the deferred log ring. Must be a power of 2.
+#define LOG_RING_SIZE 64
+//! Bytes of argument data in each record. Strings are copied in here.
+#define LOG_RING_PAYLOAD_SIZE 24
+
 /**
- * @brief Prints logger statements to stdout, or UART if TIVAWARE is defined.
+ * @brief Record in the deferred log ring
+ */
+typedef struct logRecord {
+    //! Sequence number handing the record between writers and the reader
+    volatile uint32_t sequence;
+    //! Timestamp in us
+    uint32_t timestamp;
+    //! Format string. The address doubles as the ID of the format string.
+    const char *pFmt;
+    //! Log level
+    int8_t level;
+    //! Number of bytes used in the payload
+    uint8_t len;
+    //! Raw arguments, packed in the order of the format string
+    uint8_t payload[LOG_RING_PAYLOAD_SIZE];
+} logRecord_t;
+#endif
+
+/**
+ * @brief Log a message, if log_level is at or under LOG_LEVEL.
+ *
+ * Levels above LOG_LEVEL compile to nothing, arguments included, as long
+ * as log_level is a constant.
  *
- * @note The UART printing uses a FreeRTOS critical section protection.
+ * With LOG_DEFERRED defined, the message isn't formatted here. Instead a
+ * compact record is written to a ring buffer, and formatted later by
+ * loggerFlush. See loggerWrite.
  *
- * @param pCalcCoreState Pointer to an allocated core state variable.
- * @param LOG_LEVEL The log level of this message.
+ * @param log_level The log level of this message.
+ * @param ... Format string followed by its arguments.
+ */
+#define logger(log_level, ...)                                                 \
+    do {                                                                       \
+        if ((log_level) <= LOG_LEVEL) {                                        \
+            loggerWrite((log_level), __VA_ARGS__);                             \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief Log a message without deferring it, if log_level is at or
+ * under LOG_LEVEL.
+ *
+ * Meant for bulk output that the user asked for, such as diagnostic
+ * dumps, which would not fit in the deferred log ring.
+ *
+ * @param log_level The log level of this message.
+ * @param ... Format string followed by its arguments.
+ */
+#define loggerImmediate(log_level, ...)                                        \
+    do {                                                                       \
+        if ((log_level) <= LOG_LEVEL) {                                        \
+            loggerWriteImmediate((log_level), __VA_ARGS__);                    \
+        }                                                                      \
+    } while (0)
+
+/**
+ * @brief Write a log message. Use the logger macro instead.
+ *
+ * Prints to stdout, or to UART on target. With LOG_DEFERRED defined,
+ * the record holds the address of the format string, a timestamp and the
+ * raw arguments. %s arguments are copied, so they may point to temporary
+ * buffers. Records are dropped if the ring is full.
+ *
+ * @param log_level The log level of this message.
+ * @param msg Format string.
+ * @return None.
+ */
+void loggerWrite(int8_t log_level, const char *msg, ...);
+
+/**
+ * @brief Print a log message right away. Use the loggerImmediate macro
+ * instead.
+ * @param log_level The log level of this message.
+ * @param msg Format string.
  * @return None.
- * @warning This uses critical section to protect the shared resources,
- * hence it should not be used in project with critical interrupt timings.
- * For that, the critical section should be replaced with a semaphore.
  */
-void logger(int8_t log_level, char *msg, ...);
+void loggerWriteImmediate(int8_t log_level, const char *msg, ...);
+
+#if defined(LOG_DEFERRED)
+/**
+ * @brief Format and print all records in the deferred log ring.
+ *
+ * This should be called from a low priority task, as it prints
+ * synchronously. Only one task may call it.
+ * @return True if any record was printed.
+ */
+bool loggerFlush(void);
+
+//! Static RAM used by the deferred log ring, in bytes.
+#define LOG_RING_BYTES (LOG_RING_SIZE * sizeof(logRecord_t))
+#else
+#define LOG_RING_BYTES 0
+#endif
 
 #endif /* UART_LOGGER_H_ */
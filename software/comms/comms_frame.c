@@ -0,0 +1,167 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Protocol layer messages. See comms_frame.h and README.md.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <stddef.h>
+#include <string.h>
+
+#include "comms_frame.h"
+
+/* ----------------- DEFINES ----------------- */
+//! Byte offsets in the header
+#define HEADER_ML 3
+#define HEADER_MT 4
+#define HEADER_SETTINGS 5
+
+static const uint8_t som[] = {COMMS_SOM_0, COMMS_SOM_1, COMMS_SOM_2};
+
+/* ------------- FUNCTION DEFINITIONS ------------- */
+
+uint8_t comms_checksum(const uint8_t *pData, size_t length) {
+    uint8_t sum = 0;
+    for (size_t i = 0; i < length; i++) {
+        sum += pData[i];
+    }
+    return (uint8_t)(0x100 - sum);
+}
+
+uint16_t comms_crc16(const uint8_t *pData, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)pData[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            if (crc & 0x8000) {
+                crc = (uint16_t)(crc << 1) ^ 0x1021;
+            } else {
+                crc = (uint16_t)(crc << 1);
+            }
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Length of the checksum and CRC fields of a message.
+ * @param settings Settings of the message.
+ * @return Number of bytes after the body.
+ */
+static size_t trailerLength(uint32_t settings) {
+    size_t length = 0;
+    if (settings & COMMS_SETTING_CHECKSUM) {
+        length += 1;
+    }
+    if (settings & COMMS_SETTING_CRC) {
+        length += 2;
+    }
+    return length;
+}
+
+size_t comms_encode(const commsFrame_t *pFrame, uint8_t *pBuf,
+                    size_t bufSize) {
+    size_t checkedLength = COMMS_HEADER_LEN + pFrame->bodyLen;
+    size_t frameLength = checkedLength + trailerLength(pFrame->settings);
+    if (frameLength > bufSize) {
+        return 0;
+    }
+    memcpy(pBuf, som, sizeof(som));
+    pBuf[HEADER_ML] = pFrame->bodyLen;
+    pBuf[HEADER_MT] = pFrame->msgType;
+    // Largest byte first
+    pBuf[HEADER_SETTINGS] = (uint8_t)(pFrame->settings >> 16);
+    pBuf[HEADER_SETTINGS + 1] = (uint8_t)(pFrame->settings >> 8);
+    pBuf[HEADER_SETTINGS + 2] = (uint8_t)pFrame->settings;
+    memcpy(&pBuf[COMMS_HEADER_LEN], pFrame->body, pFrame->bodyLen);
+    size_t length = checkedLength;
+    // Both the checksum and the CRC cover the header and body only.
+    if (pFrame->settings & COMMS_SETTING_CHECKSUM) {
+        pBuf[length] = comms_checksum(pBuf, checkedLength);
+        length += 1;
+    }
+    if (pFrame->settings & COMMS_SETTING_CRC) {
+        uint16_t crc = comms_crc16(pBuf, checkedLength);
+        pBuf[length] = (uint8_t)(crc >> 8);
+        pBuf[length + 1] = (uint8_t)crc;
+        length += 2;
+    }
+    return length;
+}
+
+commsDecodeStatus_t comms_decode(const uint8_t *pBuf, size_t length,
+                                 commsFrame_t *pFrame, size_t *pConsumed) {
+    // Find the first position that starts with a SOM, or with the part of
+    // one that fits in the buffer.
+    size_t start = 0;
+    while (start < length) {
+        size_t numCompare = length - start;
+        if (numCompare > sizeof(som)) {
+            numCompare = sizeof(som);
+        }
+        if (memcmp(&pBuf[start], som, numCompare) == 0) {
+            break;
+        }
+        start++;
+    }
+    if (start > 0) {
+        *pConsumed = start;
+        return commsDecode_SKIPPED;
+    }
+    *pConsumed = 0;
+    if (length < COMMS_HEADER_LEN) {
+        return commsDecode_INCOMPLETE;
+    }
+    uint8_t bodyLen = pBuf[HEADER_ML];
+    uint32_t settings = (uint32_t)pBuf[HEADER_SETTINGS] << 16 |
+                        (uint32_t)pBuf[HEADER_SETTINGS + 1] << 8 |
+                        (uint32_t)pBuf[HEADER_SETTINGS + 2];
+    size_t checkedLength = COMMS_HEADER_LEN + bodyLen;
+    size_t frameLength = checkedLength + trailerLength(settings);
+    if (length < frameLength) {
+        return commsDecode_INCOMPLETE;
+    }
+    *pConsumed = frameLength;
+
+    size_t pos = checkedLength;
+    if (settings & COMMS_SETTING_CHECKSUM) {
+        if (comms_checksum(pBuf, checkedLength) != pBuf[pos]) {
+            return commsDecode_CHECK_ERROR;
+        }
+        pos += 1;
+    }
+    if (settings & COMMS_SETTING_CRC) {
+        uint16_t crc = (uint16_t)(pBuf[pos] << 8 | pBuf[pos + 1]);
+        if (comms_crc16(pBuf, checkedLength) != crc) {
+            return commsDecode_CHECK_ERROR;
+        }
+    }
+    pFrame->msgType = pBuf[HEADER_MT];
+    pFrame->settings = settings;
+    pFrame->bodyLen = bodyLen;
+    memcpy(pFrame->body, &pBuf[COMMS_HEADER_LEN], bodyLen);
+    return commsDecode_FRAME;
+}
@@ -0,0 +1,165 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef COMMS_FRAME_H_
+#define COMMS_FRAME_H_
+
+/*
+ * Encoding and decoding of protocol layer messages, see README.md in this
+ * directory. Hardware agnostic, so the same code can run on the device and
+ * on the host.
+ */
+
+// Standard library
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* ----------------- DEFINES ----------------- */
+
+//! Start Of Message, the APC escape sequence
+#define COMMS_SOM_0 0x1B
+#define COMMS_SOM_1 0x5F
+#define COMMS_SOM_2 0x9F
+
+//! Header length: SOM, ML, MT and settings
+#define COMMS_HEADER_LEN 8
+//! Longest body, limited by the one byte ML field
+#define COMMS_MAX_BODY_LEN 255
+//! Longest message, incl. both checksum and CRC
+#define COMMS_MAX_FRAME_LEN (COMMS_HEADER_LEN + COMMS_MAX_BODY_LEN + 3)
+
+//! Message types, can be ORed. A message type of 0 is a connection event.
+#define COMMS_MT_DATA 0x01
+#define COMMS_MT_ACK 0x02
+#define COMMS_MT_NACK 0x04
+#define COMMS_MT_RETRANSMISSION 0x08
+
+//! Settings: the message ends with a one byte checksum
+#define COMMS_SETTING_CHECKSUM 0x000001
+//! Settings: the message ends with a two byte CRC
+#define COMMS_SETTING_CRC 0x000002
+//! Settings: timeout and retries fields
+#define COMMS_SETTING_TIMEOUT(settings) (((settings) >> 4) & 0xF)
+#define COMMS_SETTING_RETRIES(settings) (((settings) >> 8) & 0xF)
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief Link layer header, the first byte of the body.
+ */
+typedef enum commsLinkType {
+    //! Calculator state, device to host
+    commsLink_STATE = 0x01,
+    //! Calculator input, i.e. keystrokes, host to device
+    commsLink_INPUT = 0x02,
+    //! Request for data
+    commsLink_REQUEST = 0x03,
+    //! Response for data
+    commsLink_RESPONSE = 0x04,
+    //! New program
+    commsLink_NEW_PROGRAM = 0x05,
+    //! Expression to evaluate, host to device
+    commsLink_EVAL = 0x06,
+    //! Result of an expression, device to host
+    commsLink_RESULT = 0x07,
+    //! Number format of the calculator, host to device
+    commsLink_FORMAT = 0x08,
+} commsLinkType_t;
+
+/**
+ * @brief One protocol layer message.
+ */
+typedef struct commsFrame {
+    //! Message type, COMMS_MT_*
+    uint8_t msgType;
+    //! Settings, COMMS_SETTING_*. Only the lower 24 bits are sent.
+    uint32_t settings;
+    //! Number of bytes in the body
+    uint8_t bodyLen;
+    //! Body, i.e. the link layer data
+    uint8_t body[COMMS_MAX_BODY_LEN];
+} commsFrame_t;
+
+/**
+ * @brief Result of decoding a buffer.
+ */
+typedef enum commsDecodeStatus {
+    //! A message was decoded
+    commsDecode_FRAME = 0,
+    //! The buffer holds the start of a message, but not all of it
+    commsDecode_INCOMPLETE = 1,
+    //! The buffer doesn't start with a message, bytes were skipped
+    commsDecode_SKIPPED = 2,
+    //! A whole message was received, but the checksum or CRC is wrong
+    commsDecode_CHECK_ERROR = 3,
+} commsDecodeStatus_t;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Checksum of a message, i.e. the two's complement of the sum of
+ * all bytes, so that the sum of the message and its checksum is 0.
+ * @param pData Pointer to the data.
+ * @param length Number of bytes.
+ * @return The checksum.
+ */
+uint8_t comms_checksum(const uint8_t *pData, size_t length);
+
+/**
+ * @brief CRC of a message, CRC-16/CCITT-FALSE (polynomial 0x1021, initial
+ * value 0xFFFF). Sent largest byte first.
+ * @param pData Pointer to the data.
+ * @param length Number of bytes.
+ * @return The CRC.
+ */
+uint16_t comms_crc16(const uint8_t *pData, size_t length);
+
+/**
+ * @brief Encode a message, adding checksum and CRC as set in the settings.
+ * @param pFrame Pointer to the message.
+ * @param pBuf Pointer to the output buffer.
+ * @param bufSize Size of the output buffer, COMMS_MAX_FRAME_LEN always fits.
+ * @return Number of bytes written, or 0 if the message didn't fit.
+ */
+size_t comms_encode(const commsFrame_t *pFrame, uint8_t *pBuf,
+                    size_t bufSize);
+
+/**
+ * @brief Decode the message at the start of a buffer.
+ *
+ * Bytes in front of a SOM, e.g. ASCII output, are skipped, so a receiver
+ * can call this until it returns commsDecode_INCOMPLETE, dropping the
+ * consumed bytes each time. Several messages can be in the buffer at once.
+ * @param pBuf Pointer to the received bytes.
+ * @param length Number of received bytes.
+ * @param pFrame Pointer to where the message is written.
+ * @param pConsumed Pointer to where the number of bytes to drop from the
+ * start of the buffer is written. 0 if incomplete.
+ * @return commsDecode_FRAME if a message was decoded.
+ */
+commsDecodeStatus_t comms_decode(const uint8_t *pBuf, size_t length,
+                                 commsFrame_t *pFrame, size_t *pConsumed);
+
+#endif /* COMMS_FRAME_H_ */
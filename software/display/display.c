@@ -30,8 +30,10 @@ SOFTWARE.
 #include "EVE.h"
 #include "display.h"
 #include "firmware_common.h"
+#include "latency_trace.h"
 #include "menu.h"
 #include "print_utils.h"
+#include "ram_g_alloc.h"
 #include "uart_logger.h"
 
 //! Binary result string buffer
@@ -93,10 +95,32 @@ static void displayOutline(void) {
     EVE_cmd_dl(VERTEX2F(VERT_LOW_OUTLINE_X * 16, VERT_LOW_OUTLINE_Y1 * 16));
 }
 
+/**
+ * @brief Sleep until the FT81x co-processor has consumed its command FIFO.
+ * The EVE INTn line wakes the display task through a task notification.
+ * @return Nothing
+ */
+static void waitForCoprocessor(void) {
+    while (1) {
+        // Reading the flags clears them and releases INTn, so a new
+        // CMDEMPTY interrupt gives a new falling edge.
+        EVE_memRead8(REG_INT_FLAGS);
+        if (!EVE_busy()) {
+            return;
+        }
+        ulTaskNotifyTakeIndexed(DISPLAY_NOTIFY_EVE_INDEX, pdTRUE,
+                                DISPLAY_EVE_WAIT_TICKS);
+    }
+}
+
 /**
  * @brief Starts the display list, clear local buffers and clears color buffers
  */
 void startDisplaylist(void) {
+    // The previous display list may still be executing. Wait for it here
+    // rather than in endDisplayList, so that the next frame can be prepared
+    // while the co-processor is busy.
+    waitForCoprocessor();
     EVE_start_cmd_burst();
     EVE_cmd_dl_burst(CMD_DLSTART);
     EVE_cmd_dl_burst(DL_CLEAR_COLOR_RGB | BLACK);
@@ -105,86 +129,172 @@ void startDisplaylist(void) {
 
 /**
  * @brief End the display list by sending display and swap DL
+ * @note This does not wait for the co-processor to finish. The next call
+ * to startDisplaylist will.
  */
 void endDisplayList(void) {
     EVE_cmd_dl_burst(DL_DISPLAY);
     EVE_cmd_dl_burst(CMD_SWAP);
     EVE_end_cmd_burst();
-    // Wait until EVE is not busy anymore to ensure conclusion of command.
-    while (EVE_busy())
-        ;
 }
 
-//! Offset used when programming custom fonts into RAM_G
-static uint32_t ram_g_address_offset = 0;
 /**
  * @brief Program font to the FT81x
  * @param pFont Pointer to the font struct
  * @param fontIndex The index in FT81x this font will get
- * @return Nothing
+ * @param owner Owner tag of the RAM_G block, i.e. the index of the font
+ * collection in pFontLibraryTable
+ * @return True if the font was programmed, false if it did not fit in RAM_G
  * @warning This function assumes that the first char is a space.
  * If this is not the case, the setfont2 functions last parameter
  * must be changed.
  */
-void programFont(font_t *pFont, uint8_t fontIndex) {
-    uint32_t thisFontsAddress = EVE_RAM_G + ram_g_address_offset;
+static bool programFont(font_t *pFont, uint8_t fontIndex, uint8_t owner) {
     // Null check the pointer
     if (pFont == NULL) {
-        return;
+        return true;
     }
     // If this is a ROM font, or of the pointer to the table is NULL, then
-    // return
+    // there's nothing to upload.
     if (pFont->rom_font == true || pFont->pFontTable == NULL) {
-        return;
+        return true;
     }
-    // Write the bitmap of the pFont to the graphics RAM if there is room.
-    if (ram_g_address_offset + pFont->fontTableSize < EVE_RAM_G_SIZE) {
-        // Program the font
-        EVE_memWrite_sram_buffer(EVE_RAM_G + ram_g_address_offset,
-                                 pFont->pFontTable, pFont->fontTableSize);
-        // Program the offset for the font.
-        // This is at offset 144 in the font table,
-        // and is per default set to 148, which is the offset
-        // of the font to the start of the raw data.
-        // However, if programming more than 1 font, this offset
-        // needs to change, as it's the offset to the start of RAM_G
-        // Hence, it should be the ram_g_address_offset
-        uint32_t offsetInRam = ram_g_address_offset + 148;
-        EVE_memWrite_sram_buffer(EVE_RAM_G + ram_g_address_offset + 144,
-                                 (uint8_t *)&offsetInRam, 4);
-        ram_g_address_offset += pFont->fontTableSize;
-        // Round up to the nearest four byte aligned address:
-        uint32_t offset = ram_g_address_offset % 4;
-        ram_g_address_offset += offset;
+    uint32_t thisFontsAddress = ramGAlloc(pFont->fontTableSize, owner);
+    if (thisFontsAddress == RAM_G_INVALID_ADDRESS) {
+        return false;
+    }
+    // Don't write over SPI while a display list is still being sent.
+    waitForCoprocessor();
+    // Program the font
+    if (pFont->bitmapDeflatedSize != 0) {
+        // Only the metric block is stored as is. The bitmap is
+        // inflated by the co-processor directly into RAM_G.
+        EVE_memWrite_sram_buffer(thisFontsAddress, pFont->pFontTable,
+                                 FONT_METRIC_BLOCK_SIZE);
+        EVE_cmd_inflate(thisFontsAddress + FONT_METRIC_BLOCK_SIZE,
+                        pFont->pFontTable + FONT_METRIC_BLOCK_SIZE,
+                        pFont->bitmapDeflatedSize);
     } else {
-        logger(LOGGER_LEVEL_ERROR, "\r\nERROR: Font not programmed!\r\n\r\n");
-        return;
+        EVE_memWrite_sram_buffer(thisFontsAddress, pFont->pFontTable,
+                                 pFont->fontTableSize);
     }
+    // Program the offset for the font.
+    // This is the last word of the metric block,
+    // and is per default set to 148, which is the offset
+    // of the font to the start of the raw data.
+    // However, since the font can be placed anywhere in RAM_G,
+    // it has to be the address of the raw data.
+    uint32_t offsetInRam = thisFontsAddress + FONT_METRIC_BLOCK_SIZE;
+    EVE_memWrite_sram_buffer(thisFontsAddress + FONT_METRIC_BLOCK_SIZE - 4,
+                             (uint8_t *)&offsetInRam, 4);
     // This must be in a display list to register the new font
     startDisplaylist();
     // CMD_SETBITMAP not mandatory if using setfont2
     EVE_cmd_setfont2_burst(fontIndex, thisFontsAddress, 32);
 
     endDisplayList();
+    pFont->ft81x_font_index = fontIndex;
+    return true;
 }
 
+//! True if the font collection at that index is resident in RAM_G
+static bool fontCollectionResident[MAX_LEN_FONT_LIBRARY_TABLE] = {false};
+//! Value of fontUseCounter the last time each collection was loaded
+static uint32_t fontCollectionLastUse[MAX_LEN_FONT_LIBRARY_TABLE] = {0};
+//! Incremented every time a font collection is loaded
+static uint32_t fontUseCounter = 0;
+
 /**
- * @brief Programs the font library
- * @return None
+ * @brief Evict the least recently used resident font collection
+ * @param keepIdx Index of a collection which must not be evicted
+ * @return True if a collection was evicted, false if there was none
  */
-void programFontLibrary(void) {
-    // Go through all entries in the font library,
-    // and program the large font at the even indexes, followed by the
-    // small font add the odd ones.
+static bool evictFontCollection(uint8_t keepIdx) {
+    int victim = -1;
     for (uint8_t i = 0; i < MAX_LEN_FONT_LIBRARY_TABLE; i++) {
-        if (pFontLibraryTable[i] != NULL) {
-            // Program the large index:
-            programFont(pFontLibraryTable[i]->pLargeFont, i * 2);
-            pFontLibraryTable[i]->pLargeFont->ft81x_font_index = i * 2;
-            programFont(pFontLibraryTable[i]->pSmallFont, i * 2 + 1);
-            pFontLibraryTable[i]->pSmallFont->ft81x_font_index = i * 2 + 1;
+        if (i == keepIdx || !fontCollectionResident[i]) {
+            continue;
         }
+        if (victim < 0 ||
+            fontCollectionLastUse[i] < fontCollectionLastUse[victim]) {
+            victim = i;
+        }
+    }
+    if (victim < 0) {
+        return false;
+    }
+    logger(LOGGER_LEVEL_DEBUG, "Evicting font collection %i from RAM_G\r\n",
+           victim);
+    ramGFree(victim);
+    fontCollectionResident[victim] = false;
+    return true;
+}
+
+bool loadFontCollection(uint8_t fontIdx) {
+    if (fontIdx >= MAX_LEN_FONT_LIBRARY_TABLE ||
+        pFontLibraryTable[fontIdx] == NULL) {
+        return false;
+    }
+    fontCollectionLastUse[fontIdx] = ++fontUseCounter;
+    if (fontCollectionResident[fontIdx]) {
+        return true;
+    }
+    // Program the large font at the even indexes, followed by the
+    // small font add the odd ones. If they don't fit, evict other
+    // collections until they do.
+    font_collection_t *pCollection = pFontLibraryTable[fontIdx];
+    while (!programFont(pCollection->pLargeFont, fontIdx * 2, fontIdx) ||
+           !programFont(pCollection->pSmallFont, fontIdx * 2 + 1, fontIdx)) {
+        // Free anything that was programmed for this collection.
+        ramGFree(fontIdx);
+        if (!evictFontCollection(fontIdx)) {
+            logger(LOGGER_LEVEL_ERROR,
+                   "\r\nERROR: Font collection %i does not fit in "
+                   "RAM_G!\r\n\r\n",
+                   fontIdx);
+            return false;
+        }
+    }
+    fontCollectionResident[fontIdx] = true;
+    return true;
+}
+
+/**
+ * @brief Get the code of a char in a font
+ * @param pFont Pointer to the font struct
+ * @param c ASCII char
+ * @return The code the FT81x uses for the char in this font
+ */
+static CALC_HOT uint8_t fontMapChar(font_t *pFont, char c) {
+    if (pFont->pCharMap == NULL) {
+        return (uint8_t)c;
     }
+    return pFont->pCharMap[(uint8_t)c & 0x7F];
+}
+
+/**
+ * @brief Write a text string using a font. Subset fonts
+ * are remapped before being sent to the FT81x.
+ * @param x X coordinate of the text
+ * @param y Y coordinate of the text
+ * @param pFont Pointer to the font struct
+ * @param options EVE text options
+ * @param pString Null terminated string to write
+ * @return Nothing
+ */
+static CALC_HOT void displayText(int16_t x, int16_t y, font_t *pFont,
+                                 uint16_t options, const char *pString) {
+    if (pFont->pCharMap == NULL) {
+        EVE_cmd_text_burst(x, y, pFont->ft81x_font_index, options, pString);
+        return;
+    }
+    char pMapped[MAX_PRINTED_BUFFER_LEN];
+    uint16_t i = 0;
+    for (; i < MAX_PRINTED_BUFFER_LEN - 1 && pString[i] != '\0'; i++) {
+        pMapped[i] = (char)fontMapChar(pFont, pString[i]);
+    }
+    pMapped[i] = '\0';
+    EVE_cmd_text_burst(x, y, pFont->ft81x_font_index, options, pMapped);
 }
 
 /**
@@ -195,13 +305,14 @@ void programFontLibrary(void) {
  * @warning This function assumes that the first char is a space,
  * and follows the ASCII char setup
  */
-uint8_t getFontCharWidth(font_t *pFont, char c) {
+CALC_HOT uint8_t getFontCharWidth(font_t *pFont, char c) {
     // The font table contains a LUT for the char widths,
     // so using the char as an index, the width is simply the
     // value at that index. Conveniently, it's the first data
-    // in the struct
+    // in the struct. For subset fonts, the table is indexed
+    // by the remapped char.
     if (!pFont->rom_font) {
-        return pFont->pFontTable[(uint8_t)c];
+        return pFont->pFontTable[fontMapChar(pFont, c)];
     } else {
         // TODO: How to find the width of a ROM font?
         return pFont->font_x_width;
@@ -274,9 +385,9 @@ void displayCalcState(displayState_t *pDisplayState) {
             bitWidthString, pInputFormatString, pOutputFormatString);
     font_t *pCurrentFont =
         pFontLibraryTable[pDisplayState->fontIdx]->pSmallFont;
-    EVE_cmd_text_burst(OUTPUT_STATUS_X0,
-                       OUTPUT_STATUS_YC0(pCurrentFont->font_caps_height),
-                       pCurrentFont->ft81x_font_index, 0, pStatusString);
+    displayText(OUTPUT_STATUS_X0,
+                OUTPUT_STATUS_YC0(pCurrentFont->font_caps_height), pCurrentFont,
+                0, pStatusString);
 }
 
 /**
@@ -289,7 +400,8 @@ void displayCalcState(displayState_t *pDisplayState) {
 #define VISIBLE_INPUT_X_BUFFER (5)
 //! How many horizontal pixels are allocated for the input area
 #define VISIBLE_INPUT_X_AREA_PX (EVE_HSIZE - VISIBLE_INPUT_X_BUFFER)
-void displayInputText(displayState_t *pDisplayState, bool writeCursor) {
+CALC_HOT void displayInputText(displayState_t *pDisplayState,
+                               bool writeCursor) {
 
     uint8_t colorWheelIndex = 0; // Maximum COLORWHEEL_LEN
 
@@ -358,10 +470,9 @@ void displayInputText(displayState_t *pDisplayState, bool writeCursor) {
                            (numLinesWrap - displayWrapOffset) *
                                (pCurrentFont->font_caps_height + 5);
         // Print one colored char
-        EVE_cmd_text_burst(
-            currentLineWidth,
-            yOffset, // INPUT_TEXT_YC0(pCurrentFont->font_caps_height),
-            pCurrentFont->ft81x_font_index, INPUT_TEXT_OPTIONS, pTmpRxBuf);
+        displayText(currentLineWidth,
+                    yOffset, // INPUT_TEXT_YC0(pCurrentFont->font_caps_height),
+                    pCurrentFont, INPUT_TEXT_OPTIONS, pTmpRxBuf);
 
         // Decrease color index if closing bracket.
         if (pDisplayState->printedInputBuffer[charIter] == ')') {
@@ -391,10 +502,9 @@ void displayInputText(displayState_t *pDisplayState, bool writeCursor) {
         uint32_t yOffset = INPUT_TEXT_YC0(pCurrentFont->font_caps_height) -
                            (numLinesWrap - displayWrapOffset) *
                                (pCurrentFont->font_caps_height + 5);
-        EVE_cmd_text_burst(widthWrittenCharsUntilCursor +
-                               getFontCharWidth(pCurrentFont, ' ') / 2,
-                           yOffset, pCurrentFont->ft81x_font_index,
-                           INPUT_TEXT_OPTIONS, "|");
+        displayText(widthWrittenCharsUntilCursor +
+                        getFontCharWidth(pCurrentFont, ' ') / 2,
+                    yOffset, pCurrentFont, INPUT_TEXT_OPTIONS, "|");
     }
 }
 
@@ -428,9 +538,9 @@ void initDisplayState(displayState_t *pDisplayState) {
  * @param pFont Pointer to font
  * @return Nothing
  */
-static void displayResultWithinBounds(char *pString, uint16_t yStart,
-                                      uint16_t xStart, uint16_t xMax,
-                                      font_t *pFont) {
+static CALC_HOT void displayResultWithinBounds(char *pString, uint16_t yStart,
+                                               uint16_t xStart, uint16_t xMax,
+                                               font_t *pFont) {
 
     // Iterate through each char until null pointer
     uint16_t charIter = 0;
@@ -475,14 +585,13 @@ static void displayResultWithinBounds(char *pString, uint16_t yStart,
         uint32_t yOffset = yStart + (numLinesWrap - displayWrapOffset) *
                                         (pFont->font_caps_height + 5);
         // Print one colored char
-        EVE_cmd_text_burst(
-            xStart + xMax - currentLineWidth + currentCharWidth,
-            yOffset, // INPUT_TEXT_YC0(pCurrentFont->font_caps_height),
-            pFont->ft81x_font_index, INPUT_TEXT_OPTIONS, pTmpRxBuf);
+        displayText(xStart + xMax - currentLineWidth + currentCharWidth,
+                    yOffset, // INPUT_TEXT_YC0(pCurrentFont->font_caps_height),
+                    pFont, INPUT_TEXT_OPTIONS, pTmpRxBuf);
     }
 }
 
-void printResult(displayState_t *pDisplayState) {
+CALC_HOT void printResult(displayState_t *pDisplayState) {
     // Let the color reflect if the operation was OK or not.
     if (pDisplayState->solveStatus == calc_solveStatus_SUCCESS) {
         EVE_cmd_dl_burst(DL_COLOR_RGB | WHITE);
@@ -532,11 +641,9 @@ void printResult(displayState_t *pDisplayState) {
 void printLine(char *pString, font_t *pCurrentFont, uint16_t start_x,
                uint16_t end_x, uint16_t start_y, bool rightJustification) {
     if (rightJustification) {
-        EVE_cmd_text_burst(end_x, start_y, pCurrentFont->ft81x_font_index,
-                           EVE_OPT_RIGHTX, pString);
+        displayText(end_x, start_y, pCurrentFont, EVE_OPT_RIGHTX, pString);
     } else {
-        EVE_cmd_text_burst(start_x, start_y, pCurrentFont->ft81x_font_index, 0,
-                           pString);
+        displayText(start_x, start_y, pCurrentFont, 0, pString);
     }
 }
 
@@ -890,14 +997,34 @@ static void displayMenu(displayState_t *pDisplayState) {
 
 void displayTask(void *p) {
 
-    // Program the font library
-    programFontLibrary();
-
     // Update the screen to begin with
     bool updateScreen = true;
     bool writeCursor = true;
     displayState_t localDisplayState;
-    initDisplayState(&localDisplayState);
+    // Start from the display state set up before the tasks were created,
+    // which may have been restored from flash. That way the first frame
+    // already shows the restored input.
+    if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY) == pdTRUE) {
+        memcpy(&localDisplayState, &displayState, sizeof(displayState_t));
+        xSemaphoreGive(displayStateSemaphore);
+    } else {
+        initDisplayState(&localDisplayState);
+    }
+
+    // Only the active font is uploaded at boot. Other collections are
+    // loaded when they are selected.
+    ramGAllocInit(EVE_RAM_G, EVE_RAM_G_SIZE);
+    if (!loadFontCollection(localDisplayState.fontIdx)) {
+        // The restored font is not available, fall back to the default.
+        localDisplayState.fontIdx = 0;
+        loadFontCollection(localDisplayState.fontIdx);
+        // The local state is copied from the global one for every frame, so
+        // the fallback must be written there too.
+        if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY) == pdTRUE) {
+            displayState.fontIdx = localDisplayState.fontIdx;
+            xSemaphoreGive(displayStateSemaphore);
+        }
+    }
 
     // Write the outlines:
     startDisplaylist();
@@ -905,23 +1032,43 @@ void displayTask(void *p) {
     displayCalcState(&localDisplayState);
     endDisplayList();
 
+    // Set when something changed that has not been rendered yet.
+    bool frameDirty = false;
+
     while (1) {
         // Wait for the trigger event from the calculator task to tell this task
         // to update the display, since new data is available and ready.
         // Both updating the cursor and updating the values on screen shall
-        // trigger an event.
-        uint32_t eventbits =
-            xEventGroupWaitBits(displayTriggerEvent,
-                                (DISPLAY_EVENT_CURSOR | DISPLAY_EVENT_NEW_DATA),
-                                pdTRUE, pdFALSE, portMAX_DELAY);
+        // trigger an event. If a frame is pending, also wait for the next
+        // vsync tick. While nothing is pending the vsync bit is left latched,
+        // so the first update after an idle period is rendered immediately.
+        EventBits_t waitBits = (DISPLAY_EVENT_CURSOR | DISPLAY_EVENT_NEW_DATA |
+                                DISPLAY_EVENT_MENU_INPUT);
+        if (frameDirty) {
+            waitBits |= DISPLAY_EVENT_VSYNC;
+        }
+        uint32_t eventbits = xEventGroupWaitBits(displayTriggerEvent, waitBits,
+                                                 pdTRUE, pdFALSE, portMAX_DELAY);
         if (eventbits & DISPLAY_EVENT_CURSOR) {
             // Invert the cursor to blink it.
             writeCursor = !writeCursor;
+            frameDirty = true;
         }
         if (eventbits & DISPLAY_EVENT_NEW_DATA) {
             // If new data is available, then set the cursor to true
             writeCursor = true;
+            frameDirty = true;
         }
+        if (eventbits & DISPLAY_EVENT_MENU_INPUT) {
+            // Keys are waiting in the menu mailbox.
+            frameDirty = true;
+        }
+        if (!frameDirty || !(eventbits & DISPLAY_EVENT_VSYNC)) {
+            // A frame has already been rendered during this vsync period.
+            // Coalesce the update into the next one.
+            continue;
+        }
+        LATENCY_TRACE_MARK(tracePoint_DISPLAY_WAKE);
 
         // Wait (forever) for the semaphore to be available.
         if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY)) {
@@ -946,22 +1093,19 @@ void displayTask(void *p) {
 #endif
 
         if (localDisplayState.inMenu) {
-            // Loop until the internal state changes
-            while (localDisplayState.inMenu) {
-                // Update the screen:
-                startDisplaylist();
-                // Display the menu
-                displayMenu(&localDisplayState);
-                // End the display list
-                endDisplayList();
-                // Hijack the uartReceiveQueue and update accordingly
-                // Note, we wait for uart in this function
-                updateMenuState(&localDisplayState, &displayState);
-                // Create a task delay to give other equal priority a chance
-                // tasks to run.
-                vTaskDelay(10 / portTICK_PERIOD_MS);
-            }
+            // Apply the keys routed to the menu since the last frame. This
+            // doesn't wait for input, the next frame is triggered by the
+            // input task when there are more keys.
+            updateMenuState(&localDisplayState, &displayState);
+        }
 
+        if (localDisplayState.inMenu) {
+            // Update the screen:
+            startDisplaylist();
+            // Display the menu
+            displayMenu(&localDisplayState);
+            // End the display list
+            endDisplayList();
         } else {
             // Update the screen:
             startDisplaylist();
@@ -975,9 +1119,13 @@ void displayTask(void *p) {
             printResult(&localDisplayState);
             // End the display list
             endDisplayList();
+            LATENCY_TRACE_MARK(tracePoint_DISPLAY_SWAP);
         }
 
-        vTaskDelay(10 / portTICK_PERIOD_MS);
+        // The frame is rendered. Clear the vsync bit so the next frame has to
+        // wait for a new tick.
+        frameDirty = false;
+        xEventGroupClearBits(displayTriggerEvent, DISPLAY_EVENT_VSYNC);
     }
 }
 
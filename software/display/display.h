@@ -63,9 +63,19 @@ SOFTWARE.
 // Display events
 #define DISPLAY_EVENT_NEW_DATA 1
 #define DISPLAY_EVENT_CURSOR (1 << 1)
-#define DISPLAY_EXIT_MENU (1 << 2)
+//! Set by the input task when a key is routed to the menu mailbox.
+#define DISPLAY_EVENT_MENU_INPUT (1 << 2)
+//! Set by the 60 Hz timer. Stays latched while the display is idle, so a
+//! set bit means at least one vsync tick has passed since the last frame.
+#define DISPLAY_EVENT_VSYNC (1 << 3)
 /**@}*/
 
+//! Task notification index used by the EVE interrupt
+#define DISPLAY_NOTIFY_EVE_INDEX 1
+//! Upper bound on how long to sleep between EVE busy checks, in case the
+//! interrupt edge is missed or the caller is not the display task.
+#define DISPLAY_EVE_WAIT_TICKS (5 / portTICK_PERIOD_MS)
+
 //! Top line which parts the options from the input
 #define OUTLINE_WIDTH 2 * 16
 /**
@@ -305,6 +315,15 @@ uint8_t printMenuOptionString(displayState_t *pDisplayState, char *pString,
                               uint16_t linePadding, bool rightJustification,
                               bool print);
 
+/**
+ * @brief Make sure a font collection is resident in RAM_G.
+ * The collection is uploaded if needed, evicting the least recently
+ * used collections to make room.
+ * @param fontIdx Index of the collection in pFontLibraryTable
+ * @return True if the collection is resident, false otherwise.
+ */
+bool loadFontCollection(uint8_t fontIdx);
+
 /**
  * @brief Starts the display list, clear local buffers and clears color buffers
  */
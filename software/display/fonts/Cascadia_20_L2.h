@@ -1,7 +1,7 @@
 /*
  * Cascadia_20_L2.h
  *
- *  Created on: 2023-06-03 23:50:13
+ *  Created on: 2026-10-18 09:58:11
  *  
  * THIS IS AN AUTO GENERATED FILE.
  * DO NOT MODIFY
@@ -14,240 +14,72 @@
 #include <stdint.h>
 #include "font.h"
 
-const uint8_t Cascadia_20_L2 [6484] = 
-/*Command Line: fnt_cvt.exe -f legacy -C FT81X -i C:/Users/oskar/Downloads/cascadia-code/Cascadia.ttf -s 20 -d 0 -c setfont2 -l 32 -g -r U+0020-U+007E; U+2200-U+22FF -o C:/Users/oskar/Downloads/cascadia-code/converted_eve/test -O 2*/ 
-
-/*96 characters have been converted */
-
-/* 148 Metric Block Begin +++  */
-/*('file properties ', 'format ', 'L2', ' stride ', 3, ' width ', 12, 'height', 22)*/ 
-{ 
-/* Widths */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
-/* Format */
-17,0,0,0,
-/* Stride */
-3,0,0,0,
-/* Max Width */
-12,0,0,0,
-/* Max Height */
-22,0,0,0,
-/* Raw Data Address in Decimal: <148> */ 
-148,0,0,0,
-
-/* 148 Metric Block End ---  */
-
-/*Bitmap Raw Data begin +++*/
-/*The expected raw bitmap size is 6336 Bytes */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,60,0,0,60,0,0,60,0,0,60,0,0,56,0,0,56,0,0,56,0,
-0,56,0,0,56,0,0,20,0,0,0,0,0,120,0,0,189,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,7,199,192,7,199,192,7,199,192,3,199,192,3,195,192,3,195,128,1,
-65,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,208,224,1,209,208,2,193,208,43,235,248,47,255,252,2,194,
-192,3,130,192,3,130,192,3,130,192,47,255,252,43,235,232,7,67,128,7,67,128,7,71,64,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,36,0,0,40,0,0,40,0,2,190,64,11,255,208,31,40,240,30,40,0,31,40,0,
-11,248,0,2,254,0,0,127,208,0,42,224,0,40,244,0,40,244,20,41,240,47,255,224,27,254,64,0,40,0,0,40,
-0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,208,0,62,244,0,120,120,20,116,120,120,121,
-181,224,47,235,128,5,110,0,0,185,80,2,223,248,15,110,125,61,44,29,20,45,45,0,31,188,0,7,228,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,64,7,251,208,11,130,224,11,64,
-0,11,64,0,7,192,0,3,224,120,31,248,120,61,62,116,120,31,244,120,7,240,124,7,240,47,191,248,11,249,62,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,0,0,124,0,0,124,0,
-0,124,0,0,60,0,0,56,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,224,0,47,208,0,189,0,1,240,0,2,
-208,0,3,192,0,7,128,0,7,128,0,7,128,0,7,128,0,7,128,0,7,128,0,3,192,0,2,208,0,1,224,0,
-0,184,0,0,63,144,0,11,224,0,0,80,0,0,0,0,0,0,0,0,0,15,144,0,11,244,0,0,125,0,0,31,
-0,0,11,64,0,7,128,0,3,192,0,3,192,0,3,192,0,3,192,0,3,192,0,3,192,0,7,128,0,11,64,0,
-15,0,0,126,0,6,248,0,15,208,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,20,0,0,56,0,0,56,16,46,121,180,47,255,244,1,254,64,1,239,0,7,199,192,11,66,208,1,0,
-64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,20,0,0,56,0,0,56,0,0,56,0,0,56,0,63,255,248,42,190,168,0,56,0,0,56,0,0,56,0,
-0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,124,0,0,120,0,0,180,0,0,180,0,0,240,0,0,240,0,0,80,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,255,248,42,170,168,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,120,0,0,189,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,116,0,0,240,0,1,224,0,2,208,0,7,128,0,11,64,0,15,0,0,45,0,0,60,0,0,
-120,0,0,240,0,1,224,0,2,192,0,7,128,0,11,64,0,30,0,0,45,0,0,40,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,190,64,7,239,208,15,66,224,30,0,240,45,0,180,45,16,184,61,125,184,61,125,
-184,45,20,184,45,0,180,30,0,244,15,66,224,7,239,208,1,190,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,6,253,0,15,253,0,9,61,0,0,61,0,0,61,0,0,61,0,0,61,0,
-0,61,0,0,61,0,0,61,0,0,61,0,0,61,0,26,190,164,31,255,244,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,2,254,64,11,239,208,31,2,240,30,0,240,0,0,240,0,0,240,0,
-2,224,0,3,208,0,11,128,0,46,0,1,248,0,11,208,0,31,234,168,31,255,248,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,128,11,235,224,31,65,244,30,0,244,0,0,240,0,6,
-208,0,190,0,0,175,208,0,1,244,0,0,184,45,0,120,46,0,244,15,235,240,2,254,128,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,224,7,129,224,11,65,224,15,1,224,15,1,224,
-30,1,224,30,1,224,45,1,224,60,1,224,63,255,252,42,171,248,0,1,224,0,1,224,0,1,224,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,255,224,11,170,160,11,64,0,11,64,0,11,
-0,0,11,191,128,15,239,240,5,1,244,0,0,184,0,0,120,45,0,184,31,1,244,15,239,224,2,254,64,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,208,0,191,208,3,228,0,11,128,
-0,31,0,0,46,111,128,46,239,224,47,1,244,61,0,180,45,0,184,45,0,180,31,1,240,11,235,224,1,190,64,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,255,252,63,255,248,60,0,244,
-60,1,240,60,2,224,0,3,208,0,7,192,0,11,128,0,15,64,0,31,0,0,46,0,0,61,0,0,124,0,0,184,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,254,64,11,239,224,31,
-1,240,30,0,240,30,0,240,11,150,208,1,255,64,11,235,208,30,1,244,45,0,180,45,0,184,46,1,244,15,235,224,
-2,254,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,254,64,11,239,
-208,31,1,240,45,0,180,45,0,184,45,0,184,47,65,248,15,254,180,2,232,244,0,1,240,0,3,208,0,31,128,11,
-254,0,11,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,120,0,0,189,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,
-0,0,189,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,120,0,0,189,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,124,0,0,120,0,0,180,0,0,180,0,0,240,0,0,240,0,0,80,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,36,0,6,244,0,127,224,11,249,0,63,64,0,62,64,0,27,249,0,1,191,144,0,
-7,244,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,255,248,42,170,168,0,0,0,0,0,0,21,85,84,63,255,
-248,42,170,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,20,0,0,47,128,0,27,249,0,0,191,208,0,6,248,0,2,248,0,111,228,
-11,253,0,47,144,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,190,64,7,251,224,11,65,240,15,0,244,0,1,240,0,7,208,0,31,64,0,61,0,0,
-56,0,0,20,0,0,0,0,0,120,0,0,189,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,191,128,7,251,224,15,68,176,29,127,116,44,186,180,56,240,116,56,224,116,56,224,
-116,56,240,116,44,186,180,29,127,116,15,68,0,7,251,192,1,191,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,189,0,0,254,0,1,239,0,2,219,64,3,199,128,3,131,128,7,131,192,
-11,66,208,15,1,224,31,255,240,47,170,244,60,0,120,60,0,120,120,0,60,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,31,254,64,31,175,208,30,2,240,30,0,240,30,0,240,30,2,224,31,
-175,64,31,254,144,30,1,180,30,0,60,30,0,60,30,0,188,31,171,244,31,255,144,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,144,7,250,248,15,128,60,31,0,0,45,0,0,60,0,
-0,60,0,0,60,0,0,61,0,0,45,0,0,31,0,0,15,144,0,7,254,184,0,175,228,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,254,0,31,175,208,30,2,240,30,0,184,30,0,124,
-30,0,60,30,0,45,30,0,45,30,0,61,30,0,60,30,0,184,30,1,244,31,175,208,31,254,64,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,248,31,170,168,30,0,0,30,0,0,30,
-0,0,30,0,0,31,255,192,31,170,128,30,0,0,30,0,0,30,0,0,30,0,0,31,170,168,31,255,248,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,248,31,170,168,30,0,0,30,0,
-0,30,0,0,30,0,0,30,0,0,31,255,192,31,170,128,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,144,7,250,248,15,128,124,
-30,0,0,45,0,0,60,0,0,60,0,0,60,10,168,60,11,252,45,0,60,31,0,60,15,128,60,7,254,252,0,175,
-232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,180,45,0,180,45,
-0,180,45,0,180,45,0,180,45,0,180,47,255,244,47,170,244,45,0,180,45,0,180,45,0,180,45,0,180,45,0,180,
-45,0,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,240,26,190,
-160,0,56,0,0,56,0,0,56,0,0,56,0,0,56,0,0,56,0,0,56,0,0,56,0,0,56,0,0,56,0,26,
-190,160,31,255,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,244,
-0,42,244,0,0,116,0,0,116,0,0,116,0,0,116,0,0,116,0,0,116,0,0,116,60,0,180,61,0,180,46,1,
-240,15,239,208,2,254,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,
-0,120,30,0,120,30,0,180,30,0,240,30,1,224,30,7,208,30,31,64,31,255,0,31,155,128,30,7,192,30,2,224,
-30,1,240,30,0,184,30,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,
-0,0,30,0,0,31,170,168,31,255,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,47,66,244,47,131,244,47,199,244,45,199,116,45,218,116,44,238,116,44,189,116,44,124,116,44,20,116,44,0,
-116,44,0,116,44,0,116,44,0,116,44,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,47,0,180,47,128,180,47,192,180,47,208,180,45,224,180,45,176,180,45,116,180,45,60,180,45,29,180,
-45,14,180,45,11,180,45,7,244,45,2,244,45,1,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,190,64,11,239,208,31,1,240,45,0,184,60,0,120,60,0,124,120,0,60,120,0,60,124,
-0,60,60,0,120,45,0,184,31,1,240,11,239,208,1,254,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,31,254,64,31,175,224,30,1,244,30,0,120,30,0,124,30,0,124,30,0,184,30,1,
-244,31,255,208,31,169,0,30,0,0,30,0,0,30,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,190,64,11,239,208,31,1,240,45,0,180,60,0,120,60,0,124,120,0,60,
-120,0,60,124,0,60,60,0,120,45,0,184,31,1,244,11,239,224,2,255,64,0,56,0,0,60,0,0,45,0,0,31,
-224,0,6,240,0,0,0,0,0,0,0,0,0,47,255,64,46,171,224,45,1,244,45,0,184,45,0,120,45,0,180,45,
-1,244,47,255,208,46,175,128,45,7,192,45,3,208,45,1,240,45,0,244,45,0,124,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,64,11,235,208,31,1,240,30,0,0,31,0,0,11,224,
-0,2,254,0,0,111,208,0,6,224,0,0,244,0,0,244,20,1,240,47,239,224,27,254,64,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,255,252,42,190,168,0,60,0,0,60,0,0,60,0,
-0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,180,45,0,180,45,0,180,45,0,180,45,
-0,180,45,0,180,45,0,180,45,0,180,45,0,180,45,0,180,45,0,180,31,1,240,11,239,208,2,254,64,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,60,60,0,124,61,0,120,45,0,
-180,30,0,240,15,1,224,11,66,208,7,66,208,7,131,192,3,199,128,2,219,64,1,239,0,0,254,0,0,189,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,29,180,0,29,180,0,45,
-116,0,45,116,124,44,120,124,60,120,173,60,56,173,56,60,218,56,60,218,120,45,215,116,46,199,180,47,199,244,31,131,
-244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,0,120,30,0,244,15,
-66,224,7,131,192,2,219,64,0,254,0,0,125,0,0,124,0,0,254,0,2,219,64,7,195,192,11,66,224,30,0,244,
-61,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,61,60,0,
-120,30,0,244,15,1,224,7,130,208,3,199,128,1,235,0,0,254,0,0,124,0,0,60,0,0,60,0,0,60,0,0,
-60,0,0,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,255,244,
-26,170,244,0,2,224,0,7,208,0,11,128,0,31,0,0,61,0,0,184,0,1,240,0,3,208,0,7,128,0,15,0,
-0,47,170,164,47,255,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,255,224,1,250,160,1,
-224,0,1,224,0,1,224,0,1,224,0,1,224,0,1,224,0,1,224,0,1,224,0,1,224,0,1,224,0,1,224,0,
-1,224,0,1,224,0,1,224,0,1,250,160,1,255,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,
-0,30,0,0,15,0,0,11,64,0,3,192,0,2,208,0,0,224,0,0,180,0,0,120,0,0,45,0,0,30,0,0,
-15,0,0,7,128,0,3,192,0,2,208,0,0,240,0,0,180,0,0,36,0,0,0,0,0,0,0,0,0,15,255,0,
-10,175,0,0,15,0,0,15,0,0,15,0,0,15,0,0,15,0,0,15,0,0,15,0,0,15,0,0,15,0,0,15,
-0,0,15,0,0,15,0,0,15,0,0,15,0,10,175,0,15,255,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,189,0,0,254,0,2,219,64,3,199,128,7,131,192,10,65,144,0,0,0,0,0,0,0,0,0,
+const uint8_t Cascadia_20_L2 [1512] = 
+{
+/* Metric block */
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,255,248,42,170,168,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,224,0,0,180,0,0,120,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,249,0,10,255,128,0,7,208,
-0,2,208,6,186,224,31,255,224,61,2,224,60,7,224,47,189,253,11,244,253,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,127,128,30,251,224,31,
-64,244,31,0,120,30,0,120,30,0,120,30,0,184,30,1,240,31,175,208,31,254,64,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,128,7,251,
-224,15,64,244,30,0,80,46,0,0,46,0,0,30,0,0,15,128,0,7,250,240,1,191,224,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,0,0,240,0,0,240,0,0,240,0,0,240,2,248,240,
-15,238,240,46,2,240,61,1,240,60,0,240,60,0,240,61,0,240,46,1,240,15,238,240,6,248,240,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-190,64,11,255,208,31,65,240,30,0,180,46,170,180,47,255,244,30,0,0,15,64,0,7,250,224,1,191,224,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,248,0,63,168,0,184,0,0,244,0,0,240,
-0,0,240,0,0,240,0,127,255,244,106,250,164,0,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,2,248,240,15,238,240,46,2,240,61,1,240,60,0,240,60,0,240,61,0,240,46,1,240,15,238,240,6,249,
-240,0,0,240,0,1,224,0,7,208,27,255,128,31,233,0,0,0,0,0,0,0,30,0,0,30,0,0,30,0,0,30,
-0,0,30,0,0,30,111,64,30,251,208,31,65,240,31,0,240,30,0,240,30,0,240,30,0,240,30,0,240,30,0,240,
-30,0,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,62,0,0,45,
-0,0,0,0,0,0,0,15,254,0,10,190,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,0,30,0,26,
-191,168,31,255,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,64,0,15,128,
-0,11,64,0,0,0,0,0,0,7,255,128,6,175,128,0,7,128,0,7,128,0,7,128,0,7,128,0,7,128,0,7,
-128,0,7,128,0,7,128,0,7,128,0,11,64,0,47,0,27,253,0,31,144,0,0,0,0,0,0,0,30,0,0,30,
-0,0,30,0,0,30,0,0,30,0,0,30,0,180,30,0,240,30,2,224,30,11,208,31,255,64,31,175,64,30,7,192,
-30,3,224,30,1,244,30,0,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,240,
-0,42,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,240,0,0,
-240,0,0,244,0,0,190,180,0,47,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,246,224,62,190,248,61,56,120,61,56,120,61,56,120,61,56,
-120,61,56,120,61,56,120,61,56,120,61,56,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,111,64,30,251,208,31,65,240,31,0,240,30,0,240,
-30,0,240,30,0,240,30,0,240,30,0,240,30,0,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,64,11,239,208,31,66,240,46,0,244,46,
-0,180,46,0,180,46,0,244,31,66,240,11,239,208,1,190,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,111,128,30,251,224,31,64,244,31,0,
-184,30,0,120,30,0,120,30,0,120,31,64,244,30,251,224,30,111,128,30,0,0,30,0,0,30,0,0,30,0,0,30,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,248,240,31,238,240,46,2,240,
-60,1,240,60,0,240,60,0,240,60,0,240,46,1,240,31,238,240,6,248,240,0,0,240,0,0,240,0,0,240,0,0,
-240,0,0,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,139,224,43,222,248,3,
-228,60,3,224,61,3,208,0,3,208,0,3,192,0,3,192,0,43,234,0,127,254,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,224,11,250,
-160,15,64,0,15,64,0,11,250,64,1,111,224,0,1,240,0,1,240,31,175,224,31,254,64,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,64,0,2,208,0,2,208,0,2,208,0,127,255,240,
-107,234,160,2,208,0,2,208,0,2,208,0,2,208,0,2,208,0,2,224,0,1,254,180,0,111,244,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,
-1,240,30,1,240,30,1,240,30,1,240,30,1,240,30,1,240,30,1,240,31,2,240,15,238,253,2,248,253,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,60,0,120,45,0,180,31,0,240,15,65,224,11,130,208,3,195,192,2,215,128,1,235,64,0,254,0,0,189,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,120,124,60,120,188,60,56,173,56,60,221,120,60,218,120,44,202,116,45,198,180,46,135,176,31,131,240,31,67,
-240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,46,0,244,15,66,224,7,215,128,1,255,0,0,189,0,0,189,0,1,255,0,3,199,128,11,66,224,
-46,0,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,120,0,120,61,0,180,46,0,240,15,1,224,11,66,208,7,131,192,3,199,128,1,235,64,0,
-255,0,0,190,0,0,45,0,0,124,0,1,244,0,127,224,0,122,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,31,255,240,26,171,240,0,7,208,0,15,64,0,61,0,0,184,0,2,224,0,11,128,
-0,31,170,160,31,255,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,224,0,47,160,0,
-61,0,0,124,0,0,120,0,0,124,0,0,124,0,1,184,0,11,224,0,6,244,0,0,120,0,0,124,0,0,124,0,
-0,120,0,0,124,0,0,60,0,0,47,144,0,11,224,0,0,64,0,0,0,0,0,0,0,60,0,0,60,0,0,60,
-0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,
-60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,60,0,0,0,0,0,0,0,0,0,0,11,208,0,
-10,244,0,0,184,0,0,60,0,0,60,0,0,60,0,0,60,0,0,62,0,0,27,208,0,47,128,0,60,0,0,60,
-0,0,60,0,0,60,0,0,60,0,0,120,0,10,244,0,15,224,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,10,148,184,47,255,244,62,91,224,
-60,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,255,248,42,170,168,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-
-/*Bitmap Raw Data end ---*/
-} 
+12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,
+12,12,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+17,0,0,0,3,0,0,0,12,0,0,0,22,0,0,0,148,0,0,0,
+/* Deflated bitmap */
+120,218,173,87,191,111,227,54,20,126,148,91,11,13,129,234,134,76,9,42,46,29,218,187,72,90,111,144,28,37,127,193,
+237,93,59,181,67,22,15,46,224,107,212,102,236,226,161,232,156,225,134,212,25,124,131,6,163,104,108,3,29,178,106,43,
+208,2,5,135,12,237,5,56,115,32,10,197,169,165,62,82,142,27,39,150,34,52,71,124,48,76,137,164,222,207,239,61,
+2,188,179,65,70,161,121,157,208,111,57,13,1,97,78,160,193,59,44,237,4,173,118,135,201,142,41,186,166,240,198,41,
+189,106,173,217,220,228,224,37,112,6,68,128,145,64,99,2,102,116,23,248,16,95,17,14,48,4,216,237,1,197,127,47,
+150,7,88,248,64,2,188,4,96,160,63,175,55,220,1,62,196,87,22,192,215,208,76,193,74,224,189,50,101,54,1,158,
+35,158,184,95,197,94,46,73,22,146,41,152,231,19,186,159,16,8,31,182,197,98,251,2,187,121,250,116,116,114,251,201,
+59,24,93,128,14,64,172,33,52,94,84,45,87,50,244,79,224,29,14,252,250,153,254,93,63,218,74,38,244,22,250,108,
+105,118,7,192,215,91,138,55,55,14,177,245,155,79,214,70,212,52,177,246,185,13,194,129,216,121,50,12,94,42,56,155,
+67,156,218,32,241,21,46,192,101,101,66,52,231,96,205,225,131,0,160,28,91,163,87,44,151,101,39,24,89,72,167,9,
+51,132,189,176,50,6,40,135,70,2,52,2,23,72,10,52,1,246,230,132,229,105,105,94,140,35,122,201,217,158,68,129,
+213,246,102,2,35,128,1,134,50,78,81,145,142,139,138,92,10,35,139,74,79,32,220,252,134,211,61,110,17,5,91,195,
+33,220,39,124,55,255,231,233,105,170,172,89,160,100,208,156,211,254,113,145,152,20,167,227,200,154,138,247,181,0,232,15,
+7,134,140,72,107,202,81,217,82,119,111,37,48,78,26,23,74,111,204,48,247,32,114,167,220,35,50,64,191,40,45,98,
+70,4,170,89,225,11,20,21,131,208,7,233,19,225,23,54,68,142,192,227,172,80,159,168,221,209,213,18,85,249,130,227,
+135,208,23,8,250,67,66,242,144,94,38,54,145,142,22,195,69,45,46,171,180,88,120,147,8,103,33,246,208,219,75,173,
+44,54,254,148,138,122,80,36,22,209,12,104,239,17,41,240,64,94,44,199,199,208,148,112,200,233,21,236,134,208,10,97,
+251,10,67,165,7,38,58,229,243,58,31,71,142,241,34,181,11,253,162,232,204,72,225,224,130,206,193,235,193,167,15,110,
+70,9,51,64,78,51,126,15,27,231,81,227,40,50,143,20,185,97,116,177,92,120,125,233,67,7,209,81,233,186,126,176,
+44,100,131,196,54,22,190,176,13,206,6,33,203,122,54,193,196,244,53,126,102,167,146,229,229,166,28,244,204,89,106,69,
+62,187,33,134,2,129,158,50,77,233,102,54,132,193,69,185,12,112,35,195,208,134,174,254,168,163,17,232,255,67,12,12,
+92,192,202,227,1,211,150,245,79,144,127,150,96,249,132,245,163,149,39,253,170,236,190,127,194,218,67,236,114,87,232,80,
+92,1,86,28,116,193,253,231,229,50,136,173,209,241,74,125,185,7,92,128,203,202,78,176,107,160,218,14,222,190,244,142,
+164,119,46,157,243,182,243,91,123,231,109,123,231,172,189,211,109,239,108,182,119,96,5,165,39,160,226,81,236,77,98,47,
+137,29,30,59,175,99,167,29,59,126,236,124,20,59,31,198,14,141,29,83,58,134,116,136,172,232,64,110,178,123,168,3,
+184,139,1,140,232,130,239,47,88,78,224,2,82,17,15,42,170,145,93,145,171,59,58,162,186,139,40,202,19,246,99,45,
+111,122,121,232,158,34,57,75,77,47,29,229,56,34,189,60,113,7,145,99,78,156,70,226,40,241,240,109,183,74,139,203,
+68,179,156,238,101,176,80,102,0,7,137,234,145,84,5,145,155,68,120,83,190,93,174,197,33,22,5,236,55,124,120,24,
+181,99,242,14,10,75,86,48,109,160,12,168,11,244,209,4,73,6,217,70,245,102,93,69,59,56,53,127,65,182,193,178,
+142,229,99,13,81,146,156,147,217,241,178,166,61,12,92,156,175,212,62,43,135,141,1,168,150,163,30,112,49,110,41,227,
+201,130,36,81,145,141,189,222,99,58,38,164,250,141,28,123,217,4,155,162,230,79,200,180,60,48,184,111,114,239,108,78,
+229,188,86,98,30,70,246,53,103,161,100,202,188,5,48,62,69,53,203,221,233,70,204,107,110,133,24,225,47,92,93,117,
+241,88,11,133,154,9,50,46,235,31,196,109,24,169,176,222,10,215,16,1,214,113,80,8,64,184,68,61,108,166,162,230,
+77,129,98,66,237,97,132,199,110,95,209,157,146,1,123,246,25,47,149,129,166,176,123,162,122,3,249,159,44,135,185,252,
+98,246,106,85,58,141,26,163,74,139,43,177,232,80,205,100,59,143,216,95,37,190,56,8,237,107,165,5,131,155,34,120,
+11,101,121,5,45,253,91,68,105,6,27,163,53,84,187,53,46,101,218,123,107,227,162,248,218,52,97,57,114,87,104,155,
+19,187,81,48,216,250,70,106,87,192,211,251,22,187,3,52,242,40,6,239,162,142,37,131,191,121,107,148,6,207,59,107,
+81,231,132,255,99,201,181,204,191,47,176,151,118,49,168,20,36,78,105,229,237,96,85,134,101,102,13,111,50,171,131,83,
+124,168,94,213,40,229,222,119,252,217,31,105,227,194,111,240,0,27,201,70,178,184,116,62,123,3,135,89,189,27,244,152,
+211,217,49,38,2,130,206,66,114,192,85,83,170,178,155,87,100,55,9,213,29,171,192,97,46,190,124,115,188,156,46,128,
+199,100,49,28,200,90,118,192,186,115,15,120,253,177,222,206,141,116,94,231,4,183,160,253,95,35,146,107,254,196,75,125,
+14,200,159,72,248,46,212,146,65,245,51,167,66,241,36,26,34,80,55,2,84,65,221,59,250,235,122,24,255,17,120,168,
+191,223,248,126,136,236,212,250,140,251,186,223,46,27,255,2,101,215,5,25,
+};
 
-;
+const uint8_t Cascadia_20_L2_charmap [128] = {
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,33,32,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,32,53,32,54,32,
+32,55,56,57,58,59,60,32,61,62,32,32,63,64,65,66,67,32,68,69,70,71,32,32,72,32,32,73,32,74,75,32,
+32,76,77,78,79,80,81,82,83,84,32,85,86,87,88,89,90,32,91,92,93,94,32,32,95,32,96,32,97,32,98,32,
+};
 
 
 
 font_t font_Cascadia_20_L2 = {
     .rom_font = false,
-    .ft81x_font_index = 0, // NOTE: This needs to be added
+    .ft81x_font_index = 0, // NOTE: This needs to be added at runtime
     .font_name = "Cascadia\0",
     .font_format = 2,
     .font_size = 20,
@@ -255,7 +87,9 @@ font_t font_Cascadia_20_L2 = {
     .font_caps_height = 14,
     .font_x_width = 12,
     .pFontTable = Cascadia_20_L2,
-    .fontTableSize = 6484
+    .fontTableSize = 4570,
+    .bitmapDeflatedSize = 1364,
+    .pCharMap = Cascadia_20_L2_charmap
 };
 
 #endif
\ No newline at end of file
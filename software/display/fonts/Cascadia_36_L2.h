@@ -1,7 +1,7 @@
 /*
  * Cascadia_36_L2.h
  *
- *  Created on: 2023-11-11 12:06:30
+ *  Created on: 2026-10-18 09:58:11
  *  
  * THIS IS AN AUTO GENERATED FILE.
  * DO NOT MODIFY
@@ -14,730 +14,110 @@
 #include <stdint.h>
 #include "font.h"
 
-const uint8_t Cascadia_36_L2 [22378] = 
-/*Command Line: fnt_cvt.exe -f legacy -C FT81X -i C:/Users/oskar/Downloads/cascadia-code/Cascadia.ttf -s 36 -d 0 -c setfont2 -l 32 -g -r U+0020-U+007E -o C:/git/ComSciCalculator/utils/fontConverter/input_files -O 2*/ 
-
-/*95 characters have been converted */
-
-/* 148 Metric Block Begin +++  */
-/*('file properties ', 'format ', 'L2', ' stride ', 6, ' width ', 22, 'height', 39)*/ 
-{ 
-/* Widths */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,21,21,21,21,21,22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,0,
-/* Format */
-17,0,0,0,
-/* Stride */
-6,0,0,0,
-/* Max Width */
-22,0,0,0,
-/* Max Height */
-39,0,0,0,
-/* Raw Data Address in Decimal: <148> */ 
-148,0,0,0,
-
-/* 148 Metric Block End ---  */
-
-/*Bitmap Raw Data begin +++*/
-/*The expected raw bitmap size is 22230 Bytes */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,
-0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,4,0,0,0,0,0,127,64,0,0,0,0,255,192,0,0,0,0,255,192,0,0,0,0,191,192,0,0,0,0,
-46,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,192,255,0,0,0,63,
-192,255,0,0,0,63,192,255,0,0,0,63,192,191,0,0,0,63,192,191,0,0,0,63,192,191,0,0,0,63,192,191,
-0,0,0,47,128,191,0,0,0,47,128,191,0,0,0,47,128,191,0,0,0,47,128,190,0,0,0,21,64,21,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,7,224,11,208,0,0,11,224,15,208,0,0,11,208,15,192,0,0,11,208,15,192,0,0,11,208,15,192,0,
-0,15,208,31,192,0,15,255,255,255,254,0,15,255,255,255,254,0,15,255,255,255,254,0,0,31,192,47,128,0,0,31,
-128,47,64,0,0,31,128,47,64,0,0,31,128,47,64,0,0,47,128,63,64,0,0,47,64,63,0,0,0,47,64,63,
-0,0,15,255,255,255,254,0,15,255,255,255,254,0,15,255,255,255,254,0,0,63,0,126,0,0,0,63,0,126,0,0,
-0,127,0,190,0,0,0,126,0,189,0,0,0,126,0,189,0,0,0,126,0,253,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,31,0,0,0,0,0,31,0,0,0,
-0,0,31,0,0,0,0,0,31,0,0,0,0,6,255,228,0,0,0,47,255,254,0,0,0,191,255,255,128,0,1,255,
-175,127,208,0,2,253,31,15,224,0,3,248,31,11,240,0,3,248,31,0,0,0,3,248,31,0,0,0,3,253,31,0,
-0,0,2,255,159,0,0,0,0,255,255,0,0,0,0,47,255,144,0,0,0,11,255,248,0,0,0,0,191,255,64,0,
-0,0,31,255,208,0,0,0,31,111,240,0,0,0,31,11,244,0,0,0,31,7,244,0,0,0,31,7,244,0,0,0,
-31,7,244,0,5,0,31,31,240,0,11,249,111,191,224,0,11,255,255,255,192,0,11,255,255,254,0,0,0,107,255,164,
-0,0,0,0,31,0,0,0,0,0,31,0,0,0,0,0,31,0,0,0,0,0,31,0,0,0,0,0,31,0,0,0,
-0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,144,0,0,0,7,255,244,0,
-0,0,31,255,252,0,0,0,47,209,254,0,0,0,63,64,190,0,0,0,63,64,127,0,16,0,63,64,127,0,120,0,
-47,128,190,2,253,0,31,234,253,31,244,0,11,255,248,127,128,0,2,255,226,254,0,0,0,21,31,244,0,0,0,0,
-191,128,0,0,0,2,254,21,64,0,0,31,245,255,244,0,0,191,135,255,253,0,2,254,15,250,255,0,15,244,31,208,
-127,64,11,128,31,192,63,64,1,0,31,128,47,64,0,0,31,192,63,64,0,0,15,224,191,0,0,0,11,255,254,0,
-0,0,2,255,248,0,0,0,0,111,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,1,191,228,0,0,0,11,255,254,0,0,0,47,255,255,64,0,0,127,229,191,192,0,0,191,128,47,208,0,0,255,
-0,31,208,0,0,255,0,0,0,0,0,254,0,0,0,0,0,255,0,0,0,0,0,191,64,0,0,0,0,127,192,0,
-0,0,0,47,224,0,0,0,0,31,248,1,253,0,0,191,253,1,252,0,7,255,255,65,252,0,15,249,191,210,252,0,
-47,224,47,246,248,0,63,128,11,255,244,0,63,128,2,255,240,0,63,128,0,255,224,0,47,208,0,127,224,0,31,249,
-86,255,248,0,11,255,255,255,253,0,2,255,255,229,255,64,0,111,250,64,127,192,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,191,128,0,0,0,0,127,128,0,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,
-0,0,127,64,0,0,0,0,127,64,0,0,0,0,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,
-208,0,0,0,6,255,208,0,0,0,31,255,208,0,0,0,191,228,0,0,0,1,255,64,0,0,0,3,253,0,0,0,
-0,7,248,0,0,0,0,15,240,0,0,0,0,31,208,0,0,0,0,47,192,0,0,0,0,47,128,0,0,0,0,63,
-128,0,0,0,0,63,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,
-0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,128,0,0,0,
-0,47,192,0,0,0,0,31,208,0,0,0,0,15,224,0,0,0,0,11,240,0,0,0,0,7,248,0,0,0,0,2,
-254,0,0,0,0,0,255,128,0,0,0,0,127,249,64,0,0,0,31,255,208,0,0,0,2,255,208,0,0,0,0,26,
-144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,250,64,0,0,0,1,255,244,0,0,0,0,255,254,0,0,0,0,6,255,128,0,0,0,0,
-127,208,0,0,0,0,31,240,0,0,0,0,7,248,0,0,0,0,2,252,0,0,0,0,1,253,0,0,0,0,0,254,
-0,0,0,0,0,191,0,0,0,0,0,191,0,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,63,64,0,
-0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,
-0,127,0,0,0,0,0,191,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,2,253,0,0,0,0,3,252,
-0,0,0,0,11,244,0,0,0,0,31,224,0,0,0,0,191,208,0,0,0,91,255,64,0,0,1,255,253,0,0,0,
-1,255,224,0,0,0,1,169,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,106,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,63,64,0,0,2,64,63,0,96,0,7,244,
-63,7,244,0,11,255,191,191,248,0,15,255,255,255,252,0,1,111,255,254,80,0,0,1,255,208,0,0,0,2,255,240,
-0,0,0,11,247,248,0,0,0,47,209,254,0,0,0,191,128,191,128,0,0,191,0,63,128,0,0,45,0,30,0,0,
-0,4,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,42,0,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,
-0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,31,255,255,255,253,0,31,255,255,255,253,0,
-31,255,255,255,253,0,5,85,127,85,84,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,
-63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,42,64,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,64,0,0,
-0,0,191,64,0,0,0,0,255,0,0,0,0,0,255,0,0,0,0,0,254,0,0,0,0,1,254,0,0,0,0,1,
-253,0,0,0,0,1,252,0,0,0,0,2,252,0,0,0,0,2,248,0,0,0,0,3,248,0,0,0,0,1,80,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,31,255,255,255,253,0,31,255,255,255,253,0,31,255,255,255,253,0,5,85,85,85,84,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,4,0,0,0,0,0,127,64,0,0,0,0,255,192,0,0,0,0,255,192,0,0,0,0,191,192,0,0,
-0,0,46,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,168,0,0,0,0,2,248,0,0,0,0,7,244,0,
-0,0,0,11,240,0,0,0,0,15,208,0,0,0,0,47,192,0,0,0,0,63,128,0,0,0,0,127,0,0,0,0,
-0,254,0,0,0,0,1,253,0,0,0,0,2,248,0,0,0,0,7,244,0,0,0,0,11,224,0,0,0,0,31,208,
-0,0,0,0,47,192,0,0,0,0,63,64,0,0,0,0,191,0,0,0,0,0,254,0,0,0,0,1,252,0,0,0,
-0,3,248,0,0,0,0,7,244,0,0,0,0,11,224,0,0,0,0,31,208,0,0,0,0,47,192,0,0,0,0,63,
-64,0,0,0,0,191,0,0,0,0,0,254,0,0,0,0,1,252,0,0,0,0,3,248,0,0,0,0,7,244,0,0,
-0,0,11,224,0,0,0,0,31,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,191,144,0,0,0,31,255,253,0,0,0,127,255,255,64,0,0,255,213,191,192,0,2,254,0,47,
-224,0,3,252,0,15,240,0,7,248,0,11,244,0,7,244,0,7,248,0,11,240,0,3,248,0,11,240,0,3,252,0,
-15,240,42,66,252,0,15,240,191,194,252,0,15,224,255,210,252,0,15,224,191,194,252,0,15,240,63,66,252,0,11,240,
-4,3,252,0,11,240,0,3,248,0,11,244,0,7,248,0,7,248,0,7,244,0,3,252,0,15,240,0,2,254,0,47,
-224,0,0,255,149,191,208,0,0,127,255,255,64,0,0,31,255,253,0,0,0,1,191,144,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,191,192,0,0,1,255,255,192,0,0,2,255,255,192,0,0,
-2,255,191,192,0,0,1,144,47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,
-47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,47,192,
-0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,0,0,47,192,0,0,
-0,0,47,192,0,0,0,0,47,192,0,0,1,85,127,213,80,0,3,255,255,255,248,0,3,255,255,255,248,0,3,255,
-255,255,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,191,164,0,0,0,47,
-255,254,0,0,0,191,255,255,128,0,2,255,149,191,208,0,3,253,0,47,224,0,7,248,0,15,240,0,7,244,0,11,
-240,0,0,0,0,11,244,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,15,224,0,0,0,0,31,208,0,
-0,0,0,63,192,0,0,0,0,191,64,0,0,0,1,255,0,0,0,0,7,252,0,0,0,0,31,244,0,0,0,0,
-127,208,0,0,0,2,255,64,0,0,0,31,248,0,0,0,1,191,224,0,0,0,3,255,149,85,84,0,3,255,255,255,
-253,0,3,255,255,255,253,0,3,255,255,255,253,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,191,232,0,0,0,47,255,255,128,0,0,191,255,255,224,0,1,255,149,191,240,0,3,253,0,15,244,0,
-3,248,0,7,248,0,7,244,0,7,244,0,0,0,0,7,244,0,0,0,0,15,224,0,0,0,0,47,192,0,0,0,
-6,254,0,0,0,2,191,228,0,0,0,3,255,249,0,0,0,1,171,255,128,0,0,0,0,111,240,0,0,0,0,11,
-248,0,0,0,0,3,252,0,0,0,0,2,252,0,11,240,0,2,253,0,11,240,0,3,252,0,7,248,0,11,252,0,
-3,255,149,191,244,0,1,255,255,255,224,0,0,127,255,255,128,0,0,6,255,228,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,208,0,0,42,64,31,208,0,0,127,64,31,208,0,0,191,
-0,31,208,0,0,190,0,31,208,0,0,254,0,31,208,0,1,253,0,31,208,0,1,253,0,31,208,0,2,252,0,31,
-208,0,2,248,0,31,208,0,3,248,0,31,208,0,7,244,0,31,208,0,7,244,0,31,208,0,11,240,0,31,208,0,
-11,224,0,31,208,0,15,224,0,31,208,0,31,255,255,255,254,0,31,255,255,255,254,0,47,255,255,255,254,0,0,0,
-0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,
-208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,255,255,224,0,0,255,255,255,
-224,0,0,255,255,255,224,0,0,254,85,85,64,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,
-0,253,0,0,0,0,0,253,0,0,0,0,0,254,191,233,0,0,0,255,255,255,128,0,0,255,255,255,224,0,0,254,
-85,191,244,0,0,80,0,11,248,0,0,0,0,3,252,0,0,0,0,2,252,0,0,0,0,2,253,0,0,0,0,2,
-253,0,11,240,0,2,252,0,11,244,0,3,252,0,7,252,0,11,248,0,3,255,149,191,240,0,1,255,255,255,208,0,
-0,111,255,255,64,0,0,6,255,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,107,128,0,0,0,31,255,192,0,0,1,255,255,192,0,0,11,255,233,64,0,0,47,249,0,0,0,0,127,
-208,0,0,0,0,255,64,0,0,0,2,253,0,0,0,0,3,252,0,0,0,0,7,248,27,249,0,0,7,245,255,255,
-128,0,11,247,255,255,224,0,11,251,149,191,244,0,15,253,0,11,248,0,15,248,0,3,252,0,15,244,0,3,252,0,
-15,240,0,2,252,0,11,240,0,2,252,0,11,240,0,3,252,0,7,244,0,7,248,0,3,253,0,15,244,0,1,255,
-149,191,224,0,0,191,255,255,208,0,0,31,255,254,0,0,0,1,191,228,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,15,255,255,255,255,0,15,255,255,255,254,0,15,255,255,255,253,0,15,234,170,171,
-252,0,15,224,0,7,248,0,15,224,0,11,244,0,15,224,0,15,240,0,15,224,0,31,224,0,10,160,0,47,208,0,
-0,0,0,63,192,0,0,0,0,127,128,0,0,0,0,191,64,0,0,0,0,255,0,0,0,0,1,254,0,0,0,0,
-2,253,0,0,0,0,3,252,0,0,0,0,7,248,0,0,0,0,11,244,0,0,0,0,15,240,0,0,0,0,47,224,
-0,0,0,0,63,208,0,0,0,0,127,192,0,0,0,0,191,128,0,0,0,0,255,64,0,0,0,1,255,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,191,228,0,0,0,47,255,254,64,0,
-0,255,255,255,192,0,2,255,149,191,224,0,3,253,0,31,240,0,3,248,0,11,244,0,7,248,0,7,244,0,3,248,
-0,7,244,0,2,252,0,11,240,0,1,254,64,111,208,0,0,127,255,255,64,0,0,6,255,228,0,0,0,27,255,249,
-0,0,0,191,234,255,128,0,2,253,0,31,240,0,7,244,0,7,248,0,11,240,0,3,252,0,15,224,0,2,252,0,
-15,240,0,2,252,0,11,240,0,3,252,0,11,248,0,11,248,0,3,255,149,191,244,0,1,255,255,255,208,0,0,127,
-255,255,64,0,0,6,255,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,
-191,160,0,0,0,47,255,254,0,0,0,255,255,255,128,0,2,255,149,191,224,0,7,253,0,15,240,0,11,244,0,7,
-244,0,11,240,0,3,248,0,15,240,0,3,252,0,15,240,0,3,252,0,15,240,0,3,252,0,11,244,0,7,252,0,
-7,252,0,31,252,0,3,255,149,187,252,0,1,255,255,243,248,0,0,191,255,211,248,0,0,27,250,7,244,0,0,0,
-0,11,240,0,0,0,0,31,224,0,0,0,0,127,208,0,0,0,1,255,128,0,0,0,27,254,0,0,0,86,255,248,
-0,0,0,255,255,208,0,0,0,191,254,0,0,0,0,186,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,191,192,0,0,0,0,255,192,0,0,0,0,
-255,192,0,0,0,0,127,64,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,
-0,0,127,64,0,0,0,0,255,192,0,0,0,0,255,192,0,0,0,0,191,192,0,0,0,0,46,64,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,191,192,
-0,0,0,0,255,192,0,0,0,0,255,192,0,0,0,0,127,64,0,0,0,0,4,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,64,0,0,0,0,191,64,0,0,0,0,255,0,
-0,0,0,0,255,0,0,0,0,0,254,0,0,0,0,1,254,0,0,0,0,1,253,0,0,0,0,1,252,0,0,0,
-0,2,252,0,0,0,0,2,248,0,0,0,0,3,248,0,0,0,0,1,80,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0,0,11,248,0,
-0,0,1,191,248,0,0,0,31,255,244,0,0,6,255,255,64,0,0,111,255,228,0,0,11,255,249,0,0,0,31,254,
-64,0,0,0,31,224,0,0,0,0,31,254,64,0,0,0,11,255,249,0,0,0,0,127,255,224,0,0,0,6,255,254,
-64,0,0,0,47,255,244,0,0,0,1,191,248,0,0,0,0,27,248,0,0,0,0,0,120,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,31,255,255,255,253,0,31,255,255,255,253,0,31,255,255,255,253,0,5,85,85,85,
-84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,85,85,85,84,0,
-31,255,255,255,253,0,31,255,255,255,253,0,31,255,255,255,253,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,7,64,0,0,0,0,7,249,0,0,0,0,7,255,144,0,0,0,7,255,254,0,0,0,
-0,127,255,228,0,0,0,6,255,255,64,0,0,0,27,255,248,0,0,0,0,127,253,0,0,0,0,7,253,0,0,0,
-0,111,253,0,0,0,27,255,248,0,0,6,255,255,64,0,0,111,255,228,0,0,7,255,254,0,0,0,7,255,144,0,
-0,0,7,249,0,0,0,0,7,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,228,0,0,
-0,31,255,255,128,0,0,127,255,255,224,0,0,255,149,111,240,0,1,254,0,11,244,0,1,252,0,11,244,0,0,0,
-0,11,244,0,0,0,0,15,240,0,0,0,0,63,224,0,0,0,1,255,128,0,0,0,7,254,0,0,0,0,31,248,
-0,0,0,0,47,208,0,0,0,0,63,128,0,0,0,0,63,64,0,0,0,0,127,64,0,0,0,0,42,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,127,64,0,0,0,0,255,192,0,0,0,0,
-255,192,0,0,0,0,191,192,0,0,0,0,46,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,175,232,0,0,0,11,255,255,64,0,0,47,255,255,208,0,0,191,144,31,240,0,1,253,0,7,
-244,0,3,248,27,226,248,0,7,240,127,249,248,0,11,224,255,253,248,0,11,209,254,90,252,0,15,194,248,2,252,0,
-15,195,244,1,252,0,15,195,244,1,252,0,15,195,240,1,252,0,15,195,244,1,252,0,15,195,244,2,252,0,15,194,
-252,2,252,0,11,209,255,174,252,0,11,224,255,253,252,0,7,240,127,245,252,0,3,248,10,144,84,0,1,254,0,0,
-0,0,0,191,229,91,64,0,0,47,255,255,64,0,0,11,255,255,128,0,0,1,111,249,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,255,208,0,0,0,1,255,208,0,0,0,2,255,224,0,0,
-0,3,247,240,0,0,0,7,243,244,0,0,0,11,226,248,0,0,0,15,209,252,0,0,0,31,209,253,0,0,0,47,
-192,253,0,0,0,47,128,190,0,0,0,63,64,127,0,0,0,127,0,63,64,0,0,191,0,63,128,0,0,254,0,47,
-192,0,1,253,0,31,208,0,2,252,0,15,224,0,2,255,255,255,224,0,3,255,255,255,240,0,7,255,255,255,244,0,
-11,245,85,87,248,0,15,224,0,2,252,0,31,208,0,1,253,0,47,192,0,0,254,0,63,192,0,0,254,0,63,128,
-0,0,191,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,255,255,164,0,0,7,255,
-255,254,0,0,7,255,255,255,192,0,7,245,85,191,224,0,7,244,0,31,240,0,7,244,0,11,240,0,7,244,0,11,
-240,0,7,244,0,11,240,0,7,244,0,31,224,0,7,245,85,191,128,0,7,255,255,249,0,0,7,255,255,164,0,0,
-7,255,255,255,144,0,7,244,0,31,244,0,7,244,0,2,252,0,7,244,0,0,254,0,7,244,0,0,254,0,7,244,
-0,0,191,0,7,244,0,0,255,0,7,244,0,1,254,0,7,244,0,3,253,0,7,245,85,111,252,0,7,255,255,255,
-244,0,7,255,255,255,208,0,7,255,255,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,111,250,64,0,0,7,255,255,224,0,0,47,255,255,248,0,0,191,249,91,253,0,1,255,128,1,254,0,
-3,254,0,0,254,0,7,252,0,0,0,0,11,244,0,0,0,0,15,240,0,0,0,0,15,224,0,0,0,0,31,224,
-0,0,0,0,31,224,0,0,0,0,31,208,0,0,0,0,31,224,0,0,0,0,31,224,0,0,0,0,15,224,0,0,
-0,0,15,240,0,0,0,0,11,244,0,0,0,0,7,252,0,0,0,0,3,254,0,0,0,0,1,255,144,0,0,0,
-0,191,250,85,172,0,0,47,255,255,253,0,0,7,255,255,254,0,0,0,107,255,148,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,7,255,254,144,0,0,7,255,255,253,0,0,7,255,255,255,128,0,7,245,
-86,255,224,0,7,244,0,47,244,0,7,244,0,11,248,0,7,244,0,2,253,0,7,244,0,1,254,0,7,244,0,0,
-254,0,7,244,0,0,191,0,7,244,0,0,191,0,7,244,0,0,127,64,7,244,0,0,127,64,7,244,0,0,127,64,
-7,244,0,0,191,64,7,244,0,0,191,0,7,244,0,0,255,0,7,244,0,1,254,0,7,244,0,2,254,0,7,244,
-0,7,252,0,7,244,0,47,248,0,7,245,86,255,224,0,7,255,255,255,128,0,7,255,255,253,0,0,7,255,254,144,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,255,255,255,253,0,7,255,255,255,
-253,0,7,255,255,255,253,0,7,245,85,85,84,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,
-7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,255,255,255,64,0,7,255,
-255,255,64,0,7,255,255,255,64,0,7,245,85,85,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,
-0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,245,85,85,84,0,7,255,255,255,253,0,
-7,255,255,255,253,0,7,255,255,255,253,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-7,255,255,255,253,0,7,255,255,255,253,0,7,255,255,255,253,0,7,245,85,85,84,0,7,244,0,0,0,0,7,244,
-0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,
-0,0,7,244,0,0,0,0,7,255,255,255,64,0,7,255,255,255,64,0,7,255,255,255,64,0,7,245,85,85,0,0,
-7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,
-0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,111,254,64,0,0,7,255,255,224,0,0,47,255,255,248,0,0,191,229,91,
-253,0,1,255,64,1,254,0,3,253,0,0,190,0,7,248,0,0,0,0,11,244,0,0,0,0,15,240,0,0,0,0,
-15,224,0,0,0,0,31,224,0,0,0,0,31,224,0,0,0,0,31,208,1,85,85,0,31,224,2,255,254,0,31,224,
-2,255,254,0,15,224,2,255,254,0,15,240,0,0,190,0,11,244,0,0,190,0,7,248,0,0,190,0,3,254,0,0,
-190,0,1,255,128,0,190,0,0,191,249,85,254,0,0,47,255,255,254,0,0,7,255,255,254,0,0,0,107,255,164,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,240,0,3,248,0,11,240,0,3,248,0,
-11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,
-0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,255,255,255,248,0,11,255,255,255,
-248,0,11,255,255,255,248,0,11,245,85,87,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,
-11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,
-0,3,248,0,11,240,0,3,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,255,
-255,255,240,0,3,255,255,255,240,0,3,255,255,255,240,0,1,85,127,85,80,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,
-0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,1,85,127,85,
-80,0,3,255,255,255,240,0,3,255,255,255,240,0,3,255,255,255,240,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,127,255,252,0,0,0,127,255,252,0,0,0,127,255,252,0,0,0,21,86,252,0,
-0,0,0,2,252,0,0,0,0,2,252,0,0,0,0,2,252,0,0,0,0,2,252,0,0,0,0,2,252,0,0,0,
-0,2,252,0,0,0,0,2,252,0,0,0,0,2,252,0,0,0,0,2,252,0,0,0,0,2,252,0,0,0,0,2,
-252,0,0,0,0,2,252,0,31,208,0,2,252,0,31,208,0,2,248,0,15,224,0,3,248,0,11,240,0,7,248,0,
-7,248,0,15,244,0,3,255,149,191,224,0,1,255,255,255,192,0,0,47,255,254,0,0,0,6,255,164,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,244,0,1,253,0,7,244,0,1,253,0,7,244,
-0,1,253,0,7,244,0,2,252,0,7,244,0,2,252,0,7,244,0,3,248,0,7,244,0,7,244,0,7,244,0,15,
-240,0,7,244,0,31,208,0,7,244,0,127,128,0,7,244,1,255,64,0,7,244,11,253,0,0,7,245,191,244,0,0,
-7,255,255,248,0,0,7,255,255,252,0,0,7,255,146,254,0,0,7,244,0,255,0,0,7,244,0,191,128,0,7,244,
-0,63,208,0,7,244,0,47,224,0,7,244,0,15,244,0,7,244,0,7,248,0,7,244,0,3,253,0,7,244,0,1,
-254,0,7,244,0,0,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,244,0,0,
-0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,
-7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,
-0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,
-0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,245,85,85,84,0,
-7,255,255,255,253,0,7,255,255,255,253,0,7,255,255,255,253,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,11,255,0,47,252,0,11,255,0,63,252,0,11,255,64,127,252,0,11,255,128,127,252,0,11,255,
-128,191,252,0,11,235,192,250,252,0,11,231,209,250,252,0,11,231,225,246,252,0,11,227,226,242,252,0,11,226,243,226,
-252,0,11,225,247,226,252,0,11,224,255,210,252,0,11,224,255,194,252,0,11,224,191,130,252,0,11,224,127,66,252,0,
-11,224,0,2,252,0,11,224,0,2,252,0,11,224,0,2,252,0,11,224,0,2,252,0,11,224,0,2,252,0,11,224,
-0,2,252,0,11,224,0,2,252,0,11,224,0,2,252,0,11,224,0,2,252,0,11,224,0,2,252,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,253,0,3,248,0,7,254,0,3,248,0,7,255,0,3,
-248,0,7,255,64,3,248,0,7,255,128,3,248,0,7,255,208,3,248,0,7,251,224,3,248,0,7,247,240,3,248,0,
-7,243,244,3,248,0,7,241,248,3,248,0,7,240,253,3,248,0,7,240,190,3,248,0,7,240,127,3,248,0,7,240,
-47,67,248,0,7,240,31,131,248,0,7,240,15,211,248,0,7,240,7,227,248,0,7,240,3,243,248,0,7,240,2,247,
-248,0,7,240,1,255,248,0,7,240,0,191,248,0,7,240,0,127,248,0,7,240,0,63,248,0,7,240,0,47,248,0,
-7,240,0,15,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,191,164,0,0,
-0,47,255,254,0,0,0,191,255,255,128,0,2,255,149,191,224,0,3,253,0,31,244,0,11,248,0,7,248,0,15,240,
-0,3,252,0,15,224,0,2,253,0,31,208,0,1,253,0,31,208,0,0,254,0,47,192,0,0,254,0,47,192,0,0,
-254,0,47,192,0,0,254,0,47,192,0,0,254,0,47,192,0,0,254,0,47,208,0,0,254,0,31,208,0,1,253,0,
-31,224,0,2,253,0,15,240,0,3,252,0,11,244,0,7,248,0,7,253,0,31,244,0,2,255,149,191,224,0,0,191,
-255,255,128,0,0,47,255,254,0,0,0,6,191,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,7,255,255,164,0,0,7,255,255,255,64,0,7,255,255,255,208,0,7,245,85,191,244,0,7,244,0,11,
-252,0,7,244,0,3,253,0,7,244,0,1,253,0,7,244,0,0,254,0,7,244,0,0,254,0,7,244,0,0,254,0,
-7,244,0,1,253,0,7,244,0,2,253,0,7,244,0,7,252,0,7,244,0,111,244,0,7,255,255,255,224,0,7,255,
-255,255,64,0,7,255,255,248,0,0,7,245,85,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,
-0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,191,164,0,0,0,47,255,254,0,0,0,191,255,255,128,0,
-2,255,149,191,224,0,3,253,0,31,244,0,11,248,0,7,248,0,15,240,0,3,252,0,15,224,0,2,253,0,31,208,
-0,1,253,0,31,208,0,1,254,0,47,192,0,0,254,0,47,192,0,0,254,0,47,192,0,0,254,0,47,192,0,0,
-254,0,47,192,0,0,254,0,47,208,0,0,254,0,31,208,0,1,253,0,31,224,0,1,253,0,15,240,0,2,252,0,
-11,244,0,7,248,0,7,252,0,15,244,0,2,255,64,127,224,0,0,255,255,255,192,0,0,47,255,254,0,0,0,6,
-255,228,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,63,128,0,0,0,0,47,208,0,0,0,0,31,249,
-80,0,0,0,11,255,240,0,0,0,2,255,240,0,0,0,0,111,240,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,255,255,228,0,0,11,255,
-255,255,64,0,11,255,255,255,208,0,11,245,85,111,244,0,11,240,0,11,248,0,11,240,0,3,252,0,11,240,0,2,
-252,0,11,240,0,2,252,0,11,240,0,2,252,0,11,240,0,2,252,0,11,240,0,7,248,0,11,240,0,111,244,0,
-11,255,255,255,224,0,11,255,255,255,128,0,11,255,255,253,0,0,11,245,86,253,0,0,11,240,0,255,0,0,11,240,
-0,191,64,0,11,240,0,127,192,0,11,240,0,47,208,0,11,240,0,31,240,0,11,240,0,11,244,0,11,240,0,7,
-252,0,11,240,0,3,253,0,11,240,0,1,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,2,191,228,0,0,0,47,255,254,0,0,0,191,255,255,128,0,1,255,149,191,208,0,2,253,0,15,224,0,
-3,248,0,11,224,0,3,248,0,0,0,0,3,248,0,0,0,0,3,253,0,0,0,0,2,255,128,0,0,0,0,255,
-248,0,0,0,0,47,255,144,0,0,0,11,255,248,0,0,0,0,191,255,64,0,0,0,6,255,208,0,0,0,0,111,
-240,0,0,0,0,11,244,0,0,0,0,7,244,0,0,0,0,7,244,0,0,0,0,7,244,0,5,0,0,15,240,0,
-11,249,85,191,224,0,11,255,255,255,192,0,11,255,255,254,0,0,0,107,255,164,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,47,255,255,255,254,0,47,255,255,255,254,0,47,255,255,255,254,0,5,85,
-127,85,85,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,
-0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,240,0,3,248,0,11,240,0,3,
-248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,
-11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,
-0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,7,240,0,3,
-248,0,7,244,0,3,244,0,7,244,0,7,244,0,3,253,0,31,240,0,1,255,149,191,224,0,0,191,255,255,128,0,
-0,47,255,254,0,0,0,6,255,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-63,128,0,0,191,0,47,192,0,0,255,0,47,208,0,0,254,0,31,208,0,1,253,0,15,224,0,2,252,0,11,240,
-0,3,248,0,7,244,0,7,244,0,3,248,0,7,244,0,3,248,0,11,240,0,2,252,0,15,224,0,1,253,0,31,
-208,0,0,254,0,47,192,0,0,191,0,47,128,0,0,127,0,63,64,0,0,63,64,127,64,0,0,63,128,191,0,0,
-0,47,192,254,0,0,0,31,208,253,0,0,0,15,209,252,0,0,0,11,226,248,0,0,0,7,243,248,0,0,0,7,
-247,244,0,0,0,3,255,240,0,0,0,2,255,224,0,0,0,1,255,208,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,190,0,0,0,47,128,126,0,0,0,47,128,127,0,0,0,63,128,127,0,0,0,
-63,64,127,0,0,0,63,64,63,64,0,0,63,64,63,64,0,0,127,0,63,64,127,64,127,0,47,64,191,128,127,0,
-47,128,191,128,190,0,47,128,255,192,190,0,47,128,251,192,190,0,31,193,247,208,190,0,31,193,243,208,253,0,31,194,
-242,224,253,0,15,194,226,224,253,0,15,211,226,240,252,0,15,211,225,241,252,0,11,215,209,245,252,0,11,231,208,245,
-248,0,11,235,192,250,248,0,11,235,192,250,248,0,7,255,192,191,248,0,7,255,128,191,244,0,7,255,128,127,244,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,208,0,1,254,0,15,240,0,3,252,0,
-7,248,0,7,244,0,2,253,0,15,224,0,0,254,0,47,208,0,0,191,64,127,128,0,0,63,128,191,0,0,0,31,
-209,253,0,0,0,11,242,248,0,0,0,3,251,244,0,0,0,1,255,224,0,0,0,0,255,192,0,0,0,0,127,64,
-0,0,0,0,191,192,0,0,0,1,255,208,0,0,0,3,255,240,0,0,0,11,243,248,0,0,0,31,209,253,0,0,
-0,47,192,191,0,0,0,127,64,127,128,0,0,254,0,47,208,0,2,253,0,15,224,0,7,248,0,11,244,0,15,240,
-0,3,252,0,47,208,0,1,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,128,
-0,0,127,64,47,192,0,0,255,0,31,224,0,1,253,0,11,240,0,3,252,0,7,248,0,7,244,0,2,252,0,15,
-224,0,1,253,0,31,208,0,0,191,0,63,128,0,0,63,64,127,64,0,0,47,192,190,0,0,0,15,209,253,0,0,
-0,11,242,248,0,0,0,3,251,244,0,0,0,2,255,224,0,0,0,0,255,208,0,0,0,0,191,128,0,0,0,0,
-127,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,
-0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,63,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,7,255,255,255,244,0,7,255,255,255,244,0,7,255,255,255,244,0,1,85,85,95,244,0,
-0,0,0,47,224,0,0,0,0,127,192,0,0,0,0,191,64,0,0,0,1,254,0,0,0,0,3,252,0,0,0,0,
-11,244,0,0,0,0,31,240,0,0,0,0,63,208,0,0,0,0,191,128,0,0,0,0,255,0,0,0,0,2,253,0,
-0,0,0,7,248,0,0,0,0,15,240,0,0,0,0,47,208,0,0,0,0,127,128,0,0,0,0,191,64,0,0,0,
-1,254,0,0,0,0,3,252,0,0,0,0,7,255,255,255,248,0,7,255,255,255,248,0,7,255,255,255,248,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,7,255,255,224,0,0,7,255,255,224,0,0,7,255,255,224,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,
-240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,
-0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,
-0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,
-240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,240,0,
-0,0,0,7,240,0,0,0,0,7,240,0,0,0,0,7,255,255,224,0,0,7,255,255,224,0,0,7,255,255,224,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,144,0,0,0,0,11,240,0,0,0,0,7,244,0,0,
-0,0,2,248,0,0,0,0,1,253,0,0,0,0,0,254,0,0,0,0,0,127,0,0,0,0,0,63,128,0,0,0,
-0,47,192,0,0,0,0,15,208,0,0,0,0,11,240,0,0,0,0,7,244,0,0,0,0,2,248,0,0,0,0,1,
-253,0,0,0,0,0,190,0,0,0,0,0,127,64,0,0,0,0,63,128,0,0,0,0,31,192,0,0,0,0,15,224,
-0,0,0,0,11,240,0,0,0,0,3,244,0,0,0,0,2,252,0,0,0,0,1,253,0,0,0,0,0,190,0,0,
-0,0,0,127,64,0,0,0,0,63,128,0,0,0,0,31,192,0,0,0,0,15,224,0,0,0,0,11,240,0,0,0,
-0,3,244,0,0,0,0,2,252,0,0,0,0,1,253,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,255,255,248,0,0,1,255,255,248,0,0,
-1,255,255,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,
-7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,
-0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,
-0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,
-7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,
-0,0,1,255,255,248,0,0,1,255,255,248,0,0,1,255,255,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,255,192,0,0,0,1,255,224,0,0,0,3,255,240,
-0,0,0,7,247,244,0,0,0,11,226,252,0,0,0,31,209,253,0,0,0,47,192,254,0,0,0,63,128,191,0,0,
-0,191,64,63,128,0,0,254,0,47,192,0,0,169,0,26,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,255,255,253,0,31,255,255,255,253,0,31,255,255,255,
-253,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,
-244,0,0,0,0,3,248,0,0,0,0,2,253,0,0,0,0,0,254,0,0,0,0,0,127,64,0,0,0,0,47,128,
-0,0,0,0,26,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,169,0,0,0,0,255,255,224,0,0,0,255,
-255,253,0,0,0,85,107,255,0,0,0,0,0,191,128,0,0,0,0,47,192,0,0,0,0,31,192,0,0,0,20,31,
-192,0,0,27,255,255,208,0,1,255,255,255,208,0,7,255,235,255,208,0,15,244,0,31,208,0,31,208,0,31,208,0,
-31,208,0,47,208,0,31,208,0,191,208,0,15,244,6,235,212,0,11,255,255,219,255,64,2,255,255,139,255,64,0,111,
-249,11,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,
-0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,111,232,
-0,0,3,249,255,255,64,0,3,250,255,255,208,0,3,251,229,111,240,0,3,255,0,11,248,0,3,253,0,3,252,0,
-3,252,0,2,252,0,3,248,0,1,253,0,3,248,0,1,253,0,3,248,0,1,253,0,3,248,0,1,253,0,3,248,
-0,2,253,0,3,248,0,3,252,0,3,248,0,7,248,0,3,248,0,31,244,0,3,249,85,191,224,0,3,255,255,255,
-128,0,3,255,255,253,0,0,2,191,254,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,191,233,0,0,0,31,255,255,128,0,0,127,255,255,224,0,0,255,229,127,240,0,2,255,
-0,11,244,0,3,253,0,7,248,0,7,248,0,2,164,0,7,244,0,0,0,0,11,244,0,0,0,0,11,244,0,0,
-0,0,11,244,0,0,0,0,7,248,0,0,0,0,7,252,0,0,0,0,3,253,0,0,0,0,2,255,64,0,0,0,
-0,255,229,85,160,0,0,127,255,255,240,0,0,11,255,255,244,0,0,1,175,255,160,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,
-0,11,240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,10,254,11,240,0,0,127,255,203,240,0,1,255,255,235,
-240,0,3,255,86,251,240,0,7,248,0,47,240,0,11,244,0,31,240,0,15,224,0,15,240,0,15,224,0,11,240,0,
-31,208,0,11,240,0,31,208,0,11,240,0,31,208,0,11,240,0,31,224,0,11,240,0,15,224,0,11,240,0,11,240,
-0,11,240,0,11,248,0,31,240,0,3,254,85,191,240,0,1,255,255,247,240,0,0,127,255,215,240,0,0,11,254,71,
-240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,228,0,0,
-0,31,255,254,0,0,0,127,255,255,128,0,0,255,149,191,224,0,2,253,0,15,240,0,3,248,0,7,244,0,7,244,
-0,3,248,0,7,240,0,2,248,0,11,250,170,171,248,0,11,255,255,255,248,0,11,255,255,255,248,0,7,240,0,0,
-0,0,7,248,0,0,0,0,3,253,0,0,0,0,2,255,64,0,0,0,0,255,233,85,144,0,0,63,255,255,224,0,
-0,11,255,255,224,0,0,0,111,254,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,250,0,
-0,0,11,255,254,0,0,0,47,255,253,0,0,0,191,229,85,0,0,0,255,64,0,0,0,1,254,0,0,0,0,2,
-252,0,0,0,0,2,252,0,0,0,0,3,252,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,
-0,0,47,255,255,255,244,0,47,255,255,255,244,0,47,255,255,255,244,0,0,3,248,0,0,0,0,3,248,0,0,0,
-0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,
-248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,254,7,240,0,0,127,255,199,240,0,1,255,255,231,240,0,
-3,255,86,251,240,0,7,248,0,47,240,0,11,244,0,31,240,0,15,224,0,15,240,0,15,224,0,11,240,0,31,208,
-0,11,240,0,31,208,0,11,240,0,31,208,0,11,240,0,31,224,0,11,240,0,15,224,0,11,240,0,11,240,0,11,
-240,0,11,248,0,31,240,0,3,254,85,191,240,0,1,255,255,251,240,0,0,127,255,219,240,0,0,11,254,75,240,0,
-0,0,0,11,240,0,0,0,0,15,224,0,0,0,0,47,208,0,0,0,0,191,192,0,1,85,171,255,64,0,3,255,
-255,254,0,0,3,255,255,244,0,0,2,255,169,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,
-3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,47,232,0,0,3,249,
-255,255,64,0,3,250,255,255,192,0,3,251,213,191,224,0,3,255,0,31,240,0,3,253,0,11,240,0,3,252,0,11,
-240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,
-3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,
-0,11,240,0,3,248,0,11,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,144,0,0,0,0,
-47,240,0,0,0,0,63,240,0,0,0,0,63,240,0,0,0,0,31,208,0,0,0,0,1,0,0,0,0,0,0,0,
-0,0,0,255,255,224,0,0,0,255,255,224,0,0,0,255,255,224,0,0,0,0,15,224,0,0,0,0,15,224,0,0,
-0,0,15,224,0,0,0,0,15,224,0,0,0,0,15,224,0,0,0,0,15,224,0,0,0,0,15,224,0,0,0,0,
-15,224,0,0,0,0,15,224,0,0,0,0,15,224,0,0,0,0,15,224,0,0,0,0,15,224,0,0,0,0,15,224,
-0,0,7,255,255,255,253,0,7,255,255,255,253,0,7,255,255,255,253,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,184,0,0,0,0,3,254,0,0,0,0,7,255,0,0,0,0,3,254,0,0,0,0,1,253,0,0,
-0,0,0,16,0,0,0,0,0,0,0,0,0,127,255,254,0,0,0,127,255,254,0,0,0,127,255,254,0,0,0,0,
-0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,
-0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,
-0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,0,254,0,0,0,0,1,254,0,0,0,0,
-1,253,0,0,0,0,2,253,0,0,0,0,7,252,0,0,0,0,31,248,0,0,1,90,255,240,0,0,3,255,255,192,
-0,0,3,255,253,0,0,0,3,250,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,
-0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,0,0,0,7,248,0,3,248,0,7,248,0,7,
-248,0,7,248,0,11,244,0,7,248,0,11,240,0,7,248,0,31,224,0,7,248,0,47,208,0,7,248,0,191,192,0,
-7,248,23,255,64,0,7,255,255,254,0,0,7,255,255,248,0,0,7,255,255,252,0,0,7,249,66,254,0,0,7,248,
-1,255,64,0,7,248,0,191,128,0,7,248,0,63,208,0,7,248,0,47,240,0,7,248,0,15,248,0,7,248,0,7,
-253,0,7,248,0,2,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,248,0,0,0,31,255,248,0,
-0,0,31,255,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,
-0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,
-248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,
-0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,252,0,0,0,0,2,253,0,0,0,0,1,255,149,100,0,
-0,0,255,255,244,0,0,0,127,255,248,0,0,0,11,255,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,15,214,248,31,224,0,15,223,254,127,248,0,15,238,255,191,252,0,15,244,127,131,
-252,0,15,224,63,66,252,0,15,224,63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,
-15,224,63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,15,224,
-63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,15,224,63,2,252,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,244,47,232,0,0,3,245,255,255,64,0,
-3,250,255,255,192,0,3,251,213,191,224,0,3,255,0,31,240,0,3,253,0,11,240,0,3,252,0,11,240,0,3,248,
-0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,
-240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,3,248,0,11,240,0,
-3,248,0,11,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
-191,160,0,0,0,31,255,253,0,0,0,127,255,255,128,0,1,255,149,191,208,0,2,254,0,47,224,0,3,252,0,15,
-240,0,7,248,0,11,244,0,7,244,0,7,248,0,11,244,0,7,248,0,11,244,0,7,248,0,11,244,0,7,248,0,
-7,244,0,7,248,0,7,248,0,11,244,0,3,252,0,15,240,0,2,254,0,47,224,0,0,255,149,191,208,0,0,127,
-255,255,128,0,0,31,255,253,0,0,0,2,191,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,3,244,47,248,0,0,3,244,255,255,64,0,3,250,255,255,208,0,3,251,229,111,240,0,
-3,255,0,11,248,0,3,253,0,3,248,0,3,252,0,2,252,0,3,248,0,1,253,0,3,248,0,1,253,0,3,248,
-0,1,253,0,3,248,0,1,253,0,3,248,0,1,253,0,3,248,0,2,252,0,3,248,0,3,252,0,3,253,0,11,
-248,0,3,255,149,111,244,0,3,250,255,255,224,0,3,249,255,255,128,0,3,248,47,249,0,0,3,248,0,0,0,0,
-3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,0,0,0,0,3,248,
-0,0,0,0,3,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,254,7,240,0,0,127,255,199,240,0,1,255,
-255,235,240,0,3,254,86,251,240,0,11,248,0,63,240,0,15,240,0,31,240,0,15,224,0,15,240,0,31,208,0,11,
-240,0,31,208,0,11,240,0,31,208,0,11,240,0,31,208,0,11,240,0,31,208,0,11,240,0,31,224,0,11,240,0,
-15,240,0,15,240,0,11,248,0,31,240,0,7,254,85,191,240,0,2,255,255,235,240,0,0,191,255,219,240,0,0,27,
-254,11,240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,11,
-240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,11,240,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,255,128,191,
-144,0,15,255,131,255,248,0,15,255,203,255,253,0,0,31,207,150,254,0,0,31,220,0,255,0,0,31,244,0,191,0,
-0,31,240,0,127,64,0,31,224,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,
-208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,47,255,255,240,
-0,0,47,255,255,240,0,0,47,255,255,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,1,175,255,160,0,0,47,255,255,224,0,0,191,255,255,224,0,1,255,165,85,80,0,1,254,
-0,0,0,0,2,253,0,0,0,0,2,254,0,0,0,0,1,255,228,0,0,0,0,191,255,228,0,0,0,31,255,255,
-64,0,0,1,175,255,208,0,0,0,1,191,240,0,0,0,0,11,244,0,0,0,0,11,244,0,0,0,0,15,244,0,
-2,149,85,191,240,0,3,255,255,255,208,0,3,255,255,255,64,0,2,191,255,164,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,26,144,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,
-208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,63,255,255,255,240,0,63,255,255,255,240,0,63,255,255,255,
-240,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,
-0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,208,0,0,0,0,31,224,0,0,0,0,15,
-224,0,0,0,0,15,244,0,0,0,0,11,254,85,96,0,0,3,255,255,244,0,0,0,191,255,244,0,0,0,27,255,
-228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,244,0,15,224,0,
-7,244,0,15,224,0,7,244,0,15,224,0,7,244,0,15,224,0,7,244,0,15,224,0,7,244,0,15,224,0,7,244,
-0,15,224,0,7,244,0,15,224,0,7,244,0,15,224,0,7,244,0,15,224,0,7,244,0,15,224,0,7,244,0,15,
-224,0,7,244,0,31,224,0,7,248,0,31,224,0,3,252,0,63,224,0,2,255,150,239,244,0,1,255,255,219,255,64,
-0,127,255,139,255,64,0,10,249,11,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,31,224,0,1,254,0,15,240,0,2,252,0,11,244,0,3,248,0,7,248,0,7,244,0,3,248,0,11,
-240,0,2,252,0,15,224,0,1,253,0,31,208,0,0,254,0,47,192,0,0,191,0,63,128,0,0,127,64,127,64,0,
-0,63,128,191,0,0,0,47,192,254,0,0,0,15,209,253,0,0,0,11,225,252,0,0,0,7,242,248,0,0,0,3,
-251,244,0,0,0,2,255,240,0,0,0,1,255,224,0,0,0,0,255,208,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,128,191,64,190,0,47,192,191,128,190,0,47,192,255,128,254,0,
-31,192,255,192,253,0,31,193,251,192,253,0,31,193,247,192,253,0,31,210,227,209,252,0,15,210,227,209,252,0,15,210,
-210,225,252,0,15,211,210,225,248,0,11,211,193,226,248,0,11,215,193,242,248,0,11,231,128,242,244,0,11,235,128,247,
-244,0,7,235,64,183,244,0,7,235,64,187,240,0,7,255,0,127,240,0,3,255,0,127,240,0,3,254,0,63,224,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,244,0,7,252,0,3,252,
-0,15,244,0,1,254,0,47,208,0,0,191,64,127,128,0,0,63,192,255,0,0,0,31,226,253,0,0,0,11,251,248,
-0,0,0,3,255,240,0,0,0,1,255,208,0,0,0,0,191,128,0,0,0,0,255,208,0,0,0,2,255,240,0,0,
-0,11,251,248,0,0,0,31,226,253,0,0,0,63,192,255,0,0,0,191,64,127,128,0,1,254,0,47,208,0,3,252,
-0,15,244,0,11,244,0,7,252,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,63,192,0,2,253,0,47,208,0,2,252,0,31,224,0,3,248,0,11,240,0,7,244,0,7,244,0,11,240,0,
-3,248,0,15,224,0,2,252,0,31,208,0,1,253,0,47,192,0,0,255,0,47,128,0,0,191,64,63,64,0,0,63,
-128,127,64,0,0,47,192,191,0,0,0,31,208,254,0,0,0,15,225,253,0,0,0,11,242,252,0,0,0,7,246,248,
-0,0,0,2,255,244,0,0,0,1,255,240,0,0,0,0,255,224,0,0,0,0,31,208,0,0,0,0,63,128,0,0,
-0,0,191,64,0,0,0,7,254,0,0,0,22,191,248,0,0,0,63,255,224,0,0,0,63,255,64,0,0,0,46,148,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,7,255,255,255,240,0,7,255,255,255,240,0,7,255,255,255,240,0,0,0,
-0,47,208,0,0,0,0,191,128,0,0,0,1,254,0,0,0,0,7,252,0,0,0,0,15,244,0,0,0,0,63,208,
-0,0,0,0,191,128,0,0,0,2,254,0,0,0,0,7,252,0,0,0,0,31,244,0,0,0,0,63,208,0,0,0,
-0,255,128,0,0,0,2,254,0,0,0,0,7,255,255,255,244,0,7,255,255,255,244,0,7,255,255,255,244,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,208,0,
-0,0,7,255,208,0,0,0,31,255,208,0,0,0,47,224,64,0,0,0,63,192,0,0,0,0,127,128,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,127,64,0,0,0,0,255,64,0,0,0,7,255,0,0,0,0,191,249,0,0,0,0,191,208,0,0,0,
-0,127,253,0,0,0,0,2,255,0,0,0,0,0,191,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,128,
-0,0,0,0,63,192,0,0,0,0,47,245,64,0,0,0,15,255,208,0,0,0,2,255,208,0,0,0,0,106,144,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,64,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,
-0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,
-0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,
-0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,
-127,64,0,0,0,0,127,64,0,0,0,0,127,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,255,128,0,0,0,1,255,244,0,0,0,0,255,253,0,0,0,
-0,66,254,0,0,0,0,0,255,64,0,0,0,0,127,64,0,0,0,0,127,128,0,0,0,0,127,128,0,0,0,0,
-127,128,0,0,0,0,127,128,0,0,0,0,127,128,0,0,0,0,127,128,0,0,0,0,127,128,0,0,0,0,63,192,
-0,0,0,0,47,244,0,0,0,0,11,255,128,0,0,0,1,255,128,0,0,0,31,255,64,0,0,0,63,224,0,0,
-0,0,127,128,0,0,0,0,127,128,0,0,0,0,127,128,0,0,0,0,127,128,0,0,0,0,127,128,0,0,0,0,
-127,128,0,0,0,0,127,128,0,0,0,0,127,64,0,0,0,0,191,64,0,0,0,0,255,0,0,0,0,87,254,0,
-0,0,0,255,252,0,0,0,1,255,224,0,0,0,0,170,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,1,253,0,0,0,0,1,253,0,0,106,80,2,253,0,2,255,254,171,252,0,11,255,255,255,248,0,15,254,
-255,255,244,0,15,240,1,175,208,0,31,208,0,0,0,0,31,208,0,0,0,0,5,64,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-/*Bitmap Raw Data end ---*/
-} 
+const uint8_t Cascadia_36_L2 [2909] = 
+{
+/* Metric block */
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+21,22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+21,21,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+17,0,0,0,6,0,0,0,22,0,0,0,39,0,0,0,148,0,0,0,
+/* Deflated bitmap */
+120,218,237,91,191,111,28,199,21,158,221,149,184,128,182,216,38,64,128,16,200,246,2,226,253,19,238,226,20,41,210,176,
+200,41,133,27,23,41,2,171,184,54,221,46,162,50,13,139,200,53,11,5,136,172,0,234,19,64,67,184,73,225,34,39,
+59,74,10,5,200,89,38,97,203,2,146,139,185,52,247,200,219,157,188,247,189,253,49,119,60,73,71,233,150,39,33,94,
+17,31,168,253,49,243,102,222,155,247,190,247,102,168,212,119,151,117,57,250,128,48,48,37,97,108,76,95,169,228,80,239,
+43,165,211,120,164,148,81,17,144,175,18,40,191,235,62,99,178,207,24,143,25,163,220,41,232,126,225,204,148,111,204,143,
+103,42,156,234,79,103,244,48,254,54,87,189,52,48,25,161,107,38,132,202,140,21,53,158,140,85,52,189,97,114,234,220,
+152,66,185,198,28,82,247,195,211,190,52,251,26,215,77,146,89,109,25,198,8,136,49,58,60,56,229,21,252,134,159,51,
+134,19,72,62,194,40,100,44,41,99,79,80,198,184,2,246,108,76,219,214,164,229,16,243,19,76,218,126,221,106,42,241,
+106,50,237,55,114,186,64,245,131,221,213,84,119,218,199,176,50,52,134,54,183,170,54,209,76,100,119,57,195,23,133,165,
+73,109,225,115,71,211,127,206,76,88,223,150,45,186,104,223,67,95,1,196,138,48,120,205,242,188,199,243,239,152,2,50,
+243,109,231,110,119,102,253,193,82,37,185,253,158,122,95,249,89,207,207,200,234,180,206,85,72,182,55,83,206,208,148,59,
+44,150,40,129,231,45,56,225,121,139,31,242,184,116,170,83,30,45,235,246,71,234,135,116,231,10,253,219,248,117,93,189,
+72,93,139,24,97,149,217,120,117,144,12,126,190,98,11,215,251,255,47,14,81,92,155,160,177,92,30,12,220,41,219,101,
+228,204,218,133,229,98,145,121,64,103,231,210,100,93,166,211,1,116,250,221,117,197,114,108,102,191,69,13,124,103,189,246,
+236,252,161,181,2,63,107,253,125,104,197,22,137,12,137,101,76,197,185,143,198,139,1,73,86,159,229,104,197,234,188,117,
+126,244,202,204,97,23,38,200,163,72,192,28,204,35,154,92,10,110,196,8,40,6,80,116,165,216,67,97,128,122,228,95,
+38,44,0,35,63,186,254,46,163,254,152,112,108,62,101,196,239,147,30,221,15,38,87,188,89,253,62,190,229,159,172,106,
+83,218,87,230,54,7,21,233,87,100,16,121,186,184,182,216,102,28,195,246,227,86,136,59,187,21,105,232,20,157,65,242,
+104,71,121,180,186,243,57,236,104,164,119,192,3,17,245,12,145,9,23,243,76,164,137,230,156,180,192,58,205,42,219,14,
+44,59,175,172,221,50,170,222,126,227,70,29,56,80,31,54,24,101,13,63,113,193,199,162,28,170,227,47,61,115,155,124,
+151,7,63,102,99,71,188,247,43,97,188,41,70,58,38,41,111,235,9,143,52,204,216,240,196,228,100,177,8,202,232,160,
+152,45,158,31,23,172,210,51,83,110,237,158,16,175,161,204,70,222,210,32,23,150,76,196,72,44,159,23,194,140,71,170,
+51,182,40,230,65,9,100,216,50,7,221,133,137,17,7,112,198,4,168,113,231,1,176,100,36,79,212,32,9,204,152,51,
+122,64,26,126,131,52,10,198,49,99,8,228,184,83,86,24,3,27,27,120,49,118,16,186,49,159,198,194,114,48,232,207,
+49,212,10,11,11,75,253,84,225,253,180,253,138,180,163,118,22,245,216,16,92,209,38,107,22,78,137,44,59,200,161,211,
+9,116,74,163,27,194,47,109,153,59,157,233,244,102,10,231,219,56,166,192,60,165,30,227,105,75,255,177,188,108,70,238,
+231,219,244,216,63,230,145,6,39,60,210,224,140,237,48,44,88,254,48,135,131,109,220,236,172,30,163,216,45,252,176,172,
+14,94,41,99,204,246,136,69,40,155,44,178,131,139,249,185,1,150,64,18,224,235,143,238,113,188,128,59,26,179,10,8,
+73,96,182,198,177,186,182,199,169,101,227,127,146,116,129,204,57,231,242,20,201,143,196,153,73,66,40,9,109,111,212,166,
+184,58,109,38,84,156,89,55,190,247,64,124,111,31,118,184,15,223,59,230,57,143,236,80,40,222,41,171,84,227,148,253,
+97,19,7,197,135,108,195,35,233,175,217,123,227,219,54,254,98,222,92,75,191,30,76,183,178,222,172,182,94,187,181,110,
+70,186,215,68,25,83,71,25,82,104,193,130,9,97,144,232,31,86,108,161,69,126,138,21,23,193,139,254,121,198,50,31,
+229,108,141,159,17,110,159,218,236,75,146,79,172,6,7,254,121,155,123,188,129,224,105,164,48,0,115,248,211,229,49,246,
+101,215,59,170,229,165,54,83,21,238,122,209,68,243,82,121,239,74,215,175,154,152,232,232,28,94,43,99,235,98,27,27,
+178,141,5,48,216,168,236,55,42,147,223,229,62,89,227,24,149,13,220,139,81,237,144,118,212,182,176,160,95,191,17,249,
+134,143,153,245,33,178,111,118,129,165,200,127,160,234,241,210,226,132,204,137,84,161,128,195,162,190,111,205,137,124,91,181,
+51,109,219,191,220,218,160,25,169,182,42,2,138,118,194,11,203,63,98,37,4,79,120,40,225,67,246,162,209,195,2,220,
+8,152,62,64,14,146,32,219,225,92,68,42,39,37,115,167,134,99,176,35,66,180,101,142,55,225,154,33,105,54,56,30,
+252,34,175,124,148,16,18,166,91,37,156,121,137,70,116,55,186,51,28,169,125,144,23,31,190,215,63,30,176,71,202,42,
+255,25,156,67,50,84,126,39,229,247,167,86,11,164,49,126,154,85,46,154,221,81,105,161,6,26,70,7,119,200,189,83,
+59,195,89,53,3,62,60,176,180,217,205,53,228,170,161,15,158,19,35,143,208,211,247,10,246,143,36,143,87,66,206,217,
+98,68,172,136,189,141,163,197,59,242,78,104,165,6,210,142,39,25,40,44,89,233,211,193,31,209,111,81,79,183,186,105,
+126,215,145,78,203,93,116,34,93,145,255,247,143,111,24,232,52,150,16,35,97,180,104,117,49,167,35,193,164,191,136,186,
+191,84,143,46,208,135,198,227,188,238,75,250,173,100,40,59,202,79,125,240,162,57,60,230,42,144,157,188,188,4,13,123,
+158,57,164,22,86,252,86,250,58,39,195,27,58,210,215,31,239,57,236,226,106,171,37,175,140,168,18,204,33,188,235,235,
+180,217,197,37,254,223,70,103,144,12,118,86,220,122,121,93,148,190,206,203,208,137,245,102,27,197,75,92,167,129,81,241,
+140,177,199,216,79,24,83,65,77,248,108,255,148,240,203,135,192,207,191,37,252,226,201,55,132,79,142,158,16,126,126,194,
+136,170,32,225,199,140,250,55,140,9,215,6,193,13,94,13,59,209,105,129,116,172,4,26,193,62,48,5,142,24,207,198,
+140,39,19,198,163,140,241,191,57,227,164,0,62,0,38,192,248,39,140,209,45,198,240,51,70,255,11,70,239,136,209,61,
+97,116,12,163,210,192,4,216,3,198,192,240,50,107,131,146,159,74,48,109,242,181,49,18,207,186,160,36,196,239,69,104,
+151,161,240,109,155,235,229,60,195,212,190,219,212,28,210,90,6,145,167,75,54,88,69,135,17,152,158,112,134,89,205,217,
+50,150,118,145,221,149,237,125,225,21,194,7,134,194,235,198,109,155,57,214,227,230,163,140,145,252,139,165,10,48,82,138,
+17,67,80,220,160,174,24,4,243,181,32,27,165,170,192,239,99,116,1,216,78,0,167,18,28,223,40,16,197,12,80,247,
+25,147,125,198,88,170,136,19,244,34,116,90,106,17,133,20,52,186,25,170,91,87,87,106,235,117,80,217,102,99,27,35,
+192,141,171,0,87,161,20,250,164,170,43,57,91,12,10,27,200,127,52,178,57,57,99,80,87,125,151,41,238,42,40,113,
+48,229,108,34,64,102,17,212,180,183,35,235,141,173,74,172,32,239,243,14,46,41,158,62,31,223,72,142,180,2,250,147,
+170,224,230,101,213,142,128,84,228,156,37,30,169,51,157,142,120,93,132,245,14,130,184,23,78,184,196,121,234,62,215,57,
+123,169,110,50,241,224,27,182,82,239,12,197,18,100,238,115,53,37,212,130,36,175,247,228,180,195,81,110,101,241,26,47,
+38,105,213,190,244,37,123,121,34,131,200,179,30,87,59,94,64,57,180,242,102,226,57,105,47,80,74,97,191,97,99,93,
+121,126,19,113,153,180,175,115,153,253,198,14,197,222,252,19,169,32,217,181,163,82,213,54,172,251,77,189,72,221,93,245,
+52,212,91,115,105,28,123,18,243,17,2,62,184,89,157,170,75,219,173,223,136,241,123,140,219,28,151,157,170,46,244,140,
+48,196,78,92,243,19,3,53,223,223,122,246,55,142,47,143,77,223,53,230,183,124,154,110,26,152,53,123,223,185,40,249,
+18,28,126,69,56,101,118,225,157,178,252,222,217,225,144,51,44,236,56,20,236,73,232,135,184,4,189,239,20,203,209,5,
+122,179,106,79,150,119,36,201,3,35,158,122,224,27,30,230,208,213,229,38,205,196,193,30,98,132,88,144,200,254,227,97,
+66,52,201,96,139,176,168,206,48,184,119,234,211,23,231,176,90,123,51,155,123,72,9,255,112,176,135,54,39,32,106,244,
+178,115,223,236,117,18,76,87,194,107,37,99,98,62,193,94,231,51,214,230,141,51,80,193,24,116,46,154,180,251,113,213,
+102,241,2,226,190,60,173,126,114,236,112,149,3,217,63,61,65,251,255,224,241,150,63,157,108,82,167,7,170,222,223,148,
+61,122,68,252,42,61,169,143,7,8,67,112,41,56,158,126,116,111,190,222,226,91,231,47,231,117,250,116,64,198,218,131,
+157,4,226,8,134,93,152,239,253,83,213,30,237,101,1,244,225,160,217,199,44,173,93,237,89,187,29,122,110,25,199,168,
+75,219,120,33,23,176,28,55,117,93,43,125,88,215,95,96,105,95,118,96,189,103,104,255,49,172,247,103,231,206,198,200,
+222,52,209,47,103,112,143,189,34,114,1,15,147,234,154,187,253,117,250,222,120,206,247,238,147,239,125,4,159,9,105,139,
+54,185,91,23,85,94,187,67,194,130,136,209,112,207,66,217,121,112,44,114,81,69,210,22,235,189,136,181,96,215,21,179,
+11,49,179,234,96,82,94,159,172,203,171,52,60,2,63,39,235,34,36,235,242,243,239,75,157,65,246,179,114,224,140,119,
+18,223,229,59,57,31,133,231,55,83,198,222,168,178,127,31,135,64,164,228,194,209,106,221,153,120,100,242,5,92,131,39,
+89,9,173,179,59,148,182,253,18,134,146,193,173,231,240,144,119,54,230,144,194,191,231,164,187,240,95,101,66,147,255,111,
+163,249,4,78,114,139,107,104,124,18,146,208,93,55,110,234,242,50,120,164,227,183,215,35,93,128,57,236,41,235,100,108,
+83,107,122,222,201,216,115,232,103,237,26,95,126,234,53,173,219,119,245,158,218,164,78,115,198,231,51,252,252,229,12,191,
+226,249,179,154,231,23,213,121,164,97,134,54,199,136,98,41,71,180,233,230,136,70,104,82,189,75,120,203,240,223,140,124,
+194,83,31,253,245,67,242,144,209,63,185,196,73,57,137,198,31,220,36,253,249,13,242,85,49,6,193,183,113,115,214,139,
+252,34,70,40,173,78,198,254,126,176,51,119,114,206,173,246,244,15,164,20,42,60,25,127,222,115,95,142,140,232,201,98,
+130,67,73,171,123,155,57,146,135,76,214,67,205,217,213,157,185,94,169,26,188,112,206,123,216,233,179,241,162,90,155,59,
+6,81,81,6,25,115,57,120,191,38,118,52,65,140,219,29,30,240,93,97,231,49,28,175,7,133,105,68,240,99,61,62,
+195,243,225,127,112,110,240,49,169,51,65,205,225,218,250,107,14,23,96,141,216,115,145,131,172,206,92,117,116,159,107,44,
+209,19,84,71,207,242,166,18,37,85,208,250,132,167,245,247,95,120,71,222,151,111,209,142,180,41,237,75,95,27,211,105,
+115,110,170,198,54,191,72,155,4,79,4,20,163,236,181,15,93,235,97,100,61,52,214,195,230,60,82,141,23,191,54,187,
+227,240,54,237,101,44,247,196,69,141,31,236,184,252,23,178,229,189,89,85,91,8,75,214,72,56,113,238,143,230,92,209,
+213,142,229,251,31,90,196,220,114,
+};
 
-;
+const uint8_t Cascadia_36_L2_charmap [128] = {
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,33,32,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,32,53,32,54,32,
+32,55,56,57,58,59,60,32,61,62,32,32,63,64,65,66,67,32,68,69,70,71,32,32,72,32,32,73,32,74,75,32,
+32,76,77,78,79,80,81,82,83,84,32,85,86,87,88,89,90,32,91,92,93,94,32,32,95,32,96,32,97,32,98,32,
+};
 
 
 
@@ -751,7 +131,9 @@ font_t font_Cascadia_36_L2 = {
     .font_caps_height = 25,
     .font_x_width = 21,
     .pFontTable = Cascadia_36_L2,
-    .fontTableSize = 22378
+    .fontTableSize = 15826,
+    .bitmapDeflatedSize = 2761,
+    .pCharMap = Cascadia_36_L2_charmap
 };
 
 #endif
\ No newline at end of file
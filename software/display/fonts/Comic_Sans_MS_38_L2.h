@@ -1,1331 +1,177 @@
 /*
  * Comic_Sans_MS_38_L2.h
  *
- *  Created on: 2023-06-04 11:48:35
+ *  Created on: 2026-10-18 09:58:11
  *  
  * THIS IS AN AUTO GENERATED FILE.
  * DO NOT MODIFY
  */
 
-#ifndef Comic_Sans_MS_38_L2_H_
-#define Comic_Sans_MS_38_L2_H_
+#ifndef COMIC_SANS_MS_38_L2_H_
+#define COMIC_SANS_MS_38_L2_H_
 
 // Standard library
 #include <stdint.h>
 #include "font.h"
 
-const uint8_t Comic_Sans_MS_38_L2 [40998] =
-/*Command Line: fnt_cvt.exe -f legacy -C FT81X -i C:/Users/oskar/Downloads/comic sans/Comic_Sans_MS.ttf -s 38 -d 0 -c setfont2 -l 32 -g -r U+0020-U+007E -o C:/Users/oskar/Downloads/comic sans/generated -O 2*/ 
-
-/*95 characters have been converted */
-
-/* 148 Metric Block Begin +++  */
-/*('file properties ', 'format ', 'L2', ' stride ', 10, ' width ', 40, 'height', 43)*/ 
-{ 
-/* Widths */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,9,16,32,26,31,25,15,14,14,20,18,11,16,9,19,23,17,23,23,23,23,23,23,23,23,11,11,14,19,14,20,35,28,24,23,27,24,23,26,29,21,25,24,21,34,30,30,20,33,24,26,28,28,25,40,28,24,26,14,21,14,22,26,21,19,23,20,22,21,19,20,22,11,16,21,10,30,20,20,20,20,18,19,18,20,18,26,22,21,20,14,16,14,23,0,
-/* Format */
-17,0,0,0,
-/* Stride */
-10,0,0,0,
-/* Max Width */
-40,0,0,0,
-/* Max Height */
-43,0,0,0,
-/* Raw Data Address in Decimal: <148> */ 
-148,0,0,0,
-
-/* 148 Metric Block End ---  */
-
-/*Bitmap Raw Data begin +++*/
-/*The expected raw bitmap size is 40850 Bytes */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,2,224,0,0,0,0,0,0,0,0,3,240,0,0,0,0,0,0,0,0,3,240,0,0,0,0,0,0,0,0,
-3,240,0,0,0,0,0,0,0,0,3,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,
-0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,
-0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,
-0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,
-0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,
-7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,3,240,
-0,0,0,0,0,0,0,0,2,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,128,0,0,0,0,0,0,0,0,11,224,0,0,0,0,
-0,0,0,0,7,240,0,0,0,0,0,0,0,0,2,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,192,15,64,0,0,
-0,0,0,0,11,224,47,128,0,0,0,0,0,0,11,224,47,128,0,0,0,0,0,0,11,224,47,128,0,0,0,0,
-0,0,11,224,47,128,0,0,0,0,0,0,11,208,47,128,0,0,0,0,0,0,11,208,47,128,0,0,0,0,0,0,
-15,208,47,128,0,0,0,0,0,0,15,208,47,128,0,0,0,0,0,0,11,224,47,64,0,0,0,0,0,0,11,224,
-47,64,0,0,0,0,0,0,7,208,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,184,0,0,61,0,0,0,0,0,2,252,0,0,190,0,0,0,0,0,2,252,
-0,0,253,0,0,0,0,0,3,248,0,1,253,0,0,0,0,0,7,244,0,2,252,0,0,0,0,0,11,240,0,3,
-248,0,0,0,0,0,15,224,0,7,244,0,0,0,2,255,255,255,255,255,255,253,0,0,11,255,255,255,255,255,255,254,
-0,0,11,255,255,255,255,255,255,254,0,0,7,255,255,255,255,255,255,252,0,0,0,0,63,64,0,47,192,0,0,0,
-0,0,191,0,0,63,128,0,0,0,0,0,254,0,0,127,64,0,0,0,0,1,253,0,0,191,0,0,0,0,0,2,
-248,0,0,254,0,0,0,0,0,3,244,0,1,253,0,0,0,0,47,255,255,255,255,255,255,208,0,0,127,255,255,255,
-255,255,255,224,0,0,127,255,255,255,255,255,255,224,0,0,47,255,255,255,255,255,255,208,0,0,0,31,192,0,11,240,
-0,0,0,0,0,47,128,0,15,240,0,0,0,0,0,63,128,0,15,224,0,0,0,0,0,127,64,0,31,208,0,0,
-0,0,0,191,0,0,47,192,0,0,0,0,0,254,0,0,63,192,0,0,0,0,0,253,0,0,63,128,0,0,0,0,
-0,184,0,0,63,64,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,224,0,0,0,0,
-0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,
-0,0,3,244,0,0,0,0,0,0,0,0,3,255,148,0,0,0,0,0,0,0,47,255,255,64,0,0,0,0,0,2,
-255,255,255,192,0,0,0,0,0,11,255,255,255,208,0,0,0,0,0,63,255,244,111,128,0,0,0,0,0,191,231,244,
-0,0,0,0,0,0,1,255,3,244,0,0,0,0,0,0,2,253,3,244,0,0,0,0,0,0,2,253,3,244,0,0,
-0,0,0,0,2,255,147,244,0,0,0,0,0,0,1,255,255,254,144,0,0,0,0,0,0,191,255,255,248,0,0,0,
-0,0,0,31,255,255,255,64,0,0,0,0,0,1,191,255,255,208,0,0,0,0,0,0,3,245,255,224,0,0,0,0,
-0,0,3,244,47,244,0,0,0,0,0,0,3,244,11,248,0,0,0,0,0,0,3,244,7,248,0,0,0,0,0,0,
-3,244,3,248,0,0,0,0,0,0,3,244,3,248,0,0,0,0,0,0,3,244,7,248,0,0,0,0,11,128,3,244,
-31,244,0,0,0,0,15,244,3,244,127,240,0,0,0,0,15,254,67,246,255,208,0,0,0,0,11,255,255,255,255,128,
-0,0,0,0,7,255,255,255,254,0,0,0,0,0,1,191,255,255,244,0,0,0,0,0,0,26,255,254,64,0,0,0,
-0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,
-0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,2,224,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,
-0,0,0,0,0,11,248,0,0,188,0,0,0,0,0,127,255,64,1,252,0,0,0,0,1,255,255,192,3,248,0,0,
-0,0,3,248,31,224,7,244,0,0,0,0,7,240,7,240,11,224,0,0,0,0,7,240,3,240,31,208,0,0,0,0,
-3,240,3,240,47,192,0,0,0,0,3,248,27,240,63,64,0,0,0,0,1,255,255,208,191,0,0,0,0,0,0,191,
-255,64,253,0,0,0,0,0,0,27,249,1,252,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,7,
-240,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,0,47,128,0,
-0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,253,0,111,228,0,
-0,0,0,0,2,248,2,255,254,0,0,0,0,0,3,244,7,255,255,128,0,0,0,0,11,240,15,224,111,208,0,0,
-0,0,15,208,31,192,11,224,0,0,0,0,47,192,31,128,7,240,0,0,0,0,63,64,47,128,7,224,0,0,0,0,
-191,0,31,128,11,224,0,0,0,0,254,0,31,228,47,192,0,0,0,1,252,0,11,255,255,128,0,0,0,2,248,0,
-2,255,254,0,0,0,0,1,224,0,0,111,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,190,64,0,0,0,0,0,0,0,3,255,
-208,0,0,0,0,0,0,0,11,255,240,0,0,0,0,0,0,0,31,231,244,0,0,0,0,0,0,0,47,195,244,0,
-0,0,0,0,0,0,63,67,244,0,0,0,0,0,0,0,63,71,244,0,0,0,0,0,0,0,63,79,240,0,0,0,
-0,0,0,0,47,175,208,0,0,0,0,0,0,0,47,255,128,0,0,0,0,0,0,0,31,254,0,0,0,0,0,0,
-0,0,47,248,0,0,0,0,0,0,0,1,255,240,0,0,0,0,0,0,0,11,255,248,0,0,0,0,0,0,0,47,
-250,252,1,224,0,0,0,0,0,191,208,254,2,244,0,0,0,0,2,254,0,127,3,244,0,0,0,0,7,248,0,63,
-131,244,0,0,0,0,11,224,0,31,215,244,0,0,0,0,31,208,0,15,251,240,0,0,0,0,31,192,0,7,255,224,
-0,0,0,0,47,128,0,2,255,208,0,0,0,0,47,128,0,1,255,192,0,0,0,0,31,192,0,0,255,128,0,0,
-0,0,31,224,0,6,255,192,0,0,0,0,11,253,0,111,255,224,0,0,0,0,7,255,255,255,251,244,0,0,0,0,
-1,255,255,255,131,248,0,0,0,0,0,127,255,253,2,253,0,0,0,0,0,6,255,144,0,253,0,0,0,0,0,0,
-0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,15,64,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,
-0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,
-128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,31,128,0,
-0,0,0,0,0,0,0,15,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,11,64,0,0,0,0,0,0,0,0,127,192,0,0,0,0,0,0,0,0,255,128,0,0,0,0,
-0,0,0,3,254,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,31,240,0,0,0,0,0,0,0,
-0,47,208,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,254,
-0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,3,248,0,0,
-0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,11,240,0,0,0,0,
-0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,15,240,0,0,0,0,0,0,
-0,0,15,240,0,0,0,0,0,0,0,0,15,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,
-11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,244,0,0,0,0,0,0,0,0,7,244,
-0,0,0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,2,252,0,0,
-0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,191,128,0,0,0,
-0,0,0,0,0,63,208,0,0,0,0,0,0,0,0,31,244,0,0,0,0,0,0,0,0,11,253,0,0,0,0,0,
-0,0,0,2,255,64,0,0,0,0,0,0,0,0,191,192,0,0,0,0,0,0,0,0,27,64,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,128,0,0,0,0,0,0,0,0,11,244,0,0,
-0,0,0,0,0,0,11,252,0,0,0,0,0,0,0,0,2,255,0,0,0,0,0,0,0,0,0,191,128,0,0,0,
-0,0,0,0,0,63,208,0,0,0,0,0,0,0,0,31,224,0,0,0,0,0,0,0,0,11,244,0,0,0,0,0,
-0,0,0,3,248,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,
-0,0,254,0,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,
-127,64,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,63,192,
-0,0,0,0,0,0,0,0,63,192,0,0,0,0,0,0,0,0,47,192,0,0,0,0,0,0,0,0,47,192,0,0,
-0,0,0,0,0,0,63,192,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,63,128,0,0,0,0,
-0,0,0,0,63,128,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,
-0,0,191,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,3,
-252,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,31,240,0,0,0,0,0,0,0,0,127,208,0,
-0,0,0,0,0,0,1,255,128,0,0,0,0,0,0,0,7,254,0,0,0,0,0,0,0,0,11,248,0,0,0,0,
-0,0,0,0,7,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,1,244,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,
-248,0,0,0,0,0,0,0,46,66,248,0,0,0,0,0,0,0,63,230,253,175,208,0,0,0,0,0,63,255,255,255,
-224,0,0,0,0,0,6,255,255,255,224,0,0,0,0,0,0,111,255,234,64,0,0,0,0,0,0,31,255,64,0,0,
-0,0,0,0,0,127,255,208,0,0,0,0,0,0,1,255,159,244,0,0,0,0,0,0,7,254,7,252,0,0,0,0,
-0,0,11,248,1,254,0,0,0,0,0,0,3,208,0,190,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,224,0,0,0,0,0,0,0,0,3,244,0,
-0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,
-0,0,0,0,0,3,244,0,0,0,0,0,0,0,27,255,255,254,64,0,0,0,0,0,63,255,255,255,128,0,0,0,
-0,0,63,255,255,255,192,0,0,0,0,0,31,255,255,255,64,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,
-0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,
-244,0,0,0,0,0,0,0,0,2,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,7,128,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,31,
-192,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,190,0,0,
-0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,0,180,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,255,
-255,224,0,0,0,0,0,0,15,255,255,240,0,0,0,0,0,0,11,255,254,144,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,244,0,0,
-0,0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,7,253,0,0,0,0,0,0,0,0,3,252,0,0,0,0,
-0,0,0,0,1,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,144,0,0,0,0,0,0,0,0,3,240,0,0,0,0,0,0,0,0,11,240,0,
-0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,47,192,0,0,0,0,0,0,0,0,63,128,0,0,0,
-0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,253,0,0,0,0,0,0,
-0,0,2,252,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,
-15,224,0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,127,64,
-0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,3,248,0,0,0,
-0,0,0,0,0,11,244,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,47,208,0,0,0,0,0,
-0,0,0,63,128,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,
-2,253,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,11,240,
-0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,0,11,64,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-111,249,0,0,0,0,0,0,0,7,255,255,128,0,0,0,0,0,0,31,255,255,244,0,0,0,0,0,0,127,255,255,
-252,0,0,0,0,0,0,255,228,27,254,0,0,0,0,0,2,255,64,1,255,64,0,0,0,0,7,252,0,0,127,128,
-0,0,0,0,11,244,0,0,63,192,0,0,0,0,15,240,0,0,47,208,0,0,0,0,31,208,0,0,31,224,0,0,
-0,0,31,208,0,0,15,224,0,0,0,0,47,192,0,0,15,224,0,0,0,0,47,128,0,0,15,240,0,0,0,0,
-47,128,0,0,15,240,0,0,0,0,63,128,0,0,15,240,0,0,0,0,47,128,0,0,15,224,0,0,0,0,47,128,
-0,0,15,224,0,0,0,0,47,192,0,0,15,224,0,0,0,0,47,192,0,0,31,224,0,0,0,0,31,208,0,0,
-31,208,0,0,0,0,31,208,0,0,47,208,0,0,0,0,15,224,0,0,63,192,0,0,0,0,11,240,0,0,127,128,
-0,0,0,0,7,248,0,0,255,64,0,0,0,0,3,254,0,2,255,0,0,0,0,0,1,255,144,31,253,0,0,0,
-0,0,0,191,255,255,248,0,0,0,0,0,0,63,255,255,224,0,0,0,0,0,0,11,255,255,128,0,0,0,0,0,
-0,1,191,232,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,
-0,11,254,0,0,0,0,0,0,0,0,47,254,0,0,0,0,0,0,0,0,255,254,0,0,0,0,0,0,0,2,255,
-254,0,0,0,0,0,0,0,3,253,254,0,0,0,0,0,0,0,1,224,254,0,0,0,0,0,0,0,0,0,254,0,
-0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,1,253,0,0,0,
-0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,
-0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,
-0,2,252,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,
-252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,
-0,0,0,0,0,0,1,255,255,244,0,0,0,0,0,0,3,255,255,248,0,0,0,0,0,0,3,255,255,248,0,0,
-0,0,0,0,1,255,255,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,249,0,0,
-0,0,0,0,0,2,255,255,208,0,0,0,0,0,0,11,255,255,244,0,0,0,0,0,0,63,255,255,253,0,0,0,
-0,0,0,255,228,27,254,0,0,0,0,0,2,255,64,1,255,0,0,0,0,0,3,253,0,0,191,0,0,0,0,0,
-1,224,0,0,191,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,
-0,2,253,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,47,244,0,0,0,0,0,0,0,1,255,
-208,0,0,0,0,0,0,0,11,255,64,0,0,0,0,0,0,0,47,248,0,0,0,0,0,0,0,1,255,208,0,0,
-0,0,0,0,0,11,254,0,0,0,0,0,0,0,0,47,244,0,0,0,0,0,0,0,0,127,192,0,0,0,0,0,
-0,0,0,255,64,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,248,0,0,0,0,0,0,0,0,3,248,90,191,232,0,0,0,0,0,3,255,255,255,255,0,0,0,0,0,3,255,
-255,255,255,64,0,0,0,0,2,255,255,255,255,64,0,0,0,0,1,190,149,80,46,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,191,228,0,0,0,0,0,0,0,27,255,255,64,0,0,0,0,0,0,127,255,255,
-224,0,0,0,0,0,0,255,255,255,244,0,0,0,0,0,1,255,144,27,252,0,0,0,0,0,0,184,0,2,253,0,
-0,0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,0,253,0,0,0,
-0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,27,248,0,0,0,0,0,0,0,22,255,244,0,0,0,0,0,
-0,0,191,255,208,0,0,0,0,0,0,2,255,254,0,0,0,0,0,0,0,1,255,255,208,0,0,0,0,0,0,0,
-22,255,244,0,0,0,0,0,0,0,0,31,252,0,0,0,0,0,0,0,0,7,253,0,0,0,0,0,0,0,0,1,
-254,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,191,0,
-0,0,0,0,2,224,0,0,191,0,0,0,0,0,7,244,0,1,254,0,0,0,0,0,7,253,0,3,253,0,0,0,
-0,0,2,255,144,31,252,0,0,0,0,0,1,255,255,255,244,0,0,0,0,0,0,127,255,255,208,0,0,0,0,0,
-0,31,255,255,64,0,0,0,0,0,0,1,191,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,208,0,0,0,0,0,
-0,0,0,127,240,0,0,0,0,0,0,0,0,191,240,0,0,0,0,0,0,0,2,255,240,0,0,0,0,0,0,0,
-7,255,240,0,0,0,0,0,0,0,11,255,240,0,0,0,0,0,0,0,47,235,240,0,0,0,0,0,0,0,127,203,
-240,0,0,0,0,0,0,0,191,75,240,0,0,0,0,0,0,1,254,11,240,0,0,0,0,0,0,7,252,11,240,0,
-0,0,0,0,0,11,244,11,240,0,0,0,0,0,0,31,224,11,240,0,0,0,0,0,0,127,192,11,240,0,0,0,
-0,0,0,191,64,11,240,0,0,0,0,0,2,254,0,11,240,0,0,0,0,0,7,252,0,11,240,0,0,0,0,0,
-15,255,255,255,255,144,0,0,0,0,47,255,255,255,255,240,0,0,0,0,63,255,255,255,255,240,0,0,0,0,47,255,
-255,255,255,208,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,
-240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,
-0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,3,208,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
-0,0,0,0,2,255,255,255,255,0,0,0,0,0,3,255,255,255,255,64,0,0,0,0,2,255,255,255,255,64,0,0,
-0,0,2,255,255,255,249,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,248,27,254,64,0,0,0,0,0,3,250,
-255,255,224,0,0,0,0,0,3,255,255,255,252,0,0,0,0,0,3,255,255,255,254,0,0,0,0,0,7,255,244,6,
-255,64,0,0,0,0,7,255,128,0,191,128,0,0,0,0,7,254,0,0,63,192,0,0,0,0,7,248,0,0,47,192,
-0,0,0,0,2,224,0,0,31,208,0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,31,208,0,0,
-0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,47,208,0,0,0,0,0,0,0,0,63,192,0,0,0,0,
-0,0,0,0,127,128,0,0,0,0,2,208,0,1,255,64,0,0,0,0,11,244,0,7,255,0,0,0,0,0,11,254,
-64,111,253,0,0,0,0,0,3,255,255,255,244,0,0,0,0,0,1,255,255,255,208,0,0,0,0,0,0,47,255,254,
-64,0,0,0,0,0,0,6,255,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,0,0,0,0,0,0,3,252,
-0,0,0,0,0,0,0,0,15,248,0,0,0,0,0,0,0,0,63,240,0,0,0,0,0,0,0,0,255,192,0,0,
-0,0,0,0,0,3,255,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,31,224,0,0,0,0,0,
-0,0,0,63,192,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,
-2,253,111,249,0,0,0,0,0,0,3,254,255,255,208,0,0,0,0,0,7,255,255,255,244,0,0,0,0,0,7,255,
-255,255,253,0,0,0,0,0,11,255,64,27,254,0,0,0,0,0,11,244,0,1,255,0,0,0,0,0,15,224,0,0,
-191,64,0,0,0,0,15,224,0,0,127,64,0,0,0,0,15,224,0,0,63,128,0,0,0,0,15,224,0,0,63,128,
-0,0,0,0,11,240,0,0,127,64,0,0,0,0,11,244,0,0,191,64,0,0,0,0,7,248,0,0,255,0,0,0,
-0,0,3,254,0,2,254,0,0,0,0,0,2,255,144,31,253,0,0,0,0,0,0,255,255,255,248,0,0,0,0,0,
-0,127,255,255,224,0,0,0,0,0,0,31,255,255,64,0,0,0,0,0,0,1,191,228,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,85,64,0,0,0,0,0,0,0,
-31,255,255,255,255,244,0,0,0,0,47,255,255,255,255,244,0,0,0,0,47,255,255,255,255,244,0,0,0,0,10,170,
-191,255,255,224,0,0,0,0,0,0,0,0,191,128,0,0,0,0,0,0,0,2,255,0,0,0,0,0,0,0,0,7,
-253,0,0,0,0,0,0,0,0,15,244,0,0,0,0,0,0,0,0,47,224,0,0,0,0,0,0,0,0,127,192,0,
-0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,1,255,0,0,0,0,0,0,0,0,2,254,0,0,0,0,
-0,0,0,0,3,252,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,15,244,0,0,0,0,0,0,
-0,0,31,224,0,0,0,0,0,0,0,0,47,208,0,0,0,0,0,0,0,0,127,192,0,0,0,0,0,0,0,0,
-191,64,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,2,253,0,
-0,0,0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,15,240,0,0,0,
-0,0,0,0,0,31,224,0,0,0,0,0,0,0,0,47,208,0,0,0,0,0,0,0,0,47,192,0,0,0,0,0,
-0,0,0,31,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,249,0,0,0,0,0,0,0,7,255,255,208,0,0,0,
-0,0,0,47,255,255,240,0,0,0,0,0,0,127,255,255,248,0,0,0,0,0,0,255,144,27,252,0,0,0,0,0,
-1,254,0,2,253,0,0,0,0,0,2,252,0,1,253,0,0,0,0,0,2,248,0,1,253,0,0,0,0,0,2,252,
-0,1,253,0,0,0,0,0,2,254,0,7,252,0,0,0,0,0,1,255,208,111,248,0,0,0,0,0,0,191,255,255,
-224,0,0,0,0,0,0,47,255,255,64,0,0,0,0,0,0,15,255,255,144,0,0,0,0,0,0,63,255,255,244,0,
-0,0,0,0,0,255,244,127,253,0,0,0,0,0,2,255,64,7,255,0,0,0,0,0,3,253,0,1,255,64,0,0,
-0,0,7,248,0,0,191,128,0,0,0,0,11,240,0,0,127,128,0,0,0,0,11,240,0,0,63,192,0,0,0,0,
-11,240,0,0,63,192,0,0,0,0,11,240,0,0,127,128,0,0,0,0,11,244,0,0,127,128,0,0,0,0,7,253,
-0,1,255,64,0,0,0,0,3,255,144,27,255,0,0,0,0,0,1,255,255,255,253,0,0,0,0,0,0,191,255,255,
-244,0,0,0,0,0,0,31,255,255,208,0,0,0,0,0,0,1,191,233,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,249,
-0,0,0,0,0,0,0,11,255,255,128,0,0,0,0,0,0,63,255,255,244,0,0,0,0,0,0,255,255,255,252,0,
-0,0,0,0,2,255,144,31,254,0,0,0,0,0,3,253,0,2,255,64,0,0,0,0,7,244,0,0,191,128,0,0,
-0,0,11,240,0,0,63,192,0,0,0,0,11,224,0,0,47,208,0,0,0,0,15,224,0,0,31,208,0,0,0,0,
-15,224,0,0,31,208,0,0,0,0,11,240,0,0,31,208,0,0,0,0,11,244,0,0,47,208,0,0,0,0,7,253,
-0,1,191,208,0,0,0,0,3,255,144,27,255,192,0,0,0,0,1,255,255,255,255,192,0,0,0,0,0,127,255,255,
-255,128,0,0,0,0,0,27,255,254,191,64,0,0,0,0,0,1,191,164,255,0,0,0,0,0,0,0,0,2,254,0,
-0,0,0,0,0,0,0,3,253,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,31,244,0,0,0,
-0,0,0,0,0,127,224,0,0,0,0,0,0,0,2,255,192,0,0,0,0,0,0,0,31,255,0,0,0,0,0,0,
-0,6,255,252,0,0,0,0,0,0,0,111,255,224,0,0,0,0,0,0,0,255,254,64,0,0,0,0,0,0,0,255,
-228,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,0,0,0,0,
-0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,
-0,0,0,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,254,0,0,0,0,
-0,0,0,0,1,254,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,120,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,254,0,0,
-0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,1,253,0,0,
-0,0,0,0,0,0,3,253,0,0,0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,15,224,0,0,0,0,
-0,0,0,0,31,208,0,0,0,0,0,0,0,0,31,128,0,0,0,0,0,0,0,0,15,64,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,124,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,7,253,0,0,0,0,0,0,0,0,31,
-244,0,0,0,0,0,0,0,0,127,208,0,0,0,0,0,0,0,1,255,64,0,0,0,0,0,0,0,11,253,0,0,
-0,0,0,0,0,0,127,244,0,0,0,0,0,0,0,0,191,224,0,0,0,0,0,0,0,0,47,252,0,0,0,0,
-0,0,0,0,7,255,0,0,0,0,0,0,0,0,0,191,192,0,0,0,0,0,0,0,0,47,240,0,0,0,0,0,
-0,0,0,11,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,255,255,254,0,0,0,0,0,0,15,255,255,255,64,0,0,0,
-0,0,15,255,255,255,64,0,0,0,0,0,11,255,255,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,255,255,253,
-0,0,0,0,0,0,15,255,255,255,0,0,0,0,0,0,15,255,255,255,0,0,0,0,0,0,7,255,255,254,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,128,0,0,
-0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,0,126,0,0,0,0,
-0,0,0,0,0,7,128,0,0,0,0,0,0,0,0,0,116,0,0,0,0,0,0,0,0,0,190,0,0,0,0,0,
-0,0,0,2,255,208,0,0,0,0,0,0,0,11,255,224,0,0,0,0,0,0,0,63,255,192,0,0,0,0,0,0,
-0,255,254,0,0,0,0,0,0,0,3,255,248,0,0,0,0,0,0,0,15,255,224,0,0,0,0,0,0,0,47,255,
-64,0,0,0,0,0,0,0,63,248,0,0,0,0,0,0,0,0,47,208,0,0,0,0,0,0,0,0,30,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,228,0,0,0,
-0,0,0,0,2,255,255,64,0,0,0,0,0,0,31,255,255,224,0,0,0,0,0,0,63,255,255,248,0,0,0,0,
-0,0,63,228,27,253,0,0,0,0,0,0,30,64,1,255,0,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,
-0,0,0,31,192,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,
-0,15,224,0,0,0,0,0,0,0,0,47,224,0,0,0,0,0,0,0,0,127,224,0,0,0,0,0,0,0,2,255,
-224,0,0,0,0,0,0,0,11,255,224,0,0,0,0,0,0,0,127,255,208,0,0,0,0,0,0,1,255,255,192,0,
-0,0,0,0,0,7,255,255,128,0,0,0,0,0,0,31,255,254,0,0,0,0,0,0,0,47,255,208,0,0,0,0,
-0,0,0,63,249,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,125,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,1,255,
-0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,254,148,0,0,0,0,0,0,
-11,255,255,254,64,0,0,0,0,0,127,255,255,255,244,0,0,0,0,1,255,255,255,255,254,0,0,0,0,7,255,228,
-1,111,255,128,0,0,0,31,253,0,0,2,255,224,0,0,0,63,244,0,0,0,47,244,0,0,0,191,208,0,0,0,
-11,252,0,0,0,255,64,6,248,0,3,254,0,0,2,254,0,47,254,0,1,255,0,0,3,253,0,255,253,0,0,255,
-64,0,7,248,3,255,144,0,0,191,64,0,7,244,11,249,0,0,0,127,64,0,11,244,31,224,2,208,0,127,128,0,
-11,240,47,208,11,224,0,127,64,0,15,240,63,192,31,224,0,191,64,0,15,240,63,192,63,208,0,255,0,0,15,240,
-63,209,255,224,7,255,0,0,15,240,47,255,255,255,255,253,0,0,11,240,15,255,255,255,255,248,0,0,11,244,3,255,
-226,255,255,224,0,0,7,248,0,111,64,111,250,0,0,0,3,252,0,0,0,0,0,0,0,0,2,254,0,0,0,0,
-0,0,0,0,0,255,64,0,0,0,0,0,0,0,0,191,208,0,0,0,0,0,0,0,0,47,244,0,0,0,0,0,
-0,0,0,15,254,0,0,1,184,0,0,0,0,3,255,229,1,111,253,0,0,0,0,0,191,255,255,255,253,0,0,0,
-0,0,31,255,255,255,248,0,0,0,0,0,2,255,255,255,144,0,0,0,0,0,0,26,255,164,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,120,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,3,254,0,0,0,0,0,0,0,
-0,11,255,0,0,0,0,0,0,0,0,31,255,0,0,0,0,0,0,0,0,63,255,64,0,0,0,0,0,0,0,191,
-255,64,0,0,0,0,0,0,1,255,127,128,0,0,0,0,0,0,3,253,63,192,0,0,0,0,0,0,11,248,47,192,
-0,0,0,0,0,0,31,240,31,208,0,0,0,0,0,0,63,208,31,224,0,0,0,0,0,0,191,192,15,224,0,0,
-0,0,0,0,255,65,175,240,0,0,0,0,0,2,254,111,255,240,0,0,0,0,0,7,255,255,255,244,0,0,0,0,
-0,47,255,255,255,248,0,0,0,0,0,63,255,254,83,248,0,0,0,0,0,63,249,64,2,252,0,0,0,0,0,127,
-192,0,2,253,0,0,0,0,0,191,128,0,1,253,0,0,0,0,1,255,0,0,0,255,0,0,0,0,2,254,0,0,
-0,255,64,0,0,0,3,252,0,0,0,191,128,0,0,0,7,248,0,0,0,127,192,0,0,0,7,244,0,0,0,47,
-192,0,0,0,2,208,0,0,0,11,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,255,164,0,0,
-0,0,0,0,0,127,255,254,64,0,0,0,0,0,0,191,255,255,208,0,0,0,0,0,0,191,255,255,248,0,0,0,
-0,0,0,191,0,111,253,0,0,0,0,0,0,191,0,2,255,0,0,0,0,0,0,191,0,0,191,64,0,0,0,0,
-0,191,0,0,127,64,0,0,0,0,0,191,0,0,63,128,0,0,0,0,0,191,0,0,127,64,0,0,0,0,0,254,
-0,0,191,64,0,0,0,0,0,254,0,1,255,0,0,0,0,0,0,254,0,7,254,0,0,0,0,0,0,254,0,111,
-253,0,0,0,0,0,0,255,255,255,244,0,0,0,0,0,1,255,255,255,208,0,0,0,0,0,1,255,255,255,224,0,
-0,0,0,0,1,255,255,255,254,0,0,0,0,0,1,253,0,91,255,128,0,0,0,0,1,253,0,0,191,224,0,0,
-0,0,1,253,0,0,15,244,0,0,0,0,1,253,0,0,7,244,0,0,0,0,1,253,0,0,11,244,0,0,0,0,
-1,253,0,0,63,240,0,0,0,0,1,253,0,6,255,208,0,0,0,0,1,253,5,191,255,128,0,0,0,0,1,255,
-255,255,254,0,0,0,0,0,1,255,255,255,244,0,0,0,0,0,1,255,255,254,64,0,0,0,0,0,0,127,250,80,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,2,208,0,0,0,0,0,0,0,111,251,240,0,0,0,0,0,0,2,255,255,240,0,0,0,0,0,0,15,255,
-255,244,0,0,0,0,0,0,63,255,255,244,0,0,0,0,0,0,255,228,31,244,0,0,0,0,0,2,255,64,7,244,
-0,0,0,0,0,11,253,0,2,224,0,0,0,0,0,31,248,0,0,0,0,0,0,0,0,47,224,0,0,0,0,0,
-0,0,0,127,192,0,0,0,0,0,0,0,0,255,64,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,
-3,253,0,0,0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,11,244,0,0,0,0,0,0,0,0,11,240,
-0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,31,224,0,0,0,0,0,0,0,0,31,208,0,0,
-0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,31,224,0,0,0,0,
-0,0,0,0,15,240,0,0,11,128,0,0,0,0,11,248,0,0,127,208,0,0,0,0,7,253,0,2,255,208,0,0,
-0,0,2,255,144,111,255,128,0,0,0,0,0,255,255,255,253,0,0,0,0,0,0,127,255,255,244,0,0,0,0,0,
-0,11,255,255,64,0,0,0,0,0,0,1,191,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,0,0,0,0,0,0,0,0,
-0,255,208,0,0,0,0,0,0,0,1,255,254,0,0,0,0,0,0,0,1,255,255,228,0,0,0,0,0,0,1,253,
-191,255,64,0,0,0,0,0,1,253,7,255,224,0,0,0,0,0,1,253,0,127,253,0,0,0,0,0,1,253,0,7,
-255,64,0,0,0,0,1,253,0,0,191,224,0,0,0,0,1,253,0,0,31,244,0,0,0,0,1,253,0,0,7,253,
-0,0,0,0,1,253,0,0,1,254,0,0,0,0,1,253,0,0,0,191,64,0,0,0,1,253,0,0,0,63,128,0,
-0,0,1,253,0,0,0,47,192,0,0,0,1,253,0,0,0,31,208,0,0,0,1,253,0,0,0,31,208,0,0,0,
-1,253,0,0,0,31,224,0,0,0,1,253,0,0,0,31,208,0,0,0,1,253,0,0,0,47,208,0,0,0,1,253,
-0,0,0,63,192,0,0,0,1,253,0,0,0,127,192,0,0,0,2,253,0,0,0,255,64,0,0,0,2,253,0,0,
-2,255,0,0,0,0,2,253,0,0,11,253,0,0,0,0,2,255,144,5,191,248,0,0,0,0,2,255,255,255,255,224,
-0,0,0,0,1,255,255,255,255,128,0,0,0,0,0,31,255,255,253,0,0,0,0,0,0,1,175,254,80,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,230,171,255,234,64,0,0,0,0,3,255,255,255,255,244,0,0,0,0,3,255,255,255,255,244,0,0,
-0,0,3,255,255,255,255,224,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,
-0,0,0,0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,3,248,21,106,
-191,64,0,0,0,0,3,255,255,255,255,192,0,0,0,0,7,255,255,255,255,192,0,0,0,0,7,255,255,255,255,128,
-0,0,0,0,7,255,234,149,64,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,
-0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,
-7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,3,253,
-0,0,0,0,0,0,0,0,2,255,255,255,255,64,0,0,0,0,1,255,255,255,255,128,0,0,0,0,0,191,255,255,
-255,128,0,0,0,0,0,26,255,255,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,255,255,164,0,0,0,0,0,1,255,255,255,
-255,144,0,0,0,0,2,255,255,255,255,244,0,0,0,0,2,255,255,255,255,244,0,0,0,0,2,255,149,0,22,224,
-0,0,0,0,2,253,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,
-0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,253,107,255,254,0,0,0,0,0,2,255,255,255,255,0,0,0,0,0,2,255,255,255,255,0,0,0,0,0,2,255,
-255,255,253,0,0,0,0,0,2,255,148,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,
-0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,
-0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,
-0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,1,244,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,1,191,144,0,0,0,0,0,0,0,11,255,254,64,0,0,0,0,0,0,47,255,255,224,0,0,0,0,0,0,
-191,255,255,244,0,0,0,0,0,2,255,144,111,244,0,0,0,0,0,11,254,0,2,224,0,0,0,0,0,31,248,0,
-0,0,0,0,0,0,0,63,224,0,0,0,0,0,0,0,0,127,192,0,0,0,0,0,0,0,0,255,64,0,0,0,
-0,0,0,0,1,254,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,7,248,0,0,0,0,0,0,
-0,0,7,244,0,0,0,0,0,0,0,0,11,240,0,22,175,255,64,0,0,0,15,224,6,255,255,255,192,0,0,0,
-31,224,63,255,255,255,192,0,0,0,31,208,127,255,255,255,64,0,0,0,31,208,127,250,81,255,0,0,0,0,47,208,
-46,64,2,254,0,0,0,0,47,208,0,0,3,253,0,0,0,0,31,208,0,0,7,252,0,0,0,0,31,208,0,0,
-31,244,0,0,0,0,15,224,0,0,127,224,0,0,0,0,15,244,0,1,255,208,0,0,0,0,7,254,64,95,255,64,
-0,0,0,0,3,255,255,255,253,0,0,0,0,0,1,255,255,255,244,0,0,0,0,0,0,111,255,255,128,0,0,0,
-0,0,0,6,191,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,0,0,0,0,184,0,0,0,1,253,0,0,0,0,252,0,
-0,0,1,253,0,0,0,1,252,0,0,0,1,253,0,0,0,2,252,0,0,0,1,252,0,0,0,2,248,0,0,0,
-1,252,0,0,0,3,248,0,0,0,2,252,0,0,0,3,248,0,0,0,2,252,0,0,0,3,248,0,0,0,2,252,
-0,0,0,3,248,0,0,0,2,252,0,0,0,3,248,0,0,0,2,252,0,0,0,3,248,0,0,0,2,252,0,0,
-0,3,248,0,0,0,2,252,0,0,0,3,248,0,0,0,2,252,0,0,90,255,248,0,0,0,2,252,5,175,255,255,
-244,0,0,0,2,254,191,255,255,255,244,0,0,0,2,255,255,255,255,255,244,0,0,0,2,255,255,255,165,7,244,0,
-0,0,2,255,250,80,0,7,244,0,0,0,2,253,64,0,0,7,240,0,0,0,2,252,0,0,0,7,244,0,0,0,
-2,252,0,0,0,7,244,0,0,0,2,252,0,0,0,7,244,0,0,0,3,248,0,0,0,7,244,0,0,0,3,248,
-0,0,0,7,244,0,0,0,3,248,0,0,0,3,244,0,0,0,3,248,0,0,0,3,248,0,0,0,3,244,0,0,
-0,3,248,0,0,0,3,244,0,0,0,3,248,0,0,0,3,244,0,0,0,1,224,0,0,0,2,224,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,255,255,170,
-80,0,0,0,0,0,31,255,255,255,253,0,0,0,0,0,47,255,255,255,254,0,0,0,0,0,15,255,255,255,253,0,
-0,0,0,0,0,0,254,21,164,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,
-0,0,0,0,254,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,
-0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,
-253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,
-0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,
-0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,
-0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,6,175,255,255,244,0,0,0,0,0,
-15,255,255,255,252,0,0,0,0,0,15,255,255,255,252,0,0,0,0,0,11,255,255,255,244,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,2,186,170,255,248,0,0,0,0,0,7,255,255,255,255,0,0,0,0,0,7,
-255,255,255,255,0,0,0,0,0,2,255,255,255,254,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,
-224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,
-0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,0,0,
-0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,
-0,0,0,15,224,0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,
-0,31,208,0,0,0,0,0,11,128,0,31,192,0,0,0,0,0,15,208,0,47,192,0,0,0,0,0,31,224,0,47,
-192,0,0,0,0,0,15,224,0,63,128,0,0,0,0,0,15,248,0,63,128,0,0,0,0,0,7,254,0,127,64,0,
-0,0,0,0,2,255,208,191,0,0,0,0,0,0,0,191,255,254,0,0,0,0,0,0,0,47,255,253,0,0,0,0,
-0,0,0,7,255,248,0,0,0,0,0,0,0,0,111,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,2,208,0,0,
-0,0,0,127,0,0,15,240,0,0,0,0,0,191,64,0,47,224,0,0,0,0,0,191,0,0,191,208,0,0,0,0,
-0,191,0,2,255,128,0,0,0,0,0,191,0,7,254,0,0,0,0,0,0,191,0,31,252,0,0,0,0,0,0,191,
-0,63,240,0,0,0,0,0,0,191,0,255,208,0,0,0,0,0,0,191,2,255,64,0,0,0,0,0,0,190,11,253,
-0,0,0,0,0,0,0,190,47,244,0,0,0,0,0,0,0,190,191,208,0,0,0,0,0,0,0,191,255,64,0,0,
-0,0,0,0,0,191,253,0,0,0,0,0,0,0,0,191,248,0,0,0,0,0,0,0,0,255,253,0,0,0,0,0,
-0,0,0,255,255,64,0,0,0,0,0,0,0,255,255,192,0,0,0,0,0,0,0,254,127,240,0,0,0,0,0,0,
-0,254,31,252,0,0,0,0,0,0,0,254,7,255,0,0,0,0,0,0,0,254,1,255,192,0,0,0,0,0,0,254,
-0,191,244,0,0,0,0,0,0,254,0,47,253,0,0,0,0,0,0,254,0,11,255,128,0,0,0,0,0,254,0,2,
-255,244,0,0,0,0,0,254,0,0,191,252,0,0,0,0,0,190,0,0,31,252,0,0,0,0,0,45,0,0,2,244,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,224,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,
-0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,
-0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,
-7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,
-0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,11,240,0,0,
-0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,
-0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,0,0,11,240,0,0,0,0,0,0,
-0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,224,0,1,189,0,0,0,0,0,
-15,224,22,191,255,0,0,0,0,0,15,255,255,255,255,0,0,0,0,0,15,255,255,255,254,0,0,0,0,0,11,255,
-255,255,148,0,0,0,0,0,2,255,234,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,0,0,2,224,0,0,0,0,0,
-255,0,0,11,244,0,0,0,0,1,255,64,0,15,252,0,0,0,0,2,255,64,0,15,253,0,0,0,0,3,255,128,
-0,31,253,0,0,0,0,7,255,192,0,47,254,0,0,0,0,7,255,192,0,47,254,0,0,0,0,11,255,208,0,63,
-254,0,0,0,0,15,255,208,0,127,255,0,0,0,0,15,255,224,0,191,255,0,0,0,0,31,255,224,0,255,191,64,
-0,0,0,31,239,240,0,255,127,64,0,0,0,47,219,240,1,254,63,64,0,0,0,47,203,244,2,253,63,128,0,0,
-0,63,199,248,3,252,63,128,0,0,0,127,131,248,7,248,47,192,0,0,0,191,67,252,11,244,47,208,0,0,0,191,
-66,253,15,240,31,208,0,0,0,255,1,253,31,224,15,224,0,0,1,254,1,254,47,208,15,224,0,0,2,254,0,255,
-63,192,11,240,0,0,3,253,0,191,191,128,11,244,0,0,3,252,0,127,255,64,7,248,0,0,7,248,0,127,255,0,
-7,248,0,0,11,248,0,63,254,0,3,252,0,0,11,248,0,47,254,0,2,253,0,0,15,244,0,31,252,0,2,254,
-0,0,15,240,0,15,248,0,1,255,0,0,15,240,0,11,244,0,0,255,0,0,7,208,0,7,224,0,0,125,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,2,224,0,0,0,0,184,0,0,0,7,248,0,0,0,1,253,0,0,0,11,253,0,0,0,1,254,0,0,0,
-11,255,0,0,0,1,255,0,0,0,11,255,128,0,0,0,255,64,0,0,11,255,208,0,0,0,191,64,0,0,7,255,
-240,0,0,0,191,64,0,0,7,255,248,0,0,0,127,128,0,0,7,250,253,0,0,0,127,128,0,0,7,248,255,0,
-0,0,127,128,0,0,7,244,127,128,0,0,127,128,0,0,7,244,47,224,0,0,127,128,0,0,7,244,15,244,0,0,
-63,128,0,0,7,244,7,252,0,0,63,128,0,0,7,244,1,255,0,0,63,128,0,0,3,244,0,191,128,0,63,128,
-0,0,3,244,0,47,224,0,63,128,0,0,7,244,0,15,244,0,63,128,0,0,7,244,0,7,253,0,63,128,0,0,
-7,244,0,1,255,64,63,128,0,0,7,244,0,0,191,208,63,128,0,0,7,244,0,0,47,244,63,128,0,0,7,248,
-0,0,15,253,63,128,0,0,7,248,0,0,3,255,127,128,0,0,7,248,0,0,1,255,255,128,0,0,7,248,0,0,
-0,127,255,128,0,0,7,244,0,0,0,31,255,64,0,0,11,244,0,0,0,7,255,64,0,0,7,240,0,0,0,1,
-255,64,0,0,2,224,0,0,0,0,110,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,254,144,0,0,0,0,0,0,7,255,255,254,
-0,0,0,0,0,0,47,255,255,255,208,0,0,0,0,0,191,255,255,255,244,0,0,0,0,2,255,228,1,127,252,0,
-0,0,0,11,254,0,0,7,253,0,0,0,0,31,248,0,0,1,255,0,0,0,0,63,224,0,0,0,255,0,0,0,
-0,191,192,0,0,0,191,64,0,0,0,255,64,0,0,0,127,128,0,0,1,254,0,0,0,0,63,128,0,0,2,253,
-0,0,0,0,63,128,0,0,3,252,0,0,0,0,63,128,0,0,7,248,0,0,0,0,63,128,0,0,11,244,0,0,
-0,0,127,128,0,0,11,240,0,0,0,0,127,64,0,0,11,240,0,0,0,0,191,64,0,0,11,240,0,0,0,0,
-255,0,0,0,11,240,0,0,0,1,254,0,0,0,11,240,0,0,0,2,253,0,0,0,11,244,0,0,0,7,252,0,
-0,0,7,248,0,0,0,11,248,0,0,0,3,253,0,0,0,31,240,0,0,0,2,255,64,0,0,127,208,0,0,0,
-0,255,224,0,2,255,128,0,0,0,0,127,254,64,95,255,0,0,0,0,0,31,255,255,255,253,0,0,0,0,0,7,
-255,255,255,244,0,0,0,0,0,0,127,255,255,128,0,0,0,0,0,0,6,191,228,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,175,
-254,64,0,0,0,0,0,0,3,255,255,244,0,0,0,0,0,0,7,255,255,254,0,0,0,0,0,0,7,255,255,255,
-128,0,0,0,0,0,7,240,6,255,208,0,0,0,0,0,7,240,0,47,240,0,0,0,0,0,7,240,0,11,244,0,
-0,0,0,0,7,240,0,3,248,0,0,0,0,0,7,240,0,2,248,0,0,0,0,0,7,240,0,3,248,0,0,0,
-0,0,11,224,0,7,244,0,0,0,0,0,11,224,0,15,240,0,0,0,0,0,11,224,0,127,224,0,0,0,0,0,
-11,224,6,255,192,0,0,0,0,0,11,255,255,255,64,0,0,0,0,0,15,255,255,253,0,0,0,0,0,0,15,255,
-255,224,0,0,0,0,0,0,15,255,249,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,
-0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,
-0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,
-0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,
-11,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,255,164,0,0,0,0,0,0,6,255,255,255,64,0,0,0,
-0,0,111,255,255,255,224,0,0,0,0,1,255,255,255,255,248,0,0,0,0,11,255,229,1,111,254,0,0,0,0,47,
-254,0,0,7,255,64,0,0,0,191,244,0,0,0,255,192,0,0,1,255,128,0,0,0,127,224,0,0,2,255,0,0,
-0,0,31,240,0,0,7,252,0,0,0,0,15,244,0,0,11,248,0,0,0,0,11,248,0,0,15,240,0,0,0,0,
-7,248,0,0,31,224,0,0,0,0,3,252,0,0,31,208,0,0,0,0,2,252,0,0,47,208,0,0,0,0,2,253,
-0,0,47,208,0,0,0,0,2,253,0,0,47,208,0,0,0,0,2,253,0,0,31,208,0,0,0,0,2,253,0,0,
-31,224,0,0,0,0,2,253,0,0,15,240,0,2,224,0,3,252,0,0,11,248,0,7,248,0,7,248,0,0,7,253,
-0,7,253,0,15,244,0,0,2,255,64,2,255,0,47,240,0,0,0,255,208,0,255,192,191,208,0,0,0,127,248,0,
-127,247,255,128,0,0,0,31,255,144,31,255,254,0,0,0,0,7,255,255,255,255,248,0,0,0,0,1,255,255,255,255,
-224,0,0,0,0,0,47,255,255,239,248,0,0,0,0,0,1,191,249,11,254,0,0,0,0,0,0,0,0,2,255,208,
-0,0,0,0,0,0,0,0,191,244,0,0,0,0,0,0,0,0,47,253,0,0,0,0,0,0,0,0,11,255,0,0,
-0,0,0,0,0,0,2,255,64,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,0,30,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,254,165,0,0,0,
-0,0,0,0,3,255,255,224,0,0,0,0,0,0,7,255,255,253,0,0,0,0,0,0,7,255,255,255,128,0,0,0,
-0,0,7,244,90,255,240,0,0,0,0,0,7,244,0,111,252,0,0,0,0,0,7,248,0,7,254,0,0,0,0,0,
-3,248,0,1,255,64,0,0,0,0,3,248,0,0,127,128,0,0,0,0,3,248,0,0,63,192,0,0,0,0,7,248,
-0,0,47,208,0,0,0,0,7,244,0,0,31,208,0,0,0,0,7,244,0,0,47,208,0,0,0,0,7,244,0,0,
-191,192,0,0,0,0,11,244,0,6,255,64,0,0,0,0,11,240,1,111,254,0,0,0,0,0,11,255,255,255,248,0,
-0,0,0,0,11,255,255,255,208,0,0,0,0,0,11,255,255,254,0,0,0,0,0,0,11,255,255,244,0,0,0,0,
-0,0,11,246,255,254,0,0,0,0,0,0,11,240,31,255,208,0,0,0,0,0,11,240,1,255,248,0,0,0,0,0,
-11,240,0,47,255,0,0,0,0,0,11,240,0,7,255,192,0,0,0,0,11,240,0,0,191,240,0,0,0,0,11,240,
-0,0,47,248,0,0,0,0,7,240,0,0,7,248,0,0,0,0,2,224,0,0,1,240,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,
-249,0,0,0,0,0,0,0,11,255,255,224,0,0,0,0,0,0,127,255,255,252,0,0,0,0,0,1,255,255,255,252,
-0,0,0,0,0,7,255,144,22,248,0,0,0,0,0,31,248,0,0,0,0,0,0,0,0,47,208,0,0,0,0,0,
-0,0,0,63,192,0,0,0,0,0,0,0,0,63,208,0,0,0,0,0,0,0,0,63,249,64,0,0,0,0,0,0,
-0,47,255,255,228,0,0,0,0,0,0,15,255,255,255,128,0,0,0,0,0,2,255,255,255,240,0,0,0,0,0,0,
-107,255,255,252,0,0,0,0,0,0,0,5,191,254,0,0,0,0,0,0,0,0,7,255,0,0,0,0,0,0,0,0,
-1,255,64,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,127,
-64,0,0,0,2,208,0,0,0,191,64,0,0,0,7,244,0,0,2,255,0,0,0,0,7,253,0,0,11,253,0,0,
-0,0,3,255,144,5,191,248,0,0,0,0,2,255,255,255,255,224,0,0,0,0,0,191,255,255,255,128,0,0,0,0,
-0,27,255,255,248,0,0,0,0,0,0,1,175,250,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,84,0,0,0,0,0,0,0,0,11,255,255,255,255,170,160,0,0,0,
-11,255,255,255,255,255,252,0,0,0,11,255,255,255,255,255,252,0,0,0,1,175,255,255,255,255,248,0,0,0,0,0,
-1,254,0,21,80,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,254,
-0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,255,0,0,
-0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,191,0,0,0,0,
-0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,
-0,0,0,127,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,
-0,127,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,127,
-128,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,127,128,0,
-0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,240,0,0,0,7,192,0,0,0,2,244,0,0,0,11,224,0,0,0,3,248,0,0,0,15,224,0,
-0,0,3,248,0,0,0,15,224,0,0,0,3,248,0,0,0,15,224,0,0,0,3,248,0,0,0,15,224,0,0,0,
-3,248,0,0,0,15,224,0,0,0,3,248,0,0,0,15,224,0,0,0,3,248,0,0,0,15,224,0,0,0,3,248,
-0,0,0,15,224,0,0,0,3,248,0,0,0,15,224,0,0,0,3,248,0,0,0,31,224,0,0,0,3,248,0,0,
-0,31,224,0,0,0,3,248,0,0,0,31,224,0,0,0,3,248,0,0,0,31,208,0,0,0,3,248,0,0,0,47,
-208,0,0,0,3,248,0,0,0,47,208,0,0,0,3,252,0,0,0,63,192,0,0,0,2,252,0,0,0,63,192,0,
-0,0,2,253,0,0,0,127,128,0,0,0,1,253,0,0,0,191,64,0,0,0,1,255,0,0,0,255,0,0,0,0,
-0,255,64,0,1,254,0,0,0,0,0,191,192,0,3,253,0,0,0,0,0,127,240,0,15,252,0,0,0,0,0,47,
-254,64,127,244,0,0,0,0,0,15,255,255,255,224,0,0,0,0,0,2,255,255,255,128,0,0,0,0,0,0,191,255,
-254,0,0,0,0,0,0,0,6,191,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,224,0,0,0,30,0,0,0,0,7,244,0,0,
-0,127,128,0,0,0,7,248,0,0,0,255,64,0,0,0,3,248,0,0,1,255,0,0,0,0,3,252,0,0,3,253,
-0,0,0,0,2,253,0,0,7,252,0,0,0,0,1,254,0,0,11,244,0,0,0,0,0,254,0,0,15,240,0,0,
-0,0,0,255,0,0,31,224,0,0,0,0,0,191,64,0,47,208,0,0,0,0,0,127,128,0,63,192,0,0,0,0,
-0,63,192,0,127,128,0,0,0,0,0,47,208,0,191,64,0,0,0,0,0,31,208,0,255,0,0,0,0,0,0,31,
-224,1,254,0,0,0,0,0,0,15,240,2,253,0,0,0,0,0,0,11,244,3,252,0,0,0,0,0,0,7,248,7,
-248,0,0,0,0,0,0,3,248,15,240,0,0,0,0,0,0,3,252,31,224,0,0,0,0,0,0,2,253,47,208,0,
-0,0,0,0,0,1,254,63,192,0,0,0,0,0,0,0,255,127,128,0,0,0,0,0,0,0,191,255,64,0,0,0,
-0,0,0,0,127,255,0,0,0,0,0,0,0,0,63,254,0,0,0,0,0,0,0,0,47,253,0,0,0,0,0,0,
-0,0,31,248,0,0,0,0,0,0,0,0,15,244,0,0,0,0,0,0,0,0,7,224,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-2,224,0,0,1,224,0,0,2,244,7,248,0,0,3,248,0,0,7,252,3,252,0,0,11,252,0,0,11,248,2,253,
-0,0,15,252,0,0,15,244,2,254,0,0,47,253,0,0,15,240,1,255,0,0,63,253,0,0,31,224,0,255,64,0,
-127,254,0,0,47,208,0,191,128,0,191,254,0,0,63,192,0,127,128,0,255,255,0,0,127,128,0,63,192,0,255,191,
-0,0,191,64,0,47,208,1,254,127,0,0,255,0,0,31,224,2,254,127,64,1,253,0,0,15,224,3,253,63,64,2,
-252,0,0,11,240,7,252,63,128,3,248,0,0,11,244,11,248,47,128,7,244,0,0,7,244,15,244,47,192,11,240,0,
-0,3,248,31,240,31,192,15,208,0,0,2,248,47,224,31,208,31,192,0,0,2,252,63,192,15,224,63,128,0,0,1,
-253,127,128,15,224,127,64,0,0,1,253,191,64,11,240,190,0,0,0,0,254,255,0,11,240,253,0,0,0,0,191,254,
-0,7,245,252,0,0,0,0,191,252,0,7,250,248,0,0,0,0,127,248,0,3,255,244,0,0,0,0,63,244,0,3,
-255,240,0,0,0,0,63,244,0,2,255,208,0,0,0,0,47,240,0,1,255,192,0,0,0,0,31,240,0,0,255,128,
-0,0,0,0,11,208,0,0,191,64,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,208,0,0,0,2,208,0,0,0,11,248,0,0,0,11,240,0,
-0,0,11,254,0,0,0,47,240,0,0,0,2,255,64,0,0,127,208,0,0,0,0,191,192,0,1,255,128,0,0,0,
-0,63,224,0,3,254,0,0,0,0,0,31,244,0,11,252,0,0,0,0,0,11,253,0,31,244,0,0,0,0,0,2,
-255,0,63,224,0,0,0,0,0,0,255,128,191,192,0,0,0,0,0,0,127,225,255,64,0,0,0,0,0,0,31,251,
-254,0,0,0,0,0,0,0,11,255,252,0,0,0,0,0,0,0,3,255,244,0,0,0,0,0,0,0,1,255,208,0,
-0,0,0,0,0,0,2,255,208,0,0,0,0,0,0,0,7,255,240,0,0,0,0,0,0,0,31,255,248,0,0,0,
-0,0,0,0,127,231,253,0,0,0,0,0,0,0,255,194,255,0,0,0,0,0,0,2,255,64,255,128,0,0,0,0,
-0,11,253,0,127,208,0,0,0,0,0,47,244,0,47,240,0,0,0,0,0,127,224,0,15,248,0,0,0,0,1,255,
-128,0,7,253,0,0,0,0,7,255,0,0,2,255,64,0,0,0,15,252,0,0,0,191,192,0,0,0,47,244,0,0,
-0,63,224,0,0,0,47,208,0,0,0,31,224,0,0,0,11,64,0,0,0,7,208,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,46,0,0,0,1,224,0,0,0,0,127,64,0,0,3,248,0,0,0,0,127,192,0,0,11,248,
-0,0,0,0,47,224,0,0,15,244,0,0,0,0,31,244,0,0,47,224,0,0,0,0,7,252,0,0,63,208,0,0,
-0,0,2,254,0,0,127,128,0,0,0,0,0,255,64,0,255,64,0,0,0,0,0,127,192,1,254,0,0,0,0,0,
-0,47,208,2,253,0,0,0,0,0,0,31,240,3,252,0,0,0,0,0,0,11,244,11,248,0,0,0,0,0,0,7,
-252,15,240,0,0,0,0,0,0,2,253,31,224,0,0,0,0,0,0,1,255,111,208,0,0,0,0,0,0,0,191,255,
-192,0,0,0,0,0,0,0,63,255,64,0,0,0,0,0,0,0,31,255,0,0,0,0,0,0,0,0,7,254,0,0,
-0,0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,31,244,0,0,0,0,
-0,0,0,0,47,224,0,0,0,0,0,0,0,0,127,192,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,
-0,1,255,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,1,
-244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,11,255,255,255,255,254,64,0,0,0,31,255,255,255,255,255,224,0,0,0,31,255,
-255,255,255,255,208,0,0,0,11,255,255,255,255,255,192,0,0,0,0,0,0,0,11,255,0,0,0,0,0,0,0,0,
-47,248,0,0,0,0,0,0,0,0,191,208,0,0,0,0,0,0,0,2,255,64,0,0,0,0,0,0,0,11,252,0,
-0,0,0,0,0,0,0,47,244,0,0,0,0,0,0,0,0,127,208,0,0,0,0,0,0,0,1,255,64,0,0,0,
-0,0,0,0,3,254,0,0,0,0,0,0,0,0,11,248,0,0,0,0,0,0,0,0,31,240,0,0,0,0,0,0,
-0,0,63,208,0,0,0,0,0,0,0,0,191,128,0,0,0,0,0,0,0,2,255,0,0,0,0,0,0,0,0,7,
-253,0,0,0,0,0,0,0,0,15,244,0,0,0,0,0,0,0,0,47,224,0,0,0,0,0,0,0,0,127,192,0,
-0,0,0,0,0,0,0,255,64,0,0,0,0,0,0,0,2,254,0,0,0,0,0,0,0,0,7,252,0,0,0,0,
-0,0,0,0,15,244,0,0,0,0,0,0,0,0,31,255,255,255,255,254,128,0,0,0,47,255,255,255,255,255,208,0,
-0,0,47,255,255,255,255,255,208,0,0,0,31,255,255,255,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,255,254,0,0,0,0,0,0,0,1,255,255,64,0,0,0,0,0,0,1,255,255,64,0,0,0,0,0,0,
-1,255,254,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,
-0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,
-0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,
-0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,
-0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,
-1,252,0,0,0,0,0,0,0,0,1,248,0,0,0,0,0,0,0,0,1,248,0,0,0,0,0,0,0,0,2,248,
-0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,
-0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,
-0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,
-0,0,2,255,255,64,0,0,0,0,0,0,2,255,255,192,0,0,0,0,0,0,2,255,255,192,0,0,0,0,0,0,
-1,255,255,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,244,0,0,0,0,0,0,0,0,2,252,0,0,0,0,
-0,0,0,0,2,254,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,
-0,0,0,63,192,0,0,0,0,0,0,0,0,31,224,0,0,0,0,0,0,0,0,15,240,0,0,0,0,0,0,0,
-0,7,244,0,0,0,0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,0,
-254,0,0,0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,47,192,
-0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,11,240,0,0,
-0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,1,253,0,0,0,0,
-0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,
-0,0,0,47,192,0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,15,240,0,0,0,0,0,0,0,
-0,11,244,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,0,
-180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,
-255,64,0,0,0,0,0,0,0,255,255,128,0,0,0,0,0,0,0,255,255,128,0,0,0,0,0,0,0,127,255,128,
-0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,
-0,0,0,0,0,0,47,64,0,0,0,0,0,0,0,0,47,64,0,0,0,0,0,0,0,0,47,64,0,0,0,0,
-0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,
-0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,
-47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,
-0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,47,128,0,0,0,0,0,0,0,0,31,128,0,0,
-0,0,0,0,0,0,31,128,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,0,31,192,0,0,0,0,
-0,0,0,0,31,192,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,
-0,0,31,192,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,1,255,
-255,192,0,0,0,0,0,0,2,255,255,192,0,0,0,0,0,0,2,255,255,192,0,0,0,0,0,0,1,255,255,64,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,64,0,0,0,0,
-0,0,0,0,47,224,0,0,0,0,0,0,0,0,191,248,0,0,0,0,0,0,0,2,255,254,0,0,0,0,0,0,
-0,7,248,191,128,0,0,0,0,0,0,31,240,47,224,0,0,0,0,0,0,127,208,11,248,0,0,0,0,0,0,255,
-64,2,252,0,0,0,0,0,1,253,0,0,180,0,0,0,0,0,0,180,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,255,255,255,255,255,224,0,0,0,191,255,255,255,255,255,
-224,0,0,0,191,255,255,255,255,255,224,0,0,0,0,0,0,0,5,85,64,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,224,0,0,0,0,0,0,0,0,7,248,
-0,0,0,0,0,0,0,0,3,254,0,0,0,0,0,0,0,0,0,255,64,0,0,0,0,0,0,0,0,63,208,0,
-0,0,0,0,0,0,0,31,240,0,0,0,0,0,0,0,0,11,244,0,0,0,0,0,0,0,0,2,248,0,0,0,
-0,0,0,0,0,0,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,175,228,0,0,0,0,0,0,0,11,255,255,64,0,
-0,0,0,0,0,127,255,255,208,0,0,0,0,0,1,255,255,255,208,0,0,0,0,0,3,255,144,111,192,0,0,0,
-0,0,11,253,0,47,192,0,0,0,0,0,31,244,0,47,192,0,0,0,0,0,47,224,0,47,192,0,0,0,0,0,
-47,192,0,47,128,0,0,0,0,0,63,128,0,47,128,0,0,0,0,0,63,128,0,47,128,0,0,0,0,0,63,128,
-0,47,128,0,0,0,0,0,63,128,0,31,192,0,0,0,0,0,47,192,0,31,192,0,0,0,0,0,47,224,0,47,
-208,0,0,0,0,0,31,249,1,255,224,0,0,0,0,0,15,255,255,255,240,0,0,0,0,0,7,255,255,255,244,0,
-0,0,0,0,1,255,255,231,248,0,0,0,0,0,0,27,249,0,180,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,240,0,0,0,0,0,0,0,0,2,244,0,0,0,0,
-0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,
-0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,3,244,0,0,0,0,0,0,0,0,
-3,244,0,0,0,0,0,0,0,0,3,240,0,0,0,0,0,0,0,0,3,240,0,0,0,0,0,0,0,0,3,240,
-43,249,0,0,0,0,0,0,3,246,255,255,128,0,0,0,0,0,3,255,255,255,224,0,0,0,0,0,3,255,255,255,
-248,0,0,0,0,0,3,255,228,27,253,0,0,0,0,0,3,254,0,1,255,0,0,0,0,0,3,244,0,0,191,64,
-0,0,0,0,3,240,0,0,63,64,0,0,0,0,3,240,0,0,47,128,0,0,0,0,3,240,0,0,47,128,0,0,
-0,0,3,240,0,0,47,128,0,0,0,0,3,240,0,0,47,128,0,0,0,0,3,240,0,0,63,64,0,0,0,0,
-3,240,0,0,191,64,0,0,0,0,3,244,0,2,254,0,0,0,0,0,3,254,64,31,253,0,0,0,0,0,3,255,
-255,255,244,0,0,0,0,0,3,255,255,255,224,0,0,0,0,0,3,255,255,255,64,0,0,0,0,0,1,229,191,228,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,144,0,0,0,0,0,0,0,7,255,254,0,0,0,0,0,0,
-0,31,255,255,192,0,0,0,0,0,0,63,255,255,224,0,0,0,0,0,0,191,208,95,224,0,0,0,0,0,1,255,
-0,7,192,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,11,240,0,0,
-0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,
-0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,11,248,0,6,208,0,0,0,
-0,0,7,254,64,111,240,0,0,0,0,0,2,255,255,255,224,0,0,0,0,0,0,191,255,255,208,0,0,0,0,0,
-0,31,255,254,0,0,0,0,0,0,0,1,191,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,63,64,0,0,0,0,
-0,0,0,0,63,64,0,0,0,0,0,0,0,0,63,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,
-0,0,127,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,
-127,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,1,175,228,191,0,
-0,0,0,0,0,11,255,254,190,0,0,0,0,0,0,63,255,255,254,0,0,0,0,0,0,191,255,255,254,0,0,0,
-0,0,2,255,144,31,254,0,0,0,0,0,3,252,0,2,254,0,0,0,0,0,7,244,0,0,254,0,0,0,0,0,
-11,224,0,0,253,0,0,0,0,0,15,208,0,0,253,0,0,0,0,0,15,208,0,0,253,0,0,0,0,0,15,208,
-0,0,253,0,0,0,0,0,15,208,0,0,254,0,0,0,0,0,15,224,0,0,254,0,0,0,0,0,11,240,0,0,
-254,0,0,0,0,0,7,252,0,7,254,0,0,0,0,0,3,255,144,111,254,0,0,0,0,0,1,255,255,255,255,0,
-0,0,0,0,0,127,255,255,255,0,0,0,0,0,0,31,255,255,191,0,0,0,0,0,0,1,191,228,45,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,1,191,228,0,0,0,0,0,0,0,11,255,255,64,0,0,0,0,0,0,127,255,255,
-208,0,0,0,0,0,0,255,255,255,240,0,0,0,0,0,2,255,64,27,240,0,0,0,0,0,7,252,0,7,240,0,
-0,0,0,0,11,244,0,111,224,0,0,0,0,0,15,224,6,255,192,0,0,0,0,0,15,208,127,254,0,0,0,0,
-0,0,31,219,255,224,0,0,0,0,0,0,31,255,249,0,0,0,0,0,0,0,31,255,144,0,0,0,0,0,0,0,
-31,228,0,0,0,0,0,0,0,0,31,224,0,0,29,0,0,0,0,0,15,248,0,0,127,0,0,0,0,0,7,255,
-80,27,255,0,0,0,0,0,3,255,255,255,253,0,0,0,0,0,0,255,255,255,248,0,0,0,0,0,0,47,255,255,
-144,0,0,0,0,0,0,1,191,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,191,128,0,0,0,0,0,0,0,31,255,208,0,0,0,0,0,0,0,127,255,
-208,0,0,0,0,0,0,0,255,255,128,0,0,0,0,0,0,1,255,144,0,0,0,0,0,0,0,2,254,0,0,0,
-0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,
-0,0,0,7,240,0,0,0,0,0,0,0,0,11,240,20,0,0,0,0,0,0,6,255,255,255,64,0,0,0,0,0,
-31,255,255,255,192,0,0,0,0,0,47,255,255,255,192,0,0,0,0,0,31,255,255,170,64,0,0,0,0,0,1,11,
-224,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,11,224,0,
-0,0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,11,224,0,0,0,
-0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,
-0,0,0,11,224,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,
-0,15,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,11,
-128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,1,111,249,0,0,0,0,0,0,0,27,255,255,128,0,0,0,0,0,0,127,255,255,244,0,0,0,
-0,0,1,255,255,255,248,0,0,0,0,0,3,255,144,27,248,0,0,0,0,0,11,253,0,3,248,0,0,0,0,0,
-15,240,0,3,244,0,0,0,0,0,31,208,0,7,244,0,0,0,0,0,47,192,0,7,240,0,0,0,0,0,47,128,
-0,11,240,0,0,0,0,0,63,128,0,15,240,0,0,0,0,0,63,128,0,31,224,0,0,0,0,0,47,192,0,63,
-224,0,0,0,0,0,47,208,0,191,224,0,0,0,0,0,31,248,7,255,224,0,0,0,0,0,11,255,255,235,224,0,
-0,0,0,0,3,255,255,207,208,0,0,0,0,0,0,191,255,15,208,0,0,0,0,0,0,27,248,15,208,0,0,0,
-0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,0,47,192,0,0,0,0,0,
-0,0,0,127,128,0,0,0,0,0,0,0,0,255,64,0,0,0,0,0,26,80,23,255,0,0,0,0,0,0,47,255,
-255,254,0,0,0,0,0,0,63,255,255,248,0,0,0,0,0,0,31,255,255,224,0,0,0,0,0,0,6,191,249,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,1,224,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,
-0,0,3,248,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,252,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,3,248,
-0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,3,248,6,254,64,0,0,0,0,0,3,248,47,255,
-224,0,0,0,0,0,3,248,255,255,240,0,0,0,0,0,3,250,255,255,244,0,0,0,0,0,3,255,253,7,248,0,
-0,0,0,0,3,255,240,3,248,0,0,0,0,0,3,255,192,2,248,0,0,0,0,0,3,255,64,2,248,0,0,0,
-0,0,3,254,0,2,252,0,0,0,0,0,3,252,0,2,252,0,0,0,0,0,3,248,0,2,252,0,0,0,0,0,
-3,248,0,2,252,0,0,0,0,0,3,248,0,2,253,0,0,0,0,0,3,248,0,1,253,0,0,0,0,0,3,248,
-0,1,253,0,0,0,0,0,3,248,0,0,254,0,0,0,0,0,7,248,0,0,255,0,0,0,0,0,7,244,0,0,
-191,0,0,0,0,0,2,224,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,0,0,0,0,0,0,0,0,0,255,64,0,0,0,
-0,0,0,0,0,255,64,0,0,0,0,0,0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,184,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,
-0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,2,252,0,0,
-0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,
-0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,
-0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,252,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,0,180,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-184,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,1,254,0,0,0,0,0,0,0,0,0,184,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,191,0,0,0,0,0,
-0,0,0,0,191,0,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,
-0,0,191,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,
-127,64,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,0,0,0,63,128,
-0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,63,128,0,0,
-0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,47,192,0,0,0,0,0,0,0,0,47,192,0,0,0,0,
-0,0,0,0,47,192,0,0,0,0,0,0,0,0,47,192,0,0,0,0,0,0,0,0,47,192,0,0,0,0,0,0,
-46,0,47,192,0,0,0,0,0,0,127,64,31,192,0,0,0,0,0,0,63,192,47,192,0,0,0,0,0,0,47,224,
-63,192,0,0,0,0,0,0,31,244,191,128,0,0,0,0,0,0,11,255,255,64,0,0,0,0,0,0,3,255,254,0,
-0,0,0,0,0,0,0,255,252,0,0,0,0,0,0,0,0,47,224,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,0,0,0,0,
-0,0,1,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,
-1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,16,0,0,0,0,0,1,253,
-0,1,248,0,0,0,0,0,1,253,0,3,252,0,0,0,0,0,1,253,0,11,253,0,0,0,0,0,1,252,0,47,
-252,0,0,0,0,0,1,252,0,127,252,0,0,0,0,0,1,252,1,255,244,0,0,0,0,0,1,252,3,255,208,0,
-0,0,0,0,2,252,11,255,64,0,0,0,0,0,2,252,47,253,0,0,0,0,0,0,2,252,191,244,0,0,0,0,
-0,0,2,254,255,208,0,0,0,0,0,0,2,255,255,224,0,0,0,0,0,0,2,255,255,244,0,0,0,0,0,0,
-2,255,235,253,0,0,0,0,0,0,2,255,130,255,0,0,0,0,0,0,2,253,0,255,128,0,0,0,0,0,2,252,
-0,127,208,0,0,0,0,0,3,252,0,47,240,0,0,0,0,0,3,248,0,11,248,0,0,0,0,0,3,248,0,3,
-253,0,0,0,0,0,3,248,0,1,254,0,0,0,0,0,3,248,0,0,191,0,0,0,0,0,1,244,0,0,125,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,0,0,
-0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,
-0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,
-0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,
-1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,
-0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,
-0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,
-0,0,0,0,1,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,
-0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,
-2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,248,
-0,0,0,0,0,0,0,0,1,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,2,192,0,0,0,0,0,0,0,0,7,224,0,0,0,0,0,0,0,0,11,240,11,228,6,254,0,0,
-0,0,11,240,63,253,47,255,192,0,0,0,11,240,255,255,191,255,224,0,0,0,11,243,255,255,255,255,240,0,0,0,
-11,251,253,191,254,31,240,0,0,0,11,255,224,127,224,11,244,0,0,0,7,255,128,127,64,7,244,0,0,0,7,254,
-0,127,64,3,248,0,0,0,7,252,0,127,64,3,248,0,0,0,7,244,0,127,64,2,252,0,0,0,7,244,0,127,
-64,2,252,0,0,0,11,240,0,63,64,2,252,0,0,0,11,240,0,63,128,1,253,0,0,0,11,240,0,63,128,1,
-253,0,0,0,11,240,0,47,128,1,254,0,0,0,11,240,0,47,192,0,254,0,0,0,11,240,0,47,192,0,254,0,
-0,0,11,240,0,47,192,0,191,0,0,0,7,244,0,31,192,0,191,0,0,0,2,224,0,31,192,0,125,0,0,0,
-0,0,0,11,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,2,224,6,249,0,0,0,0,0,0,7,244,63,255,64,0,0,0,0,0,7,245,255,255,192,0,
-0,0,0,0,7,251,255,255,208,0,0,0,0,0,7,255,249,31,224,0,0,0,0,0,3,255,224,15,224,0,0,0,
-0,0,7,255,128,11,240,0,0,0,0,0,7,255,0,11,240,0,0,0,0,0,7,254,0,11,240,0,0,0,0,0,
-7,252,0,11,240,0,0,0,0,0,7,248,0,11,240,0,0,0,0,0,11,244,0,11,240,0,0,0,0,0,11,240,
-0,11,240,0,0,0,0,0,11,240,0,11,240,0,0,0,0,0,11,240,0,11,244,0,0,0,0,0,11,240,0,7,
-244,0,0,0,0,0,11,240,0,7,248,0,0,0,0,0,11,240,0,3,248,0,0,0,0,0,7,240,0,3,248,0,
-0,0,0,0,2,224,0,1,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,144,0,0,0,0,0,0,0,31,
-255,252,0,0,0,0,0,0,0,127,255,255,0,0,0,0,0,0,1,255,255,255,128,0,0,0,0,0,2,255,64,191,
-192,0,0,0,0,0,7,253,0,31,208,0,0,0,0,0,11,244,0,15,224,0,0,0,0,0,15,240,0,11,224,0,
-0,0,0,0,31,224,0,11,240,0,0,0,0,0,31,208,0,7,240,0,0,0,0,0,31,208,0,7,240,0,0,0,
-0,0,31,208,0,11,240,0,0,0,0,0,31,208,0,11,224,0,0,0,0,0,15,224,0,31,208,0,0,0,0,0,
-11,244,0,63,192,0,0,0,0,0,7,254,1,255,128,0,0,0,0,0,2,255,255,255,0,0,0,0,0,0,0,255,
-255,253,0,0,0,0,0,0,0,47,255,244,0,0,0,0,0,0,0,6,254,64,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,224,0,0,0,0,0,0,
-0,0,7,240,111,228,0,0,0,0,0,0,11,246,255,254,0,0,0,0,0,0,11,255,255,255,128,0,0,0,0,0,
-11,255,255,255,208,0,0,0,0,0,11,255,208,47,224,0,0,0,0,0,11,254,0,15,240,0,0,0,0,0,7,244,
-0,7,244,0,0,0,0,0,7,244,0,7,244,0,0,0,0,0,7,244,0,3,248,0,0,0,0,0,7,244,0,3,
-248,0,0,0,0,0,7,244,0,3,248,0,0,0,0,0,7,244,0,3,248,0,0,0,0,0,7,244,0,7,248,0,
-0,0,0,0,7,244,0,11,244,0,0,0,0,0,7,244,0,31,240,0,0,0,0,0,7,249,64,127,224,0,0,0,
-0,0,7,255,255,255,192,0,0,0,0,0,7,255,255,255,64,0,0,0,0,0,7,255,255,253,0,0,0,0,0,0,
-7,250,255,144,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,
-0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,
-0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,
-0,0,0,0,2,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,235,128,0,0,0,0,0,0,7,255,255,208,0,
-0,0,0,0,0,47,255,255,208,0,0,0,0,0,0,255,255,255,208,0,0,0,0,0,2,255,208,15,208,0,0,0,
-0,0,7,254,0,15,208,0,0,0,0,0,15,248,0,15,208,0,0,0,0,0,31,240,0,31,208,0,0,0,0,0,
-31,208,0,31,208,0,0,0,0,0,47,192,0,31,208,0,0,0,0,0,47,192,0,31,192,0,0,0,0,0,63,192,
-0,31,192,0,0,0,0,0,63,192,0,47,192,0,0,0,0,0,47,208,0,63,192,0,0,0,0,0,31,240,0,127,
-128,0,0,0,0,0,15,253,1,255,128,0,0,0,0,0,11,255,255,255,64,0,0,0,0,0,2,255,255,255,64,0,
-0,0,0,0,0,127,255,255,64,0,0,0,0,0,0,6,254,191,0,0,0,0,0,0,0,0,0,127,0,0,0,0,
-0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,0,0,0,190,0,0,0,0,0,0,
-0,0,0,254,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,0,254,0,0,0,0,0,0,0,0,
-0,253,0,0,0,0,0,0,0,0,0,184,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,208,
-6,254,0,0,0,0,0,0,7,240,191,255,64,0,0,0,0,0,7,247,255,255,128,0,0,0,0,0,7,255,249,47,
-192,0,0,0,0,0,7,255,144,31,192,0,0,0,0,0,7,254,0,31,192,0,0,0,0,0,7,252,0,31,192,0,
-0,0,0,0,7,244,0,11,64,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,
-0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,
-7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,
-0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,2,224,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,110,0,0,0,0,
-0,0,0,0,107,255,64,0,0,0,0,0,0,11,255,255,128,0,0,0,0,0,0,191,255,255,128,0,0,0,0,0,
-2,255,249,111,192,0,0,0,0,0,7,255,64,47,192,0,0,0,0,0,11,248,0,15,64,0,0,0,0,0,11,240,
-0,0,0,0,0,0,0,0,11,249,64,0,0,0,0,0,0,0,7,255,249,0,0,0,0,0,0,0,2,255,255,208,
-0,0,0,0,0,0,0,111,255,244,0,0,0,0,0,0,0,1,111,253,0,0,0,0,0,0,0,0,2,254,0,0,
-0,0,0,0,0,0,0,191,0,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,30,0,0,127,64,0,0,0,
-0,0,63,148,6,255,64,0,0,0,0,0,63,255,255,254,0,0,0,0,0,0,47,255,255,253,0,0,0,0,0,0,
-11,255,255,244,0,0,0,0,0,0,0,111,250,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,224,0,0,0,0,0,0,0,0,7,
-244,0,0,0,0,0,0,0,0,7,244,0,0,0,0,0,0,0,0,7,248,0,0,0,0,0,0,0,0,7,248,0,
-0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,5,67,248,84,0,0,0,0,0,0,31,255,255,255,64,0,
-0,0,0,0,47,255,255,255,128,0,0,0,0,0,47,255,255,255,128,0,0,0,0,0,10,191,255,170,0,0,0,0,
-0,0,0,3,248,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,
-0,3,248,0,0,0,0,0,0,0,0,3,248,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,2,
-252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,
-0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,
-0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,248,0,0,0,0,0,0,0,0,1,244,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,2,224,0,3,208,0,0,0,0,0,7,240,0,11,240,0,0,0,0,0,11,240,0,11,
-240,0,0,0,0,0,11,240,0,11,240,0,0,0,0,0,11,240,0,15,240,0,0,0,0,0,15,224,0,15,240,0,
-0,0,0,0,15,224,0,15,224,0,0,0,0,0,15,224,0,15,224,0,0,0,0,0,15,224,0,15,224,0,0,0,
-0,0,15,224,0,15,224,0,0,0,0,0,15,224,0,15,224,0,0,0,0,0,11,240,0,15,224,0,0,0,0,0,
-11,240,0,15,224,0,0,0,0,0,11,240,0,15,224,0,0,0,0,0,7,244,0,15,224,0,0,0,0,0,7,249,
-1,111,224,0,0,0,0,0,3,255,255,255,224,0,0,0,0,0,2,255,255,255,240,0,0,0,0,0,0,191,255,255,
-240,0,0,0,0,0,0,27,254,71,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,64,0,3,208,0,0,0,0,0,
-47,192,0,11,240,0,0,0,0,0,47,208,0,15,224,0,0,0,0,0,31,224,0,31,208,0,0,0,0,0,15,240,
-0,63,192,0,0,0,0,0,7,244,0,127,128,0,0,0,0,0,3,248,0,191,64,0,0,0,0,0,2,252,0,254,
-0,0,0,0,0,0,1,253,1,253,0,0,0,0,0,0,0,254,2,252,0,0,0,0,0,0,0,127,71,248,0,0,
-0,0,0,0,0,63,139,240,0,0,0,0,0,0,0,47,207,224,0,0,0,0,0,0,0,31,239,208,0,0,0,0,
-0,0,0,15,255,128,0,0,0,0,0,0,0,11,255,64,0,0,0,0,0,0,0,7,255,0,0,0,0,0,0,0,
-0,2,253,0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,11,64,0,180,0,31,64,0,0,0,47,192,2,252,0,47,192,0,0,0,47,208,3,253,0,63,128,0,
-0,0,31,208,7,253,0,63,128,0,0,0,31,208,11,254,0,127,64,0,0,0,15,224,15,254,0,191,0,0,0,0,
-15,224,31,255,0,254,0,0,0,0,15,224,47,191,64,253,0,0,0,0,11,240,63,111,65,253,0,0,0,0,11,240,
-127,47,130,252,0,0,0,0,7,244,189,31,131,248,0,0,0,0,7,244,252,31,195,244,0,0,0,0,3,245,248,31,
-199,240,0,0,0,0,2,250,244,15,219,224,0,0,0,0,2,255,240,11,223,208,0,0,0,0,1,255,224,11,255,192,
-0,0,0,0,0,255,192,7,255,128,0,0,0,0,0,191,128,3,255,64,0,0,0,0,0,127,64,2,254,0,0,0,
-0,0,0,45,0,0,188,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,228,0,0,11,128,0,0,0,0,2,253,0,0,
-31,208,0,0,0,0,2,255,0,0,127,192,0,0,0,0,0,191,128,2,255,64,0,0,0,0,0,47,224,11,253,0,
-0,0,0,0,0,15,244,47,244,0,0,0,0,0,0,7,253,255,192,0,0,0,0,0,0,1,255,254,0,0,0,0,
-0,0,0,0,191,248,0,0,0,0,0,0,0,0,127,240,0,0,0,0,0,0,0,1,255,244,0,0,0,0,0,0,
-0,7,255,253,0,0,0,0,0,0,0,31,246,255,0,0,0,0,0,0,0,191,208,191,128,0,0,0,0,0,2,255,
-64,63,224,0,0,0,0,0,11,253,0,31,244,0,0,0,0,0,47,244,0,7,253,0,0,0,0,0,47,208,0,2,
-255,0,0,0,0,0,30,64,0,0,191,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-31,64,0,0,125,0,0,0,0,0,63,192,0,0,255,0,0,0,0,0,63,224,0,1,254,0,0,0,0,0,31,244,
-0,3,253,0,0,0,0,0,11,248,0,7,252,0,0,0,0,0,7,253,0,15,244,0,0,0,0,0,2,254,0,31,
-240,0,0,0,0,0,0,255,64,47,208,0,0,0,0,0,0,191,128,127,192,0,0,0,0,0,0,63,208,191,128,0,
-0,0,0,0,0,47,224,255,0,0,0,0,0,0,0,15,245,254,0,0,0,0,0,0,0,11,251,252,0,0,0,0,
-0,0,0,3,255,248,0,0,0,0,0,0,0,2,255,244,0,0,0,0,0,0,0,0,255,224,0,0,0,0,0,0,
-0,0,127,208,0,0,0,0,0,0,0,0,127,128,0,0,0,0,0,0,0,0,191,64,0,0,0,0,0,0,0,0,
-255,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,7,248,0,
-0,0,0,0,0,0,0,11,244,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,31,208,0,0,0,
-0,0,0,0,0,47,192,0,0,0,0,0,0,0,0,63,128,0,0,0,0,0,0,0,0,63,64,0,0,0,0,0,
-0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,255,255,255,252,0,0,0,0,0,3,255,255,255,253,0,0,0,
-0,0,3,255,255,255,252,0,0,0,0,0,2,255,255,255,248,0,0,0,0,0,0,0,0,47,224,0,0,0,0,0,
-0,0,0,127,192,0,0,0,0,0,0,0,0,255,64,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,
-7,248,0,0,0,0,0,0,0,0,31,240,0,0,0,0,0,0,0,0,63,208,0,0,0,0,0,0,0,0,191,128,
-0,0,0,0,0,0,0,2,255,0,0,0,0,0,0,0,0,7,253,0,0,0,0,0,0,0,0,31,244,0,0,0,
-0,0,0,0,0,127,224,0,0,0,0,0,0,0,1,255,255,255,244,0,0,0,0,0,7,255,255,255,248,0,0,0,
-0,0,11,255,255,255,248,0,0,0,0,0,7,255,255,255,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,0,0,0,0,0,0,0,0,11,255,128,0,0,0,0,
-0,0,0,47,255,192,0,0,0,0,0,0,0,127,255,64,0,0,0,0,0,0,0,191,144,0,0,0,0,0,0,0,
-0,254,0,0,0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,1,252,
-0,0,0,0,0,0,0,0,1,253,0,0,0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,0,253,0,0,
-0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,0,253,0,0,0,0,0,0,0,0,0,253,0,0,0,0,
-0,0,0,0,0,253,0,0,0,0,0,0,0,0,2,253,0,0,0,0,0,0,0,0,15,252,0,0,0,0,0,0,
-0,0,63,244,0,0,0,0,0,0,0,0,191,208,0,0,0,0,0,0,0,0,191,208,0,0,0,0,0,0,0,0,
-127,240,0,0,0,0,0,0,0,0,15,244,0,0,0,0,0,0,0,0,3,252,0,0,0,0,0,0,0,0,2,252,
-0,0,0,0,0,0,0,0,1,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,248,0,0,
-0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,2,252,0,0,0,0,0,0,0,0,1,253,0,0,0,0,
-0,0,0,0,1,254,0,0,0,0,0,0,0,0,0,255,0,0,0,0,0,0,0,0,0,191,128,0,0,0,0,0,
-0,0,0,63,255,0,0,0,0,0,0,0,0,31,255,128,0,0,0,0,0,0,0,11,255,64,0,0,0,0,0,0,
-0,1,190,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,2,208,0,0,0,0,0,0,0,0,7,224,0,0,0,0,0,0,0,0,7,240,0,
-0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,
-0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,
-0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,
-0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,
-240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,
-0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,
-0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,
-0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,
-0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,
-240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,
-0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,240,0,0,0,0,0,0,0,0,7,224,0,0,0,
-0,0,0,0,0,2,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,47,144,0,0,0,0,0,0,0,0,191,252,0,0,0,0,0,0,0,0,255,255,
-0,0,0,0,0,0,0,0,127,255,64,0,0,0,0,0,0,0,1,191,128,0,0,0,0,0,0,0,0,47,192,0,
-0,0,0,0,0,0,0,31,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,
-0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,31,208,0,0,0,0,0,
-0,0,0,31,192,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,0,31,192,0,0,0,0,0,0,0,
-0,31,192,0,0,0,0,0,0,0,0,31,224,0,0,0,0,0,0,0,0,11,253,0,0,0,0,0,0,0,0,7,
-255,0,0,0,0,0,0,0,0,1,255,128,0,0,0,0,0,0,0,1,255,192,0,0,0,0,0,0,0,3,255,64,
-0,0,0,0,0,0,0,7,252,0,0,0,0,0,0,0,0,15,240,0,0,0,0,0,0,0,0,15,224,0,0,0,
-0,0,0,0,0,15,208,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,11,224,0,0,0,0,0,
-0,0,0,11,224,0,0,0,0,0,0,0,0,15,224,0,0,0,0,0,0,0,0,31,224,0,0,0,0,0,0,0,
-0,31,208,0,0,0,0,0,0,0,0,63,192,0,0,0,0,0,0,0,0,191,128,0,0,0,0,0,0,0,47,255,
-64,0,0,0,0,0,0,0,127,254,0,0,0,0,0,0,0,0,127,248,0,0,0,0,0,0,0,0,47,144,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,249,0,7,128,
-0,0,0,0,0,127,255,64,15,192,0,0,0,0,1,255,255,192,31,192,0,0,0,0,3,253,47,224,47,192,0,0,
-0,0,11,244,11,249,127,128,0,0,0,0,15,208,2,255,255,0,0,0,0,0,11,128,0,191,253,0,0,0,0,0,
-0,0,0,27,228,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-/*Bitmap Raw Data end ---*/
-} 
+const uint8_t Comic_Sans_MS_38_L2 [4448] = 
+{
+/* Metric block */
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+11,25,14,14,20,18,11,16,9,19,23,17,23,23,23,23,23,23,23,23,11,14,14,28,24,23,27,24,23,29,21,21,
+34,30,30,20,24,26,28,28,28,14,14,22,19,23,20,22,21,19,20,22,11,21,10,30,20,20,20,18,19,18,20,22,
+20,16,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+17,0,0,0,10,0,0,0,40,0,0,0,43,0,0,0,148,0,0,0,
+/* Deflated bitmap */
+120,218,237,93,61,147,228,70,25,86,75,220,168,202,10,134,0,31,85,158,194,250,1,20,214,79,24,97,7,4,4,108,
+21,38,49,129,115,174,96,18,2,83,133,209,20,254,3,27,216,49,14,236,228,8,54,113,112,69,21,167,41,8,8,28,
+160,140,192,137,168,90,108,176,3,84,133,48,154,189,145,154,254,120,63,180,163,62,221,172,189,183,171,219,61,5,87,207,
+205,73,173,86,191,221,239,251,188,31,221,231,121,207,175,27,116,61,76,1,4,178,0,20,201,10,80,252,89,13,40,249,
+51,162,229,107,132,126,64,232,71,248,68,114,130,173,36,114,141,173,116,248,178,164,1,32,232,21,145,196,223,146,179,157,
+40,13,202,139,206,55,77,251,157,151,5,6,133,141,183,124,199,160,168,244,226,191,25,20,23,222,252,145,105,39,222,120,
+161,52,207,38,107,207,183,31,162,144,144,27,248,87,207,118,38,46,189,153,253,45,106,189,149,125,34,148,82,62,170,109,
+167,164,124,199,246,38,147,173,223,26,52,147,199,94,75,163,245,214,117,136,40,66,17,121,217,6,17,13,110,64,131,27,
+225,64,122,113,69,3,94,208,163,248,128,151,83,195,244,168,160,47,244,119,136,2,106,46,100,84,211,203,170,49,52,31,
+69,227,207,70,245,240,109,220,3,238,21,247,84,208,119,120,146,80,78,223,187,164,49,136,185,251,252,193,146,70,55,167,
+209,93,164,95,85,86,225,122,248,29,209,142,95,54,222,191,114,248,176,243,131,219,161,8,123,98,205,210,33,90,174,29,
+104,51,68,137,3,245,238,91,143,33,126,91,158,142,76,54,159,122,31,236,198,230,110,86,144,178,192,87,132,142,201,30,
+30,95,202,34,19,52,226,126,51,64,175,188,138,104,249,105,11,26,110,169,180,69,9,42,2,145,210,41,159,195,167,199,
+52,175,50,84,172,66,254,174,198,239,8,119,248,29,56,123,131,194,123,72,189,249,222,115,195,116,77,151,160,53,24,212,
+23,68,11,41,187,148,230,198,154,208,6,38,132,196,41,113,225,150,61,191,124,46,153,103,251,98,195,48,103,125,191,25,
+83,162,172,13,72,97,10,82,152,222,71,207,135,52,34,181,59,151,200,39,35,217,29,63,31,153,91,161,168,235,33,141,
+8,29,212,130,239,187,206,206,210,164,12,92,116,185,116,144,46,23,173,26,106,4,39,95,175,135,13,199,197,88,195,14,
+71,128,155,139,28,205,37,142,230,198,169,222,168,15,17,59,84,98,148,94,191,216,86,91,236,52,218,115,109,198,107,228,
+117,18,6,95,158,46,58,116,38,132,53,242,154,223,89,151,75,15,159,101,208,218,3,178,3,167,191,215,146,125,141,236,
+176,106,209,207,209,135,5,111,137,209,242,252,111,229,30,218,244,17,183,28,211,219,236,123,245,61,182,47,122,236,109,255,
+180,111,101,251,172,92,73,112,80,132,60,142,65,116,185,68,7,125,73,234,54,162,209,16,249,63,167,163,17,126,62,116,
+8,35,14,61,16,146,29,121,99,136,130,182,35,250,215,57,124,171,110,216,50,175,20,23,226,101,121,48,106,28,232,176,
+103,5,77,201,128,132,197,136,255,117,90,215,119,183,36,6,116,144,34,234,170,154,107,173,107,109,129,180,80,217,104,178,
+158,15,157,127,225,80,64,236,48,38,53,141,27,71,188,210,97,132,170,24,206,161,218,17,136,73,199,132,223,139,91,188,
+1,75,69,73,70,74,70,41,12,1,32,241,240,189,163,87,38,104,108,243,83,118,114,82,210,127,160,15,36,202,77,233,
+141,5,124,252,131,222,216,123,163,136,135,107,129,195,117,151,166,108,142,98,224,197,42,104,190,244,238,243,98,7,9,112,
+7,134,246,144,79,115,72,89,38,120,66,53,17,180,240,218,99,104,89,200,190,230,47,200,26,164,251,35,52,133,107,193,
+113,63,50,178,121,69,11,174,34,179,198,97,88,138,224,126,129,40,251,24,81,254,195,10,71,20,141,118,184,67,20,213,
+136,226,18,81,182,65,148,167,128,252,14,13,190,178,141,128,230,122,222,27,106,148,104,84,161,199,108,145,249,173,56,44,
+104,120,32,10,138,9,9,233,27,30,173,253,199,234,3,141,182,23,51,46,205,2,162,16,193,25,174,80,221,242,142,16,
+204,113,89,207,128,171,40,107,110,195,145,58,190,102,249,129,102,5,150,140,234,245,209,227,103,163,168,71,11,73,65,90,
+150,225,23,30,48,35,197,135,66,9,138,53,93,181,212,171,154,86,25,52,146,96,52,197,155,201,15,38,36,182,143,134,
+62,198,156,244,252,146,166,154,196,17,8,164,35,202,89,14,7,138,130,166,125,243,133,12,52,232,112,92,66,26,43,141,
+90,180,95,96,37,213,232,130,149,212,92,207,54,169,81,70,200,18,118,70,134,9,162,100,224,9,195,9,61,228,132,29,
+105,194,150,244,125,179,111,3,38,164,9,197,79,112,36,117,204,205,14,86,226,64,47,220,207,169,251,189,128,60,7,233,
+217,146,204,201,206,36,229,144,3,176,228,232,81,191,27,206,18,22,63,55,23,59,92,42,71,195,227,220,198,249,138,106,
+236,21,236,103,198,233,132,150,86,223,223,34,45,128,150,41,163,89,71,44,67,13,6,140,130,210,127,160,32,21,231,18,
+131,223,58,47,68,43,94,172,26,242,108,74,122,71,74,129,164,99,98,160,32,36,89,103,200,5,210,144,24,40,250,121,
+13,206,28,246,168,52,98,47,107,223,223,210,171,12,60,47,106,37,80,95,36,73,255,177,231,85,211,52,198,20,66,254,
+175,9,74,139,253,193,222,168,161,197,209,122,163,195,81,131,108,155,142,1,228,251,99,85,246,189,212,120,15,233,251,0,
+213,120,159,30,191,188,160,241,219,224,248,129,230,205,40,8,191,144,29,172,36,145,127,224,90,162,14,47,129,115,133,89,
+73,138,97,67,122,197,67,203,132,75,111,69,154,132,204,150,242,93,134,177,220,155,114,61,112,48,15,135,35,204,247,93,
+69,95,132,131,250,11,151,67,255,150,119,107,175,95,15,7,134,237,92,111,214,115,246,21,167,51,39,205,51,186,45,103,
+227,194,14,88,207,217,34,59,147,48,27,119,144,214,43,153,38,207,222,21,81,112,53,42,135,49,5,239,55,132,56,187,
+228,253,210,27,40,29,191,23,232,192,118,150,164,204,56,10,70,165,56,115,186,45,33,233,47,155,33,141,120,249,6,141,
+245,91,142,24,56,199,17,105,74,147,234,87,35,152,82,144,2,169,175,196,50,155,160,69,98,31,53,72,182,226,10,61,
+165,101,129,164,44,223,96,80,93,126,255,4,29,229,21,80,30,166,250,9,81,238,165,236,126,12,104,155,194,2,82,132,
+17,116,175,50,170,182,251,134,137,74,50,115,166,131,134,38,26,179,107,234,105,12,205,52,209,120,211,65,191,152,72,208,
+253,252,245,18,249,126,25,25,214,156,248,16,71,167,115,111,133,188,137,24,124,78,12,58,167,108,71,78,41,11,254,173,
+163,251,58,162,240,29,21,155,116,212,178,195,75,21,84,251,33,200,179,86,18,248,169,101,30,90,22,86,67,106,100,89,
+191,70,33,161,136,144,245,28,21,154,217,166,69,123,39,135,86,184,229,126,15,112,52,178,179,163,235,23,147,143,58,97,
+245,168,162,176,110,69,164,186,30,208,195,83,48,53,154,84,215,104,94,160,204,33,110,198,188,45,57,244,147,153,192,133,
+142,180,149,43,209,198,78,209,19,98,27,101,223,161,178,250,88,147,196,12,25,40,232,86,197,114,87,192,54,153,193,103,
+244,185,209,36,227,132,191,226,240,40,91,251,94,152,245,20,21,34,42,56,209,134,56,219,91,15,188,34,133,66,136,93,
+159,155,237,49,207,246,22,145,149,152,209,80,102,193,25,100,150,163,65,70,15,25,100,4,176,143,202,225,111,9,161,37,
+61,107,102,138,209,135,166,91,26,89,133,160,145,229,48,74,90,119,242,134,34,109,37,121,14,107,244,183,64,130,226,164,
+59,154,136,176,196,167,191,135,226,178,128,34,24,123,168,60,32,58,56,138,2,71,54,57,104,94,252,89,206,239,221,160,
+97,234,33,235,205,202,207,223,75,49,142,142,171,241,235,160,102,184,186,123,121,18,150,86,78,232,37,41,207,166,178,182,
+254,32,193,112,9,138,113,251,36,173,62,122,207,187,91,158,247,158,156,104,92,130,237,61,217,237,69,147,207,35,140,96,
+188,251,149,231,198,101,35,49,165,172,228,3,252,195,178,167,29,34,65,200,116,220,252,213,16,112,131,204,34,241,47,13,
+189,33,45,186,115,98,39,135,223,229,48,77,140,44,9,125,24,90,164,236,190,69,173,90,18,97,133,237,217,223,28,200,
+188,200,133,2,70,123,127,61,143,76,109,228,245,151,34,42,99,122,255,136,226,187,45,17,228,14,217,6,106,111,175,123,
+241,131,129,235,255,53,178,250,79,17,29,214,131,217,9,50,138,57,197,215,24,69,114,138,169,126,158,47,151,100,23,46,
+5,93,78,58,145,249,228,57,36,254,8,232,110,46,73,70,140,58,146,214,187,160,149,63,63,154,142,188,222,38,145,73,
+114,79,148,205,157,239,128,173,123,243,214,146,129,181,103,243,65,161,98,2,182,186,134,81,164,8,229,178,179,31,92,40,
+30,140,65,5,59,30,177,66,210,112,138,248,223,149,39,141,23,150,124,82,137,110,105,208,199,181,223,26,82,184,252,75,
+19,236,12,202,222,105,66,235,71,231,175,237,162,218,208,190,252,213,118,110,61,106,41,218,184,212,18,16,157,232,146,66,
+35,229,245,202,165,73,66,43,246,144,231,107,253,33,138,221,100,202,219,104,12,183,80,125,210,72,113,121,213,79,205,123,
+20,74,108,58,65,249,105,241,206,248,205,138,243,207,27,227,18,42,164,155,80,40,44,188,176,52,195,52,149,181,245,0,
+217,146,209,19,134,225,26,125,98,130,22,198,159,141,12,65,210,204,41,50,76,95,143,189,205,253,91,100,194,1,234,150,
+240,172,69,212,72,68,181,254,211,34,237,142,89,164,125,217,165,65,58,177,98,145,126,149,70,202,86,228,107,68,234,17,
+251,175,122,88,1,41,135,0,144,154,89,128,188,188,64,148,212,6,169,78,205,91,68,129,204,0,9,195,246,108,4,67,
+194,19,118,183,133,153,172,198,23,49,198,208,4,46,237,8,253,98,42,139,235,30,86,39,135,168,6,140,229,42,136,200,
+2,41,60,21,153,89,111,186,246,200,186,79,113,131,233,197,101,137,161,29,19,93,53,235,200,144,98,61,66,214,144,232,
+81,179,220,209,72,97,135,200,114,106,141,236,194,214,79,88,109,166,215,160,69,57,33,137,186,206,206,166,10,9,169,29,
+231,29,206,58,147,51,49,28,221,236,221,49,41,30,235,30,171,101,238,91,106,158,117,233,155,114,207,100,135,231,10,106,
+32,110,54,155,140,123,172,92,191,20,227,162,216,79,150,90,72,78,71,88,205,48,51,95,97,148,59,172,48,252,160,16,
+184,82,10,249,205,222,111,81,137,38,73,33,200,216,42,4,25,167,168,132,205,138,198,86,164,104,63,90,138,170,148,136,
+48,17,199,91,11,174,2,113,116,122,2,210,234,62,164,40,54,142,75,72,99,213,147,86,253,6,6,87,107,111,181,67,
+79,19,98,125,65,67,25,217,6,179,180,26,245,106,98,10,228,17,49,33,254,205,166,59,148,232,161,178,38,170,196,138,
+173,125,67,168,64,212,17,163,197,64,209,151,244,91,21,227,125,149,192,103,213,12,147,136,66,216,201,90,97,105,151,70,
+182,126,81,235,63,187,214,181,254,19,213,51,18,130,239,39,148,75,210,12,92,126,7,226,146,199,119,155,253,56,161,163,
+240,136,247,85,46,183,41,165,51,48,168,53,167,41,225,75,138,84,222,163,146,110,239,78,222,13,243,89,162,183,89,148,
+208,222,118,75,31,13,172,153,17,54,242,20,82,228,41,112,68,158,122,17,140,5,151,237,158,156,93,111,44,94,188,222,
+243,183,148,199,245,62,34,51,68,140,196,137,164,185,173,12,197,139,71,123,14,141,119,40,122,124,137,230,99,209,227,100,
+240,85,17,41,52,231,246,214,245,240,137,41,150,234,234,185,28,154,24,104,237,65,226,208,152,155,249,83,67,241,56,42,
+16,37,123,104,135,235,213,103,132,4,180,31,37,166,92,150,230,57,48,179,148,170,133,184,96,86,129,115,162,248,123,154,
+177,123,92,210,234,94,99,178,8,39,219,44,127,127,42,222,113,129,127,24,26,101,72,150,41,56,79,246,184,148,250,94,
+216,7,173,248,31,36,38,227,26,147,233,74,185,80,62,197,18,68,61,88,107,76,191,103,127,71,197,21,63,234,104,85,
+239,200,98,14,43,226,57,101,204,53,194,49,229,135,179,207,48,34,33,255,36,241,129,20,198,89,245,5,138,7,146,26,
+9,145,98,52,182,70,82,127,67,216,162,86,181,229,64,70,122,166,171,166,192,222,116,223,76,16,51,135,76,74,50,44,
+166,182,204,250,121,146,116,136,232,95,57,222,57,77,212,12,145,127,21,136,198,202,199,122,173,30,18,180,102,47,233,162,
+12,189,199,45,51,202,248,109,201,56,74,71,209,250,122,80,236,66,155,203,68,194,33,163,115,210,250,26,84,133,75,14,
+56,217,155,55,52,77,58,74,7,97,129,110,92,225,141,89,129,245,122,18,75,33,180,213,128,2,237,231,59,164,159,245,
+75,156,156,50,5,77,201,33,224,202,139,2,236,215,241,106,131,166,7,138,109,148,53,4,164,38,11,162,13,46,26,69,
+234,198,81,76,79,196,220,138,125,91,188,21,64,45,230,228,56,132,253,186,140,207,96,78,46,182,215,60,5,217,239,243,
+47,124,224,196,19,80,229,66,184,163,47,248,18,85,107,32,251,59,80,26,64,167,11,216,245,65,213,54,1,237,60,208,
+237,45,9,89,129,60,25,241,19,208,74,141,213,189,65,151,198,251,123,76,206,247,202,206,43,241,143,73,237,223,186,130,
+43,63,38,130,215,17,193,67,149,206,123,125,243,226,205,18,102,182,245,42,250,89,233,94,181,13,103,71,202,3,227,72,
+116,159,82,226,51,136,160,117,233,170,34,218,142,61,232,237,182,35,90,149,79,224,148,7,174,126,92,166,99,232,9,78,
+167,119,0,82,154,48,71,77,216,61,36,25,117,52,66,188,71,7,230,253,14,87,128,142,66,116,36,153,150,164,48,142,
+58,146,81,71,242,133,246,118,20,45,83,122,151,235,210,36,233,103,73,179,41,71,105,157,222,170,3,141,184,198,203,97,
+183,60,178,26,202,251,89,208,142,200,16,162,191,181,183,2,235,66,209,223,121,145,129,160,227,79,120,187,213,150,22,45,
+46,133,152,52,152,118,156,190,99,159,109,112,14,133,242,104,193,251,12,7,59,185,18,218,249,50,129,10,53,65,155,177,
+98,242,67,233,24,45,38,238,130,62,221,181,221,202,153,0,238,37,113,191,5,177,0,178,1,49,109,29,73,250,167,54,
+221,7,11,193,138,237,106,209,124,28,77,50,28,255,20,167,6,5,137,23,52,15,178,126,93,46,178,140,99,216,77,174,
+56,33,100,91,230,21,82,152,184,192,57,161,24,30,204,9,197,38,192,136,41,254,55,39,4,5,160,234,62,8,171,40,
+26,8,155,30,226,6,171,33,213,50,255,130,24,197,95,169,54,25,101,179,104,230,174,210,82,114,179,120,55,30,199,24,
+97,78,190,116,244,109,73,11,180,35,197,223,144,138,45,49,162,181,61,108,248,104,226,4,205,24,186,248,97,21,238,246,
+102,184,23,185,73,144,115,53,168,255,244,254,100,100,100,109,136,114,171,2,68,27,31,81,138,168,195,78,104,251,182,195,
+183,57,81,139,72,56,16,218,50,218,231,106,178,55,246,139,202,137,36,247,159,124,113,55,217,1,103,116,241,143,112,237,
+163,58,16,93,113,237,224,212,207,65,251,104,216,83,215,241,157,143,67,223,68,4,65,57,133,2,138,111,192,54,44,213,
+50,108,185,82,40,67,36,80,19,238,240,60,95,127,135,167,155,248,187,164,197,190,228,53,26,78,62,96,3,117,137,79,
+217,72,95,126,129,79,200,223,98,160,183,197,195,103,213,23,65,160,87,117,14,2,189,106,109,65,76,70,161,128,87,30,
+229,87,241,228,150,250,218,87,25,111,57,187,174,162,191,203,65,79,111,189,113,108,184,246,110,236,229,147,241,13,153,124,
+85,209,233,204,22,178,85,203,54,49,92,48,170,148,63,99,150,72,244,31,60,162,36,122,212,230,157,169,122,137,100,153,
+149,80,128,180,206,236,150,22,229,38,101,169,45,181,221,17,170,21,194,146,92,64,138,118,44,25,173,109,21,87,31,37,
+107,172,192,81,76,193,133,114,219,94,108,145,178,96,10,189,125,107,88,161,95,206,182,72,244,113,83,94,248,95,100,240,
+225,35,62,57,99,27,35,75,43,129,65,43,105,225,169,52,146,206,167,113,156,84,163,152,66,68,30,26,162,202,141,106,
+68,33,35,170,223,8,246,107,128,148,180,110,242,242,114,57,119,228,176,82,10,50,195,160,129,232,149,101,164,144,190,12,
+91,100,205,106,104,65,110,186,30,179,68,95,23,198,94,179,122,7,226,127,141,208,179,238,181,7,245,34,97,39,122,229,
+32,228,104,162,150,77,40,69,58,163,221,253,55,122,69,177,195,188,130,104,64,175,50,137,100,212,175,101,42,32,43,19,
+117,232,61,233,74,207,122,136,112,5,60,9,133,132,34,122,22,78,7,15,183,105,86,82,228,125,67,40,69,132,117,95,
+103,24,33,120,122,149,228,83,58,154,217,47,102,88,159,88,97,202,51,252,31,213,190,201,109,130,99,117,28,227,188,71,
+63,84,233,58,68,53,38,229,56,92,114,21,232,134,31,114,77,69,200,247,208,71,139,122,165,41,164,125,182,43,148,81,
+10,210,82,132,122,158,238,71,217,169,164,45,148,195,131,20,189,21,151,116,172,216,71,27,249,207,2,94,38,180,124,23,
+138,23,123,1,230,132,86,20,87,42,122,171,179,244,217,83,103,163,27,13,29,255,205,196,157,215,154,215,41,214,2,227,
+146,144,254,99,244,66,46,239,31,20,88,113,6,91,46,122,226,231,115,10,127,128,200,3,170,202,30,231,107,96,173,230,
+101,31,149,23,66,186,149,199,163,144,88,75,184,21,43,138,19,246,10,212,42,210,2,128,22,221,15,138,91,36,45,113,
+138,142,138,14,219,197,176,163,158,54,253,231,107,252,95,90,146,18,15,161,153,215,120,26,107,216,114,33,10,105,56,170,
+32,225,3,48,5,105,174,144,120,93,252,37,114,189,188,200,137,119,66,164,151,139,234,146,26,207,200,73,10,60,93,226,
+229,180,175,70,111,83,126,75,156,59,77,146,179,235,59,154,207,135,157,223,224,202,35,243,127,255,194,229,219,163,39,243,
+57,206,233,18,231,78,72,228,170,251,134,126,187,66,93,72,7,99,244,194,11,87,75,171,110,29,42,135,99,255,108,95,
+209,22,15,120,202,100,58,223,192,28,223,88,186,30,180,73,105,137,98,84,71,91,155,64,154,23,62,56,177,74,171,230,
+180,86,22,55,171,196,229,255,160,77,141,146,
+};
 
-;
+const uint8_t Comic_Sans_MS_38_L2_charmap [128] = {
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,33,32,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,32,53,32,54,32,
+32,55,56,57,58,59,60,32,61,62,32,32,63,64,65,66,67,32,68,69,70,71,32,32,72,32,32,73,32,74,75,32,
+32,76,77,78,79,80,81,82,83,84,32,85,86,87,88,89,90,32,91,92,93,94,32,32,95,32,96,32,97,32,98,32,
+};
 
 
 
 font_t font_Comic_Sans_MS_38_L2 = {
     .rom_font = false,
-    .ft81x_font_index = 0, // NOTE: This needs to be added
+    .ft81x_font_index = 0, // NOTE: This needs to be added at runtime
     .font_name = "Comic Sans\0",
     .font_format = 2,
     .font_size = 38,
@@ -1333,7 +179,9 @@ font_t font_Comic_Sans_MS_38_L2 = {
     .font_caps_height = 30,
     .font_x_width = 28,
     .pFontTable = Comic_Sans_MS_38_L2,
-    .fontTableSize = 40998
+    .fontTableSize = 28958,
+    .bitmapDeflatedSize = 4300,
+    .pCharMap = Comic_Sans_MS_38_L2_charmap
 };
 
-#endif
+#endif
\ No newline at end of file
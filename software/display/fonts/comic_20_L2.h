@@ -1,7 +1,7 @@
 /*
  * comic_20_L2.h
  *
- *  Created on: 2024-09-08 11:59:16
+ *  Created on: 2026-10-18 09:58:11
  *  
  * THIS IS AN AUTO GENERATED FILE.
  * DO NOT MODIFY
@@ -14,445 +14,83 @@
 #include <stdint.h>
 #include "font.h"
 
-const uint8_t comic_20_L2 [13258] = 
-/*Command Line: fnt_cvt.exe -f legacy -C BT81X -i C:/Users/oskar/Downloads/comic.ttf -s 20 -d 0 -c setfont2 -l 32 -g -r U+0020-U+007E -o C:/git/ComSciCalculator/utils/fontConverter/input_files -O 1234*/ 
-
-/*95 characters have been converted */
-
-/* 148 Metric Block Begin +++  */
-/*('file properties ', 'format ', 'L2', ' stride ', 6, ' width ', 22, 'height', 23)*/ 
-{ 
-/* Widths */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,5,8,17,14,16,13,8,7,7,11,10,6,8,5,10,12,9,12,12,12,12,12,12,12,12,6,6,8,10,8,10,19,15,13,12,14,12,12,14,15,11,13,13,11,18,16,16,10,18,13,14,15,15,13,21,14,13,14,8,11,8,12,14,11,10,12,10,12,11,10,11,12,6,9,11,5,16,10,11,11,10,10,10,9,10,10,14,12,11,11,7,8,7,12,0,
-/* Format */
-17,0,0,0,
-/* Stride */
-6,0,0,0,
-/* Max Width */
-22,0,0,0,
-/* Max Height */
-23,0,0,0,
-/* Raw Data Address in Decimal: <148> */ 
-148,0,0,0,
-
-/* 148 Metric Block End ---  */
-
-/*Bitmap Raw Data begin +++*/
-/*The expected raw bitmap size is 13110 Bytes */
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,
-0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,
-45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,28,0,
-0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-40,56,0,0,0,0,44,56,0,0,0,0,60,56,0,0,0,0,60,56,0,0,0,0,60,56,0,0,0,0,40,52,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,10,0,52,0,0,0,30,0,180,0,0,0,45,0,240,0,0,47,255,255,255,
-64,0,47,255,255,255,64,0,0,116,2,192,0,0,0,176,3,128,0,0,0,240,7,128,0,0,1,224,11,64,0,0,
-127,255,255,253,0,0,191,255,255,253,0,0,7,128,30,0,0,0,7,64,45,0,0,0,11,0,60,0,0,0,10,0,
-56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,29,0,0,0,0,0,127,228,0,0,0,2,255,252,0,0,0,
-11,157,0,0,0,0,15,29,0,0,0,0,31,29,0,0,0,0,15,93,0,0,0,0,11,255,144,0,0,0,1,191,
-248,0,0,0,0,30,126,0,0,0,0,29,31,0,0,0,0,29,15,0,0,0,56,29,30,0,0,0,62,94,189,0,
-0,0,47,255,248,0,0,0,6,255,144,0,0,0,0,29,0,0,0,0,0,29,0,0,0,0,0,13,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,6,224,
-15,0,0,0,15,252,29,0,0,0,29,45,44,0,0,0,29,29,120,0,0,0,15,252,176,0,0,0,7,229,224,0,
-0,0,0,2,208,0,0,0,0,3,128,0,0,0,0,11,64,0,0,0,0,14,7,228,0,0,0,45,31,253,0,0,
-0,56,45,30,0,0,0,116,44,30,0,0,0,240,31,253,0,0,0,208,7,228,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,11,128,0,0,0,0,46,208,0,0,0,0,120,224,0,0,0,0,121,208,0,0,0,
-0,63,192,0,0,0,0,63,0,0,0,0,1,254,9,0,0,0,11,219,14,0,0,0,30,7,142,0,0,0,60,2,
-238,0,0,0,120,1,253,0,0,0,120,0,188,0,0,0,62,6,253,0,0,0,31,255,222,0,0,0,6,254,11,64,
-0,0,0,0,7,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,64,0,0,0,0,7,128,0,0,0,0,7,128,
-0,0,0,0,7,128,0,0,0,0,3,128,0,0,0,0,3,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,244,0,0,
-0,0,2,224,0,0,0,0,7,128,0,0,0,0,11,64,0,0,0,0,15,0,0,0,0,0,30,0,0,0,0,0,
-45,0,0,0,0,0,45,0,0,0,0,0,60,0,0,0,0,0,60,0,0,0,0,0,60,0,0,0,0,0,45,0,
-0,0,0,0,45,0,0,0,0,0,30,0,0,0,0,0,15,0,0,0,0,0,11,128,0,0,0,0,7,208,0,0,
-0,0,1,244,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-40,0,0,0,0,0,47,0,0,0,0,0,11,128,0,0,0,0,3,208,0,0,0,0,1,224,0,0,0,0,0,240,
-0,0,0,0,0,180,0,0,0,0,0,120,0,0,0,0,0,120,0,0,0,0,0,120,0,0,0,0,0,120,0,0,
-0,0,0,120,0,0,0,0,0,120,0,0,0,0,0,120,0,0,0,0,0,180,0,0,0,0,0,240,0,0,0,0,
-2,224,0,0,0,0,7,192,0,0,0,0,31,64,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,0,0,224,0,0,0,0,122,251,208,0,0,0,127,255,128,0,
-0,0,7,248,0,0,0,0,11,189,0,0,0,0,30,31,0,0,0,0,40,11,64,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,0,0,0,0,1,208,
-0,0,0,0,1,208,0,0,0,0,127,255,128,0,0,0,127,255,128,0,0,0,1,208,0,0,0,0,1,208,0,0,
-0,0,1,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,128,0,0,0,0,3,128,
-0,0,0,0,11,64,0,0,0,0,15,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,253,
-0,0,0,0,47,249,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,
-0,0,0,1,208,0,0,0,0,3,192,0,0,0,0,7,128,0,0,0,0,11,64,0,0,0,0,14,0,0,0,0,
-0,45,0,0,0,0,0,60,0,0,0,0,0,180,0,0,0,0,0,240,0,0,0,0,2,208,0,0,0,0,3,128,
-0,0,0,0,11,64,0,0,0,0,14,0,0,0,0,0,45,0,0,0,0,0,60,0,0,0,0,0,52,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,1,190,64,0,0,0,7,255,224,0,0,0,15,129,244,0,0,0,46,0,
-60,0,0,0,60,0,45,0,0,0,120,0,45,0,0,0,120,0,30,0,0,0,120,0,29,0,0,0,120,0,45,0,
-0,0,120,0,45,0,0,0,60,0,60,0,0,0,45,0,120,0,0,0,31,65,244,0,0,0,11,255,224,0,0,0,
-1,190,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,0,0,0,2,240,0,0,
-0,0,15,240,0,0,0,0,29,176,0,0,0,0,0,240,0,0,0,0,0,240,0,0,0,0,0,240,0,0,0,0,
-0,240,0,0,0,0,0,224,0,0,0,0,1,224,0,0,0,0,1,224,0,0,0,0,0,224,0,0,0,0,0,224,
-0,0,0,0,31,254,0,0,0,0,31,254,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,191,64,0,0,0,7,255,224,0,0,0,15,145,244,0,0,0,29,0,120,0,0,0,0,0,180,0,0,0,0,1,
-244,0,0,0,0,7,224,0,0,0,0,47,128,0,0,0,1,253,0,0,0,0,7,224,0,0,0,0,15,64,0,0,
-0,0,30,0,0,0,0,0,30,0,0,0,0,0,31,255,228,0,0,0,15,255,248,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,1,190,64,0,0,0,11,255,208,0,0,0,14,65,240,0,0,0,0,0,180,0,
-0,0,0,0,176,0,0,0,0,22,224,0,0,0,0,255,128,0,0,0,0,111,208,0,0,0,0,2,240,0,0,0,
-0,0,180,0,0,0,0,0,120,0,0,0,29,0,180,0,0,0,31,65,240,0,0,0,11,255,208,0,0,0,1,190,
-64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,208,0,0,0,0,11,208,0,0,0,
-0,31,208,0,0,0,0,62,208,0,0,0,0,181,208,0,0,0,1,225,208,0,0,0,3,193,208,0,0,0,11,65,
-208,0,0,0,30,1,208,0,0,0,127,255,253,0,0,0,127,255,253,0,0,0,0,1,208,0,0,0,0,1,208,0,
-0,0,0,2,208,0,0,0,0,1,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,
-248,0,0,0,31,255,244,0,0,0,14,0,0,0,0,0,30,0,0,0,0,0,30,191,144,0,0,0,31,255,244,0,
-0,0,31,208,184,0,0,0,47,0,60,0,0,0,29,0,45,0,0,0,0,0,45,0,0,0,0,0,60,0,0,0,
-44,0,120,0,0,0,46,66,244,0,0,0,15,255,208,0,0,0,2,254,64,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,62,0,0,0,0,0,248,0,0,0,0,3,224,0,0,0,0,
-11,128,0,0,0,0,15,0,0,0,0,0,31,191,128,0,0,0,47,255,240,0,0,0,46,65,248,0,0,0,60,0,
-120,0,0,0,44,0,56,0,0,0,45,0,120,0,0,0,31,65,244,0,0,0,11,255,224,0,0,0,1,190,64,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,255,254,0,0,0,47,255,254,0,0,0,0,0,
-184,0,0,0,0,1,224,0,0,0,0,3,192,0,0,0,0,11,128,0,0,0,0,15,0,0,0,0,0,46,0,0,
-0,0,0,61,0,0,0,0,0,120,0,0,0,0,0,180,0,0,0,0,0,240,0,0,0,0,2,224,0,0,0,0,
-3,192,0,0,0,0,3,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,64,0,
-0,0,7,255,224,0,0,0,15,65,240,0,0,0,30,0,180,0,0,0,30,0,176,0,0,0,15,134,240,0,0,0,
-7,255,128,0,0,0,7,255,208,0,0,0,15,150,244,0,0,0,46,0,120,0,0,0,44,0,60,0,0,0,45,0,
-124,0,0,0,46,65,184,0,0,0,15,255,240,0,0,0,2,190,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,1,191,64,0,0,0,11,255,224,0,0,0,31,65,248,0,0,0,45,0,124,0,0,0,60,0,
-61,0,0,0,60,0,45,0,0,0,45,0,44,0,0,0,31,65,188,0,0,0,11,255,248,0,0,0,1,190,184,0,
-0,0,0,0,244,0,0,0,0,2,224,0,0,0,0,11,192,0,0,0,0,127,64,0,0,0,11,248,0,0,0,0,
-11,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,31,0,0,0,0,0,14,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,15,0,0,0,0,0,10,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,15,0,
-0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,10,0,0,0,0,0,30,0,0,0,0,0,60,0,0,0,0,0,52,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,176,0,0,0,0,2,224,0,0,0,0,11,128,0,0,0,0,126,0,0,0,0,0,189,0,0,0,0,0,
-31,64,0,0,0,0,3,208,0,0,0,0,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,47,255,64,0,0,0,63,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,47,255,64,0,0,0,47,255,64,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,30,0,0,0,0,0,1,128,0,0,
-0,0,0,180,0,0,0,0,2,252,0,0,0,0,11,244,0,0,0,0,47,208,0,0,0,0,126,0,0,0,0,0,
-116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,11,228,0,0,0,0,127,253,0,0,0,0,120,31,64,0,0,0,0,3,128,0,0,0,
-0,2,208,0,0,0,0,2,208,0,0,0,0,7,208,0,0,0,0,31,192,0,0,0,0,191,128,0,0,0,2,254,
-0,0,0,0,7,208,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,11,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,27,254,64,0,0,0,191,255,224,0,0,2,249,5,253,0,0,7,208,0,47,0,0,15,65,
-240,11,128,0,30,11,240,7,192,0,45,47,64,3,192,0,45,61,29,3,192,0,60,120,45,3,192,0,60,60,125,11,
-128,0,45,47,255,255,64,0,30,11,151,249,0,0,15,64,0,0,0,0,7,208,0,0,0,0,1,249,1,180,0,0,
-0,127,255,244,0,0,0,6,254,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,0,0,0,0,0,244,0,
-0,0,0,2,248,0,0,0,0,7,248,0,0,0,0,15,124,0,0,0,0,46,60,0,0,0,0,60,45,0,0,0,
-0,184,46,0,0,0,0,250,254,0,0,0,3,255,255,0,0,0,7,229,15,64,0,0,11,64,11,64,0,0,15,0,
-7,128,0,0,46,0,3,192,0,0,44,0,2,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-6,254,64,0,0,0,11,255,208,0,0,0,11,66,244,0,0,0,11,64,120,0,0,0,11,0,120,0,0,0,15,0,
-184,0,0,0,15,6,240,0,0,0,15,255,208,0,0,0,15,255,244,0,0,0,15,1,189,0,0,0,14,0,30,0,
-0,0,14,0,46,0,0,0,14,6,252,0,0,0,15,255,224,0,0,0,11,250,64,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,11,253,0,0,0,0,63,254,0,0,0,0,249,30,0,0,0,2,224,9,0,
-0,0,7,192,0,0,0,0,15,64,0,0,0,0,30,0,0,0,0,0,45,0,0,0,0,0,60,0,0,0,0,0,
-60,0,0,0,0,0,60,0,0,0,0,0,61,0,44,0,0,0,31,65,252,0,0,0,11,255,224,0,0,0,1,254,
-64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,64,0,0,0,0,15,249,0,0,0,0,
-15,111,144,0,0,0,15,2,244,0,0,0,15,0,126,0,0,0,15,0,11,64,0,0,15,0,3,192,0,0,15,0,
-2,208,0,0,15,0,2,208,0,0,15,0,2,208,0,0,15,0,3,192,0,0,30,0,11,128,0,0,31,64,111,0,
-0,0,15,255,253,0,0,0,1,191,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,191,
-249,0,0,0,31,255,254,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,
-0,0,30,22,188,0,0,0,47,255,252,0,0,0,47,233,64,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,
-45,0,0,0,0,0,30,0,0,0,0,0,31,255,248,0,0,0,6,255,248,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,15,255,228,0,0,0,31,255,254,0,0,0,14,0,29,0,0,0,14,0,0,0,0,0,
-14,0,0,0,0,0,30,0,0,0,0,0,30,111,244,0,0,0,31,255,244,0,0,0,31,144,0,0,0,0,30,0,
-0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,13,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,228,0,0,0,0,127,254,0,0,0,1,244,
-30,0,0,0,3,208,0,0,0,0,11,128,0,0,0,0,31,0,0,0,0,0,45,0,0,0,0,0,60,22,191,192,
-0,0,60,127,255,192,0,0,120,121,75,64,0,0,120,0,15,0,0,0,60,0,62,0,0,0,46,1,252,0,0,0,
-31,255,224,0,0,0,6,254,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,112,
-0,0,14,0,0,180,0,0,14,0,0,176,0,0,30,0,0,176,0,0,30,0,0,176,0,0,30,0,0,240,0,0,
-30,0,0,240,0,0,30,5,175,240,0,0,31,255,255,224,0,0,31,249,80,224,0,0,30,0,0,224,0,0,30,0,
-0,240,0,0,29,0,0,240,0,0,29,0,0,240,0,0,29,0,0,160,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,63,254,160,0,0,0,63,255,244,0,0,0,0,181,80,0,0,0,0,240,0,0,0,0,0,240,
-0,0,0,0,0,240,0,0,0,0,0,240,0,0,0,0,0,240,0,0,0,0,0,240,0,0,0,0,0,240,0,0,
-0,0,0,240,0,0,0,0,0,240,0,0,0,0,0,240,0,0,0,0,47,255,240,0,0,0,47,255,224,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,255,255,64,0,0,1,255,255,128,0,0,0,2,208,0,
-0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,
-0,2,192,0,0,0,56,3,192,0,0,0,60,3,192,0,0,0,61,3,128,0,0,0,31,135,64,0,0,0,7,255,
-0,0,0,0,1,189,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,29,0,0,0,
-11,64,125,0,0,0,11,64,248,0,0,0,11,67,224,0,0,0,11,15,128,0,0,0,11,110,0,0,0,0,11,248,
-0,0,0,0,11,224,0,0,0,0,11,244,0,0,0,0,15,189,0,0,0,0,15,47,64,0,0,0,15,11,208,0,
-0,0,15,2,248,0,0,0,15,0,191,0,0,0,11,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,29,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,
-0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,44,0,0,0,0,0,
-44,0,0,0,0,0,60,0,0,0,0,0,60,0,0,0,0,0,63,255,244,0,0,0,47,255,244,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,0,160,0,0,0,244,1,244,0,0,1,248,2,244,0,0,
-2,252,2,248,0,0,2,252,3,184,0,0,3,237,7,124,0,0,3,157,11,44,0,0,7,158,11,44,0,0,11,78,
-14,29,0,0,15,11,29,30,0,0,31,11,108,14,0,0,30,7,120,15,0,0,45,3,244,11,64,0,45,3,240,11,
-128,0,60,2,224,7,128,0,40,1,208,2,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,116,0,0,47,0,
-0,184,0,0,47,128,0,124,0,0,47,208,0,60,0,0,46,244,0,60,0,0,45,124,0,60,0,0,45,30,0,60,
-0,0,45,11,128,60,0,0,45,2,224,60,0,0,45,0,244,60,0,0,45,0,125,44,0,0,45,0,31,108,0,0,
-45,0,7,252,0,0,45,0,1,252,0,0,28,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,11,254,64,0,0,0,127,255,224,0,0,1,249,6,244,0,0,7,208,0,120,0,0,11,128,0,60,0,0,
-31,0,0,60,0,0,46,0,0,60,0,0,45,0,0,60,0,0,44,0,0,120,0,0,45,0,0,184,0,0,45,0,
-1,240,0,0,31,64,3,224,0,0,11,208,31,128,0,0,2,255,254,0,0,0,0,111,228,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,27,249,0,0,0,0,47,255,64,0,0,0,45,7,208,0,0,0,44,1,
-224,0,0,0,44,0,224,0,0,0,44,1,224,0,0,0,44,27,208,0,0,0,63,255,64,0,0,0,63,248,0,0,
-0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,
-40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,254,64,0,0,0,191,255,224,
-0,0,2,249,1,248,0,0,11,192,0,125,0,0,31,0,0,30,0,0,61,0,0,15,0,0,60,0,0,11,64,0,
-120,0,0,11,64,0,120,0,0,11,64,0,60,0,64,11,64,0,46,1,240,15,0,0,15,128,184,46,0,0,7,228,
-62,252,0,0,1,255,255,224,0,0,0,27,250,244,0,0,0,0,0,190,0,0,0,0,0,47,128,0,0,0,0,11,
-192,0,0,0,0,2,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-31,228,0,0,0,0,47,255,64,0,0,0,45,27,224,0,0,0,45,1,248,0,0,0,29,0,60,0,0,0,45,0,
-45,0,0,0,45,0,124,0,0,0,45,6,248,0,0,0,47,255,208,0,0,0,62,254,0,0,0,0,60,47,128,0,
-0,0,45,7,240,0,0,0,45,0,189,0,0,0,45,0,47,0,0,0,28,0,10,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,27,249,0,0,0,0,127,255,0,0,0,1,244,0,0,0,0,3,192,0,0,
-0,0,7,128,0,0,0,0,7,212,0,0,0,0,2,255,228,0,0,0,0,191,254,0,0,0,0,0,111,128,0,0,
-0,0,7,128,0,0,0,0,3,192,0,0,29,0,11,128,0,0,47,64,111,64,0,0,15,255,253,0,0,0,1,191,
-144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,47,255,255,160,0,0,27,255,255,244,0,0,
-0,11,64,64,0,0,0,11,64,0,0,0,0,11,64,0,0,0,0,11,64,0,0,0,0,11,64,0,0,0,0,7,
-64,0,0,0,0,7,128,0,0,0,0,7,128,0,0,0,0,7,128,0,0,0,0,7,128,0,0,0,0,7,128,0,
-0,0,0,7,128,0,0,0,0,3,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,
-0,208,0,0,30,0,1,224,0,0,30,0,1,224,0,0,30,0,1,224,0,0,30,0,1,224,0,0,30,0,2,208,
-0,0,30,0,2,208,0,0,30,0,2,208,0,0,30,0,3,208,0,0,30,0,3,192,0,0,15,0,7,128,0,0,
-11,128,15,64,0,0,7,224,111,0,0,0,2,255,253,0,0,0,0,111,224,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,29,0,2,128,0,0,46,0,11,128,0,0,30,0,15,64,0,0,15,0,30,0,0,0,
-11,64,45,0,0,0,7,128,60,0,0,0,7,192,120,0,0,0,3,192,180,0,0,0,2,208,240,0,0,0,1,226,
-224,0,0,0,0,243,208,0,0,0,0,187,192,0,0,0,0,127,64,0,0,0,0,63,0,0,0,0,0,46,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,10,0,7,64,30,0,31,0,15,64,15,0,
-63,64,31,0,11,64,127,64,30,0,7,128,123,128,45,0,7,192,183,128,60,0,3,192,243,128,116,0,2,209,226,192,
-240,0,1,210,210,209,224,0,0,227,193,210,208,0,0,247,129,227,128,0,0,187,64,231,64,0,0,127,0,251,0,0,
-0,126,0,190,0,0,0,61,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,208,
-0,0,47,64,3,224,0,0,11,192,11,128,0,0,2,224,47,0,0,0,0,248,125,0,0,0,0,125,244,0,0,0,
-0,31,224,0,0,0,0,15,192,0,0,0,0,47,224,0,0,0,0,189,244,0,0,0,1,244,124,0,0,0,7,208,
-46,0,0,0,31,64,15,128,0,0,61,0,7,208,0,0,56,0,1,208,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,112,0,10,0,0,0,184,0,31,0,0,0,61,0,61,0,0,0,31,0,124,0,0,0,11,128,
-180,0,0,0,3,192,240,0,0,0,2,226,224,0,0,0,0,247,208,0,0,0,0,127,192,0,0,0,0,47,64,0,
-0,0,0,31,0,0,0,0,0,45,0,0,0,0,0,124,0,0,0,0,0,180,0,0,0,0,1,224,0,0,0,0,
-0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,255,255,208,0,0,63,255,255,208,0,0,0,0,47,64,
-0,0,0,0,184,0,0,0,0,2,224,0,0,0,0,11,128,0,0,0,0,31,0,0,0,0,0,125,0,0,0,0,
-0,180,0,0,0,0,2,224,0,0,0,0,7,192,0,0,0,0,15,64,0,0,0,0,45,0,0,0,0,0,127,255,
-255,208,0,0,127,255,255,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,244,0,0,0,0,15,244,0,0,0,0,
-14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,
-0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,
-0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,29,0,0,0,0,0,29,0,0,0,0,0,
-31,248,0,0,0,0,15,248,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,13,0,0,0,0,0,15,0,0,0,0,0,11,128,0,0,0,0,3,192,0,0,0,0,2,208,0,0,
-0,0,0,240,0,0,0,0,0,180,0,0,0,0,0,120,0,0,0,0,0,60,0,0,0,0,0,29,0,0,0,0,
-0,15,0,0,0,0,0,11,64,0,0,0,0,7,128,0,0,0,0,3,192,0,0,0,0,1,224,0,0,0,0,0,
-160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,11,248,0,0,0,0,11,248,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,
-0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,
-0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,56,0,0,
-0,0,0,56,0,0,0,0,0,56,0,0,0,0,0,60,0,0,0,0,15,252,0,0,0,0,15,248,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,190,0,0,0,0,2,235,
-128,0,0,0,11,130,224,0,0,0,14,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,127,255,255,240,0,0,127,255,255,240,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,29,0,0,0,0,0,31,0,0,0,0,0,7,192,0,0,0,0,2,208,0,0,0,0,0,208,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,64,0,0,0,11,255,192,0,0,0,
-47,67,192,0,0,0,60,3,192,0,0,0,120,3,192,0,0,0,116,3,192,0,0,0,120,2,192,0,0,0,125,7,
-208,0,0,0,47,255,224,0,0,0,11,248,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,
-29,0,0,0,0,0,29,0,0,0,0,0,29,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,190,
-64,0,0,0,47,255,224,0,0,0,31,65,244,0,0,0,29,0,120,0,0,0,29,0,60,0,0,0,29,0,60,0,
-0,0,29,0,120,0,0,0,30,65,244,0,0,0,31,255,208,0,0,0,30,254,64,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,1,190,0,0,0,0,7,255,192,0,0,0,15,130,192,0,0,0,30,0,0,0,0,0,
-44,0,0,0,0,0,60,0,0,0,0,0,60,0,0,0,0,0,46,66,208,0,0,0,15,255,208,0,0,0,2,254,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,56,0,0,0,0,0,56,0,0,0,
-0,0,120,0,0,0,0,0,120,0,0,0,0,0,116,0,0,0,1,190,116,0,0,0,11,255,244,0,0,0,31,65,
-244,0,0,0,45,0,180,0,0,0,60,0,180,0,0,0,56,0,180,0,0,0,60,0,180,0,0,0,47,65,244,0,
-0,0,11,255,244,0,0,0,1,254,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,254,64,0,
-0,0,11,255,208,0,0,0,30,66,224,0,0,0,44,27,192,0,0,0,58,254,0,0,0,0,63,224,0,0,0,0,
-62,0,36,0,0,0,45,1,180,0,0,0,31,255,224,0,0,0,2,254,64,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,31,192,0,0,0,0,191,192,0,0,0,0,248,0,0,0,0,1,224,0,0,0,0,1,208,0,0,0,0,
-2,208,0,0,0,0,47,255,128,0,0,0,63,255,128,0,0,0,2,192,0,0,0,0,2,192,0,0,0,0,2,192,
-0,0,0,0,2,192,0,0,0,0,2,192,0,0,0,0,2,192,0,0,0,0,3,192,0,0,0,0,2,128,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,191,64,0,0,0,11,255,224,0,0,0,47,65,240,0,
-0,0,60,1,224,0,0,0,120,1,224,0,0,0,120,2,208,0,0,0,120,3,208,0,0,0,61,30,208,0,0,0,
-47,250,208,0,0,0,7,226,192,0,0,0,0,2,192,0,0,0,0,3,192,0,0,0,0,7,128,0,0,0,16,31,
-64,0,0,0,127,254,0,0,0,0,47,248,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,30,0,0,0,
-0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,47,128,0,0,0,
-30,255,224,0,0,0,31,225,224,0,0,0,31,128,240,0,0,0,31,0,240,0,0,0,30,0,240,0,0,0,30,0,
-240,0,0,0,30,0,180,0,0,0,29,0,180,0,0,0,29,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,14,0,0,0,0,0,15,0,0,0,0,0,14,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,
-0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,14,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,0,0,0,0,0,116,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,60,0,0,0,0,0,60,0,0,0,0,
-0,60,0,0,0,0,0,60,0,0,0,0,0,60,0,0,0,0,0,60,0,0,0,0,0,45,0,0,0,0,0,45,
-0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,52,45,0,0,0,0,60,45,0,0,0,0,46,61,0,0,
-0,0,15,248,0,0,0,0,2,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,
-14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,160,0,0,0,14,1,240,0,0,0,14,7,
-224,0,0,0,30,31,128,0,0,0,30,126,0,0,0,0,31,253,0,0,0,0,31,239,0,0,0,0,31,11,128,0,
-0,0,30,3,208,0,0,0,30,1,240,0,0,0,29,0,180,0,0,0,4,0,32,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,
-0,0,0,0,15,0,0,0,0,0,15,0,0,0,0,0,15,0,0,0,0,0,15,0,0,0,0,0,15,0,0,0,
-0,0,15,0,0,0,0,0,15,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,
-30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,13,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,28,46,31,128,0,0,45,255,255,224,0,0,46,235,229,224,0,0,47,71,
-128,240,0,0,45,7,128,176,0,0,45,7,128,180,0,0,45,3,128,180,0,0,44,3,192,120,0,0,45,3,192,120,
-0,0,28,2,128,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,47,64,0,0,0,46,255,192,0,
-0,0,47,210,208,0,0,0,47,65,208,0,0,0,47,1,208,0,0,0,45,2,208,0,0,0,45,1,208,0,0,0,
-44,1,224,0,0,0,45,1,224,0,0,0,28,0,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-1,254,0,0,0,0,11,255,128,0,0,0,31,71,192,0,0,0,61,2,208,0,0,0,60,1,208,0,0,0,120,1,
-208,0,0,0,60,2,208,0,0,0,46,11,192,0,0,0,31,255,64,0,0,0,2,249,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,28,0,0,0,0,0,45,190,0,0,0,0,47,255,192,0,0,0,47,66,208,0,0,0,45,1,224,0,
-0,0,45,0,224,0,0,0,45,0,224,0,0,0,45,1,224,0,0,0,46,7,208,0,0,0,47,255,128,0,0,0,
-47,254,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,
-0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,190,192,0,0,0,11,255,208,0,0,0,
-31,130,192,0,0,0,61,2,192,0,0,0,120,2,192,0,0,0,120,3,192,0,0,0,120,3,192,0,0,0,62,11,
-128,0,0,0,31,255,128,0,0,0,6,255,128,0,0,0,0,7,64,0,0,0,0,11,64,0,0,0,0,11,64,0,
-0,0,0,11,64,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,47,
-64,0,0,0,45,255,192,0,0,0,47,211,192,0,0,0,46,2,128,0,0,0,45,0,0,0,0,0,45,0,0,0,
-0,0,45,0,0,0,0,0,45,0,0,0,0,0,45,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,91,64,0,0,0,7,255,128,0,0,0,47,147,128,0,0,0,45,0,0,0,0,0,
-31,228,0,0,0,0,5,190,0,0,0,0,0,11,64,0,0,0,116,11,128,0,0,0,127,255,64,0,0,0,27,249,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,208,0,0,0,0,
-1,208,0,0,0,0,1,224,0,0,0,0,1,224,0,0,0,0,127,255,128,0,0,0,47,255,128,0,0,0,1,224,
-0,0,0,0,1,224,0,0,0,0,1,224,0,0,0,0,1,224,0,0,0,0,0,224,0,0,0,0,0,224,0,0,
-0,0,1,224,0,0,0,0,0,208,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,1,208,0,
-0,0,45,1,208,0,0,0,60,2,208,0,0,0,60,2,208,0,0,0,60,2,208,0,0,0,60,2,208,0,0,0,
-44,2,208,0,0,0,45,6,208,0,0,0,31,255,208,0,0,0,7,250,208,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,116,1,208,0,0,0,120,2,208,0,0,0,61,3,192,0,0,0,30,11,128,0,0,0,15,15,
-0,0,0,0,11,94,0,0,0,0,7,173,0,0,0,0,3,248,0,0,0,0,1,244,0,0,0,0,0,240,0,0,
-0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,10,2,192,0,0,120,31,3,192,0,0,60,47,71,128,
-0,0,60,63,71,64,0,0,44,119,139,0,0,0,45,178,142,0,0,0,30,226,222,0,0,0,15,193,237,0,0,0,
-11,129,248,0,0,0,7,64,180,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,44,0,0,0,
-15,64,188,0,0,0,7,210,240,0,0,0,1,251,128,0,0,0,0,190,0,0,0,0,0,254,0,0,0,0,3,239,
-64,0,0,0,31,135,208,0,0,0,62,1,244,0,0,0,116,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,40,0,40,0,0,0,45,0,120,0,0,0,31,0,244,0,0,0,11,129,240,0,0,0,7,194,208,0,
-0,0,2,231,192,0,0,0,1,251,64,0,0,0,0,191,0,0,0,0,0,62,0,0,0,0,0,60,0,0,0,0,
-0,120,0,0,0,0,0,244,0,0,0,0,1,224,0,0,0,0,2,208,0,0,0,0,3,192,0,0,0,0,2,128,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,255,240,0,0,0,31,255,240,0,0,0,0,3,208,0,0,0,
-0,11,64,0,0,0,0,46,0,0,0,0,0,120,0,0,0,0,1,240,0,0,0,0,7,208,0,0,0,0,31,255,
-224,0,0,0,47,255,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,244,0,0,0,0,7,248,0,0,0,0,
-11,64,0,0,0,0,15,0,0,0,0,0,14,0,0,0,0,0,14,0,0,0,0,0,15,0,0,0,0,0,15,0,
-0,0,0,0,14,0,0,0,0,0,125,0,0,0,0,0,248,0,0,0,0,0,125,0,0,0,0,0,30,0,0,0,
-0,0,14,0,0,0,0,0,30,0,0,0,0,0,30,0,0,0,0,0,15,0,0,0,0,0,11,64,0,0,0,0,
-7,244,0,0,0,0,1,244,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,192,
-0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,
-0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,
-2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,2,208,
-0,0,0,0,2,208,0,0,0,0,2,208,0,0,0,0,1,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,189,0,0,0,0,0,191,64,0,0,0,0,7,128,0,0,0,0,3,128,0,0,0,0,
-3,192,0,0,0,0,3,192,0,0,0,0,3,128,0,0,0,0,3,128,0,0,0,0,3,192,0,0,0,0,2,244,
-0,0,0,0,0,248,0,0,0,0,1,244,0,0,0,0,2,208,0,0,0,0,2,192,0,0,0,0,2,192,0,0,
-0,0,2,192,0,0,0,0,3,192,0,0,0,0,11,128,0,0,0,0,191,0,0,0,0,0,189,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,224,0,0,0,0,11,244,28,0,
-0,0,30,46,60,0,0,0,60,31,248,0,0,0,40,7,224,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
-/*Bitmap Raw Data end ---*/
-} 
+const uint8_t comic_20_L2 [2060] = 
+{
+/* Metric block */
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+6,13,7,7,11,10,6,8,5,10,12,9,12,12,12,12,12,12,12,12,6,8,8,15,13,12,14,12,12,15,11,11,
+18,16,16,10,13,14,15,15,14,8,8,12,10,12,10,12,11,10,11,12,6,11,5,16,10,11,11,10,10,9,10,12,
+11,8,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+17,0,0,0,6,0,0,0,22,0,0,0,23,0,0,0,148,0,0,0,
+/* Deflated bitmap */
+120,218,205,90,59,111,219,86,20,230,35,17,145,18,33,59,101,177,196,219,161,131,11,136,228,210,193,40,104,139,118,135,
+108,69,246,254,133,0,234,160,65,45,236,74,205,208,110,133,139,2,221,90,228,31,212,131,3,120,176,99,245,31,8,105,
+183,2,133,82,36,67,17,180,209,160,65,118,100,177,60,223,97,200,107,49,150,69,90,110,195,225,131,204,215,61,247,60,
+190,243,160,21,229,173,60,204,46,161,215,39,108,15,8,63,199,239,70,15,72,160,78,111,209,141,191,91,49,58,198,183,
+49,6,218,63,116,187,122,70,168,28,198,184,81,161,223,34,250,35,198,202,212,12,233,57,35,92,80,134,85,224,136,64,
+131,8,6,132,226,183,216,184,232,0,93,9,131,28,202,87,249,126,91,218,162,129,109,169,88,37,22,122,142,32,190,244,
+148,206,79,65,42,101,8,220,151,222,176,8,238,103,207,38,187,131,106,5,118,247,193,69,58,193,186,10,238,255,226,21,
+253,209,137,72,32,99,12,217,142,176,71,1,153,205,240,255,247,34,214,146,132,44,45,163,154,187,250,182,29,26,219,58,
+231,117,183,151,186,138,127,6,60,81,222,242,195,145,176,200,177,155,25,88,239,205,134,177,149,11,93,57,46,250,179,250,
+207,223,254,97,65,105,212,199,244,34,35,162,16,178,191,162,176,247,240,166,0,111,109,39,232,0,107,210,25,23,247,4,
+88,157,2,88,108,210,179,38,222,195,239,44,124,236,97,143,216,169,13,172,237,73,124,146,199,65,198,57,9,243,72,40,
+166,25,22,62,142,37,157,124,71,251,170,201,36,197,228,104,96,25,31,145,123,150,157,176,195,89,223,16,209,51,58,31,
+141,75,8,194,154,52,35,50,188,181,41,19,43,84,115,7,75,130,61,148,102,63,83,159,68,190,53,252,22,120,150,223,
+83,210,58,236,124,38,80,0,55,128,143,240,206,167,132,250,47,132,230,38,161,163,50,27,159,165,120,142,218,180,242,52,
+39,160,73,17,141,82,255,79,180,125,188,155,158,23,253,3,100,168,0,26,152,205,135,117,104,198,219,26,193,46,36,131,
+54,45,165,147,119,128,27,64,152,87,31,100,57,145,185,81,28,211,31,126,68,250,247,54,199,144,160,13,25,214,150,24,
+59,157,104,138,85,216,221,15,178,144,96,134,145,5,242,128,235,243,50,47,63,196,60,83,216,99,229,216,129,215,57,88,
+192,129,199,218,95,15,113,21,57,26,154,183,127,96,206,97,157,48,159,108,67,87,7,176,14,221,175,149,210,9,75,194,
+90,21,208,60,191,57,192,230,153,223,220,120,77,186,122,136,59,199,208,255,193,108,153,101,66,29,29,188,109,156,169,115,
+89,7,251,176,144,126,95,116,143,45,57,221,181,28,123,210,166,177,199,47,113,250,72,201,42,49,174,244,148,135,215,37,
+194,170,20,209,106,55,243,79,109,2,169,96,22,191,159,201,214,90,194,154,159,73,22,135,129,185,124,180,183,17,47,200,
+171,1,216,227,0,193,115,74,81,166,71,17,221,248,156,248,222,12,41,27,219,72,228,30,162,167,174,104,189,226,114,84,
+166,25,219,155,96,39,51,164,184,48,17,29,54,226,218,174,12,83,214,178,193,117,182,122,4,15,113,128,36,161,85,153,
+224,42,25,210,60,45,197,108,38,24,187,1,62,57,113,224,21,183,210,154,92,206,113,23,117,25,235,73,100,77,50,102,
+43,197,177,73,157,137,106,208,110,18,195,219,26,118,13,251,219,10,107,158,116,110,35,169,156,71,58,239,192,151,69,216,
+132,78,206,192,12,101,220,215,57,62,65,126,153,206,228,247,115,120,231,16,60,76,187,246,255,10,103,186,45,247,92,85,
+64,62,86,41,85,21,216,168,40,88,18,11,85,153,37,177,68,34,73,115,148,101,195,93,101,158,204,87,168,225,45,4,
+143,133,24,181,192,31,206,121,28,166,120,243,231,33,201,67,174,32,78,238,13,112,126,240,250,106,237,60,150,48,79,99,
+74,15,53,176,95,229,209,189,121,117,227,2,200,249,218,143,6,37,116,82,203,89,124,17,172,75,40,199,17,239,200,231,
+125,21,231,115,82,202,136,10,86,117,76,97,163,77,136,224,180,137,30,83,137,254,183,17,19,156,254,163,25,47,106,252,
+68,104,126,98,197,194,219,102,45,54,138,48,239,91,52,199,104,199,73,199,213,71,113,152,185,250,48,14,164,64,27,196,
+52,183,170,246,181,110,49,157,180,48,49,56,64,201,188,13,14,143,55,232,141,8,221,109,160,3,52,187,132,218,128,80,
+25,1,119,234,132,226,62,161,49,33,84,99,172,94,56,159,152,79,40,160,161,14,153,86,61,169,140,48,241,104,35,223,
+5,200,194,1,74,36,172,75,88,199,42,46,36,143,215,37,31,14,169,202,51,251,34,86,128,198,21,87,243,89,9,65,
+86,78,216,211,192,18,24,187,212,81,179,213,209,192,36,191,87,250,240,1,186,167,1,170,88,83,230,225,106,169,40,22,
+207,36,73,86,104,93,87,29,195,106,92,143,185,105,237,228,86,198,184,147,164,218,192,214,3,116,64,174,49,196,61,71,
+64,154,12,85,203,213,41,172,148,78,148,182,89,114,139,108,252,134,20,13,246,83,142,185,214,109,118,179,235,116,111,13,
+108,239,135,205,48,99,251,221,66,34,220,224,41,68,20,197,177,179,18,69,156,134,195,52,21,229,145,7,120,70,247,114,
+212,203,100,192,219,152,27,57,40,232,223,132,90,127,22,117,198,222,235,154,196,236,82,198,54,6,77,104,15,153,189,89,
+134,217,92,72,226,179,255,247,72,207,218,0,83,192,241,14,225,14,12,38,184,13,134,217,124,252,62,26,193,154,219,152,
+46,122,168,36,237,46,85,8,228,244,107,5,155,64,123,148,161,156,245,202,97,62,15,214,36,20,92,6,94,144,162,147,
+94,96,172,92,30,150,87,65,164,1,123,50,79,146,228,206,199,136,142,23,228,105,230,131,1,246,120,109,101,250,21,142,
+215,51,13,242,16,255,99,194,0,65,222,6,182,248,55,202,231,29,176,34,103,97,115,252,176,104,212,204,88,243,13,121,
+25,146,248,73,135,152,205,121,106,201,220,32,72,207,56,155,92,77,97,178,81,110,86,112,137,78,64,18,208,137,253,160,
+151,122,99,190,30,240,182,250,210,212,162,92,119,37,187,151,60,130,111,65,146,22,172,51,74,117,226,162,1,11,128,107,
+210,111,63,153,90,32,186,167,173,229,235,68,234,134,156,45,206,134,164,153,143,176,235,198,128,71,47,239,35,91,97,198,
+5,59,22,158,228,8,48,213,113,47,157,225,36,19,69,105,76,229,99,94,209,0,114,95,55,31,57,103,21,42,144,74,
+204,52,124,76,87,2,136,219,102,132,184,109,180,232,235,14,98,231,148,208,248,51,39,28,242,209,187,104,233,59,208,167,
+63,158,173,96,231,247,11,14,242,190,195,177,243,20,216,29,98,142,193,51,31,25,247,211,57,100,237,10,253,186,41,225,
+69,179,17,107,17,201,231,78,90,22,153,213,188,9,137,157,44,42,15,21,11,131,96,71,64,63,24,82,8,164,92,241,
+18,136,193,138,163,243,140,116,152,106,230,134,242,94,161,161,163,189,48,46,146,245,174,210,3,206,63,170,30,41,194,69,
+223,231,189,120,30,163,127,151,28,197,53,186,123,192,125,234,47,8,235,122,143,42,109,96,85,235,174,45,91,146,154,79,
+222,238,113,222,121,130,232,192,164,218,71,168,187,136,29,87,205,234,112,23,88,85,6,215,192,108,240,100,240,137,184,75,
+242,172,99,245,0,171,183,129,1,206,120,152,61,10,84,230,218,82,191,136,85,147,12,200,252,6,157,108,245,211,93,187,
+138,132,56,227,37,185,24,211,236,233,229,253,108,181,168,60,176,142,203,146,252,74,232,129,64,151,187,202,66,199,167,97,
+58,163,246,191,207,100,224,46,233,230,227,108,44,213,66,44,119,96,157,149,43,88,231,220,151,95,233,123,22,127,23,102,
+157,171,185,175,93,249,111,94,201,153,107,248,118,92,85,179,232,96,207,204,99,157,35,168,210,79,43,37,227,116,249,162,
+212,80,19,217,33,205,217,140,39,196,159,234,171,110,90,253,42,240,76,253,37,89,68,124,131,46,21,109,100,75,89,126,
+125,34,48,35,98,76,198,226,220,15,122,89,73,5,130,79,254,167,130,235,147,162,51,37,181,151,213,33,255,13,170,189,
+242,58,73,190,29,140,40,46,29,76,206,3,52,81,171,198,114,88,244,95,71,122,252,94,
+};
 
-;
+const uint8_t comic_20_L2_charmap [128] = {
+32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+32,32,32,32,32,32,33,32,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,32,53,32,54,32,
+32,55,56,57,58,59,60,32,61,62,32,32,63,64,65,66,67,32,68,69,70,71,32,32,72,32,32,73,32,74,75,32,
+32,76,77,78,79,80,81,82,83,84,32,85,86,87,88,89,90,32,91,92,93,94,32,32,95,32,96,32,97,32,98,32,
+};
 
 
 
@@ -466,7 +104,9 @@ font_t font_comic_20_L2 = {
     .font_caps_height = 15,
     .font_x_width = 14,
     .pFontTable = comic_20_L2,
-    .fontTableSize = 13258
+    .fontTableSize = 9394,
+    .bitmapDeflatedSize = 1912,
+    .pCharMap = comic_20_L2_charmap
 };
 
 #endif
\ No newline at end of file
@@ -30,6 +30,8 @@ SOFTWARE.
 #include <stdlib.h>
 
 #define MAX_FONT_NAME_LEN 40
+//! Size of the metric block preceding the bitmap in a font table
+#define FONT_METRIC_BLOCK_SIZE 148
 
 /**
  * @brief Struct for holding the font
@@ -78,9 +80,21 @@ typedef struct font {
      */
     const uint8_t *pFontTable;
     /**
-     * @param fontTableSize Size of the font table in bytes
+     * @param fontTableSize Size of the font table in bytes, as placed in
+     * RAM_G (i.e. after inflating)
      */
     uint32_t fontTableSize;
+    /**
+     * @param bitmapDeflatedSize Size of the zlib deflated bitmap following
+     * the metric block in pFontTable. 0 if the bitmap is not compressed.
+     */
+    uint32_t bitmapDeflatedSize;
+    /**
+     * @param pCharMap Maps an ASCII char to its code in a subset font,
+     * i.e. a font which only holds the glyphs the calculator uses.
+     * NULL if the font holds the full ASCII table.
+     */
+    const uint8_t *pCharMap;
 }font_t;
 
 /**
@@ -45,7 +45,9 @@ font_t rom_font_0 = {.rom_font = true,
                      .font_caps_height = 18,
                      .font_x_width = 8,
                      .pFontTable = NULL,
-                     .fontTableSize = 0};
+                     .fontTableSize = 0,
+                     .bitmapDeflatedSize = 0,
+                     .pCharMap = NULL};
 font_t rom_font_1 = {.rom_font = true,
                      .ft81x_font_index = 31,
                      .font_name = "ROM24",
@@ -55,7 +57,9 @@ font_t rom_font_1 = {.rom_font = true,
                      .font_caps_height = 40,
                      .font_x_width = 24,
                      .pFontTable = NULL,
-                     .fontTableSize = 0};
+                     .fontTableSize = 0,
+                     .bitmapDeflatedSize = 0,
+                     .pCharMap = NULL};
 
 const font_collection_t cascadia = {
     .pSmallFont = &font_Cascadia_20_L2,
@@ -175,8 +175,7 @@ void getFractionalBits(displayState_t *pDisplayState, char *pString) {
 
 // Function to update the number of bits:
 // NOTE: THIS HIJACKS THE DISPLAY AND RECEIVE QUEUE!
-void updateBitWidth(displayState_t *pDisplayState,
-                    QueueHandle_t *pUartReceiveQueue) {
+void updateBitWidth(displayState_t *pDisplayState, QueueHandle_t inputQueue) {
 
 // This should show a new screen, with the option to enter a number between
 // 0-64.
@@ -291,32 +290,23 @@ void updateBitWidth(displayState_t *pDisplayState,
             true);
         endDisplayList();
 
-        // Wait for a character to be received.
-        char receiveChar = 0;
-        if (xQueueReceive(*pUartReceiveQueue, &receiveChar,
-                          (TickType_t)portMAX_DELAY)) {
-            if (receiveChar == 27) {
-                // Escape char. read them out of the queue if there are any,
+        // Wait for a key to be received. The screen is only redrawn when
+        // there is a key.
+        inputEvent_t event;
+        if (xQueueReceive(inputQueue, &event, (TickType_t)portMAX_DELAY) &&
+            event.type == inputEventType_KEY) {
+            keyEvent_t *pKey = &event.key;
+            char receiveChar = pKey->type == keyType_CHAR ? pKey->c : 0;
+            if (pKey->type == keyType_UP) {
                 // Only up or down is available, to select writing or aborting.
-                char escapeSeq[3] = {0};
-                for (int i = 0; i < 2; i++) {
-                    xQueueReceive(*pUartReceiveQueue, &(escapeSeq[i]),
-                                  (TickType_t)10);
+                if (selectionIter > 0) {
+                    selectionIter--;
                 }
-                escapeSeq[2] = '\0';
-                if (strcmp(escapeSeq, "[A") == 0) {
-                    // Up
-                    if (selectionIter > 0) {
-                        selectionIter--;
-                    }
+            } else if (pKey->type == keyType_DOWN) {
+                if (selectionIter < MAX_NUM_MENU_ITEMS - 1) {
+                    selectionIter++;
                 }
-                if (strcmp(escapeSeq, "[B") == 0) {
-                    // Down
-                    if (selectionIter < MAX_NUM_MENU_ITEMS - 1) {
-                        selectionIter++;
-                    }
-                }
-            } else if (receiveChar == '\r') {
+            } else if (pKey->type == keyType_ENTER) {
                 // Done, check if the number of bits are OK, in which case
                 // change it and exit this function.
                 if (selectionIter == 1) {
@@ -328,7 +318,7 @@ void updateBitWidth(displayState_t *pDisplayState,
                     pDisplayState->inputOptions.numBits = newBitSize;
                     return;
                 }
-            } else if (receiveChar == '\b' || receiveChar == 127) {
+            } else if (pKey->type == keyType_BACKSPACE) {
                 // Backspace, remove the latest added char.
                 if (charIter != 0) {
                     pEnteredChars[--charIter] = '\0';
@@ -355,8 +345,8 @@ void updateBitWidth(displayState_t *pDisplayState,
                 }
             } else {
                 logger(LOGGER_LEVEL_INFO,
-                       "updateBitWidth: Unrecognized/unhandled input: %c\r\n",
-                       receiveChar);
+                       "updateBitWidth: Unrecognized/unhandled input: %i\r\n",
+                       pKey->type);
             }
         }
     }
@@ -365,18 +355,27 @@ void updateBitWidth(displayState_t *pDisplayState,
 void changeFont(displayState_t *pDisplayState, char *pString) {
     // Get the current font index
     uint8_t fontIdx = pDisplayState->fontIdx;
+    uint8_t newFontIdx;
     // Do we have any more fonts?
     if (fontIdx + 1 < MAX_LEN_FONT_LIBRARY_TABLE) {
         // If we increase the font index, will the font table point to 0?
         if (pFontLibraryTable[fontIdx + 1] == NULL) {
             // No more fonts have been programmed, roll around to 0
-            pDisplayState->fontIdx = 0;
+            newFontIdx = 0;
         } else {
-            pDisplayState->fontIdx += 1;
+            newFontIdx = fontIdx + 1;
         }
     } else {
         // Maximum font index is reached roll around to 0
-        pDisplayState->fontIdx = 0;
+        newFontIdx = 0;
+    }
+    // Fonts are uploaded to the FT81x the first time they are selected.
+    // If that fails, keep the current font.
+    if (loadFontCollection(newFontIdx)) {
+        pDisplayState->fontIdx = newFontIdx;
+    } else {
+        logger(LOGGER_LEVEL_ERROR, "changeFont: Could not load font %i\r\n",
+               newFontIdx);
     }
 }
 
@@ -411,110 +410,84 @@ int findCurrentMenuOption(menuState_t *pMenuState) {
 
 void updateMenuState(displayState_t *pLocalDisplayState,
                      displayState_t *pGlobalDisplayState) {
-    do {
-        char receiveChar = 0;
-        if (xQueueReceive(uartReceiveQueue, &receiveChar,
-                          (TickType_t)portMAX_DELAY)) {
-            if (receiveChar == 27) {
-                // Escape char. We expect two more chars in there, but don't
-                // wait around for it
-                char escapeSeq[3] = {0};
-                for (int i = 0; i < 2; i++) {
-                    xQueueReceive(uartReceiveQueue, &(escapeSeq[i]),
-                                  (TickType_t)10);
-                }
-                escapeSeq[2] = '\0';
-                if (strcmp(escapeSeq, "[A") == 0) {
-                    // Up
-                    menuState_t *pMenuState = pLocalDisplayState->pMenuState;
-                    menuOption_t *pCurrentMenuOption =
-                        pMenuState->pCurrentMenuOption;
-                    menuOption_t *pMenuOption = pMenuState->pMenuOptionList;
-                    // Check if the current menu option points to the
-                    // first entry to the list:
-                    if (pCurrentMenuOption !=
-                        &(pMenuState->pMenuOptionList[0])) {
-                        // We're not at the top, meaning we can go down.
-                        int idx = findCurrentMenuOption(pMenuState) - 1;
-                        pMenuState->pCurrentMenuOption =
-                            &(pMenuState->pMenuOptionList[idx]);
-                    }
-                }
-                if (strcmp(escapeSeq, "[B") == 0) {
-                    // Down
-                    menuState_t *pMenuState = pLocalDisplayState->pMenuState;
-                    menuOption_t *pCurrentMenuOption =
-                        pMenuState->pCurrentMenuOption;
-                    menuOption_t *pMenuOption = pMenuState->pMenuOptionList;
-                    // Check if the current menu option points to the
-                    // first entry to the list:
-                    if ((++pCurrentMenuOption)->pOptionString == NULL) {
-                        // We're at the bottom, revert the change we made.
-                        pCurrentMenuOption--;
-                    } else {
-                        int idx = findCurrentMenuOption(pMenuState) + 1;
-                        pMenuState->pCurrentMenuOption =
-                            &(pMenuState->pMenuOptionList[idx]);
-                    }
-                }
-                if (strcmp(escapeSeq, "[C") == 0) {
-                }
-                if (strcmp(escapeSeq, "[D") == 0) {
-                    // Backward/left
-                }
+    inputEvent_t event;
+    // Apply all keys that have been routed to the menu, without waiting
+    // for more.
+    while (pLocalDisplayState->inMenu &&
+           xQueueReceive(menuInputQueue, &event, 0) == pdTRUE) {
+        if (event.type != inputEventType_KEY) {
+            continue;
+        }
+        keyEvent_t *pKey = &event.key;
+        if (pKey->type == keyType_UP) {
+            menuState_t *pMenuState = pLocalDisplayState->pMenuState;
+            menuOption_t *pCurrentMenuOption = pMenuState->pCurrentMenuOption;
+            // Check if the current menu option points to the
+            // first entry to the list:
+            if (pCurrentMenuOption != &(pMenuState->pMenuOptionList[0])) {
+                // We're not at the top, meaning we can go down.
+                int idx = findCurrentMenuOption(pMenuState) - 1;
+                pMenuState->pCurrentMenuOption =
+                    &(pMenuState->pMenuOptionList[idx]);
+            }
+        }
+        if (pKey->type == keyType_DOWN) {
+            menuState_t *pMenuState = pLocalDisplayState->pMenuState;
+            menuOption_t *pCurrentMenuOption = pMenuState->pCurrentMenuOption;
+            // Check if the current menu option points to the
+            // last entry to the list:
+            if ((++pCurrentMenuOption)->pOptionString != NULL) {
+                int idx = findCurrentMenuOption(pMenuState) + 1;
+                pMenuState->pCurrentMenuOption =
+                    &(pMenuState->pMenuOptionList[idx]);
             }
-            if (receiveChar == '\r') {
-                // This is carriage return.
-                // If there is an associated function, run that.
-                // else if there is a submenu, enter that
-                menuState_t *pMenuState = pLocalDisplayState->pMenuState;
-                menuOption_t *pCurrentMenuOption =
-                    pMenuState->pCurrentMenuOption;
-                menuOption_t *pMenuOption = pMenuState->pMenuOptionList;
-                if (pCurrentMenuOption->menuUpdateFun.pUpdateFun != NULL) {
-                    // Run the update function
-                    // This is a void function with args:
-                    // displayState_t *pDisplayState, char *pString,
-                    // Where in this case the pString is NULL
-                    if (pCurrentMenuOption->menuUpdateFun
-                            .interactiveUpdateFun) {
-                        // NOTE: This will hijack the display and serial
-                        // interface, and return when it's done
-                        (*((interactive_menu_function *)(pCurrentMenuOption
+        }
+        if (pKey->type == keyType_ENTER) {
+            // If there is an associated function, run that.
+            // else if there is a submenu, enter that
+            menuState_t *pMenuState = pLocalDisplayState->pMenuState;
+            menuOption_t *pCurrentMenuOption = pMenuState->pCurrentMenuOption;
+            if (pCurrentMenuOption->menuUpdateFun.pUpdateFun != NULL) {
+                // Run the update function
+                // This is a void function with args:
+                // displayState_t *pDisplayState, char *pString,
+                // Where in this case the pString is NULL
+                if (pCurrentMenuOption->menuUpdateFun.interactiveUpdateFun) {
+                    // NOTE: This takes over the display, and reads the
+                    // menu mailbox until it's done.
+                    (*((interactive_menu_function *)(pCurrentMenuOption
+                                                         ->menuUpdateFun
+                                                         .pUpdateFun)))(
+                        pLocalDisplayState, menuInputQueue);
+                } else {
+                    (*((non_interactive_menu_function *)(pCurrentMenuOption
                                                              ->menuUpdateFun
                                                              .pUpdateFun)))(
-                            pLocalDisplayState, &uartReceiveQueue);
-                    } else {
-                        (*((non_interactive_menu_function
-                                *)(pCurrentMenuOption->menuUpdateFun
-                                       .pUpdateFun)))(pLocalDisplayState, NULL);
-                    }
-                } else if (pCurrentMenuOption->pSubMenu != NULL) {
-                    // Enter the sub menu
-                    pLocalDisplayState->pMenuState =
-                        (menuState_t *)(pCurrentMenuOption->pSubMenu);
-                }
-            }
-            if (receiveChar == 't' || receiveChar == 'T') {
-                pLocalDisplayState->inMenu = false;
-            }
-            // Copy over the local state to the global state.
-            if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY)) {
-                // To save time, copy the display state. Sort of waste of
-                // space. Not sure if this is the best approach..
-                memcpy(pGlobalDisplayState, pLocalDisplayState,
-                       sizeof(displayState_t));
-                // Release the semaphore, since we're done with the display
-                // state global variable
-                xSemaphoreGive(displayStateSemaphore);
-                // Give the event to the main loop to give back control
-                xEventGroupSetBits(displayTriggerEvent, DISPLAY_EXIT_MENU);
-                if (pLocalDisplayState->inMenu == false) {
-                    // Return if we're exiting the menu, since we don't
-                    // want to read from the receive queue.
-                    return;
+                        pLocalDisplayState, NULL);
                 }
+            } else if (pCurrentMenuOption->pSubMenu != NULL) {
+                // Enter the sub menu
+                pLocalDisplayState->pMenuState =
+                    (menuState_t *)(pCurrentMenuOption->pSubMenu);
             }
         }
-    } while (uxQueueMessagesWaiting(uartReceiveQueue) > 0);
+        if (pKey->type == keyType_CHAR && (pKey->c == 't' || pKey->c == 'T')) {
+            pLocalDisplayState->inMenu = false;
+        }
+    }
+
+    // Copy over the local state to the global state.
+    if (xSemaphoreTake(displayStateSemaphore, portMAX_DELAY)) {
+        // To save time, copy the display state. Sort of waste of
+        // space. Not sure if this is the best approach..
+        memcpy(pGlobalDisplayState, pLocalDisplayState, sizeof(displayState_t));
+        // Release the semaphore, since we're done with the display
+        // state global variable
+        xSemaphoreGive(displayStateSemaphore);
+    }
+    if (!pLocalDisplayState->inMenu) {
+        // Give the input back to the calculator, which picks up any
+        // changes made in the menu.
+        exitMenuInput();
+    }
 }
\ No newline at end of file
@@ -82,7 +82,7 @@ extern menuState_t topMenu;
 typedef void non_interactive_menu_function(displayState_t *pDisplayState,
                                            char *pString);
 typedef void interactive_menu_function(displayState_t *pDisplayState,
-                                       QueueHandle_t *pUartReceiveQueue);
+                                       QueueHandle_t inputQueue);
 
 /**
  * @brief Function to get the current font.
@@ -130,13 +130,14 @@ void exitMenu(displayState_t *pDisplayState, char *pString);
 /**
  * @brief Interactive menu-function to update the bit width
  * @param pDisplayState Pointer to the display state.
- * @param pUartReceiveQueue Pointer to the UART receive queue
+ * @param inputQueue Mailbox holding the input events for the menu
  * @return Nothing
  */
-void updateBitWidth(displayState_t *pDisplayState,
-                    QueueHandle_t *pUartReceiveQueue);
+void updateBitWidth(displayState_t *pDisplayState, QueueHandle_t inputQueue);
 /**
- * @brief Function to update the display state
+ * @brief Function to update the menu state with the keys in the menu
+ * mailbox. Doesn't wait for input. Hands the input back to the calculator
+ * when the menu is closed.
  * @param pLocalDisplayState Pointer to the local displayState. This can be read
  * and written to willy nilly
  * @param pGlobalDisplayState Pointer to the global displayState. This needs a
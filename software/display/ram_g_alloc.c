@@ -0,0 +1,104 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Allocator for the FT81x graphics RAM (RAM_G).
+ * Blocks are kept sorted by address, and new blocks are
+ * placed in the first gap that is large enough.
+ */
+
+// Standard library
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ram_g_alloc.h"
+
+/**
+ * @brief An allocated block in RAM_G
+ */
+typedef struct ramGBlock {
+    //! Start address of the block
+    uint32_t address;
+    //! Size of the block, padded to RAM_G_ALIGNMENT
+    uint32_t size;
+    //! Owner tag of the block
+    uint8_t owner;
+} ramGBlock_t;
+
+//! Allocated blocks, sorted by address
+static ramGBlock_t blocks[RAM_G_MAX_BLOCKS];
+//! Number of allocated blocks
+static uint8_t numBlocks = 0;
+//! Start of the managed area
+static uint32_t ramGBase = 0;
+//! End of the managed area
+static uint32_t ramGEnd = 0;
+
+void ramGAllocInit(uint32_t base, uint32_t size) {
+    numBlocks = 0;
+    ramGBase = base;
+    ramGEnd = base + size;
+}
+
+uint32_t ramGAlloc(uint32_t size, uint8_t owner) {
+    if (numBlocks >= RAM_G_MAX_BLOCKS || size == 0) {
+        return RAM_G_INVALID_ADDRESS;
+    }
+    // Pad the size up to the next aligned size
+    size = (size + RAM_G_ALIGNMENT - 1) & ~(uint32_t)(RAM_G_ALIGNMENT - 1);
+    // Walk the gaps between the blocks, starting at the base.
+    uint32_t gapStart = ramGBase;
+    uint8_t i = 0;
+    for (; i <= numBlocks; i++) {
+        uint32_t gapEnd = (i < numBlocks) ? blocks[i].address : ramGEnd;
+        if (gapEnd - gapStart >= size) {
+            break;
+        }
+        if (i < numBlocks) {
+            gapStart = blocks[i].address + blocks[i].size;
+        }
+    }
+    if (i > numBlocks) {
+        // No gap large enough
+        return RAM_G_INVALID_ADDRESS;
+    }
+    // Insert the block at index i to keep the list sorted.
+    memmove(&blocks[i + 1], &blocks[i], (numBlocks - i) * sizeof(ramGBlock_t));
+    blocks[i].address = gapStart;
+    blocks[i].size = size;
+    blocks[i].owner = owner;
+    numBlocks++;
+    return gapStart;
+}
+
+void ramGFree(uint8_t owner) {
+    uint8_t j = 0;
+    for (uint8_t i = 0; i < numBlocks; i++) {
+        if (blocks[i].owner != owner) {
+            blocks[j++] = blocks[i];
+        }
+    }
+    numBlocks = j;
+}
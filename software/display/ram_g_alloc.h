@@ -0,0 +1,62 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef RAM_G_ALLOC_H_
+#define RAM_G_ALLOC_H_
+// Standard library
+#include <stdbool.h>
+#include <stdint.h>
+
+//! Maximum number of blocks that can be allocated at the same time
+#define RAM_G_MAX_BLOCKS 16
+//! Alignment of all blocks in RAM_G, in bytes
+#define RAM_G_ALIGNMENT 4
+//! Returned by ramGAlloc if no block could be allocated
+#define RAM_G_INVALID_ADDRESS 0xFFFFFFFF
+
+/**
+ * @brief Initialize the RAM_G allocator. All memory is freed.
+ * @param base Start address of the managed area
+ * @param size Size of the managed area in bytes
+ * @return Nothing
+ */
+void ramGAllocInit(uint32_t base, uint32_t size);
+
+/**
+ * @brief Allocate a 4 byte aligned block in RAM_G (first fit)
+ * @param size Size of the block in bytes
+ * @param owner Tag identifying the owner, used when freeing
+ * @return Address of the block, or RAM_G_INVALID_ADDRESS if no
+ * gap is large enough.
+ */
+uint32_t ramGAlloc(uint32_t size, uint8_t owner);
+
+/**
+ * @brief Free all blocks belonging to an owner
+ * @param owner Tag given when the blocks were allocated
+ * @return Nothing
+ */
+void ramGFree(uint8_t owner);
+
+#endif /* RAM_G_ALLOC_H_ */
@@ -0,0 +1,569 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Microbenchmarks of comscicalc_lib.
+ *
+ * Times the input, solve, print and conversion paths of the calculator
+ * core, and counts the heap allocations they make. Each benchmark is
+ * calibrated to run for a minimum time, repeated, and the median is
+ * reported, so runs on the same machine are comparable. Results can be
+ * printed as a table, CSV or JSON, to track them from release to release.
+ *
+ * Allocations are counted by wrapping malloc, calloc and realloc at link
+ * time (-Wl,--wrap), so calls made from inside the C library itself are
+ * not counted.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "comscicalc.h"
+#include "print_utils.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Maximum number of benchmarks
+#define BENCH_MAX_CASES 128
+//! Maximum number of repetitions of a benchmark
+#define BENCH_MAX_REPS 31
+//! Longest benchmark name
+#define BENCH_NAME_LEN 64
+
+#if defined(CALC_COUNTERS)
+//! The library was built with the work counters, which the firmware isn't
+#define BENCH_COUNTERS true
+#else
+#define BENCH_COUNTERS false
+#endif
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief Output formats of the results.
+ */
+typedef enum benchOutput {
+    benchOutput_TEXT,
+    benchOutput_CSV,
+    benchOutput_JSON,
+} benchOutput_t;
+
+struct benchCase;
+
+//! Runs a benchmark for a number of iterations
+typedef void (*benchRunFun_t)(struct benchCase *pCase, uint64_t iterations);
+
+/**
+ * @brief One benchmark, with the state it runs on.
+ */
+typedef struct benchCase {
+    //! Name, e.g. solver/nested
+    char name[BENCH_NAME_LEN];
+    //! Function running the benchmark
+    benchRunFun_t pRun;
+    //! Calculator state, if used
+    calcCoreState_t calcCore;
+    //! Number format, for the conversion benchmarks
+    numberFormat_t numberFormat;
+    //! Base, input string or value, depending on the benchmark
+    uint8_t base;
+    const char *pString;
+    SUBRESULT_INT value;
+} benchCase_t;
+
+/**
+ * @brief Result of one benchmark.
+ */
+typedef struct benchResult {
+    //! Median time per operation
+    double nsPerOp;
+    //! Fastest repetition, time per operation
+    double minNsPerOp;
+    //! Heap allocations and allocated bytes per operation
+    double allocsPerOp;
+    double bytesPerOp;
+    //! Operations per repetition
+    uint64_t iterations;
+} benchResult_t;
+
+/* ------------- GLOBAL VARIABLES ------------ */
+
+static benchCase_t benchCases[BENCH_MAX_CASES];
+static int numBenchCases = 0;
+
+//! Allocation counters, updated by the malloc wrappers
+static uint64_t numAllocs = 0;
+static uint64_t numAllocBytes = 0;
+
+//! Keeps results alive, so that the compiler can't drop the work
+static volatile uint64_t benchSink;
+
+//! Scratch output of the print and conversion benchmarks
+static char benchBuf[512];
+
+/* ----------------- ALLOCATION COUNTING ----------------- */
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t num, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    numAllocs++;
+    numAllocBytes += size;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t num, size_t size) {
+    numAllocs++;
+    numAllocBytes += num * size;
+    return __real_calloc(num, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    numAllocs++;
+    numAllocBytes += size;
+    return __real_realloc(ptr, size);
+}
+
+/* ----------------- BENCHMARKS ----------------- */
+
+/**
+ * @brief Add a string to a calculator state.
+ * @param pCalcCore Pointer to the calculator state.
+ * @param pString Null terminated input.
+ */
+static void addString(calcCoreState_t *pCalcCore, const char *pString) {
+    while (*pString != '\0') {
+        calc_addInput(pCalcCore, *pString++);
+    }
+}
+
+// Insert a digit at the cursor and remove it again, one op per pair.
+static void runAddRemove(benchCase_t *pCase, uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        calc_addInput(&pCase->calcCore, '7');
+        calc_removeInput(&pCase->calcCore);
+    }
+}
+
+static void runSolver(benchCase_t *pCase, uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        benchSink += calc_solver(&pCase->calcCore);
+    }
+    benchSink += pCase->calcCore.result;
+}
+
+static void runPrintBuffer(benchCase_t *pCase, uint64_t iterations) {
+    int16_t syntaxIssuePos;
+    for (uint64_t i = 0; i < iterations; i++) {
+        syntaxIssuePos = -1;
+        calc_printBuffer(&pCase->calcCore, benchBuf, sizeof(benchBuf),
+                         &syntaxIssuePos);
+        benchSink += benchBuf[0];
+    }
+}
+
+static void runGetCursorLocation(benchCase_t *pCase, uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        benchSink += calc_getCursorLocation(&pCase->calcCore);
+    }
+}
+
+// Switch the number at the cursor between two bases, one op per switch.
+static void runUpdateBase(benchCase_t *pCase, uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        pCase->calcCore.numberFormat.inputBase =
+            (i & 1) ? inputBase_DEC : inputBase_HEX;
+        calc_updateBase(&pCase->calcCore);
+    }
+    // Leave the state as it was, in case the benchmark is run again.
+    if (iterations & 1) {
+        pCase->calcCore.numberFormat.inputBase = inputBase_DEC;
+        calc_updateBase(&pCase->calcCore);
+    }
+}
+
+static void runConvertResult(benchCase_t *pCase, uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        convertResult(benchBuf, pCase->value, &pCase->numberFormat,
+                      pCase->base);
+        benchSink += benchBuf[0];
+    }
+}
+
+static void runStrtofp(benchCase_t *pCase, uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        benchSink += strtofp(pCase->pString, false, 32, pCase->base);
+    }
+}
+
+static void runFptostr(benchCase_t *pCase, uint64_t iterations) {
+    for (uint64_t i = 0; i < iterations; i++) {
+        fptostr(benchBuf, (uint64_t)pCase->value, false, 32, pCase->base);
+        benchSink += benchBuf[0];
+    }
+}
+
+static void runPrintToBinary(benchCase_t *pCase, uint64_t iterations) {
+    bool printAllBits = pCase->base != 0;
+    for (uint64_t i = 0; i < iterations; i++) {
+        printToBinary(benchBuf, (uint64_t)pCase->value, printAllBits, 64,
+                      true);
+        benchSink += benchBuf[0];
+    }
+}
+
+/**
+ * @brief Add a benchmark.
+ * @param pRun Function running the benchmark.
+ * @param pNameFmt printf format of the name, followed by its arguments.
+ * @return Pointer to the new benchmark, to fill in its state.
+ */
+static benchCase_t *addCase(benchRunFun_t pRun, const char *pNameFmt, ...) {
+    if (numBenchCases == BENCH_MAX_CASES) {
+        fprintf(stderr, "comscicalc_bench: too many benchmarks\n");
+        exit(1);
+    }
+    benchCase_t *pCase = &benchCases[numBenchCases++];
+    memset(pCase, 0, sizeof(benchCase_t));
+    va_list args;
+    va_start(args, pNameFmt);
+    vsnprintf(pCase->name, sizeof(pCase->name), pNameFmt, args);
+    va_end(args);
+    pCase->pRun = pRun;
+    calc_coreInit(&pCase->calcCore);
+    pCase->calcCore.numberFormat.inputBase = inputBase_DEC;
+    pCase->numberFormat = pCase->calcCore.numberFormat;
+    return pCase;
+}
+
+//! Expressions of the solver benchmarks
+static const struct {
+    const char *pName;
+    const char *pInput;
+    inputBase_t inputBase;
+    inputFormat_t inputFormat;
+} benchExprs[] = {
+    {"short", "12+34", inputBase_DEC, INPUT_FMT_INT},
+    {"arith", "123*456+789/3-42<2", inputBase_DEC, INPUT_FMT_INT},
+    {"nested", "((((1+2)*3)+4)*5)-(6*(7+8))", inputBase_DEC, INPUT_FMT_INT},
+    {"variadic", "s1,2,3,4,5,6,7,8)*s9,10)", inputBase_DEC, INPUT_FMT_INT},
+    {"logic", "&ff,f0)|^a5,5a)", inputBase_HEX, INPUT_FMT_INT},
+    {"float", "1.5*2.25+3.125/0.5", inputBase_DEC, INPUT_FMT_FLOAT},
+    {"fixed", "0.5*3+1.25-0.125", inputBase_DEC, INPUT_FMT_FIXED},
+};
+
+//! Input of the benchmarks that edit and print, 48 entries
+#define BENCH_EDIT_INPUT "12*(34+56)-78/9+s1,2,3)*4-(5+6)*7+89-10*(11+12)"
+
+/**
+ * @brief Set up all benchmarks.
+ */
+static void addAllCases(void) {
+    benchCase_t *pCase;
+    uint8_t editLen = (uint8_t)strlen(BENCH_EDIT_INPUT);
+
+    // Editing at the end, the middle and the start of the input. The
+    // cursor counts from the end.
+    const uint8_t cursors[] = {0, editLen / 2, editLen};
+    const char *pCursorNames[] = {"end", "middle", "start"};
+    for (int i = 0; i < 3; i++) {
+        pCase = addCase(runAddRemove, "input/add_remove/%s", pCursorNames[i]);
+        addString(&pCase->calcCore, BENCH_EDIT_INPUT);
+        pCase->calcCore.cursorPosition = cursors[i];
+    }
+
+    for (size_t i = 0; i < sizeof(benchExprs) / sizeof(benchExprs[0]); i++) {
+        pCase = addCase(runSolver, "solver/%s", benchExprs[i].pName);
+        pCase->calcCore.numberFormat.inputBase = benchExprs[i].inputBase;
+        pCase->calcCore.numberFormat.inputFormat = benchExprs[i].inputFormat;
+        addString(&pCase->calcCore, benchExprs[i].pInput);
+    }
+    // Long input: 40 terms
+    pCase = addCase(runSolver, "solver/long");
+    for (int i = 0; i < 40; i++) {
+        addString(&pCase->calcCore, i % 2 ? "7*" : "3+");
+    }
+    addString(&pCase->calcCore, "1");
+
+    pCase = addCase(runPrintBuffer, "print/buffer/short");
+    addString(&pCase->calcCore, "12+34");
+    pCase = addCase(runPrintBuffer, "print/buffer/long");
+    addString(&pCase->calcCore, BENCH_EDIT_INPUT);
+    pCase = addCase(runGetCursorLocation, "print/cursor_location");
+    addString(&pCase->calcCore, BENCH_EDIT_INPUT);
+    pCase->calcCore.cursorPosition = editLen / 2;
+
+    pCase = addCase(runUpdateBase, "input/update_base");
+    addString(&pCase->calcCore, "12+3456789");
+
+    // Every pair of input and output format, in every base
+    const char *pFormatNames[] = {"int", "fixed", "float"};
+    const char *pBaseNames[] = {"dec", "hex", "bin"};
+    double floatValue = 1234.5678;
+    SUBRESULT_INT floatBits;
+    memcpy(&floatBits, &floatValue, sizeof(floatBits));
+    const SUBRESULT_INT values[] = {123456789, 1234LL << 32 | 0x75C28F5C,
+                                    floatBits};
+    for (uint8_t in = INPUT_FMT_INT; in <= INPUT_FMT_FLOAT; in++) {
+        for (uint8_t out = INPUT_FMT_INT; out <= INPUT_FMT_FLOAT; out++) {
+            for (uint8_t base = inputBase_DEC; base <= inputBase_BIN; base++) {
+                pCase = addCase(runConvertResult, "convert/%s_to_%s/%s",
+                                pFormatNames[in], pFormatNames[out],
+                                pBaseNames[base]);
+                pCase->numberFormat.inputFormat = in;
+                pCase->numberFormat.outputFormat = out;
+                pCase->base = base;
+                pCase->value = values[in];
+            }
+        }
+    }
+
+    const char *pFixedStrings[] = {"1234.5678", "4d2.9161", "10011010010.1001"};
+    const uint8_t radixes[] = {10, 16, 2};
+    for (int i = 0; i < 3; i++) {
+        pCase = addCase(runStrtofp, "utils/strtofp/%s", pBaseNames[i]);
+        pCase->pString = pFixedStrings[i];
+        pCase->base = radixes[i];
+        pCase = addCase(runFptostr, "utils/fptostr/%s", pBaseNames[i]);
+        pCase->value = values[INPUT_FMT_FIXED];
+        pCase->base = radixes[i];
+    }
+    pCase = addCase(runPrintToBinary, "utils/print_to_binary/all_bits");
+    pCase->value = 0x123456789ABCDEFLL;
+    pCase->base = 1;
+    pCase = addCase(runPrintToBinary, "utils/print_to_binary/no_leading");
+    pCase->value = 0x12345LL;
+}
+
+/* ----------------- MEASUREMENT ----------------- */
+
+/**
+ * @brief Monotonic time.
+ * @return Time in ns.
+ */
+static uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int compareDouble(const void *pA, const void *pB) {
+    double a = *(const double *)pA;
+    double b = *(const double *)pB;
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Run one benchmark.
+ * @param pCase Pointer to the benchmark.
+ * @param minTimeNs Minimum time of each repetition.
+ * @param numReps Number of repetitions.
+ * @param pResult Pointer to where the result is written.
+ */
+static void runCase(benchCase_t *pCase, uint64_t minTimeNs, int numReps,
+                    benchResult_t *pResult) {
+    // Find the number of iterations that takes at least the minimum time.
+    uint64_t iterations = 1;
+    while (true) {
+        uint64_t start = nowNs();
+        pCase->pRun(pCase, iterations);
+        uint64_t elapsed = nowNs() - start;
+        if (elapsed >= minTimeNs) {
+            break;
+        }
+        uint64_t next = elapsed > 0 ? iterations * minTimeNs / elapsed : 0;
+        // Overshoot a little, but grow at least 2x and at most 100x.
+        next += next / 5;
+        if (next < 2 * iterations) {
+            next = 2 * iterations;
+        } else if (next > 100 * iterations) {
+            next = 100 * iterations;
+        }
+        iterations = next;
+    }
+
+    double nsPerOp[BENCH_MAX_REPS];
+    uint64_t allocs = 0;
+    uint64_t bytes = 0;
+    for (int rep = 0; rep < numReps; rep++) {
+        uint64_t allocsBefore = numAllocs;
+        uint64_t bytesBefore = numAllocBytes;
+        uint64_t start = nowNs();
+        pCase->pRun(pCase, iterations);
+        uint64_t elapsed = nowNs() - start;
+        allocs = numAllocs - allocsBefore;
+        bytes = numAllocBytes - bytesBefore;
+        nsPerOp[rep] = (double)elapsed / (double)iterations;
+    }
+    qsort(nsPerOp, (size_t)numReps, sizeof(double), compareDouble);
+    pResult->nsPerOp = nsPerOp[numReps / 2];
+    pResult->minNsPerOp = nsPerOp[0];
+    pResult->allocsPerOp = (double)allocs / (double)iterations;
+    pResult->bytesPerOp = (double)bytes / (double)iterations;
+    pResult->iterations = iterations;
+}
+
+/**
+ * @brief Print one result.
+ * @param output Output format.
+ * @param pName Name of the benchmark.
+ * @param pResult Pointer to the result.
+ * @param first True for the first result printed.
+ */
+static void printResult(benchOutput_t output, const char *pName,
+                        const benchResult_t *pResult, bool first) {
+    if (BENCH_COUNTERS) {
+        fprintf(stderr, "comscicalc_bench: timing a build with "
+                        "CALC_COUNTERS, which the firmware leaves off\n");
+    }
+
+    switch (output) {
+    case benchOutput_TEXT:
+        printf("%-36s %12.1f %12.1f %10.2f %12.1f %12llu\n", pName,
+               pResult->nsPerOp, pResult->minNsPerOp, pResult->allocsPerOp,
+               pResult->bytesPerOp, (unsigned long long)pResult->iterations);
+        break;
+    case benchOutput_CSV:
+        printf("%s,%.2f,%.2f,%.4f,%.2f,%llu\n", pName, pResult->nsPerOp,
+               pResult->minNsPerOp, pResult->allocsPerOp, pResult->bytesPerOp,
+               (unsigned long long)pResult->iterations);
+        break;
+    case benchOutput_JSON:
+        printf("%s    {\"name\": \"%s\", \"ns_per_op\": %.2f, "
+               "\"min_ns_per_op\": %.2f, \"allocs_per_op\": %.4f, "
+               "\"bytes_per_op\": %.2f, \"iterations\": %llu}",
+               first ? "" : ",\n", pName, pResult->nsPerOp,
+               pResult->minNsPerOp, pResult->allocsPerOp, pResult->bytesPerOp,
+               (unsigned long long)pResult->iterations);
+        break;
+    }
+}
+
+/**
+ * @brief Print the usage of the benchmarks.
+ * @param pName Name of the executable.
+ */
+static void printUsage(const char *pName) {
+    fprintf(stderr,
+            "Usage: %s [-f text|csv|json] [-t ms] [-r repetitions] "
+            "[-l] [filter]\n"
+            "Runs the benchmarks whose names contain the filter, or all.\n"
+            "  -f  output format, default text\n"
+            "  -t  minimum time of each repetition in ms, default 20\n"
+            "  -r  number of repetitions, the median is reported, "
+            "default 5\n"
+            "  -l  list the benchmarks\n",
+            pName);
+}
+
+int main(int argc, char **argv) {
+    benchOutput_t output = benchOutput_TEXT;
+    uint64_t minTimeNs = 20000000;
+    int numReps = 5;
+    bool list = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "f:t:r:lh")) != -1) {
+        switch (opt) {
+        case 'f':
+            if (strcmp(optarg, "csv") == 0) {
+                output = benchOutput_CSV;
+            } else if (strcmp(optarg, "json") == 0) {
+                output = benchOutput_JSON;
+            } else if (strcmp(optarg, "text") == 0) {
+                output = benchOutput_TEXT;
+            } else {
+                printUsage(argv[0]);
+                return 1;
+            }
+            break;
+        case 't':
+            minTimeNs = (uint64_t)atoi(optarg) * 1000000;
+            break;
+        case 'r':
+            numReps = atoi(optarg);
+            if (numReps < 1 || numReps > BENCH_MAX_REPS) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            break;
+        case 'l':
+            list = true;
+            break;
+        default:
+            printUsage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+    const char *pFilter = optind < argc ? argv[optind] : "";
+
+    addAllCases();
+    if (list) {
+        for (int i = 0; i < numBenchCases; i++) {
+            printf("%s\n", benchCases[i].name);
+        }
+        return 0;
+    }
+
+    switch (output) {
+    case benchOutput_TEXT:
+        printf("%-36s %12s %12s %10s %12s %12s\n", "benchmark", "ns/op",
+               "min ns/op", "allocs/op", "bytes/op", "iterations");
+        break;
+    case benchOutput_CSV:
+        printf("name,ns_per_op,min_ns_per_op,allocs_per_op,bytes_per_op,"
+               "iterations\n");
+        break;
+    case benchOutput_JSON:
+        printf("{\n  \"version\": 1,\n  \"repetitions\": %i,\n"
+               "  \"counters\": %s,\n  \"benchmarks\": [\n",
+               numReps, BENCH_COUNTERS ? "true" : "false");
+        break;
+    }
+    bool first = true;
+    for (int i = 0; i < numBenchCases; i++) {
+        benchCase_t *pCase = &benchCases[i];
+        if (strstr(pCase->name, pFilter) == NULL) {
+            continue;
+        }
+        benchResult_t result;
+        runCase(pCase, minTimeNs, numReps, &result);
+        printResult(output, pCase->name, &result, first);
+        fflush(stdout);
+        first = false;
+    }
+    if (output == benchOutput_JSON) {
+        printf("\n  ]\n}\n");
+    }
+    for (int i = 0; i < numBenchCases; i++) {
+        calc_coreBufferTeardown(&benchCases[i].calcCore);
+    }
+    return 0;
+}
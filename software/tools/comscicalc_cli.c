@@ -0,0 +1,483 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Command line evaluator of comscicalc_lib.
+ *
+ * Reads newline separated expressions from files, or from stdin, and
+ * writes one result per line to stdout. Files, and stdin if redirected
+ * from a file, are memory mapped and evaluated in place. Other input is
+ * read in large blocks. Lines are evaluated in batches with
+ * calc_evalBatch, on one pool of workers, and the output is buffered.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "comscicalc.h"
+#include "eval_batch.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Number of lines evaluated per batch
+#define CLI_BATCH_LINES 16384
+//! Size of the output buffer
+#define CLI_OUT_BUF_SIZE (1 << 16)
+//! Size of the blocks read from input that can't be mapped. Also the
+//! longest line accepted from such input.
+#define CLI_READ_SIZE (1 << 20)
+//! Longest output of one line, e.g. 64 bits in binary
+#define CLI_MAX_RESULT_LEN 128
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief Options of the evaluator
+ */
+typedef struct cliOptions {
+    //! Number format to evaluate in
+    numberFormat_t numberFormat;
+    //! Base of the printed results
+    inputBase_t outputBase;
+    //! Number of threads, 0 for one per CPU
+    uint16_t numThreads;
+} cliOptions_t;
+
+/* ------------- GLOBAL VARIABLES ------------ */
+
+//! Workers the batches are evaluated on
+static calcEvalPool_t evalPool;
+
+//! Lines of the current batch, pointing into the input
+static calcExprSpan_t batchLines[CLI_BATCH_LINES];
+static SUBRESULT_INT batchResults[CLI_BATCH_LINES];
+static calc_funStatus_t batchStatuses[CLI_BATCH_LINES];
+static size_t numBatchLines = 0;
+
+//! Output buffer
+static char outBuf[CLI_OUT_BUF_SIZE];
+static size_t outLen = 0;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Write the output buffer to stdout.
+ */
+static void outFlush(void) {
+    size_t written = 0;
+    while (written < outLen) {
+        ssize_t n = write(STDOUT_FILENO, &outBuf[written], outLen - written);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("comscicalc_cli: write");
+            exit(1);
+        }
+        written += (size_t)n;
+    }
+    outLen = 0;
+}
+
+/**
+ * @brief Add to the output buffer.
+ * @param pData Pointer to the data.
+ * @param length Number of bytes, at most CLI_OUT_BUF_SIZE.
+ */
+static void outWrite(const char *pData, size_t length) {
+    if (outLen + length > CLI_OUT_BUF_SIZE) {
+        outFlush();
+    }
+    memcpy(&outBuf[outLen], pData, length);
+    outLen += length;
+}
+
+/**
+ * @brief Evaluate the lines of the batch and print the results.
+ *
+ * Must be called before the input the lines point into goes away.
+ * @param pOptions Pointer to the options.
+ */
+static void flushBatch(const cliOptions_t *pOptions) {
+    if (numBatchLines == 0) {
+        return;
+    }
+    calc_evalBatch(&evalPool, batchLines, numBatchLines,
+                   pOptions->numberFormat, batchResults, batchStatuses);
+    numberFormat_t numberFormat = pOptions->numberFormat;
+    char result[CLI_MAX_RESULT_LEN];
+    for (size_t i = 0; i < numBatchLines; i++) {
+        int length = 0;
+        if (batchLines[i].length == 0) {
+            // Keep empty lines, so that the output lines up with the input.
+        } else if (batchStatuses[i] == calc_funStatus_SUCCESS) {
+            convertResult(result, batchResults[i], &numberFormat,
+                          pOptions->outputBase);
+            length = (int)strlen(result);
+        } else {
+            length = snprintf(result, sizeof(result), "error %i",
+                              batchStatuses[i]);
+        }
+        result[length++] = '\n';
+        outWrite(result, (size_t)length);
+    }
+    numBatchLines = 0;
+}
+
+/**
+ * @brief Add a line to the batch, evaluating the batch if it's full.
+ * @param pLine Pointer to the line, without the newline.
+ * @param length Number of characters in the line.
+ * @param pOptions Pointer to the options.
+ */
+static void addLine(const char *pLine, size_t length,
+                    const cliOptions_t *pOptions) {
+    // Accept files with Windows line endings.
+    if (length > 0 && pLine[length - 1] == '\r') {
+        length--;
+    }
+    batchLines[numBatchLines].pString = pLine;
+    batchLines[numBatchLines].length = length;
+    if (++numBatchLines == CLI_BATCH_LINES) {
+        flushBatch(pOptions);
+    }
+}
+
+/**
+ * @brief Split a buffer into lines and add them to the batch.
+ * @param pData Pointer to the buffer.
+ * @param size Number of bytes in the buffer.
+ * @param final True if no more data follows, i.e. the last line doesn't
+ * need to end with a newline.
+ * @param pOptions Pointer to the options.
+ * @return Number of bytes consumed. Only a partial last line is left.
+ */
+static size_t addLines(const char *pData, size_t size, bool final,
+                       const cliOptions_t *pOptions) {
+    const char *pLine = pData;
+    const char *pEnd = pData + size;
+    while (pLine < pEnd) {
+        const char *pNewline = memchr(pLine, '\n', (size_t)(pEnd - pLine));
+        if (pNewline == NULL) {
+            if (final) {
+                addLine(pLine, (size_t)(pEnd - pLine), pOptions);
+                pLine = pEnd;
+            }
+            break;
+        }
+        addLine(pLine, (size_t)(pNewline - pLine), pOptions);
+        pLine = pNewline + 1;
+    }
+    return (size_t)(pLine - pData);
+}
+
+/**
+ * @brief Evaluate input that can't be mapped, e.g. a pipe.
+ *
+ * The input is read into one large buffer, and the batch is only
+ * evaluated when it's full, or when the buffer is, so a batch spans many
+ * reads of a pipe.
+ * @param fd File descriptor to read from.
+ * @param pOptions Pointer to the options.
+ * @return True if the input was read to the end.
+ */
+static bool evalStream(int fd, const cliOptions_t *pOptions) {
+    char *pBuf = malloc(CLI_READ_SIZE);
+    if (pBuf == NULL) {
+        return false;
+    }
+    // Bytes in the buffer
+    size_t have = 0;
+    // Bytes of the buffer that have been added to the batch as lines
+    size_t added = 0;
+    // True while dropping the rest of a line longer than the buffer.
+    bool skipping = false;
+    while (true) {
+        if (have == CLI_READ_SIZE) {
+            // The lines point into the buffer, so evaluate them before
+            // moving the partial last line to the front.
+            flushBatch(pOptions);
+            memmove(pBuf, &pBuf[added], have - added);
+            have -= added;
+            added = 0;
+            if (have == CLI_READ_SIZE) {
+                // A line that doesn't fit is reported as too long.
+                char error[32];
+                int length = snprintf(error, sizeof(error), "error %i\n",
+                                      calc_funStatus_ALLOCATE_ERROR);
+                outWrite(error, (size_t)length);
+                have = 0;
+                skipping = true;
+            }
+        }
+        ssize_t n = read(fd, &pBuf[have], CLI_READ_SIZE - have);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            free(pBuf);
+            return false;
+        }
+        size_t start = have;
+        have += (size_t)n;
+        if (skipping) {
+            // Nothing has been added since the batch was evaluated.
+            char *pNewline = memchr(&pBuf[start], '\n', have - start);
+            if (pNewline == NULL) {
+                have = 0;
+                if (n == 0) {
+                    break;
+                }
+                continue;
+            }
+            size_t skipped = (size_t)(pNewline + 1 - pBuf);
+            memmove(pBuf, pNewline + 1, have - skipped);
+            have -= skipped;
+            skipping = false;
+        }
+        added += addLines(&pBuf[added], have - added, n == 0, pOptions);
+        if (n == 0) {
+            break;
+        }
+    }
+    flushBatch(pOptions);
+    free(pBuf);
+    return true;
+}
+
+/**
+ * @brief Evaluate all lines of a file or stdin.
+ * @param fd File descriptor to read from.
+ * @param pOptions Pointer to the options.
+ * @return True if the input was read to the end.
+ */
+static bool evalFile(int fd, const cliOptions_t *pOptions) {
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+        return evalStream(fd, pOptions);
+    }
+    if (fileStat.st_size == 0) {
+        return true;
+    }
+    size_t size = (size_t)fileStat.st_size;
+    char *pData = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (pData == MAP_FAILED) {
+        return evalStream(fd, pOptions);
+    }
+    madvise(pData, size, MADV_SEQUENTIAL);
+    addLines(pData, size, true, pOptions);
+    flushBatch(pOptions);
+    munmap(pData, size);
+    return true;
+}
+
+/**
+ * @brief Parse a base name.
+ * @param pName Name of the base, i.e. dec, hex or bin.
+ * @param pBase Pointer to where the base is written.
+ * @return True if the name is known.
+ */
+static bool parseBase(const char *pName, inputBase_t *pBase) {
+    if (strcasecmp(pName, "dec") == 0) {
+        *pBase = inputBase_DEC;
+    } else if (strcasecmp(pName, "hex") == 0) {
+        *pBase = inputBase_HEX;
+    } else if (strcasecmp(pName, "bin") == 0) {
+        *pBase = inputBase_BIN;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Parse a format name.
+ * @param pName Name of the format, i.e. int, fixed or float.
+ * @param pFormat Pointer to where the format is written.
+ * @return True if the name is known.
+ */
+static bool parseFormat(const char *pName, uint8_t *pFormat) {
+    if (strcasecmp(pName, "int") == 0) {
+        *pFormat = INPUT_FMT_INT;
+    } else if (strcasecmp(pName, "fixed") == 0) {
+        *pFormat = INPUT_FMT_FIXED;
+    } else if (strcasecmp(pName, "float") == 0) {
+        *pFormat = INPUT_FMT_FLOAT;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Parse a number.
+ * @param pString String holding the number, and nothing else.
+ * @param min Smallest value accepted.
+ * @param max Largest value accepted.
+ * @param pValue Pointer to where the number is written.
+ * @return True if the string is a number between min and max.
+ */
+static bool parseNumber(const char *pString, long min, long max,
+                        long *pValue) {
+    char *pEnd = NULL;
+    errno = 0;
+    long value = strtol(pString, &pEnd, 10);
+    if (errno != 0 || pEnd == pString || *pEnd != '\0' || value < min ||
+        value > max) {
+        return false;
+    }
+    *pValue = value;
+    return true;
+}
+
+/**
+ * @brief Print the usage of the evaluator.
+ * @param pName Name of the executable.
+ */
+static void printUsage(const char *pName) {
+    fprintf(stderr,
+            "Usage: %s [-b dec|hex|bin] [-f int|fixed|float] [-n bits] "
+            "[-s] [-u]\n"
+            "       [-p fixed point decimal place] [-o dec|hex|bin] "
+            "[-j threads] [file...]\n"
+            "Evaluates one expression per line of the files, or of stdin, "
+            "and prints one\nresult per line. Failed lines print "
+            "\"error <status>\".\n"
+            "  -b  input base, default dec\n"
+            "  -f  number format, default int\n"
+            "  -n  number of bits, 1 to 64, default 64. 32 or 64 for float\n"
+            "  -s  signed, -u unsigned (default)\n"
+            "  -p  fixed point decimal place, 0 to 63, default 32\n"
+            "  -o  output base, default dec\n"
+            "  -j  number of threads, up to %i, default one per CPU\n",
+            pName, EVAL_BATCH_MAX_THREADS);
+}
+
+int main(int argc, char **argv) {
+    cliOptions_t options = {
+        .numberFormat =
+            {
+                .numBits = 64,
+                .inputFormat = INPUT_FMT_INT,
+                .outputFormat = INPUT_FMT_INT,
+                .sign = false,
+                .fixedPointDecimalPlace = 32,
+                .inputBase = inputBase_DEC,
+            },
+        .outputBase = inputBase_DEC,
+        .numThreads = 0,
+    };
+    int opt;
+    while ((opt = getopt(argc, argv, "b:f:n:sup:o:j:h")) != -1) {
+        bool valid = true;
+        long value = 0;
+        switch (opt) {
+        case 'b':
+            valid = parseBase(optarg, &options.numberFormat.inputBase);
+            break;
+        case 'f':
+            valid = parseFormat(optarg, &options.numberFormat.inputFormat);
+            options.numberFormat.outputFormat =
+                options.numberFormat.inputFormat;
+            break;
+        case 'n':
+            valid = parseNumber(optarg, 1, 64, &value);
+            options.numberFormat.numBits = (uint8_t)value;
+            break;
+        case 's':
+            options.numberFormat.sign = true;
+            break;
+        case 'u':
+            options.numberFormat.sign = false;
+            break;
+        case 'p':
+            valid = parseNumber(optarg, 0, 63, &value);
+            options.numberFormat.fixedPointDecimalPlace = (uint8_t)value;
+            break;
+        case 'o':
+            valid = parseBase(optarg, &options.outputBase);
+            break;
+        case 'j':
+            valid = parseNumber(optarg, 0, EVAL_BATCH_MAX_THREADS, &value);
+            options.numThreads = (uint16_t)value;
+            break;
+        default:
+            valid = false;
+            break;
+        }
+        if (!valid) {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.numberFormat.inputFormat == INPUT_FMT_FLOAT &&
+        options.numberFormat.numBits != 32 &&
+        options.numberFormat.numBits != 64) {
+        fprintf(stderr, "comscicalc_cli: float needs 32 or 64 bits\n");
+        return 1;
+    }
+
+    if (calc_evalPoolInit(&evalPool, options.numThreads) !=
+        calc_funStatus_SUCCESS) {
+        fprintf(stderr, "comscicalc_cli: could not start the workers\n");
+        return 1;
+    }
+
+    int status = 0;
+    if (optind == argc) {
+        if (!evalFile(STDIN_FILENO, &options)) {
+            perror("comscicalc_cli: stdin");
+            status = 1;
+        }
+    }
+    for (int i = optind; i < argc; i++) {
+        if (strcmp(argv[i], "-") == 0) {
+            if (!evalFile(STDIN_FILENO, &options)) {
+                perror("comscicalc_cli: stdin");
+                status = 1;
+            }
+            continue;
+        }
+        int fd = open(argv[i], O_RDONLY);
+        if (fd < 0 || !evalFile(fd, &options)) {
+            perror(argv[i]);
+            status = 1;
+        }
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    outFlush();
+    calc_evalPoolFree(&evalPool);
+    return status;
+}
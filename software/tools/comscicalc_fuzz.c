@@ -0,0 +1,717 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Worst case keystroke search of comscicalc_lib.
+ *
+ * Each byte of the input is one keystroke: a key added with calc_addInput,
+ * backspace, a cursor move, a change of input base or input format, or a
+ * solve. The work done by each keystroke is read from the counters of the
+ * calculator state (list steps, allocated entries and operator calls), and
+ * the objective is the most expensive single keystroke of the input, since
+ * it's the slowest keystroke that the user notices.
+ *
+ * The harness runs in two ways:
+ * - As a libFuzzer target, built with -DCOMSCICALC_LIBFUZZER=ON and clang.
+ *   The cost of the worst keystroke is turned into coverage, so that
+ *   libFuzzer keeps the inputs reaching a new order of magnitude of work.
+ *   New worst cases are written to $COMSCICALC_FUZZ_OUT, if set.
+ * - Standalone, with a built in mutational search keeping a corpus of the
+ *   worst inputs found so far. Works with any compiler.
+ *
+ * The worst case corpus is written as one file per input, which can be
+ * replayed with -r to time the worst keystroke, i.e. used as benchmark
+ * inputs.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "comscicalc.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Longest input, in keystrokes
+#define FUZZ_MAX_LEN 256
+//! Most entries kept in the input. The solver copies the whole list, and
+//! allocCounter is 8 bit, so the list has to stay well below 128 entries.
+#define FUZZ_MAX_ENTRIES 100
+//! Number of inputs in the worst case corpus
+#define FUZZ_CORPUS_SIZE 16
+//! Weight of an allocated entry in the cost, in list steps
+#define FUZZ_ALLOC_WEIGHT 16
+//! Weight of an operator call in the cost, in list steps
+#define FUZZ_OPERATOR_WEIGHT 4
+//! Number of repetitions when timing a keystroke, the median is used
+#define FUZZ_TIME_REPS 101
+
+// Keystrokes. Anything below FUZZ_KEY_REMOVE adds a key from fuzzKeys.
+#define FUZZ_KEY_REMOVE 0xC0
+#define FUZZ_KEY_LEFT 0xD0
+#define FUZZ_KEY_RIGHT 0xD8
+#define FUZZ_KEY_HOME_END 0xE0
+#define FUZZ_KEY_BASE 0xE8
+#define FUZZ_KEY_FORMAT 0xF0
+#define FUZZ_KEY_SOLVE 0xF8
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief Work done by one keystroke.
+ */
+typedef struct fuzzCost {
+    //! Counters of the calculator state, difference over the keystroke
+    calcCounters_t counters;
+    //! Weighted sum of the counters
+    uint64_t cost;
+} fuzzCost_t;
+
+/**
+ * @brief The worst keystroke of an input.
+ */
+typedef struct fuzzResult {
+    //! Work done by the worst keystroke
+    fuzzCost_t worst;
+    //! Index of the worst keystroke in the input
+    size_t worstIdx;
+} fuzzResult_t;
+
+/**
+ * @brief One input of the worst case corpus.
+ */
+typedef struct fuzzInput {
+    uint8_t data[FUZZ_MAX_LEN];
+    size_t len;
+    fuzzResult_t result;
+} fuzzInput_t;
+
+/* ------------- GLOBAL VARIABLES ------------ */
+
+//! Keys added by the keystrokes below FUZZ_KEY_REMOVE
+static const char fuzzKeys[] = "0123456789abcdef+-*/<>s&n|^~(),.";
+#define FUZZ_NUM_KEYS (sizeof(fuzzKeys) - 1)
+
+/* ----------------- HARNESS ----------------- */
+
+/**
+ * @brief Count the entries of the input list, without touching the
+ * counters of the state.
+ * @param pCalcCore Pointer to the calculator state.
+ * @return Number of entries.
+ */
+static uint16_t countEntries(const calcCoreState_t *pCalcCore) {
+    uint16_t count = 0;
+    for (const inputListEntry_t *pEntry = pCalcCore->pListEntrypoint;
+         pEntry != NULL; pEntry = pEntry->pNext) {
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Apply one keystroke to a calculator state, the way the firmware
+ * does.
+ * @param pCalcCore Pointer to the calculator state.
+ * @param key Keystroke, see FUZZ_KEY_*.
+ */
+static void fuzzApplyKey(calcCoreState_t *pCalcCore, uint8_t key) {
+    uint16_t numEntries = countEntries(pCalcCore);
+    // The cursor can't be placed further left than this.
+    uint16_t maxCursor = numEntries < INT8_MAX ? numEntries : INT8_MAX;
+    if (key < FUZZ_KEY_REMOVE) {
+        if (numEntries < FUZZ_MAX_ENTRIES) {
+            calc_addInput(pCalcCore, fuzzKeys[key % FUZZ_NUM_KEYS]);
+        }
+    } else if (key < FUZZ_KEY_LEFT) {
+        calc_removeInput(pCalcCore);
+    } else if (key < FUZZ_KEY_RIGHT) {
+        if (pCalcCore->cursorPosition < maxCursor) {
+            pCalcCore->cursorPosition++;
+        }
+    } else if (key < FUZZ_KEY_HOME_END) {
+        if (pCalcCore->cursorPosition > 0) {
+            pCalcCore->cursorPosition--;
+        }
+    } else if (key < FUZZ_KEY_BASE) {
+        pCalcCore->cursorPosition = key & 1 ? maxCursor : 0;
+    } else if (key < FUZZ_KEY_FORMAT) {
+        pCalcCore->numberFormat.inputBase = (inputBase_t)(key % 3);
+        calc_updateBase(pCalcCore);
+    } else if (key < FUZZ_KEY_SOLVE) {
+        calc_updateInputFormat(pCalcCore, key % 3);
+    } else {
+        calc_solver(pCalcCore);
+    }
+}
+
+/**
+ * @brief Run the first keystrokes of an input, and find the worst one.
+ * @param pData Pointer to the keystrokes.
+ * @param len Number of keystrokes to run.
+ * @param pCalcCore Pointer to an uninitialized calculator state. It's left
+ * holding the input after the keystrokes, and must be torn down.
+ * @param pResult Pointer to where the worst keystroke is written.
+ */
+static void fuzzRun(const uint8_t *pData, size_t len,
+                    calcCoreState_t *pCalcCore, fuzzResult_t *pResult) {
+    calc_coreInit(pCalcCore);
+    pCalcCore->numberFormat.inputBase = inputBase_DEC;
+    memset(pResult, 0, sizeof(fuzzResult_t));
+    for (size_t i = 0; i < len; i++) {
+        calcCounters_t before = pCalcCore->counters;
+        fuzzApplyKey(pCalcCore, pData[i]);
+        fuzzCost_t cost;
+        cost.counters.numAllocations =
+            pCalcCore->counters.numAllocations - before.numAllocations;
+        cost.counters.numFrees = pCalcCore->counters.numFrees - before.numFrees;
+        cost.counters.numListSteps =
+            pCalcCore->counters.numListSteps - before.numListSteps;
+        cost.counters.numOperatorCalls =
+            pCalcCore->counters.numOperatorCalls - before.numOperatorCalls;
+        cost.cost = cost.counters.numListSteps +
+                    (uint64_t)cost.counters.numAllocations * FUZZ_ALLOC_WEIGHT +
+                    (uint64_t)cost.counters.numOperatorCalls *
+                        FUZZ_OPERATOR_WEIGHT;
+        if (cost.cost > pResult->worst.cost) {
+            pResult->worst = cost;
+            pResult->worstIdx = i;
+        }
+    }
+}
+
+/**
+ * @brief Name of a keystroke.
+ * @param key Keystroke, see FUZZ_KEY_*.
+ * @param pBuf Pointer to at least 16 chars to write the name to.
+ * @return pBuf
+ */
+static const char *keyName(uint8_t key, char *pBuf) {
+    if (key < FUZZ_KEY_REMOVE) {
+        sprintf(pBuf, "add '%c'", fuzzKeys[key % FUZZ_NUM_KEYS]);
+    } else if (key < FUZZ_KEY_LEFT) {
+        strcpy(pBuf, "remove");
+    } else if (key < FUZZ_KEY_RIGHT) {
+        strcpy(pBuf, "left");
+    } else if (key < FUZZ_KEY_HOME_END) {
+        strcpy(pBuf, "right");
+    } else if (key < FUZZ_KEY_BASE) {
+        strcpy(pBuf, key & 1 ? "home" : "end");
+    } else if (key < FUZZ_KEY_FORMAT) {
+        sprintf(pBuf, "base %i", key % 3);
+    } else if (key < FUZZ_KEY_SOLVE) {
+        sprintf(pBuf, "format %i", key % 3);
+    } else {
+        strcpy(pBuf, "solve");
+    }
+    return pBuf;
+}
+
+#if defined(COMSCICALC_LIBFUZZER)
+
+//! Touched by fuzzCoverCost, so that each branch stays in the binary
+static volatile uint8_t fuzzCostBuckets[32];
+
+/**
+ * @brief Turn the order of magnitude of a cost into coverage. libFuzzer
+ * keeps inputs reaching new edges, so each bucket is its own branch.
+ * @param cost Cost of the worst keystroke.
+ */
+static void fuzzCoverCost(uint64_t cost) {
+    int bucket = cost ? 64 - __builtin_clzll(cost) : 0;
+    switch (bucket < 31 ? bucket : 31) {
+#define FUZZ_BUCKET(n)                                                         \
+    case n:                                                                    \
+        fuzzCostBuckets[n]++;                                                  \
+        break;
+        FUZZ_BUCKET(0) FUZZ_BUCKET(1) FUZZ_BUCKET(2) FUZZ_BUCKET(3)
+        FUZZ_BUCKET(4) FUZZ_BUCKET(5) FUZZ_BUCKET(6) FUZZ_BUCKET(7)
+        FUZZ_BUCKET(8) FUZZ_BUCKET(9) FUZZ_BUCKET(10) FUZZ_BUCKET(11)
+        FUZZ_BUCKET(12) FUZZ_BUCKET(13) FUZZ_BUCKET(14) FUZZ_BUCKET(15)
+        FUZZ_BUCKET(16) FUZZ_BUCKET(17) FUZZ_BUCKET(18) FUZZ_BUCKET(19)
+        FUZZ_BUCKET(20) FUZZ_BUCKET(21) FUZZ_BUCKET(22) FUZZ_BUCKET(23)
+        FUZZ_BUCKET(24) FUZZ_BUCKET(25) FUZZ_BUCKET(26) FUZZ_BUCKET(27)
+        FUZZ_BUCKET(28) FUZZ_BUCKET(29) FUZZ_BUCKET(30) FUZZ_BUCKET(31)
+#undef FUZZ_BUCKET
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *pData, size_t size) {
+    static uint64_t worstCost = 0;
+    static unsigned numWorst = 0;
+    if (size > FUZZ_MAX_LEN) {
+        return 0;
+    }
+    calcCoreState_t calcCore;
+    fuzzResult_t result;
+    fuzzRun(pData, size, &calcCore, &result);
+    calc_coreBufferTeardown(&calcCore);
+    fuzzCoverCost(result.worst.cost);
+    if (result.worst.cost > worstCost) {
+        worstCost = result.worst.cost;
+        char name[16];
+        fprintf(stderr, "comscicalc_fuzz: new worst keystroke %s, cost %llu\n",
+                keyName(pData[result.worstIdx], name),
+                (unsigned long long)worstCost);
+        const char *pOutDir = getenv("COMSCICALC_FUZZ_OUT");
+        if (pOutDir != NULL) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/worst-%04u-%llu", pOutDir,
+                     numWorst++, (unsigned long long)worstCost);
+            FILE *pFile = fopen(path, "wb");
+            if (pFile != NULL) {
+                fwrite(pData, 1, size, pFile);
+                fclose(pFile);
+            }
+        }
+    }
+    return 0;
+}
+
+#else
+
+/* ----------------- SEARCH ----------------- */
+
+//! State of the random number generator
+static uint64_t fuzzRandomState = 0x9e3779b97f4a7c15ULL;
+
+/**
+ * @brief xorshift64* random number generator.
+ * @return Next random number.
+ */
+static uint64_t fuzzRandom(void) {
+    fuzzRandomState ^= fuzzRandomState >> 12;
+    fuzzRandomState ^= fuzzRandomState << 25;
+    fuzzRandomState ^= fuzzRandomState >> 27;
+    return fuzzRandomState * 0x2545f4914f6cdd1dULL;
+}
+
+/**
+ * @brief Monotonic time.
+ * @return Time in ns.
+ */
+static uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Evaluate an input of the corpus.
+ * @param pInput Pointer to the input.
+ */
+static void evaluate(fuzzInput_t *pInput) {
+    calcCoreState_t calcCore;
+    fuzzRun(pInput->data, pInput->len, &calcCore, &pInput->result);
+    calc_coreBufferTeardown(&calcCore);
+}
+
+/**
+ * @brief Add keys to a seed, followed by a solve.
+ * @param pInput Pointer to the seed.
+ * @param pKeys Null terminated keys to add.
+ */
+static void seedKeys(fuzzInput_t *pInput, const char *pKeys) {
+    pInput->len = 0;
+    while (*pKeys != '\0' && pInput->len < FUZZ_MAX_LEN - 1) {
+        pInput->data[pInput->len++] =
+            (uint8_t)(strchr(fuzzKeys, *pKeys++) - fuzzKeys);
+    }
+    pInput->data[pInput->len++] = FUZZ_KEY_SOLVE;
+}
+
+/**
+ * @brief Mutate an input in place.
+ * @param pInput Pointer to the input to mutate.
+ * @param pCorpus Pointer to the corpus, to splice from.
+ */
+static void mutate(fuzzInput_t *pInput, const fuzzInput_t *pCorpus) {
+    int numMutations = 1 + fuzzRandom() % 4;
+    for (int m = 0; m < numMutations; m++) {
+        size_t pos = pInput->len ? fuzzRandom() % pInput->len : 0;
+        switch (fuzzRandom() % 5) {
+        case 0:
+            // Replace a keystroke
+            if (pInput->len > 0) {
+                pInput->data[pos] = (uint8_t)fuzzRandom();
+            }
+            break;
+        case 1:
+            // Insert a keystroke
+            if (pInput->len < FUZZ_MAX_LEN) {
+                memmove(&pInput->data[pos + 1], &pInput->data[pos],
+                        pInput->len - pos);
+                pInput->data[pos] = (uint8_t)fuzzRandom();
+                pInput->len++;
+            }
+            break;
+        case 2:
+            // Remove a keystroke
+            if (pInput->len > 1) {
+                memmove(&pInput->data[pos], &pInput->data[pos + 1],
+                        pInput->len - pos - 1);
+                pInput->len--;
+            }
+            break;
+        case 3: {
+            // Repeat a run of keystrokes, which is what grows the input
+            size_t runLen = 1 + fuzzRandom() % 8;
+            if (pos + runLen <= pInput->len &&
+                pInput->len + runLen <= FUZZ_MAX_LEN) {
+                memmove(&pInput->data[pos + runLen], &pInput->data[pos],
+                        pInput->len - pos);
+                pInput->len += runLen;
+            }
+            break;
+        }
+        default: {
+            // Splice in the tail of another input of the corpus
+            const fuzzInput_t *pOther =
+                &pCorpus[fuzzRandom() % FUZZ_CORPUS_SIZE];
+            size_t otherPos = pOther->len ? fuzzRandom() % pOther->len : 0;
+            size_t copyLen = pOther->len - otherPos;
+            if (pos + copyLen > FUZZ_MAX_LEN) {
+                copyLen = FUZZ_MAX_LEN - pos;
+            }
+            memcpy(&pInput->data[pos], &pOther->data[otherPos], copyLen);
+            pInput->len = pos + copyLen;
+            break;
+        }
+        }
+    }
+}
+
+static int compareInputs(const void *pA, const void *pB) {
+    uint64_t a = ((const fuzzInput_t *)pA)->result.worst.cost;
+    uint64_t b = ((const fuzzInput_t *)pB)->result.worst.cost;
+    return (a < b) - (a > b);
+}
+
+/**
+ * @brief Search for the inputs with the worst keystrokes.
+ * @param pCorpus Pointer to the corpus, sorted worst first on return.
+ * @param numIterations Number of inputs to try.
+ * @param timeLimitNs Time limit of the search, 0 for none.
+ */
+static void search(fuzzInput_t *pCorpus, uint64_t numIterations,
+                   uint64_t timeLimitNs) {
+    // Seed with the shapes that comscicalc_scaling grows.
+    char seed[FUZZ_MAX_ENTRIES + 4];
+    for (int i = 0; i < FUZZ_CORPUS_SIZE; i++) {
+        int n = 2 + i * 3;
+        int len = 0;
+        switch (i % 3) {
+        case 0:
+            for (int j = 0; j < n && len < FUZZ_MAX_ENTRIES - 1; j++) {
+                seed[len++] = '7';
+                seed[len++] = "+*"[j % 2];
+            }
+            seed[len++] = '7';
+            break;
+        case 1:
+            for (int j = 0; j < n && len < FUZZ_MAX_ENTRIES / 4; j++) {
+                seed[len++] = '(';
+            }
+            seed[len++] = '1';
+            for (int j = len - 1; j > 0 && len < FUZZ_MAX_ENTRIES - 2; j--) {
+                memcpy(&seed[len], "+1)", 3);
+                len += 3;
+            }
+            break;
+        default:
+            seed[len++] = 's';
+            for (int j = 0; j < n && len < FUZZ_MAX_ENTRIES - 1; j++) {
+                seed[len++] = '1';
+                seed[len++] = ',';
+            }
+            seed[len - 1] = ')';
+            break;
+        }
+        seed[len] = '\0';
+        seedKeys(&pCorpus[i], seed);
+        evaluate(&pCorpus[i]);
+    }
+    qsort(pCorpus, FUZZ_CORPUS_SIZE, sizeof(fuzzInput_t), compareInputs);
+
+    uint64_t start = nowNs();
+    for (uint64_t it = 0; it < numIterations; it++) {
+        if (timeLimitNs && (it % 256) == 0 && nowNs() - start > timeLimitNs) {
+            break;
+        }
+        // Prefer mutating the worst inputs.
+        size_t parent = fuzzRandom() % FUZZ_CORPUS_SIZE;
+        parent = parent * parent / FUZZ_CORPUS_SIZE;
+        fuzzInput_t candidate = pCorpus[parent];
+        mutate(&candidate, pCorpus);
+        evaluate(&candidate);
+        fuzzInput_t *pLeast = &pCorpus[FUZZ_CORPUS_SIZE - 1];
+        if (candidate.result.worst.cost <= pLeast->result.worst.cost) {
+            continue;
+        }
+        // Keep the corpus diverse, one input per cost.
+        bool duplicate = false;
+        for (int i = 0; i < FUZZ_CORPUS_SIZE; i++) {
+            if (pCorpus[i].result.worst.cost == candidate.result.worst.cost) {
+                duplicate = true;
+                break;
+            }
+        }
+        if (!duplicate) {
+            *pLeast = candidate;
+            qsort(pCorpus, FUZZ_CORPUS_SIZE, sizeof(fuzzInput_t),
+                  compareInputs);
+        }
+    }
+}
+
+/* ----------------- REPLAY ----------------- */
+
+/**
+ * @brief Print the input of a calculator state.
+ * @param pCalcCore Pointer to the calculator state.
+ * @param pBuf Pointer to the string to print to.
+ * @param bufLen Length of the string.
+ */
+static void printInput(calcCoreState_t *pCalcCore, char *pBuf,
+                       uint16_t bufLen) {
+    int16_t syntaxIssuePos = -1;
+    // calc_printBuffer doesn't terminate the string, and counts the work
+    // it does, so work on a copy of the counters.
+    calcCounters_t counters = pCalcCore->counters;
+    memset(pBuf, 0, bufLen);
+    calc_printBuffer(pCalcCore, pBuf, bufLen - 1, &syntaxIssuePos);
+    pCalcCore->counters = counters;
+}
+
+/**
+ * @brief Time the worst keystroke of an input. The keystrokes before it
+ * are replayed on a fresh state for each repetition, and not timed.
+ * @param pInput Pointer to the input.
+ * @return Median time of the worst keystroke in ns.
+ */
+static uint64_t timeWorstKey(const fuzzInput_t *pInput) {
+    uint64_t times[FUZZ_TIME_REPS];
+    for (int rep = 0; rep < FUZZ_TIME_REPS; rep++) {
+        calcCoreState_t calcCore;
+        fuzzResult_t result;
+        fuzzRun(pInput->data, pInput->result.worstIdx, &calcCore, &result);
+        uint64_t start = nowNs();
+        fuzzApplyKey(&calcCore, pInput->data[pInput->result.worstIdx]);
+        times[rep] = nowNs() - start;
+        calc_coreBufferTeardown(&calcCore);
+    }
+    // Insertion sort, the number of repetitions is small.
+    for (int i = 1; i < FUZZ_TIME_REPS; i++) {
+        uint64_t t = times[i];
+        int j = i;
+        for (; j > 0 && times[j - 1] > t; j--) {
+            times[j] = times[j - 1];
+        }
+        times[j] = t;
+    }
+    return times[FUZZ_TIME_REPS / 2];
+}
+
+/**
+ * @brief Print the worst keystroke of an input.
+ * @param pOut File to print to.
+ * @param pName Name of the input.
+ * @param pInput Pointer to the input.
+ * @param timeIt True to also time the worst keystroke.
+ */
+static void printWorst(FILE *pOut, const char *pName,
+                       const fuzzInput_t *pInput, bool timeIt) {
+    calcCoreState_t calcCore;
+    fuzzResult_t result;
+    fuzzRun(pInput->data, pInput->result.worstIdx, &calcCore, &result);
+    char input[2 * FUZZ_MAX_ENTRIES + 8];
+    printInput(&calcCore, input, sizeof(input));
+    calc_coreBufferTeardown(&calcCore);
+
+    const fuzzCost_t *pWorst = &pInput->result.worst;
+    char name[16];
+    fprintf(pOut, "%s\t%llu\t%s\t%u\t%u\t%u\t%u\t", pName,
+            (unsigned long long)pWorst->cost,
+            keyName(pInput->data[pInput->result.worstIdx], name),
+            (unsigned)pWorst->counters.numListSteps,
+            (unsigned)pWorst->counters.numAllocations,
+            (unsigned)pWorst->counters.numFrees,
+            (unsigned)pWorst->counters.numOperatorCalls);
+    if (timeIt) {
+        fprintf(pOut, "%llu\t", (unsigned long long)timeWorstKey(pInput));
+    }
+    fprintf(pOut, "%s\n", input);
+}
+
+/**
+ * @brief Print the header of the printWorst table.
+ * @param pOut File to print to.
+ * @param timeIt True if the worst keystroke is timed.
+ */
+static void printHeader(FILE *pOut, bool timeIt) {
+    fprintf(pOut, "input\tcost\tkey\tsteps\tallocs\tfrees\toperators\t%s"
+                  "before\n",
+            timeIt ? "ns\t" : "");
+}
+
+/**
+ * @brief Read an input from a file.
+ * @param pPath Path of the file.
+ * @param pInput Pointer to where the input is read to.
+ * @return True if the file could be read.
+ */
+static bool readInput(const char *pPath, fuzzInput_t *pInput) {
+    FILE *pFile = fopen(pPath, "rb");
+    if (pFile == NULL) {
+        return false;
+    }
+    pInput->len = fread(pInput->data, 1, FUZZ_MAX_LEN, pFile);
+    fclose(pFile);
+    return true;
+}
+
+/**
+ * @brief Write the corpus to a directory, one file per input, and a table
+ * of the worst keystrokes.
+ * @param pDir Path of the directory.
+ * @param pCorpus Pointer to the corpus.
+ * @return True if everything was written.
+ */
+static bool writeCorpus(const char *pDir, const fuzzInput_t *pCorpus) {
+    if (mkdir(pDir, 0755) != 0 && errno != EEXIST) {
+        return false;
+    }
+    char path[512];
+    snprintf(path, sizeof(path), "%s/worst.tsv", pDir);
+    FILE *pTable = fopen(path, "w");
+    if (pTable == NULL) {
+        return false;
+    }
+    printHeader(pTable, false);
+    for (int i = 0; i < FUZZ_CORPUS_SIZE; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "worst-%02i", i);
+        snprintf(path, sizeof(path), "%s/%s", pDir, name);
+        FILE *pFile = fopen(path, "wb");
+        if (pFile == NULL) {
+            fclose(pTable);
+            return false;
+        }
+        fwrite(pCorpus[i].data, 1, pCorpus[i].len, pFile);
+        fclose(pFile);
+        printWorst(pTable, name, &pCorpus[i], false);
+    }
+    fclose(pTable);
+    return true;
+}
+
+/**
+ * @brief Print the usage of the fuzzer.
+ * @param pName Name of the executable.
+ */
+static void printUsage(const char *pName) {
+    fprintf(stderr,
+            "Usage: %s [-n iterations] [-t s] [-s seed] [-o dir]\n"
+            "       %s -r input...\n"
+            "Searches for the keystroke sequences with the most expensive "
+            "keystroke.\n"
+            "  -n  number of inputs to try, default 20000\n"
+            "  -t  time limit in seconds\n"
+            "  -s  seed of the search\n"
+            "  -o  directory to write the worst case corpus to\n"
+            "  -r  replay inputs, e.g. a corpus, and time the worst "
+            "keystroke\n",
+            pName, pName);
+}
+
+int main(int argc, char **argv) {
+    uint64_t numIterations = 20000;
+    uint64_t timeLimitNs = 0;
+    const char *pOutDir = NULL;
+    bool replay = false;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:t:s:o:rh")) != -1) {
+        switch (opt) {
+        case 'n':
+            numIterations = strtoull(optarg, NULL, 0);
+            break;
+        case 't':
+            timeLimitNs = strtoull(optarg, NULL, 0) * 1000000000ULL;
+            break;
+        case 's':
+            // xorshift must not be seeded with 0
+            fuzzRandomState = strtoull(optarg, NULL, 0) | 1;
+            break;
+        case 'o':
+            pOutDir = optarg;
+            break;
+        case 'r':
+            replay = true;
+            break;
+        default:
+            printUsage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (replay) {
+        if (optind >= argc) {
+            printUsage(argv[0]);
+            return 1;
+        }
+        printHeader(stdout, true);
+        for (int i = optind; i < argc; i++) {
+            fuzzInput_t input;
+            if (!readInput(argv[i], &input)) {
+                fprintf(stderr, "comscicalc_fuzz: can't read %s\n", argv[i]);
+                return 1;
+            }
+            evaluate(&input);
+            printWorst(stdout, argv[i], &input, true);
+        }
+        return 0;
+    }
+
+    static fuzzInput_t corpus[FUZZ_CORPUS_SIZE];
+    search(corpus, numIterations, timeLimitNs);
+    printHeader(stdout, false);
+    for (int i = 0; i < FUZZ_CORPUS_SIZE; i++) {
+        char name[32];
+        snprintf(name, sizeof(name), "worst-%02i", i);
+        printWorst(stdout, name, &corpus[i], false);
+    }
+    if (pOutDir != NULL && !writeCorpus(pOutDir, corpus)) {
+        fprintf(stderr, "comscicalc_fuzz: can't write to %s\n", pOutDir);
+        return 1;
+    }
+    return 0;
+}
+
+#endif
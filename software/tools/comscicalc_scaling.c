@@ -0,0 +1,404 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Complexity scaling benchmark of comscicalc_lib.
+ *
+ * Generates deterministic expressions of growing size in three families:
+ * a flat chain of terms, nested brackets and a variadic function with a
+ * growing number of arguments. At each size it times one keystroke
+ * (inserting and removing a digit at the end of the input), solving the
+ * input and printing it. The growth exponent k of time ~ n^k, with n the
+ * number of input entries, is then fitted by least squares in log-log
+ * space.
+ *
+ * Each metric has an exponent budget. If a fitted exponent exceeds its
+ * budget the program exits with status 1, so e.g. a keystroke going from
+ * O(n) to O(n^2) fails a CI run.
+ *
+ * The cursor is an int8 in practice, and allocCounter a uint8 that also
+ * counts the copies made while solving, so inputs are kept below 128
+ * entries.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// Standard library
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "comscicalc.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Number of sizes of each family
+#define SCALING_NUM_SIZES 6
+//! Sizes below this many entries are dominated by constant costs, and not
+//! used in the fit.
+#define SCALING_MIN_FIT_ENTRIES 12
+//! Longest generated input
+#define SCALING_MAX_INPUT 128
+//! Number of repetitions, the median is used
+#define SCALING_REPS 5
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief Measured metrics.
+ */
+typedef enum scalingMetric {
+    scalingMetric_INSERT = 0,
+    scalingMetric_SOLVE,
+    scalingMetric_PRINT,
+    scalingMetric_NUM,
+} scalingMetric_t;
+
+//! Generates the input of a family with the given parameter
+typedef void (*scalingGenFun_t)(char *pBuf, int param);
+
+/**
+ * @brief One family of expressions.
+ */
+typedef struct scalingFamily {
+    //! Name of the family
+    const char *pName;
+    //! Generator of the input
+    scalingGenFun_t pGenerate;
+    //! Parameter of each size, e.g. number of terms or depth
+    int params[SCALING_NUM_SIZES];
+    //! Exponent budget of each metric. Measured exponents plus a margin,
+    //! well below the next power of n.
+    double budgets[scalingMetric_NUM];
+} scalingFamily_t;
+
+/* ------------- GLOBAL VARIABLES ------------ */
+
+static const char *pMetricNames[scalingMetric_NUM] = {"insert", "solve",
+                                                      "print"};
+
+//! Budgets given on the command line, overriding those of the families.
+//! Negative if not given.
+static double budgetOverrides[scalingMetric_NUM] = {-1, -1, -1};
+
+//! Keeps results alive, so that the compiler can't drop the work
+static volatile uint64_t scalingSink;
+
+/* ----------------- GENERATORS ----------------- */
+
+// 7+7+...+7 with param terms
+static void genTerms(char *pBuf, int param) {
+    for (int i = 0; i < param - 1; i++) {
+        *pBuf++ = '7';
+        *pBuf++ = i % 2 ? '*' : '+';
+    }
+    *pBuf++ = '7';
+    *pBuf = '\0';
+}
+
+// ((...(1+1)+1)...+1) with param levels
+static void genDepth(char *pBuf, int param) {
+    for (int i = 0; i < param; i++) {
+        *pBuf++ = '(';
+    }
+    *pBuf++ = '1';
+    for (int i = 0; i < param; i++) {
+        memcpy(pBuf, "+1)", 3);
+        pBuf += 3;
+    }
+    *pBuf = '\0';
+}
+
+// s1,1,...,1) with param arguments
+static void genArgs(char *pBuf, int param) {
+    *pBuf++ = 's';
+    for (int i = 0; i < param; i++) {
+        *pBuf++ = '1';
+        *pBuf++ = i < param - 1 ? ',' : ')';
+    }
+    *pBuf = '\0';
+}
+
+// Printing the arguments is quadratic, as every comma looks up its depth
+// by walking back through the list.
+static const scalingFamily_t families[] = {
+    {"terms", genTerms, {4, 8, 16, 24, 40, 60}, {1.5, 2.5, 1.5}},
+    {"depth", genDepth, {2, 4, 8, 12, 20, 30}, {1.5, 2.5, 1.5}},
+    {"args", genArgs, {4, 8, 16, 24, 40, 60}, {1.5, 2.5, 2.5}},
+};
+
+/* ----------------- MEASUREMENT ----------------- */
+
+/**
+ * @brief Monotonic time.
+ * @return Time in ns.
+ */
+static uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int compareDouble(const void *pA, const void *pB) {
+    double a = *(const double *)pA;
+    double b = *(const double *)pB;
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Run one metric on a calculator state.
+ * @param pCalcCore Pointer to the calculator state.
+ * @param metric Metric to run.
+ * @param iterations Number of operations.
+ */
+static void runMetric(calcCoreState_t *pCalcCore, scalingMetric_t metric,
+                      uint64_t iterations) {
+    char buf[2 * SCALING_MAX_INPUT];
+    int16_t syntaxIssuePos;
+    for (uint64_t i = 0; i < iterations; i++) {
+        switch (metric) {
+        case scalingMetric_INSERT:
+            calc_addInput(pCalcCore, '1');
+            calc_removeInput(pCalcCore);
+            break;
+        case scalingMetric_SOLVE:
+            scalingSink += calc_solver(pCalcCore);
+            break;
+        default:
+            syntaxIssuePos = -1;
+            calc_printBuffer(pCalcCore, buf, sizeof(buf), &syntaxIssuePos);
+            scalingSink += buf[0];
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Time one metric.
+ * @param pCalcCore Pointer to the calculator state.
+ * @param metric Metric to time.
+ * @param minTimeNs Minimum time of each repetition.
+ * @return Median time per operation in ns.
+ */
+static double timeMetric(calcCoreState_t *pCalcCore, scalingMetric_t metric,
+                         uint64_t minTimeNs) {
+    uint64_t iterations = 1;
+    while (true) {
+        uint64_t start = nowNs();
+        runMetric(pCalcCore, metric, iterations);
+        if (nowNs() - start >= minTimeNs) {
+            break;
+        }
+        iterations *= 2;
+    }
+    double nsPerOp[SCALING_REPS];
+    for (int rep = 0; rep < SCALING_REPS; rep++) {
+        uint64_t start = nowNs();
+        runMetric(pCalcCore, metric, iterations);
+        nsPerOp[rep] = (double)(nowNs() - start) / (double)iterations;
+    }
+    qsort(nsPerOp, SCALING_REPS, sizeof(double), compareDouble);
+    return nsPerOp[SCALING_REPS / 2];
+}
+
+/**
+ * @brief Fit the exponent k of y = c * x^k.
+ * @param pX Pointer to the sizes.
+ * @param pY Pointer to the times.
+ * @param num Number of points.
+ * @return The exponent, i.e. the slope in log-log space.
+ */
+static double fitExponent(const double *pX, const double *pY, int num) {
+    double sumX = 0;
+    double sumY = 0;
+    double sumXX = 0;
+    double sumXY = 0;
+    for (int i = 0; i < num; i++) {
+        double x = log(pX[i]);
+        double y = log(pY[i]);
+        sumX += x;
+        sumY += y;
+        sumXX += x * x;
+        sumXY += x * y;
+    }
+    double denominator = num * sumXX - sumX * sumX;
+    if (num < 2 || denominator == 0) {
+        return 0;
+    }
+    return (num * sumXY - sumX * sumY) / denominator;
+}
+
+/**
+ * @brief Parse an exponent budget, e.g. solve=2.5.
+ * @param pArg Argument to parse.
+ * @return True if the metric is known.
+ */
+static bool parseBudget(const char *pArg) {
+    const char *pValue = strchr(pArg, '=');
+    if (pValue == NULL) {
+        return false;
+    }
+    for (int metric = 0; metric < scalingMetric_NUM; metric++) {
+        size_t nameLen = strlen(pMetricNames[metric]);
+        if ((size_t)(pValue - pArg) == nameLen &&
+            strncmp(pArg, pMetricNames[metric], nameLen) == 0) {
+            budgetOverrides[metric] = atof(pValue + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Print the usage of the benchmark.
+ * @param pName Name of the executable.
+ */
+static void printUsage(const char *pName) {
+    fprintf(stderr,
+            "Usage: %s [-j] [-t ms] [-b metric=exponent]...\n"
+            "Fits how the insert, solve and print times grow with the "
+            "input size.\n"
+            "Exits with 1 if an exponent is above its budget.\n"
+            "  -j  JSON output\n"
+            "  -t  minimum time of each repetition in ms, default 10\n"
+            "  -b  exponent budget of a metric in all families, e.g. "
+            "solve=2.5\n",
+            pName);
+}
+
+int main(int argc, char **argv) {
+    bool json = false;
+    uint64_t minTimeNs = 10000000;
+    int opt;
+    while ((opt = getopt(argc, argv, "jt:b:h")) != -1) {
+        switch (opt) {
+        case 'j':
+            json = true;
+            break;
+        case 't':
+            minTimeNs = (uint64_t)atoi(optarg) * 1000000;
+            break;
+        case 'b':
+            if (!parseBudget(optarg)) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            break;
+        default:
+            printUsage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    int numFamilies = sizeof(families) / sizeof(families[0]);
+    bool withinBudget = true;
+    if (json) {
+        printf("{\n  \"version\": 1,\n  \"families\": [\n");
+    }
+    for (int f = 0; f < numFamilies; f++) {
+        const scalingFamily_t *pFamily = &families[f];
+        double sizes[SCALING_NUM_SIZES];
+        double times[scalingMetric_NUM][SCALING_NUM_SIZES];
+        if (!json) {
+            printf("%s\n%8s %12s %12s %12s\n", pFamily->pName, "entries",
+                   "insert ns", "solve ns", "print ns");
+        }
+        for (int s = 0; s < SCALING_NUM_SIZES; s++) {
+            char input[SCALING_MAX_INPUT];
+            pFamily->pGenerate(input, pFamily->params[s]);
+            calcCoreState_t calcCore;
+            calc_coreInit(&calcCore);
+            calcCore.numberFormat.inputBase = inputBase_DEC;
+            for (const char *pChar = input; *pChar != '\0'; pChar++) {
+                calc_addInput(&calcCore, *pChar);
+            }
+            if (calc_solver(&calcCore) != calc_funStatus_SUCCESS) {
+                fprintf(stderr, "comscicalc_scaling: can't solve %s\n",
+                        input);
+                return 1;
+            }
+            sizes[s] = (double)strlen(input);
+            for (int metric = 0; metric < scalingMetric_NUM; metric++) {
+                times[metric][s] = timeMetric(
+                    &calcCore, (scalingMetric_t)metric, minTimeNs);
+            }
+            calc_coreBufferTeardown(&calcCore);
+            if (!json) {
+                printf("%8.0f %12.1f %12.1f %12.1f\n", sizes[s],
+                       times[scalingMetric_INSERT][s],
+                       times[scalingMetric_SOLVE][s],
+                       times[scalingMetric_PRINT][s]);
+            }
+        }
+
+        // Fit on the sizes large enough to not be all overhead.
+        int firstFit = 0;
+        while (firstFit < SCALING_NUM_SIZES - 2 &&
+               sizes[firstFit] < SCALING_MIN_FIT_ENTRIES) {
+            firstFit++;
+        }
+        if (json) {
+            printf("%s    {\"name\": \"%s\", \"sizes\": [", f ? ",\n" : "",
+                   pFamily->pName);
+            for (int s = 0; s < SCALING_NUM_SIZES; s++) {
+                printf("%s%.0f", s ? ", " : "", sizes[s]);
+            }
+            printf("]");
+        }
+        for (int metric = 0; metric < scalingMetric_NUM; metric++) {
+            double exponent =
+                fitExponent(&sizes[firstFit], &times[metric][firstFit],
+                            SCALING_NUM_SIZES - firstFit);
+            double budget = budgetOverrides[metric] >= 0
+                                ? budgetOverrides[metric]
+                                : pFamily->budgets[metric];
+            bool ok = exponent <= budget;
+            withinBudget &= ok;
+            if (json) {
+                printf(", \"%s\": {\"ns\": [", pMetricNames[metric]);
+                for (int s = 0; s < SCALING_NUM_SIZES; s++) {
+                    printf("%s%.1f", s ? ", " : "", times[metric][s]);
+                }
+                printf("], \"exponent\": %.3f, \"budget\": %.2f}", exponent,
+                       budget);
+            } else {
+                printf("%-8s exponent %.2f, budget %.2f%s\n",
+                       pMetricNames[metric], exponent, budget,
+                       ok ? "" : "  OVER BUDGET");
+            }
+        }
+        if (json) {
+            printf("}");
+        } else {
+            printf("\n");
+        }
+    }
+    if (json) {
+        printf("\n  ],\n  \"within_budget\": %s\n}\n",
+               withinBudget ? "true" : "false");
+    }
+    return withinBudget ? 0 : 1;
+}
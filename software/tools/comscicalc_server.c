@@ -0,0 +1,687 @@
+/*
+MIT License
+
+Copyright (c) 2024 Oskar von Heideken
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+ * Local calculator service built on comscicalc_lib.
+ *
+ * Listens on a Unix-domain socket, or on a loopback TCP port, and speaks
+ * the protocol and link layers of software/comms/README.md, so that the
+ * same host code can talk to the device or to this server. One epoll loop
+ * serves all connections. Each connection is given a calculator state from
+ * a pool initialized at start up, and keeps it until it disconnects.
+ *
+ * Requests can be pipelined: a client can send any number of messages
+ * without waiting, and they are answered in order, one reply per message.
+ * Since the socket is reliable and ordered, the reply to a message is also
+ * its acknowledgement, so stop-and-wait isn't required here.
+ */
+
+/* ----------------- HEADERS ----------------- */
+// accept4 is a Linux extension
+#define _GNU_SOURCE
+// Standard library
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "comms_frame.h"
+#include "comscicalc.h"
+#include "result_cache.h"
+
+/* ----------------- DEFINES ----------------- */
+
+//! Default path of the Unix-domain socket
+#define SERVER_DEFAULT_PATH "comscicalc.sock"
+//! Default number of calculator states, i.e. concurrent connections
+#define SERVER_DEFAULT_SESSIONS 64
+//! Receive buffer of a connection, room for many pipelined messages
+#define SERVER_RX_BUF_SIZE (16 * COMMS_MAX_FRAME_LEN)
+//! Transmit buffer of a connection. A connection stops reading when less
+//! than one message fits, until the client has read its replies.
+#define SERVER_TX_BUF_SIZE (64 * COMMS_MAX_FRAME_LEN)
+//! Number of epoll events handled per wait
+#define SERVER_MAX_EVENTS 64
+
+//! Keys of the input message that aren't calculator input
+#define SERVER_KEY_BACKSPACE 0x08
+#define SERVER_KEY_DELETE 0x7F
+#define SERVER_KEY_CLEAR 0x0C
+
+//! Layout of the state message: type, status, result and input
+#define STATE_HEADER_LEN 10
+//! Layout of the result message: type, status and result
+#define RESULT_LEN 10
+//! Layout of the format message: type, number of bits, input format,
+//! output format, sign, input base and fixed point decimal place
+#define FORMAT_LEN 7
+
+/* ------- ENUMS, TYPEDEFS AND STRUCTS ------- */
+
+/**
+ * @brief One calculator state of the pool.
+ */
+typedef struct serverSession {
+    //! Calculator state, for input messages
+    calcCoreState_t calcCore;
+    //! Scratch of calc_evalStringScratch, for eval messages
+    calcEvalState_t evalScratch;
+    //! Status of the last solve of calcCore
+    calc_funStatus_t solveStatus;
+    //! Next free session, if in the free list
+    struct serverSession *pNextFree;
+} serverSession_t;
+
+/**
+ * @brief One client connection.
+ */
+typedef struct serverConn {
+    //! Socket of the connection
+    int fd;
+    //! Calculator state of the connection
+    serverSession_t *pSession;
+    //! True once the client has sent a connection event
+    bool connected;
+    //! True while the connection waits for room in the transmit buffer
+    bool rxPaused;
+    //! Received bytes not yet decoded
+    uint8_t rxBuf[SERVER_RX_BUF_SIZE];
+    size_t rxLen;
+    //! Encoded replies, from txSent to txLen not yet sent
+    uint8_t txBuf[SERVER_TX_BUF_SIZE];
+    size_t txLen;
+    size_t txSent;
+    //! Last reply, kept for retransmission
+    commsFrame_t lastReply;
+} serverConn_t;
+
+/* ------------- GLOBAL VARIABLES ------------ */
+
+static serverSession_t *pSessions = NULL;
+static serverSession_t *pFreeSessions = NULL;
+static int epollFd = -1;
+//! Result cache shared by all sessions, NULL if not used
+static calcResultCache_t *pResultCache = NULL;
+
+/* ----------------- FUNCTIONS ----------------- */
+
+/**
+ * @brief Take a calculator state from the pool.
+ * @return Pointer to the state, or NULL if all are in use.
+ */
+static serverSession_t *sessionTake(void) {
+    serverSession_t *pSession = pFreeSessions;
+    if (pSession != NULL) {
+        pFreeSessions = pSession->pNextFree;
+    }
+    return pSession;
+}
+
+/**
+ * @brief Clear the input of a calculator state, keeping its number format.
+ * @param pSession Pointer to the state.
+ */
+static void sessionClear(serverSession_t *pSession) {
+    numberFormat_t numberFormat = pSession->calcCore.numberFormat;
+    calc_coreBufferTeardown(&pSession->calcCore);
+    calc_coreInit(&pSession->calcCore);
+    pSession->calcCore.numberFormat = numberFormat;
+    if (pResultCache != NULL) {
+        resultCache_attach(pResultCache, &pSession->calcCore);
+    }
+    pSession->solveStatus = calc_funStatus_INPUT_LIST_NULL;
+}
+
+/**
+ * @brief Reset a calculator state and return it to the pool.
+ * @param pSession Pointer to the state.
+ * @param defaultFormat Number format new connections start with.
+ */
+static void sessionGive(serverSession_t *pSession,
+                        numberFormat_t defaultFormat) {
+    sessionClear(pSession);
+    pSession->calcCore.numberFormat = defaultFormat;
+    pSession->pNextFree = pFreeSessions;
+    pFreeSessions = pSession;
+}
+
+/**
+ * @brief Write a 64 bit value, largest byte first.
+ * @param pBuf Pointer to 8 bytes.
+ * @param value Value to write.
+ */
+static void putResult(uint8_t *pBuf, SUBRESULT_INT value) {
+    for (int i = 0; i < 8; i++) {
+        pBuf[i] = (uint8_t)((uint64_t)value >> (56 - 8 * i));
+    }
+}
+
+/**
+ * @brief Fill in a state message, mirroring what the device displays.
+ * @param pSession Pointer to the calculator state.
+ * @param linkType commsLink_STATE or commsLink_RESPONSE.
+ * @param pReply Pointer to the reply.
+ */
+static void buildState(serverSession_t *pSession, commsLinkType_t linkType,
+                       commsFrame_t *pReply) {
+    calcCoreState_t *pCalcCore = &pSession->calcCore;
+    pReply->body[0] = (uint8_t)linkType;
+    pReply->body[1] = (uint8_t)pSession->solveStatus;
+    putResult(&pReply->body[2], pCalcCore->result);
+    // calc_printBuffer doesn't terminate the string
+    char input[COMMS_MAX_BODY_LEN - STATE_HEADER_LEN + 1] = {0};
+    int16_t syntaxIssuePos = -1;
+    size_t inputLen = 0;
+    if (calc_printBuffer(pCalcCore, input, sizeof(input), &syntaxIssuePos) ==
+        calc_funStatus_SUCCESS) {
+        inputLen = strnlen(input, sizeof(input) - 1);
+    }
+    memcpy(&pReply->body[STATE_HEADER_LEN], input, inputLen);
+    pReply->bodyLen = (uint8_t)(STATE_HEADER_LEN + inputLen);
+}
+
+/**
+ * @brief Fill in a result message.
+ * @param status Status of the evaluation.
+ * @param result Result of the evaluation.
+ * @param pReply Pointer to the reply.
+ */
+static void buildResult(calc_funStatus_t status, SUBRESULT_INT result,
+                        commsFrame_t *pReply) {
+    pReply->body[0] = commsLink_RESULT;
+    pReply->body[1] = (uint8_t)status;
+    putResult(&pReply->body[2], result);
+    pReply->bodyLen = RESULT_LEN;
+}
+
+/**
+ * @brief Apply keystrokes to a calculator state and solve it.
+ * @param pSession Pointer to the calculator state.
+ * @param pKeys Pointer to the keys.
+ * @param numKeys Number of keys.
+ */
+static void applyInput(serverSession_t *pSession, const uint8_t *pKeys,
+                       size_t numKeys) {
+    calcCoreState_t *pCalcCore = &pSession->calcCore;
+    calc_funStatus_t status = calc_funStatus_SUCCESS;
+    for (size_t i = 0; i < numKeys && status == calc_funStatus_SUCCESS; i++) {
+        switch (pKeys[i]) {
+        case SERVER_KEY_BACKSPACE:
+        case SERVER_KEY_DELETE:
+            status = calc_removeInput(pCalcCore);
+            break;
+        case SERVER_KEY_CLEAR:
+            sessionClear(pSession);
+            break;
+        default:
+            status = calc_addInput(pCalcCore, (char)pKeys[i]);
+            break;
+        }
+    }
+    if (status != calc_funStatus_SUCCESS) {
+        pSession->solveStatus = status;
+        return;
+    }
+    pSession->solveStatus = calc_solver(pCalcCore);
+}
+
+/**
+ * @brief Apply a format message to a calculator state.
+ * @param pSession Pointer to the calculator state.
+ * @param pBody Pointer to the body of the message.
+ * @param bodyLen Number of bytes in the body.
+ * @return Status of the update.
+ */
+static calc_funStatus_t applyFormat(serverSession_t *pSession,
+                                    const uint8_t *pBody, size_t bodyLen) {
+    calcCoreState_t *pCalcCore = &pSession->calcCore;
+    // Same ranges as comscicalc_cli. A decimal place beyond the number of
+    // bits is allowed, the library then uses numBits - 1.
+    if (bodyLen != FORMAT_LEN || pBody[1] < 1 || pBody[1] > 64 ||
+        pBody[5] > inputBase_BIN || pBody[6] > 63) {
+        return calc_funStatus_UNKNOWN_PARAMETER;
+    }
+    calc_funStatus_t status = calc_updateInputFormat(pCalcCore, pBody[2]);
+    if (status != calc_funStatus_SUCCESS) {
+        return status;
+    }
+    status = calc_updateOutputFormat(pCalcCore, pBody[3]);
+    if (status != calc_funStatus_SUCCESS) {
+        return status;
+    }
+    pCalcCore->numberFormat.numBits = pBody[1];
+    pCalcCore->numberFormat.sign = pBody[4] != 0;
+    pCalcCore->numberFormat.inputBase = (inputBase_t)pBody[5];
+    pCalcCore->numberFormat.fixedPointDecimalPlace = pBody[6];
+    calc_updateBase(pCalcCore);
+    pSession->solveStatus = calc_solver(pCalcCore);
+    return calc_funStatus_SUCCESS;
+}
+
+/**
+ * @brief Handle the link layer data of a message.
+ * @param pConn Pointer to the connection.
+ * @param pRequest Pointer to the received message, with a body.
+ * @param pReply Pointer to the reply.
+ */
+static void handleData(serverConn_t *pConn, const commsFrame_t *pRequest,
+                       commsFrame_t *pReply) {
+    serverSession_t *pSession = pConn->pSession;
+    const uint8_t *pBody = pRequest->body;
+    size_t bodyLen = pRequest->bodyLen;
+    SUBRESULT_INT result = 0;
+    calc_funStatus_t status;
+    switch (pBody[0]) {
+    case commsLink_EVAL:
+        status = calc_evalStringScratch(
+            &pSession->evalScratch, (const char *)&pBody[1], bodyLen - 1,
+            pSession->calcCore.numberFormat, &result);
+        buildResult(status, result, pReply);
+        break;
+    case commsLink_INPUT:
+        applyInput(pSession, &pBody[1], bodyLen - 1);
+        buildState(pSession, commsLink_STATE, pReply);
+        break;
+    case commsLink_REQUEST:
+        buildState(pSession, commsLink_RESPONSE, pReply);
+        break;
+    case commsLink_FORMAT:
+        status = applyFormat(pSession, pBody, bodyLen);
+        if (status != calc_funStatus_SUCCESS) {
+            buildResult(status, 0, pReply);
+        } else {
+            buildState(pSession, commsLink_STATE, pReply);
+        }
+        break;
+    default:
+        // E.g. new programs, which the server has no room for.
+        buildResult(calc_funStatus_UNKNOWN_PARAMETER, 0, pReply);
+        break;
+    }
+}
+
+/**
+ * @brief Handle one received message, adding the reply to the transmit
+ * buffer.
+ * @param pConn Pointer to the connection.
+ * @param decodeStatus Status of decoding the message.
+ * @param pRequest Pointer to the received message.
+ */
+static void handleFrame(serverConn_t *pConn, commsDecodeStatus_t decodeStatus,
+                        const commsFrame_t *pRequest) {
+    commsFrame_t reply;
+    reply.msgType = COMMS_MT_ACK;
+    reply.settings = 0;
+    reply.bodyLen = 0;
+
+    if (decodeStatus == commsDecode_CHECK_ERROR) {
+        reply.msgType = COMMS_MT_NACK;
+    } else if (pRequest->msgType == 0) {
+        // Connection event
+        pConn->connected = true;
+    } else if (!pConn->connected) {
+        reply.msgType = COMMS_MT_NACK;
+    } else if (pRequest->msgType & COMMS_MT_NACK) {
+        // The client didn't get the last reply, send it again.
+        reply = pConn->lastReply;
+        reply.msgType |= COMMS_MT_RETRANSMISSION;
+    } else if (pRequest->msgType & COMMS_MT_DATA) {
+        // Reply with the same integrity checks as the request.
+        reply.settings = pRequest->settings &
+                         (COMMS_SETTING_CHECKSUM | COMMS_SETTING_CRC);
+        if (pRequest->bodyLen > 0) {
+            reply.msgType |= COMMS_MT_DATA;
+            handleData(pConn, pRequest, &reply);
+        }
+    } else {
+        // A plain acknowledgement of a reply, nothing to answer.
+        return;
+    }
+    pConn->lastReply = reply;
+    pConn->txLen += comms_encode(&reply, &pConn->txBuf[pConn->txLen],
+                                 SERVER_TX_BUF_SIZE - pConn->txLen);
+}
+
+/**
+ * @brief Set the epoll events of a connection.
+ * @param pConn Pointer to the connection.
+ */
+static void updateEvents(serverConn_t *pConn) {
+    struct epoll_event event = {.data.ptr = pConn};
+    if (!pConn->rxPaused) {
+        event.events |= EPOLLIN;
+    }
+    if (pConn->txSent < pConn->txLen) {
+        event.events |= EPOLLOUT;
+    }
+    epoll_ctl(epollFd, EPOLL_CTL_MOD, pConn->fd, &event);
+}
+
+/**
+ * @brief Close a connection and return its calculator state to the pool.
+ * @param pConn Pointer to the connection.
+ * @param defaultFormat Number format new connections start with.
+ */
+static void closeConn(serverConn_t *pConn, numberFormat_t defaultFormat) {
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, pConn->fd, NULL);
+    close(pConn->fd);
+    sessionGive(pConn->pSession, defaultFormat);
+    free(pConn);
+}
+
+/**
+ * @brief Send as much of the transmit buffer as the socket takes.
+ * @param pConn Pointer to the connection.
+ * @return False if the connection failed.
+ */
+static bool flushTx(serverConn_t *pConn) {
+    while (pConn->txSent < pConn->txLen) {
+        ssize_t n = send(pConn->fd, &pConn->txBuf[pConn->txSent],
+                         pConn->txLen - pConn->txSent, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        pConn->txSent += (size_t)n;
+    }
+    pConn->txLen = 0;
+    pConn->txSent = 0;
+    return true;
+}
+
+/**
+ * @brief Decode and answer the received messages, as long as the replies
+ * fit in the transmit buffer.
+ * @param pConn Pointer to the connection.
+ */
+static void processRx(serverConn_t *pConn) {
+    size_t pos = 0;
+    commsFrame_t request;
+    while (SERVER_TX_BUF_SIZE - pConn->txLen >= COMMS_MAX_FRAME_LEN) {
+        size_t consumed = 0;
+        commsDecodeStatus_t status = comms_decode(
+            &pConn->rxBuf[pos], pConn->rxLen - pos, &request, &consumed);
+        if (status == commsDecode_INCOMPLETE) {
+            break;
+        }
+        pos += consumed;
+        if (status != commsDecode_SKIPPED) {
+            handleFrame(pConn, status, &request);
+        }
+    }
+    memmove(pConn->rxBuf, &pConn->rxBuf[pos], pConn->rxLen - pos);
+    pConn->rxLen -= pos;
+    // Stop reading until the client has read its replies.
+    pConn->rxPaused =
+        SERVER_TX_BUF_SIZE - pConn->txLen < COMMS_MAX_FRAME_LEN;
+}
+
+/**
+ * @brief Handle the epoll events of a connection.
+ * @param pConn Pointer to the connection.
+ * @param events Events from epoll.
+ * @param defaultFormat Number format new connections start with.
+ */
+static void handleConn(serverConn_t *pConn, uint32_t events,
+                       numberFormat_t defaultFormat) {
+    if ((events & EPOLLIN) && pConn->rxLen < SERVER_RX_BUF_SIZE) {
+        ssize_t n = recv(pConn->fd, &pConn->rxBuf[pConn->rxLen],
+                         SERVER_RX_BUF_SIZE - pConn->rxLen, 0);
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+            closeConn(pConn, defaultFormat);
+            return;
+        }
+        if (n > 0) {
+            pConn->rxLen += (size_t)n;
+        }
+    } else if (events & (EPOLLERR | EPOLLHUP)) {
+        closeConn(pConn, defaultFormat);
+        return;
+    }
+    // Sending first makes room for the replies of paused messages.
+    if (!flushTx(pConn)) {
+        closeConn(pConn, defaultFormat);
+        return;
+    }
+    processRx(pConn);
+    if (!flushTx(pConn)) {
+        closeConn(pConn, defaultFormat);
+        return;
+    }
+    if (pConn->rxPaused && pConn->txLen == 0) {
+        // All replies were sent, so the rest can be processed right away.
+        processRx(pConn);
+        if (!flushTx(pConn)) {
+            closeConn(pConn, defaultFormat);
+            return;
+        }
+    }
+    updateEvents(pConn);
+}
+
+/**
+ * @brief Accept the pending connections of the listening socket.
+ * @param listenFd Listening socket.
+ */
+static void acceptConns(int listenFd) {
+    while (true) {
+        int fd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+        // Small replies shouldn't wait for more data on TCP.
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        serverSession_t *pSession = sessionTake();
+        serverConn_t *pConn = NULL;
+        if (pSession != NULL) {
+            pConn = malloc(sizeof(serverConn_t));
+        }
+        if (pConn == NULL) {
+            // All calculator states are in use.
+            if (pSession != NULL) {
+                pSession->pNextFree = pFreeSessions;
+                pFreeSessions = pSession;
+            }
+            close(fd);
+            continue;
+        }
+        pConn->fd = fd;
+        pConn->pSession = pSession;
+        pConn->connected = false;
+        pConn->rxPaused = false;
+        pConn->rxLen = 0;
+        pConn->txLen = 0;
+        pConn->txSent = 0;
+        memset(&pConn->lastReply, 0, sizeof(commsFrame_t));
+        struct epoll_event event = {.events = EPOLLIN, .data.ptr = pConn};
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+            pSession->pNextFree = pFreeSessions;
+            pFreeSessions = pSession;
+            close(fd);
+            free(pConn);
+        }
+    }
+}
+
+/**
+ * @brief Open the listening socket.
+ * @param pPath Path of the Unix-domain socket, used if port is 0.
+ * @param port Loopback TCP port, or 0.
+ * @return The socket, or -1.
+ */
+static int openListener(const char *pPath, uint16_t port) {
+    int fd;
+    if (port != 0) {
+        fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            return -1;
+        }
+        int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        struct sockaddr_in addr = {
+            .sin_family = AF_INET,
+            .sin_port = htons(port),
+            .sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+        };
+        if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+            close(fd);
+            return -1;
+        }
+    } else {
+        struct sockaddr_un addr = {.sun_family = AF_UNIX};
+        if (strlen(pPath) >= sizeof(addr.sun_path)) {
+            return -1;
+        }
+        fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            return -1;
+        }
+        strcpy(addr.sun_path, pPath);
+        unlink(pPath);
+        if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+            close(fd);
+            return -1;
+        }
+    }
+    if (listen(fd, SOMAXCONN) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Print the usage of the server.
+ * @param pName Name of the executable.
+ */
+static void printUsage(const char *pName) {
+    fprintf(stderr,
+            "Usage: %s [-u path | -p port] [-n sessions] [-c entries]\n"
+            "Serves the calculator over the protocol in "
+            "software/comms/README.md.\n"
+            "  -u  Unix-domain socket path, default " SERVER_DEFAULT_PATH
+            "\n"
+            "  -p  listen on this loopback TCP port instead\n"
+            "  -n  number of calculator states, i.e. concurrent "
+            "connections, default %i\n"
+            "  -c  share a cache of this many solved inputs between the "
+            "sessions\n",
+            pName, SERVER_DEFAULT_SESSIONS);
+}
+
+int main(int argc, char **argv) {
+    const char *pPath = SERVER_DEFAULT_PATH;
+    uint16_t port = 0;
+    int numSessions = SERVER_DEFAULT_SESSIONS;
+    int cacheEntries = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "u:p:n:c:h")) != -1) {
+        switch (opt) {
+        case 'u':
+            pPath = optarg;
+            break;
+        case 'p':
+            port = (uint16_t)atoi(optarg);
+            break;
+        case 'n':
+            numSessions = atoi(optarg);
+            break;
+        case 'c':
+            cacheEntries = atoi(optarg);
+            break;
+        default:
+            printUsage(argv[0]);
+            return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (numSessions < 1) {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    if (cacheEntries > 0) {
+        static calcResultCache_t resultCache;
+        if (resultCache_init(&resultCache, (uint32_t)cacheEntries) !=
+            calc_funStatus_SUCCESS) {
+            fprintf(stderr, "comscicalc_server: out of memory\n");
+            return 1;
+        }
+        pResultCache = &resultCache;
+    }
+
+    // Initialize all calculator states up front, so that connections
+    // don't set anything up.
+    pSessions = calloc((size_t)numSessions, sizeof(serverSession_t));
+    if (pSessions == NULL) {
+        fprintf(stderr, "comscicalc_server: out of memory\n");
+        return 1;
+    }
+    calc_coreInit(&pSessions[0].calcCore);
+    numberFormat_t defaultFormat = pSessions[0].calcCore.numberFormat;
+    defaultFormat.inputBase = inputBase_DEC;
+    for (int i = numSessions - 1; i >= 0; i--) {
+        calc_coreInit(&pSessions[i].calcCore);
+        sessionGive(&pSessions[i], defaultFormat);
+    }
+
+    int listenFd = openListener(pPath, port);
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (listenFd < 0 || epollFd < 0) {
+        perror("comscicalc_server");
+        return 1;
+    }
+    struct epoll_event listenEvent = {.events = EPOLLIN, .data.ptr = NULL};
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &listenEvent);
+    signal(SIGPIPE, SIG_IGN);
+
+    struct epoll_event events[SERVER_MAX_EVENTS];
+    while (true) {
+        int numEvents = epoll_wait(epollFd, events, SERVER_MAX_EVENTS, -1);
+        if (numEvents < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("comscicalc_server: epoll_wait");
+            return 1;
+        }
+        for (int i = 0; i < numEvents; i++) {
+            if (events[i].data.ptr == NULL) {
+                acceptConns(listenFd);
+            } else {
+                handleConn(events[i].data.ptr, events[i].events,
+                           defaultFormat);
+            }
+        }
+    }
+}
@@ -15,6 +15,9 @@
  * 2. ComSciCalc_lib shall catch unsolvable, syntax correct expressions (e.g.
  * divide by zero)
  * 3. ComSciCalc_lib shall catch and highlight incorrect syntax.
+ * 4. Solving an expression of n entries shall allocate at most n entries,
+ * free all it allocates, call each operator once, and take at most 12n steps
+ * through the list.
  */
 
 // Standard lib
@@ -280,6 +283,15 @@ testParams_t params_unsolvable[] = {
         .inputBase = {[0 ... MAX_STR_LEN - 1] = inputBase_DEC},
         .expectedResult = 0, // There shouldn't be a result
     },
+    {
+        // The operator must not take the 4 before the bracket.
+        .pInputString = "4(/4)0\0",
+        .pCursor = {0, 0, 0},
+        .pExpectedString = "4(/4)0\0",
+        //
+        .inputBase = {[0 ... MAX_STR_LEN - 1] = inputBase_DEC},
+        .expectedResult = 0, // There shouldn't be a result
+    },
     {
         .pInputString = "123(\0",
         .pCursor = {0, 0, 0},
@@ -296,6 +308,24 @@ testParams_t params_unsolvable[] = {
         .inputBase = {[0 ... MAX_STR_LEN - 1] = inputBase_DEC},
         .expectedResult = 0, // There shouldn't be a result
     },
+    {
+        // Balanced depth, but nothing to solve. Used to loop forever.
+        .pInputString = ")^\0",
+        .pCursor = {0, 0, 0},
+        .pExpectedString = ")XOR(\0",
+        //
+        .inputBase = {[0 ... MAX_STR_LEN - 1] = inputBase_DEC},
+        .expectedResult = 0, // There shouldn't be a result
+    },
+    {
+        // Fewer arguments than commas. Used to leak the argument buffer.
+        .pInputString = "s1,)\0",
+        .pCursor = {0, 0, 0},
+        .pExpectedString = "SUM(1,)\0",
+        //
+        .inputBase = {[0 ... MAX_STR_LEN - 1] = inputBase_DEC},
+        .expectedResult = 0, // There shouldn't be a result
+    },
 };
 void test_unsolvable_solution(void) {
     calcCoreState_t calcCore;
@@ -461,4 +491,99 @@ void test_logic_operations(void) {
             printf("************************************************\r\n\r\n");
         }
     }
-}
\ No newline at end of file
+}
+testParams_t cancel_expression[] = {
+    {
+        .pInputString = "123+(456+789)/1011\0",
+        .pCursor = {0, 0, 0},
+        .pExpectedString = "123+(456+789)/1011\0",
+        //
+        .inputBase = {[0 ... MAX_STR_LEN - 1] = inputBase_DEC},
+        .expectedResult = 0,
+    },
+};
+// Cancel function used by test_solver_cancel. Cancels on the second poll.
+static bool cancelOnSecondPoll(void *pArg) {
+    int *pNumPolls = (int *)pArg;
+    (*pNumPolls)++;
+    return *pNumPolls >= 2;
+}
+// This test checks that a cancelled solve stops early and frees everything
+void test_solver_cancel(void) {
+    calcCoreState_t calcCore;
+    int numTests = sizeof(cancel_expression) / sizeof(cancel_expression[0]);
+    for (int i = 0; i < numTests; i++) {
+        int numPolls = 0;
+        setupTestStruct(&calcCore, &cancel_expression[i]);
+        calcCoreAddInput(&calcCore, &cancel_expression[i]);
+        calcCore.pSolverCancelFun = cancelOnSecondPoll;
+        calcCore.pSolverCancelArg = &numPolls;
+        calc_funStatus_t state = calc_solver(&calcCore);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(calc_funStatus_SOLVE_CANCELLED, state,
+                                      "Solve not cancelled.");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(2, numPolls, "Solver polled too often.");
+        TEST_ASSERT_FALSE(calcCore.solved);
+
+        // The input must be left intact so it can be solved again
+        calcCore.pSolverCancelFun = NULL;
+        state = calc_solver(&calcCore);
+        TEST_ASSERT_EQUAL_INT(calc_funStatus_SUCCESS, state);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(124, calcCore.result,
+                                      "Result not right.");
+        calcCoreGetBuffer(&calcCore, pOutputString);
+        TEST_ASSERT_EQUAL_STRING(cancel_expression[i].pExpectedString,
+                                 pOutputString);
+        teardownTestStruct(&calcCore);
+        TEST_ASSERT_EQUAL_UINT_MESSAGE(0, calcCore.allocCounter,
+                                       "Leaky memory!");
+    }
+}
+
+//! Most steps through the list the solver may take per entry. With four
+//! operator priorities, the worst inputs take just under 10.
+#define SOLVER_STEPS_PER_ENTRY 12
+
+/**
+ * @brief Check the work budget of solving one expression
+ * @param pParams Pointer to the parameters of the expression
+ */
+static void checkSolverBudget(testParams_t *pParams) {
+    calcCoreState_t calcCore;
+    setupTestStruct(&calcCore, pParams);
+    calcCoreAddInput(&calcCore, pParams);
+    uint32_t numEntries = countInputEntries(&calcCore);
+    uint32_t numOperators = countOperatorEntries(&calcCore);
+
+    calc_resetCounters(&calcCore);
+    calc_solver(&calcCore);
+    // The solver works on a copy of the input, one entry per entry.
+    TEST_ASSERT_BUDGET_MESSAGE(numEntries, &calcCore, numAllocations,
+                               pParams->pInputString);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(calcCore.counters.numAllocations,
+                                     calcCore.counters.numFrees,
+                                     pParams->pInputString);
+    TEST_ASSERT_BUDGET_MESSAGE(2 * numEntries, &calcCore, peakLiveEntries,
+                               pParams->pInputString);
+    TEST_ASSERT_BUDGET_MESSAGE(numOperators, &calcCore, numOperatorCalls,
+                               pParams->pInputString);
+    // Each entry is passed a fixed number of times: when looking for the
+    // next expression, once per operator priority, and when reading out the
+    // arguments of a function.
+    TEST_ASSERT_BUDGET_MESSAGE(SOLVER_STEPS_PER_ENTRY * numEntries, &calcCore,
+                               numListSteps, pParams->pInputString);
+    teardownTestStruct(&calcCore);
+}
+
+// This test checks the work done by the solver, so that a change that
+// makes it slower fails like a wrong result would.
+void test_solver_budget(void) {
+    TEST_REQUIRE_COUNTERS();
+    int numTests = sizeof(params_solvable) / sizeof(params_solvable[0]);
+    for (int i = 0; i < numTests; i++) {
+        checkSolverBudget(&params_solvable[i]);
+    }
+    numTests = sizeof(long_expression) / sizeof(long_expression[0]);
+    for (int i = 0; i < numTests; i++) {
+        checkSolverBudget(&long_expression[i]);
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for encoding and decoding protocol layer messages.
+ *
+ *
+ * Requirements:
+ * 1. A decoded message shall equal the encoded message, with and without
+ *    checksum and CRC.
+ * 2. Bytes in front of a SOM shall be skipped, and a partly received
+ *    message shall be reported as incomplete without consuming anything.
+ * 3. A message with a wrong checksum or CRC shall be reported as such,
+ *    and consumed, so that the next message can be decoded.
+ */
+
+// Standard lib
+#include <string.h>
+
+#include "test_suite.h"
+
+#include "../comms/comms_frame.h"
+
+/**
+ * @brief Encode a message and decode it again.
+ * @param settings Settings of the message.
+ * @param bodyLen Number of bytes in the body.
+ */
+static void checkRoundTrip(uint32_t settings, uint8_t bodyLen) {
+    commsFrame_t frame;
+    commsFrame_t decoded;
+    uint8_t buf[COMMS_MAX_FRAME_LEN];
+    frame.msgType = COMMS_MT_DATA | COMMS_MT_ACK;
+    frame.settings = settings;
+    frame.bodyLen = bodyLen;
+    for (int i = 0; i < bodyLen; i++) {
+        frame.body[i] = (uint8_t)(i * 7);
+    }
+    size_t length = comms_encode(&frame, buf, sizeof(buf));
+    TEST_ASSERT_NOT_EQUAL(0, length);
+    size_t consumed = 0;
+    TEST_ASSERT_EQUAL_INT(commsDecode_FRAME,
+                          comms_decode(buf, length, &decoded, &consumed));
+    TEST_ASSERT_EQUAL_INT(length, consumed);
+    TEST_ASSERT_EQUAL_INT(frame.msgType, decoded.msgType);
+    TEST_ASSERT_EQUAL_INT(frame.settings, decoded.settings);
+    TEST_ASSERT_EQUAL_INT(frame.bodyLen, decoded.bodyLen);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(frame.body, decoded.body, bodyLen));
+}
+
+// This test checks encoding and decoding of messages.
+void test_comms_frame(void) {
+    // CRC-16/CCITT-FALSE check value
+    TEST_ASSERT_EQUAL_INT(0x29B1,
+                          comms_crc16((const uint8_t *)"123456789", 9));
+
+    checkRoundTrip(0, 0);
+    checkRoundTrip(0, 5);
+    checkRoundTrip(COMMS_SETTING_CHECKSUM, 17);
+    checkRoundTrip(COMMS_SETTING_CRC, 100);
+    checkRoundTrip(COMMS_SETTING_CHECKSUM | COMMS_SETTING_CRC | 0x350,
+                   COMMS_MAX_BODY_LEN);
+
+    // Connection event: all header, no body
+    commsFrame_t frame = {.msgType = 0, .settings = 0, .bodyLen = 0};
+    uint8_t expected[] = {0x1B, 0x5F, 0x9F, 0, 0, 0, 0, 0};
+    uint8_t buf[2 * COMMS_MAX_FRAME_LEN];
+    TEST_ASSERT_EQUAL_INT(COMMS_HEADER_LEN,
+                          comms_encode(&frame, buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, buf, sizeof(expected)));
+    // Too small buffer
+    TEST_ASSERT_EQUAL_INT(0, comms_encode(&frame, buf, COMMS_HEADER_LEN - 1));
+}
+
+// This test checks decoding of garbled and partial input.
+void test_comms_frame_stream(void) {
+    commsFrame_t frame = {.msgType = COMMS_MT_DATA,
+                          .settings = COMMS_SETTING_CRC,
+                          .bodyLen = 4,
+                          .body = {commsLink_EVAL, '1', '+', '2'}};
+    commsFrame_t decoded;
+    uint8_t buf[3 * COMMS_MAX_FRAME_LEN];
+    // ASCII in front of two messages
+    memcpy(buf, "hi\x1b", 3);
+    size_t length = 3;
+    size_t frameLength =
+        comms_encode(&frame, &buf[length], COMMS_MAX_FRAME_LEN);
+    length += frameLength;
+    length += comms_encode(&frame, &buf[length], COMMS_MAX_FRAME_LEN);
+
+    size_t consumed = 0;
+    TEST_ASSERT_EQUAL_INT(commsDecode_SKIPPED,
+                          comms_decode(buf, length, &decoded, &consumed));
+    TEST_ASSERT_EQUAL_INT(3, consumed);
+    size_t pos = consumed;
+
+    // Partial messages, also partial SOMs, aren't consumed.
+    for (size_t i = 1; i < frameLength; i++) {
+        TEST_ASSERT_EQUAL_INT(
+            commsDecode_INCOMPLETE,
+            comms_decode(&buf[pos], i, &decoded, &consumed));
+        TEST_ASSERT_EQUAL_INT(0, consumed);
+    }
+    TEST_ASSERT_EQUAL_INT(
+        commsDecode_FRAME,
+        comms_decode(&buf[pos], length - pos, &decoded, &consumed));
+    TEST_ASSERT_EQUAL_INT(frameLength, consumed);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(frame.body, decoded.body, 4));
+    pos += consumed;
+
+    // Flip a bit in the body of the second message.
+    buf[pos + COMMS_HEADER_LEN + 1] ^= 0x01;
+    TEST_ASSERT_EQUAL_INT(
+        commsDecode_CHECK_ERROR,
+        comms_decode(&buf[pos], length - pos, &decoded, &consumed));
+    TEST_ASSERT_EQUAL_INT(frameLength, consumed);
+
+    // Same for the checksum.
+    frame.settings = COMMS_SETTING_CHECKSUM;
+    length = comms_encode(&frame, buf, sizeof(buf));
+    buf[length - 1] ^= 0x80;
+    TEST_ASSERT_EQUAL_INT(commsDecode_CHECK_ERROR,
+                          comms_decode(buf, length, &decoded, &consumed));
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for evaluating batches of expressions on several threads.
+ *
+ *
+ * Requirements:
+ * 1. calc_evalBatch shall give the same result and status for each
+ *    expression as calc_evalString, for any number of threads.
+ * 2. Every expression shall be evaluated, also when there are more
+ *    threads than expressions.
+ * 3. A pool shall be reusable for any number of batches, of any size.
+ */
+
+// Standard lib
+#include <stdio.h>
+#include <string.h>
+
+#include "test_suite.h"
+
+#include "../comSciCalc_lib/comscicalc.h"
+#include "../comSciCalc_lib/eval_batch.h"
+
+#define NUM_BATCH_EXPRS 3000
+#define BATCH_EXPR_LEN 48
+
+static char batchInput[NUM_BATCH_EXPRS][BATCH_EXPR_LEN];
+static calcExprSpan_t batchExprs[NUM_BATCH_EXPRS];
+static SUBRESULT_INT batchResults[NUM_BATCH_EXPRS];
+static calc_funStatus_t batchStatuses[NUM_BATCH_EXPRS];
+
+/**
+ * @brief Check a batch against calc_evalString, one expression at a time
+ * @param pPool Pointer to the pool to evaluate the batch on
+ * @param numExprs Number of expressions in the batch
+ * @param numberFormat Number format of the batch
+ */
+static void checkBatch(calcEvalPool_t *pPool, size_t numExprs,
+                       numberFormat_t numberFormat) {
+    // Make sure that every entry is written.
+    memset(batchResults, 0x55, sizeof(batchResults));
+    memset(batchStatuses, 0x55, sizeof(batchStatuses));
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           calc_evalBatch(pPool, batchExprs, numExprs,
+                                          numberFormat, batchResults,
+                                          batchStatuses));
+    for (size_t i = 0; i < numExprs; i++) {
+        SUBRESULT_INT expectedResult = 0;
+        calc_funStatus_t expectedStatus =
+            calc_evalString(batchExprs[i].pString, batchExprs[i].length,
+                            numberFormat, &expectedResult);
+        TEST_ASSERT_EQUAL_INT8_MESSAGE(expectedStatus, batchStatuses[i],
+                                       batchExprs[i].pString);
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(expectedResult, batchResults[i],
+                                        batchExprs[i].pString);
+    }
+}
+
+// This test checks batches against calc_evalString.
+void test_eval_batch(void) {
+    calcCoreState_t calcCore;
+    calc_coreInit(&calcCore);
+    numberFormat_t numberFormat = calcCore.numberFormat;
+    numberFormat.inputBase = inputBase_DEC;
+
+    // Mix short, long and unsolvable expressions, so that the workers
+    // finish their ranges at different times.
+    for (int i = 0; i < NUM_BATCH_EXPRS; i++) {
+        if (i % 7 == 0) {
+            snprintf(batchInput[i], BATCH_EXPR_LEN, "%i/(%i-%i)", i, i, i);
+        } else if (i < NUM_BATCH_EXPRS / 4) {
+            snprintf(batchInput[i], BATCH_EXPR_LEN,
+                     "s%i,(%i+1)*3,%i<2,((%i)))-%i", i, i, i, i, i);
+        } else {
+            snprintf(batchInput[i], BATCH_EXPR_LEN, "%i*(%i+7)", i, i);
+        }
+        batchExprs[i].pString = batchInput[i];
+        batchExprs[i].length = strlen(batchInput[i]);
+    }
+
+    calcEvalPool_t pool;
+    uint16_t poolThreads[] = {1, 3, 0};
+    int numPools = sizeof(poolThreads) / sizeof(poolThreads[0]);
+    for (int i = 0; i < numPools; i++) {
+        TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                               calc_evalPoolInit(&pool, poolThreads[i]));
+        checkBatch(&pool, NUM_BATCH_EXPRS, numberFormat);
+        calc_evalPoolFree(&pool);
+    }
+
+    // More threads than expressions.
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           calc_evalPoolInit(&pool, 8));
+    checkBatch(&pool, 5, numberFormat);
+    // The same pool is reused for batches of all sizes.
+    for (size_t numExprs = 1; numExprs <= NUM_BATCH_EXPRS; numExprs *= 3) {
+        checkBatch(&pool, numExprs, numberFormat);
+    }
+    checkBatch(&pool, NUM_BATCH_EXPRS, numberFormat);
+    // An empty batch has nothing to do.
+    TEST_ASSERT_EQUAL_INT8(
+        calc_funStatus_SUCCESS,
+        calc_evalBatch(&pool, NULL, 0, numberFormat, NULL, NULL));
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_UNKNOWN_PARAMETER,
+                           calc_evalBatch(&pool, batchExprs, 1, numberFormat,
+                                          NULL, batchStatuses));
+    calc_evalPoolFree(&pool);
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_UNKNOWN_PARAMETER,
+                           calc_evalBatch(NULL, batchExprs, 1, numberFormat,
+                                          batchResults, batchStatuses));
+}
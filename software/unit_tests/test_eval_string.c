@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for evaluating strings without a calculator state.
+ *
+ *
+ * Requirements:
+ * 1. calc_evalString shall give the same result and status as adding the
+ *    same string to a calculator state and solving it.
+ * 2. calc_evalString shall report input nesting deeper than its fixed
+ *    stacks as an allocation error, instead of writing outside of them.
+ */
+
+// Standard lib
+#include <string.h>
+
+#include "test_suite.h"
+
+#include "../comSciCalc_lib/comscicalc.h"
+
+/**
+ * @brief Input and format of one calc_evalString test
+ */
+typedef struct evalTestParams {
+    //! Null terminated input
+    const char *pInputString;
+    //! Input base of the input
+    inputBase_t inputBase;
+    //! Format to evaluate in
+    inputFormat_t inputFormat;
+} evalTestParams_t;
+
+evalTestParams_t eval_string_test_params[] = {
+    // Solvable
+    {"12+3", inputBase_DEC, INPUT_FMT_INT},
+    {"2+3*4", inputBase_DEC, INPUT_FMT_INT},
+    {"2*3+4", inputBase_DEC, INPUT_FMT_INT},
+    {"10-4-3", inputBase_DEC, INPUT_FMT_INT},
+    {"100/10/5", inputBase_DEC, INPUT_FMT_INT},
+    {"1<3+1", inputBase_DEC, INPUT_FMT_INT},
+    {"(1+2)*3", inputBase_DEC, INPUT_FMT_INT},
+    {"((2))", inputBase_DEC, INPUT_FMT_INT},
+    {"s1,2,3)", inputBase_DEC, INPUT_FMT_INT},
+    {"s1+2,3*4)*2", inputBase_DEC, INPUT_FMT_INT},
+    {"&12,10)|s1,2)", inputBase_DEC, INPUT_FMT_INT},
+    {"1.5+1", inputBase_DEC, INPUT_FMT_INT},
+    {"a*(b+7)", inputBase_HEX, INPUT_FMT_INT},
+    {"101<10", inputBase_BIN, INPUT_FMT_INT},
+    {"1.5+2.25", inputBase_DEC, INPUT_FMT_FLOAT},
+    {"0.5*3", inputBase_DEC, INPUT_FMT_FIXED},
+    // Not solvable
+    {"1+", inputBase_DEC, INPUT_FMT_INT},
+    {"(1", inputBase_DEC, INPUT_FMT_INT},
+    {"1)", inputBase_DEC, INPUT_FMT_INT},
+    {"()", inputBase_DEC, INPUT_FMT_INT},
+    {"(1,2)", inputBase_DEC, INPUT_FMT_INT},
+    {"s)", inputBase_DEC, INPUT_FMT_INT},
+    {".5", inputBase_DEC, INPUT_FMT_INT},
+    {"8/0", inputBase_DEC, INPUT_FMT_INT},
+    {"1+x", inputBase_DEC, INPUT_FMT_INT},
+    {"1+(2", inputBase_NONE, INPUT_FMT_INT},
+};
+
+/**
+ * @brief Solve a string the interactive way, one character at a time
+ * @param pString Null terminated input
+ * @param numberFormat Number format to solve in
+ * @param pResult Pointer to where the result is written
+ * @return Status of the first failing add, otherwise of the solver
+ */
+static calc_funStatus_t solveInteractive(const char *pString,
+                                         numberFormat_t numberFormat,
+                                         SUBRESULT_INT *pResult) {
+    calcCoreState_t calcCore;
+    calc_coreInit(&calcCore);
+    calcCore.numberFormat = numberFormat;
+    calc_funStatus_t status = calc_funStatus_SUCCESS;
+    while (*pString != '\0' && status == calc_funStatus_SUCCESS) {
+        status = calc_addInput(&calcCore, *pString++);
+    }
+    if (status == calc_funStatus_SUCCESS) {
+        status = calc_solver(&calcCore);
+        *pResult = calcCore.result;
+    }
+    calc_coreBufferTeardown(&calcCore);
+    return status;
+}
+
+// This test checks calc_evalString against the interactive path.
+void test_eval_string(void) {
+    calcCoreState_t calcCore;
+    calc_coreInit(&calcCore);
+    int numTests =
+        sizeof(eval_string_test_params) / sizeof(eval_string_test_params[0]);
+    for (int i = 0; i < numTests; i++) {
+        evalTestParams_t *pParams = &eval_string_test_params[i];
+        numberFormat_t numberFormat = calcCore.numberFormat;
+        numberFormat.inputBase = pParams->inputBase;
+        numberFormat.inputFormat = pParams->inputFormat;
+
+        SUBRESULT_INT expectedResult = 0;
+        SUBRESULT_INT result = 0;
+        calc_funStatus_t expectedStatus = solveInteractive(
+            pParams->pInputString, numberFormat, &expectedResult);
+        calc_funStatus_t status = calc_evalString(
+            pParams->pInputString, strlen(pParams->pInputString),
+            numberFormat, &result);
+        TEST_ASSERT_EQUAL_INT8_MESSAGE(expectedStatus, status,
+                                       pParams->pInputString);
+        if (expectedStatus == calc_funStatus_SUCCESS) {
+            TEST_ASSERT_EQUAL_INT64_MESSAGE(expectedResult, result,
+                                            pParams->pInputString);
+        }
+    }
+
+    // Spot check a few results, so that both paths can't be wrong together
+    numberFormat_t numberFormat = calcCore.numberFormat;
+    numberFormat.inputBase = inputBase_DEC;
+    SUBRESULT_INT result = 0;
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           calc_evalString("2+3*4", 5, numberFormat, &result));
+    TEST_ASSERT_EQUAL_INT64(14, result);
+    TEST_ASSERT_EQUAL_INT8(
+        calc_funStatus_SUCCESS,
+        calc_evalString("s1+2,3*4)*2", 11, numberFormat, &result));
+    TEST_ASSERT_EQUAL_INT64(30, result);
+    // Only the given length is read.
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           calc_evalString("12+3)", 4, numberFormat, &result));
+    TEST_ASSERT_EQUAL_INT64(15, result);
+}
+
+// This test checks the limits and argument checks of calc_evalString.
+void test_eval_string_limits(void) {
+    calcCoreState_t calcCore;
+    calc_coreInit(&calcCore);
+    numberFormat_t numberFormat = calcCore.numberFormat;
+    numberFormat.inputBase = inputBase_DEC;
+    SUBRESULT_INT result = 0;
+
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_INPUT_LIST_NULL,
+                           calc_evalString("", 0, numberFormat, &result));
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_INPUT_LIST_NULL,
+                           calc_evalString(NULL, 3, numberFormat, &result));
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_UNKNOWN_PARAMETER,
+                           calc_evalString("1+2", 3, numberFormat, NULL));
+
+    // One level deeper than the stacks fit.
+    char input[2 * CALC_EVAL_STACK_SIZE + 3];
+    size_t length = 0;
+    for (int i = 0; i < CALC_EVAL_STACK_SIZE + 1; i++) {
+        input[length++] = '(';
+    }
+    input[length++] = '1';
+    for (int i = 0; i < CALC_EVAL_STACK_SIZE + 1; i++) {
+        input[length++] = ')';
+    }
+    TEST_ASSERT_EQUAL_INT8(
+        calc_funStatus_ALLOCATE_ERROR,
+        calc_evalString(input, length, numberFormat, &result));
+    // ... but one level less is fine.
+    TEST_ASSERT_EQUAL_INT8(
+        calc_funStatus_SUCCESS,
+        calc_evalString(&input[1], length - 2, numberFormat, &result));
+    TEST_ASSERT_EQUAL_INT64(1, result);
+}
@@ -561,4 +561,17 @@ void test_format_conversion(void) {
             printf("************************************************\r\n\r\n");
         }
     }
+
+    // The format can't change in the middle of a number, but it can with
+    // the cursor at the very start of the input.
+    calc_coreInit(&calcCore);
+    calcCore.numberFormat.inputBase = inputBase_DEC;
+    calc_addInput(&calcCore, '1');
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_FORMAT_ERROR,
+                           calc_updateInputFormat(&calcCore, INPUT_FMT_FIXED));
+    calcCore.cursorPosition = 1;
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           calc_updateInputFormat(&calcCore, INPUT_FMT_FIXED));
+    TEST_ASSERT_EQUAL_INT8(INPUT_FMT_FIXED, calcCore.numberFormat.inputFormat);
+    calc_coreBufferTeardown(&calcCore);
 }
\ No newline at end of file
@@ -11,6 +11,9 @@
  * 3. Inputs shall be restricted to the current input format (dec, float, int).
  * 4. Inputs shall be restricted to the current input base (dec, bin hex).
  * 5. Cursor shall be limited to current expressions length.
+ * 6. Adding or removing an entry shall allocate or free at most one entry,
+ * and step through at most the entries of the input plus the cursor
+ * position. Printing shall not allocate.
  */
 
 // Standard lib
@@ -196,4 +199,65 @@ void test_addInvalidInput(void) {
         // in the calculator core
         TEST_ASSERT_EQUAL_INT(0, calcCore.allocCounter);
     }
-}
\ No newline at end of file
+}
+
+/*
+ * Work budget tests.
+ */
+const char *pBudgetInputs[] = {
+    "1+2+3+4+5+6+7+8",
+    "((((1+2)*3)+4)*5)",
+    "s1,2,3,4,5,6,7,8)",
+    "123+n456*(12+45))",
+};
+void test_input_budget(void) {
+    TEST_REQUIRE_COUNTERS();
+    calcCoreState_t calcCore;
+    int numTests = sizeof(pBudgetInputs) / sizeof(pBudgetInputs[0]);
+    for (int i = 0; i < numTests; i++) {
+        const char *pInput = pBudgetInputs[i];
+        calc_coreInit(&calcCore);
+        calcCore.numberFormat.inputBase = inputBase_DEC;
+        for (const char *pChar = pInput; *pChar != '\0'; pChar++) {
+            calc_addInput(&calcCore, *pChar);
+        }
+        uint32_t numEntries = countInputEntries(&calcCore);
+
+        // Add and remove an entry at every cursor position. The input is
+        // walked to the end, and then back to the cursor.
+        for (uint8_t cursor = 0; cursor <= numEntries; cursor++) {
+            calcCore.cursorPosition = cursor;
+            calc_resetCounters(&calcCore);
+            calc_addInput(&calcCore, '1');
+            TEST_ASSERT_BUDGET_MESSAGE(1, &calcCore, numAllocations, pInput);
+            TEST_ASSERT_BUDGET_MESSAGE(0, &calcCore, numFrees, pInput);
+            TEST_ASSERT_BUDGET_MESSAGE(numEntries + cursor, &calcCore,
+                                       numListSteps, pInput);
+
+            calc_resetCounters(&calcCore);
+            calc_removeInput(&calcCore);
+            TEST_ASSERT_BUDGET_MESSAGE(0, &calcCore, numAllocations, pInput);
+            TEST_ASSERT_BUDGET_MESSAGE(1, &calcCore, numFrees, pInput);
+            TEST_ASSERT_BUDGET_MESSAGE(numEntries + cursor + 1, &calcCore,
+                                       numListSteps, pInput);
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(
+                numEntries, countInputEntries(&calcCore), pInput);
+        }
+
+        // Printing walks the input once, but each opening bracket and
+        // comma also walks back to find its depth.
+        uint32_t numDepthLookups = 0;
+        for (const char *pChar = pInput; *pChar != '\0'; pChar++) {
+            numDepthLookups += (*pChar == '(' || *pChar == ',');
+        }
+        calcCore.cursorPosition = 0;
+        calc_resetCounters(&calcCore);
+        calcCoreGetBuffer(&calcCore, pOutputString);
+        TEST_ASSERT_BUDGET_MESSAGE(0, &calcCore, numAllocations, pInput);
+        TEST_ASSERT_BUDGET_MESSAGE(numEntries * (1 + numDepthLookups),
+                                   &calcCore, numListSteps, pInput);
+
+        calc_coreBufferTeardown(&calcCore);
+        TEST_ASSERT_EQUAL_UINT32(0, calcCore.counters.numLiveEntries);
+    }
+}
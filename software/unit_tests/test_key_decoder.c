@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for the terminal key decoder.
+ *
+ *
+ * Requirements:
+ * 1. The decoder shall decode arrow keys, Home, End and Delete, both in
+ *    their CSI and SS3 forms, including modifiers.
+ * 2. The decoder shall decode Ctrl-chars and Alt-chars.
+ * 3. The decoder shall mark chars inside a bracketed paste as pasted, and
+ *    not interpret them as keys.
+ * 4. The decoder shall give the same result regardless of how the input is
+ *    split up, i.e. it shall never depend on timeouts.
+ */
+
+// Standard lib
+#include <string.h>
+
+#include "test_suite.h"
+
+#include "../comSciCalc_lib/key_decoder.h"
+
+#define MAX_KEY_EVENTS 10
+
+typedef struct keyDecoderTestParams {
+    //! Input bytes, null terminated
+    char *pInput;
+    //! Number of expected events
+    uint8_t numEvents;
+    //! Expected events
+    keyEvent_t events[MAX_KEY_EVENTS];
+} keyDecoderTestParams_t;
+
+keyDecoderTestParams_t key_decoder_params[] = {
+    {
+        .pInput = "1+a",
+        .numEvents = 3,
+        .events = {{.type = keyType_CHAR, .c = '1'},
+                   {.type = keyType_CHAR, .c = '+'},
+                   {.type = keyType_CHAR, .c = 'a'}},
+    },
+    {
+        .pInput = "\x1b[A\x1b[B\x1b[C\x1b[D",
+        .numEvents = 4,
+        .events = {{.type = keyType_UP},
+                   {.type = keyType_DOWN},
+                   {.type = keyType_RIGHT},
+                   {.type = keyType_LEFT}},
+    },
+    {
+        .pInput = "\x1bOH\x1bOF\x1b[H\x1b[F\x1b[1~\x1b[4~\x1b[3~",
+        .numEvents = 7,
+        .events = {{.type = keyType_HOME},
+                   {.type = keyType_END},
+                   {.type = keyType_HOME},
+                   {.type = keyType_END},
+                   {.type = keyType_HOME},
+                   {.type = keyType_END},
+                   {.type = keyType_DELETE}},
+    },
+    {
+        .pInput = "\x1b[1;5C\x1b[1;2D",
+        .numEvents = 2,
+        .events = {{.type = keyType_RIGHT, .modifiers = KEY_MOD_CTRL},
+                   {.type = keyType_LEFT, .modifiers = KEY_MOD_SHIFT}},
+    },
+    {
+        .pInput = "\x01\x7f\r\x1bx",
+        .numEvents = 4,
+        .events = {{.type = keyType_CHAR, .c = 'a', .modifiers = KEY_MOD_CTRL},
+                   {.type = keyType_BACKSPACE},
+                   {.type = keyType_ENTER},
+                   {.type = keyType_CHAR, .c = 'x', .modifiers = KEY_MOD_ALT}},
+    },
+    {
+        .pInput = "\x1b\x1b[A\x1b[2~",
+        .numEvents = 3,
+        .events = {{.type = keyType_ESCAPE},
+                   {.type = keyType_UP},
+                   {.type = keyType_UNKNOWN}},
+    },
+    {
+        .pInput = "\x1b[200~1\x7f\x1b[201~i",
+        .numEvents = 5,
+        .events = {{.type = keyType_PASTE_START},
+                   {.type = keyType_CHAR, .c = '1', .pasted = true},
+                   {.type = keyType_CHAR, .c = 127, .pasted = true},
+                   {.type = keyType_PASTE_END},
+                   {.type = keyType_CHAR, .c = 'i'}},
+    },
+};
+
+/**
+ * @brief Feed bytes to a decoder, and collect the events.
+ * @param pDecoder Pointer to the decoder.
+ * @param pBytes Pointer to the bytes.
+ * @param len Number of bytes.
+ * @param pEvents Pointer to the events, appended to.
+ * @param pNumEvents Pointer to the number of events so far.
+ */
+static void feedKeyDecoder(keyDecoder_t *pDecoder, const char *pBytes, int len,
+                           keyEvent_t *pEvents, int *pNumEvents) {
+    for (int i = 0; i < len; i++) {
+        keyEvent_t event;
+        if (keyDecoder_feed(pDecoder, pBytes[i], &event)) {
+            TEST_ASSERT_LESS_THAN_INT_MESSAGE(MAX_KEY_EVENTS, *pNumEvents,
+                                              "Too many events");
+            pEvents[(*pNumEvents)++] = event;
+        }
+    }
+}
+
+/**
+ * @brief Check decoded events against the expected events.
+ * @param pExpected Pointer to the expected events.
+ * @param numExpected Number of expected events.
+ * @param pEvents Pointer to the decoded events.
+ * @param numEvents Number of decoded events.
+ */
+static void checkKeyEvents(const keyEvent_t *pExpected, int numExpected,
+                           const keyEvent_t *pEvents, int numEvents) {
+    TEST_ASSERT_EQUAL_INT_MESSAGE(numExpected, numEvents,
+                                  "Wrong number of events");
+    for (int i = 0; i < numEvents; i++) {
+        TEST_ASSERT_EQUAL_INT_MESSAGE(pExpected[i].type, pEvents[i].type,
+                                      "Wrong key type");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(pExpected[i].c, pEvents[i].c,
+                                      "Wrong char");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(pExpected[i].modifiers,
+                                      pEvents[i].modifiers, "Wrong modifiers");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(pExpected[i].pasted, pEvents[i].pasted,
+                                      "Wrong paste flag");
+    }
+}
+
+/**
+ * @brief Decode the input at once, then split in two at every offset, and
+ * check that the events are the expected ones every time.
+ * @param pParams Pointer to the test parameters.
+ */
+static void checkKeyDecoder(keyDecoderTestParams_t *pParams) {
+    int len = strlen(pParams->pInput);
+    keyDecoder_t decoder;
+    keyEvent_t events[MAX_KEY_EVENTS];
+    int numEvents = 0;
+    keyDecoder_init(&decoder);
+    feedKeyDecoder(&decoder, pParams->pInput, len, events, &numEvents);
+    checkKeyEvents(pParams->events, pParams->numEvents, events, numEvents);
+
+    // Every offset splits somewhere, including inside escape sequences and
+    // the bracketed paste markers.
+    for (int split = 1; split < len; split++) {
+        keyEvent_t splitEvents[MAX_KEY_EVENTS];
+        int numSplitEvents = 0;
+        keyDecoder_init(&decoder);
+        feedKeyDecoder(&decoder, pParams->pInput, split, splitEvents,
+                       &numSplitEvents);
+        feedKeyDecoder(&decoder, &pParams->pInput[split], len - split,
+                       splitEvents, &numSplitEvents);
+        checkKeyEvents(events, numEvents, splitEvents, numSplitEvents);
+    }
+}
+
+void test_key_decoder(void) {
+    int numTests = sizeof(key_decoder_params) / sizeof(key_decoder_params[0]);
+    for (int i = 0; i < numTests; i++) {
+        checkKeyDecoder(&key_decoder_params[i]);
+    }
+}
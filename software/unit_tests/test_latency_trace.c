@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for the latency trace.
+ *
+ *
+ * Requirements:
+ * 1. Each stage shall be measured between its start and end trace points,
+ *    and recorded in a histogram with the count, min, max, sum and
+ *    power of two buckets.
+ * 2. When several keys arrive before they are dequeued, the first one shall
+ *    start the stages.
+ * 3. A frame rendered without new input, e.g. a cursor blink, shall count
+ *    as a render, but not as another key to photon sample.
+ * 4. Latencies shall be measured correctly across a wrap of the clock, and
+ *    latencies beyond the last bucket shall end up in the last bucket.
+ */
+
+// Standard lib
+#include <string.h>
+
+#include "test_suite.h"
+
+#include "../comSciCalc_lib/latency_trace.h"
+
+//! Time returned by the fake clock, in us
+static uint32_t fakeTime = 0;
+
+static uint32_t fakeClock(void) { return fakeTime; }
+
+// This test checks that stages are measured between their trace points
+void test_latency_trace(void) {
+    latencyTrace_setClock(fakeClock);
+    latencyTrace_reset();
+
+    // Two keys arrive before the calculator core dequeues them. The first
+    // one starts the stages.
+    fakeTime = 1000;
+    latencyTrace_mark(tracePoint_INPUT_RECEIVE);
+    fakeTime = 1003;
+    latencyTrace_mark(tracePoint_INPUT_RECEIVE);
+    fakeTime = 1010;
+    latencyTrace_mark(tracePoint_INPUT_DEQUEUE);
+    fakeTime = 1050;
+    latencyTrace_mark(tracePoint_INPUT_PRINTED);
+    fakeTime = 1060;
+    latencyTrace_mark(tracePoint_DISPLAY_HANDOFF);
+    fakeTime = 2000;
+    latencyTrace_mark(tracePoint_DISPLAY_WAKE);
+    fakeTime = 6000;
+    latencyTrace_mark(tracePoint_DISPLAY_SWAP);
+
+    const latencyHistogram_t *pHist =
+        latencyTrace_getHistogram(traceStage_INPUT_QUEUE);
+    TEST_ASSERT_EQUAL_UINT(1, pHist->count);
+    TEST_ASSERT_EQUAL_UINT(10, pHist->min);
+    // 10 us is in the [8, 16) bucket
+    TEST_ASSERT_EQUAL_UINT(1, pHist->buckets[3]);
+    pHist = latencyTrace_getHistogram(traceStage_EDIT);
+    TEST_ASSERT_EQUAL_UINT(40, pHist->max);
+    pHist = latencyTrace_getHistogram(traceStage_RENDER);
+    TEST_ASSERT_EQUAL_UINT(4000, pHist->max);
+    pHist = latencyTrace_getHistogram(traceStage_KEY_TO_PHOTON);
+    TEST_ASSERT_EQUAL_UINT(1, pHist->count);
+    TEST_ASSERT_EQUAL_UINT(5000, pHist->max);
+
+    // A cursor blink renders another frame, which must not count as
+    // another key to photon sample.
+    fakeTime = 7000;
+    latencyTrace_mark(tracePoint_DISPLAY_WAKE);
+    fakeTime = 7100;
+    latencyTrace_mark(tracePoint_DISPLAY_SWAP);
+    pHist = latencyTrace_getHistogram(traceStage_KEY_TO_PHOTON);
+    TEST_ASSERT_EQUAL_UINT(1, pHist->count);
+    pHist = latencyTrace_getHistogram(traceStage_RENDER);
+    TEST_ASSERT_EQUAL_UINT(2, pHist->count);
+    TEST_ASSERT_EQUAL_UINT(100, pHist->min);
+    TEST_ASSERT_EQUAL_UINT(4100, (uint32_t)pHist->sum);
+
+    // The clock is free running, so it must handle wrapping.
+    fakeTime = 0xFFFFFFF0;
+    latencyTrace_mark(tracePoint_SOLVE_START);
+    fakeTime = 0x10;
+    latencyTrace_mark(tracePoint_SOLVE_END);
+    pHist = latencyTrace_getHistogram(traceStage_SOLVE);
+    TEST_ASSERT_EQUAL_UINT(0x20, pHist->max);
+
+    // Very long latencies end up in the last bucket
+    latencyTrace_reset();
+    fakeTime = 0;
+    latencyTrace_mark(tracePoint_SOLVE_START);
+    fakeTime = 0x80000000;
+    latencyTrace_mark(tracePoint_SOLVE_END);
+    pHist = latencyTrace_getHistogram(traceStage_SOLVE);
+    TEST_ASSERT_EQUAL_UINT(1, pHist->buckets[LATENCY_TRACE_NUM_BUCKETS - 1]);
+
+    TEST_ASSERT_NULL(latencyTrace_getHistogram(traceStage_NUM));
+    latencyTrace_setClock(NULL);
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for the deferred logger.
+ *
+ *
+ * Requirements:
+ * 1. The deferred logger shall print the same text as printing directly,
+ *    with a timestamp, and copy strings when logging.
+ * 2. Levels above LOG_LEVEL shall be compiled out, without evaluating
+ *    their arguments.
+ * 3. Records that don't fit in the ring shall be dropped and reported,
+ *    without blocking the writer.
+ */
+
+// Standard lib
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * The library is built without LOG_DEFERRED, so the deferred logger is
+ * built as its own library under different names, see CMakeLists.txt.
+ */
+#define LOG_DEFERRED
+#undef LOG_LEVEL
+#define LOG_LEVEL LOGGER_LEVEL_DEBUG
+#define loggerWrite deferredLoggerWrite
+#define loggerFlush deferredLoggerFlush
+#define loggerWriteImmediate deferredLoggerWriteImmediate
+#include "../comSciCalc_lib/uart_logger.h"
+
+#include "test_suite.h"
+
+//! Size of the buffer holding the flushed output
+#define FLUSH_OUTPUT_SIZE 4096
+
+//! Output of the last flush
+static char flushOutput[FLUSH_OUTPUT_SIZE];
+
+/**
+ * @brief Flush the log ring and capture what is printed on stdout.
+ * @return Return value of loggerFlush
+ */
+static bool flushAndCapture(void) {
+    memset(flushOutput, 0, FLUSH_OUTPUT_SIZE);
+    FILE *pTmp = tmpfile();
+    TEST_ASSERT_NOT_NULL(pTmp);
+    fflush(stdout);
+    int savedStdout = dup(fileno(stdout));
+    dup2(fileno(pTmp), fileno(stdout));
+    bool printed = loggerFlush();
+    fflush(stdout);
+    dup2(savedStdout, fileno(stdout));
+    close(savedStdout);
+    rewind(pTmp);
+    fread(flushOutput, 1, FLUSH_OUTPUT_SIZE - 1, pTmp);
+    fclose(pTmp);
+    return printed;
+}
+
+//! Number of times countCalls has been called
+static int numCalls = 0;
+
+static int countCalls(void) { return ++numCalls; }
+
+// This test checks the deferred log ring, and that disabled levels are
+// compiled out.
+void test_logger(void) {
+    TEST_ASSERT_FALSE(flushAndCapture());
+
+    // Strings are copied, so the buffer can be changed after logging.
+    char str[] = "hello";
+    logger(LOGGER_LEVEL_INFO, "a=%i s=%s x=%08x ll=%llx %%\r\n", 5, str,
+           0xbeef, 0x123456789ULL);
+    str[0] = 'j';
+    logger(LOGGER_LEVEL_ERROR, "f=%.2f c=%c\r\n", 1.5, 'q');
+    TEST_ASSERT_TRUE(flushAndCapture());
+    TEST_ASSERT_NOT_NULL(
+        strstr(flushOutput, "a=5 s=hello x=0000beef ll=123456789 %\r\n"));
+    TEST_ASSERT_NOT_NULL(strstr(flushOutput, "f=1.50 c=q\r\n"));
+    // Both records are timestamped
+    TEST_ASSERT_EQUAL_INT('[', flushOutput[0]);
+
+    // Levels above LOG_LEVEL don't evaluate their arguments
+    logger(LOGGER_LEVEL_DEBUG + 1, "%i\r\n", countCalls());
+    TEST_ASSERT_EQUAL_INT(0, numCalls);
+    logger(LOGGER_LEVEL_DEBUG, "%i\r\n", countCalls());
+    TEST_ASSERT_EQUAL_INT(1, numCalls);
+
+    // Arguments that don't fit in the record are left out
+    logger(LOGGER_LEVEL_DEBUG, "%llx %llx %llx %llx\r\n", 1ULL, 2ULL, 3ULL,
+           4ULL);
+    flushAndCapture();
+    TEST_ASSERT_NOT_NULL(strstr(flushOutput, "1 2 3 <?>\r\n"));
+
+    // Overfill the ring. The records that don't fit are dropped and
+    // reported, and the ring keeps working across laps.
+    for (int i = 0; i < LOG_RING_SIZE + 3; i++) {
+        logger(LOGGER_LEVEL_INFO, "%i\r\n", i);
+    }
+    TEST_ASSERT_TRUE(flushAndCapture());
+    TEST_ASSERT_NOT_NULL(strstr(flushOutput, "] 0\r\n"));
+    TEST_ASSERT_NULL(strstr(flushOutput, "] 64\r\n"));
+    TEST_ASSERT_NOT_NULL(strstr(flushOutput, "[3 log records dropped]"));
+    logger(LOGGER_LEVEL_INFO, "after\r\n");
+    TEST_ASSERT_TRUE(flushAndCapture());
+    TEST_ASSERT_NOT_NULL(strstr(flushOutput, "] after\r\n"));
+    TEST_ASSERT_NULL(strstr(flushOutput, "dropped"));
+}
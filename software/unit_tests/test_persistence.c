@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for persisting the calculator state to flash.
+ *
+ *
+ * Requirements:
+ * 1. A snapshot shall restore the same input, input base of each token,
+ *    number format, cursor and result into a fresh calculator core.
+ * 2. A snapshot from another SNAPSHOT_VERSION shall be rejected, leaving
+ *    the calculator core empty.
+ * 3. The flash log shall read back the latest record, also after a power
+ *    cycle, and nothing from erased flash.
+ * 4. The flash log shall fall back to the previous record after a torn
+ *    write.
+ * 5. The flash log shall spread the erases evenly over all its sectors.
+ */
+
+// Standard lib
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "test_suite.h"
+
+#include "../comSciCalc_lib/comscicalc.h"
+#include "../comSciCalc_lib/flash_emulator.h"
+#include "../comSciCalc_lib/flash_log.h"
+#include "../comSciCalc_lib/snapshot.h"
+
+#define EMU_SECTORS 4
+#define EMU_SECTOR_SIZE 4096
+#define EMU_PAGE_SIZE 256
+
+// This test checks that a snapshot restores the same input, format and
+// cursor into a fresh calculator core.
+void test_snapshot_restore(void) {
+    calcCoreState_t coreState;
+    calcSnapshot_t snapshot;
+    // calc_printBuffer doesn't terminate the string
+    char before[100] = {0};
+    char after[100] = {0};
+    int16_t syntaxIssuePos;
+
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_coreInit(&coreState));
+    coreState.numberFormat.inputBase = inputBase_DEC;
+    calc_addInput(&coreState, '1');
+    calc_addInput(&coreState, '2');
+    calc_addInput(&coreState, '+');
+    calc_addInput(&coreState, '3');
+    calc_solver(&coreState);
+    // Tokens keep their base when the input base changes
+    coreState.numberFormat.inputBase = inputBase_HEX;
+    coreState.numberFormat.sign = true;
+    coreState.cursorPosition = 2;
+    SUBRESULT_INT result = coreState.result;
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           snapshot_capture(&coreState, &snapshot));
+    calc_printBuffer(&coreState, before, sizeof(before), &syntaxIssuePos);
+    calc_coreBufferTeardown(&coreState);
+    TEST_ASSERT_EQUAL_INT8(0, coreState.allocCounter);
+
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_coreInit(&coreState));
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           snapshot_restore(&coreState, &snapshot));
+    calc_printBuffer(&coreState, after, sizeof(after), &syntaxIssuePos);
+    TEST_ASSERT_EQUAL_STRING(before, after);
+    TEST_ASSERT_EQUAL_INT(inputBase_HEX, coreState.numberFormat.inputBase);
+    TEST_ASSERT_TRUE(coreState.numberFormat.sign);
+    TEST_ASSERT_EQUAL_INT(2, coreState.cursorPosition);
+    TEST_ASSERT_EQUAL_INT(15, result);
+    TEST_ASSERT_EQUAL_INT(result, coreState.result);
+    // The restored input solves to the same result
+    coreState.cursorPosition = 0;
+    calc_solver(&coreState);
+    TEST_ASSERT_EQUAL_INT(result, coreState.result);
+    calc_coreBufferTeardown(&coreState);
+    TEST_ASSERT_EQUAL_INT8(0, coreState.allocCounter);
+
+    // A snapshot from another version is rejected
+    snapshot.version = SNAPSHOT_VERSION + 1;
+    calc_coreInit(&coreState);
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_FORMAT_ERROR,
+                           snapshot_restore(&coreState, &snapshot));
+    TEST_ASSERT_NULL(coreState.pListEntrypoint);
+}
+
+// This test checks that the flash log keeps the latest record across power
+// cycles, survives a torn write and spreads erases over all sectors.
+void test_flash_log(void) {
+    char path[] = "/tmp/comscicalc_flash_XXXXXX";
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    close(fd);
+    remove(path);
+
+    flashEmulator_t emulator;
+    flashLog_t log;
+    uint32_t record;
+    TEST_ASSERT_TRUE(flashEmulator_open(&emulator, path, EMU_SECTORS,
+                                        EMU_SECTOR_SIZE, EMU_PAGE_SIZE));
+    TEST_ASSERT_TRUE(flashLog_init(&log, &emulator.device, sizeof(record)));
+    TEST_ASSERT_FALSE(flashLog_read(&log, &record));
+
+    // Write enough records to wrap around all sectors several times
+    uint32_t numRecords = 5 * EMU_SECTORS * log.slotsPerSector + 3;
+    for (uint32_t i = 0; i < numRecords; i++) {
+        TEST_ASSERT_TRUE(flashLog_append(&log, &i));
+    }
+    TEST_ASSERT_TRUE(flashLog_read(&log, &record));
+    TEST_ASSERT_EQUAL_UINT32(numRecords - 1, record);
+
+    // Power cycle
+    flashEmulator_close(&emulator);
+    TEST_ASSERT_TRUE(flashEmulator_open(&emulator, path, EMU_SECTORS,
+                                        EMU_SECTOR_SIZE, EMU_PAGE_SIZE));
+    TEST_ASSERT_TRUE(flashLog_init(&log, &emulator.device, sizeof(record)));
+    TEST_ASSERT_TRUE(flashLog_read(&log, &record));
+    TEST_ASSERT_EQUAL_UINT32(numRecords - 1, record);
+
+    // A torn write, i.e. a slot header without a matching record, falls
+    // back to the previous record.
+    uint8_t torn[EMU_PAGE_SIZE];
+    memset(torn, 0xFF, sizeof(torn));
+    memset(torn, 0x5A, 6);
+    uint32_t addr = log.activeSector * EMU_SECTOR_SIZE + EMU_PAGE_SIZE +
+                    log.nextSlot * log.slotSize;
+    TEST_ASSERT_TRUE(
+        emulator.device.pProgram(emulator.device.pCtx, addr, torn,
+                                 EMU_PAGE_SIZE));
+    TEST_ASSERT_TRUE(flashLog_init(&log, &emulator.device, sizeof(record)));
+    TEST_ASSERT_TRUE(flashLog_read(&log, &record));
+    TEST_ASSERT_EQUAL_UINT32(numRecords - 1, record);
+
+    // Erases are spread evenly over the sectors. The emulator was reopened,
+    // so only erases from here on are counted.
+    record = 0xC0FFEE;
+    for (uint32_t i = 0; i < 2 * EMU_SECTORS * log.slotsPerSector; i++) {
+        TEST_ASSERT_TRUE(flashLog_append(&log, &record));
+    }
+    uint32_t minErases = UINT32_MAX;
+    uint32_t maxErases = 0;
+    for (uint8_t sector = 0; sector < EMU_SECTORS; sector++) {
+        uint32_t erases = emulator.eraseCount[sector];
+        minErases = (erases < minErases) ? erases : minErases;
+        maxErases = (erases > maxErases) ? erases : maxErases;
+    }
+    TEST_ASSERT_TRUE(minErases >= 1);
+    TEST_ASSERT_TRUE(maxErases - minErases <= 1);
+    TEST_ASSERT_TRUE(flashLog_read(&log, &record));
+    TEST_ASSERT_EQUAL_UINT32(0xC0FFEE, record);
+
+    flashEmulator_close(&emulator);
+    remove(path);
+}
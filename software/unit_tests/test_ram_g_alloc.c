@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for the RAM_G allocator used by the display.
+ *
+ *
+ * Requirements:
+ * 1. Allocated blocks shall start on a RAM_G_ALIGNMENT boundary, and the
+ *    size of a block shall be padded to RAM_G_ALIGNMENT.
+ * 2. A zero sized allocation shall fail.
+ * 3. An allocation that does not fit in the free space shall fail, as
+ *    shall one made when RAM_G_MAX_BLOCKS blocks are in use.
+ * 4. Freeing an owner shall free all of its blocks, and the freed space
+ *    shall be reused by the next allocation that fits (first fit).
+ */
+
+#include "test_suite.h"
+
+#include "../display/ram_g_alloc.h"
+
+#define RAM_G_TEST_BASE 0x1000
+#define RAM_G_TEST_SIZE 64
+
+void test_ram_g_alloc(void) {
+    ramGAllocInit(RAM_G_TEST_BASE, RAM_G_TEST_SIZE);
+
+    // Zero sized blocks are not allowed
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_INVALID_ADDRESS, ramGAlloc(0, 1));
+
+    // Sizes are padded, so the next block starts on the next boundary
+    uint32_t addrA = ramGAlloc(5, 1);
+    uint32_t addrB = ramGAlloc(3, 2);
+    uint32_t addrC = ramGAlloc(8, 1);
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE, addrA);
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE + 8, addrB);
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE + 12, addrC);
+    TEST_ASSERT_EQUAL_UINT32(0, addrA % RAM_G_ALIGNMENT);
+    TEST_ASSERT_EQUAL_UINT32(0, addrB % RAM_G_ALIGNMENT);
+    TEST_ASSERT_EQUAL_UINT32(0, addrC % RAM_G_ALIGNMENT);
+
+    // 20 bytes are used, so 44 bytes are left
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_INVALID_ADDRESS, ramGAlloc(45, 3));
+    uint32_t addrD = ramGAlloc(44, 3);
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE + 20, addrD);
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_INVALID_ADDRESS, ramGAlloc(1, 4));
+
+    // Freeing owner 1 frees both of its blocks, and the first gap is reused
+    ramGFree(1);
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE, ramGAlloc(8, 4));
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_INVALID_ADDRESS, ramGAlloc(12, 4));
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE + 12, ramGAlloc(5, 4));
+
+    // The block table is full after RAM_G_MAX_BLOCKS blocks
+    ramGAllocInit(RAM_G_TEST_BASE, RAM_G_TEST_SIZE * RAM_G_MAX_BLOCKS);
+    for (uint32_t i = 0; i < RAM_G_MAX_BLOCKS; i++) {
+        uint32_t addr = ramGAlloc(1, (uint8_t)i);
+        TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE + i * RAM_G_ALIGNMENT,
+                                 addr);
+    }
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_INVALID_ADDRESS, ramGAlloc(1, 0));
+
+    // Freeing an owner in the middle makes its slot and space free again
+    ramGFree(3);
+    TEST_ASSERT_EQUAL_UINT32(RAM_G_TEST_BASE + 3 * RAM_G_ALIGNMENT,
+                             ramGAlloc(4, 3));
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for the result cache shared between calculator states.
+ *
+ *
+ * Requirements:
+ * 1. Solving with a cache attached shall give the same result and status
+ *    as solving without.
+ * 2. Solving an input again, in the same number format, shall be answered
+ *    from the cache without running the solver. Another number format
+ *    shall be solved again.
+ * 3. A full shard shall evict its least recently used entry, and hits,
+ *    misses and evictions shall be counted.
+ * 4. States on several threads shall be able to share one cache.
+ */
+
+// Standard lib
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_suite.h"
+
+#include "../comSciCalc_lib/comscicalc.h"
+#include "../comSciCalc_lib/result_cache.h"
+
+#define NUM_CACHE_THREADS 4
+#define NUM_CACHE_ITERATIONS 300
+
+static const char *cache_test_inputs[] = {
+    "12+3", "2+3*4", "(1+2)*3", "s1,2,3)", "1+", "8/0", "(1", "a*(b+7)",
+};
+
+/**
+ * @brief Cancel function that never cancels, but counts how many times the
+ * solver polled it, i.e. if the solver ran.
+ * @param pArg Pointer to the counter.
+ * @return False.
+ */
+static bool countSolverPolls(void *pArg) {
+    (*(int *)pArg)++;
+    return false;
+}
+
+/**
+ * @brief Add a string to a fresh calculator state.
+ * @param pCalcCoreState Pointer to the calculator state.
+ * @param pString Null terminated input.
+ * @param inputBase Input base of the input.
+ */
+static void setInput(calcCoreState_t *pCalcCoreState, const char *pString,
+                     inputBase_t inputBase) {
+    calc_coreInit(pCalcCoreState);
+    pCalcCoreState->numberFormat.inputBase = inputBase;
+    while (*pString != '\0') {
+        calc_addInput(pCalcCoreState, *pString++);
+    }
+}
+
+// This test checks calc_solver with a cache attached.
+void test_result_cache(void) {
+    calcResultCache_t cache;
+    resultCacheStats_t stats;
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           resultCache_init(&cache, 64));
+    int numInputs = sizeof(cache_test_inputs) / sizeof(cache_test_inputs[0]);
+    for (int i = 0; i < numInputs; i++) {
+        const char *pInput = cache_test_inputs[i];
+        inputBase_t inputBase = pInput[0] == 'a' ? inputBase_HEX
+                                                 : inputBase_DEC;
+        calcCoreState_t uncached;
+        setInput(&uncached, pInput, inputBase);
+        calc_funStatus_t expectedStatus = calc_solver(&uncached);
+
+        // First solve misses, the second is answered from the cache.
+        for (int pass = 0; pass < 2; pass++) {
+            calcCoreState_t cached;
+            int numPolls = 0;
+            setInput(&cached, pInput, inputBase);
+            resultCache_attach(&cache, &cached);
+            cached.pSolverCancelFun = countSolverPolls;
+            cached.pSolverCancelArg = &numPolls;
+            TEST_ASSERT_EQUAL_INT8_MESSAGE(expectedStatus,
+                                           calc_solver(&cached), pInput);
+            if (expectedStatus == calc_funStatus_SUCCESS) {
+                TEST_ASSERT_EQUAL_INT64_MESSAGE(uncached.result,
+                                                cached.result, pInput);
+            }
+            if (pass == 1) {
+                TEST_ASSERT_EQUAL_INT_MESSAGE(0, numPolls, pInput);
+            }
+            calc_coreBufferTeardown(&cached);
+            TEST_ASSERT_EQUAL_INT8(0, cached.allocCounter);
+        }
+        calc_coreBufferTeardown(&uncached);
+    }
+    resultCache_getStats(&cache, &stats);
+    TEST_ASSERT_EQUAL_INT(numInputs, stats.hits);
+    TEST_ASSERT_EQUAL_INT(numInputs, stats.misses);
+    TEST_ASSERT_EQUAL_INT(numInputs, stats.numEntries);
+
+    // The same input in another format is another entry.
+    calcCoreState_t calcCore;
+    setInput(&calcCore, "10+1", inputBase_DEC);
+    resultCache_attach(&cache, &calcCore);
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_solver(&calcCore));
+    TEST_ASSERT_EQUAL_INT64(11, calcCore.result);
+    int numPolls = 0;
+    calcCore.pSolverCancelFun = countSolverPolls;
+    calcCore.pSolverCancelArg = &numPolls;
+    calcCore.numberFormat.numBits = 32;
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_solver(&calcCore));
+    TEST_ASSERT_NOT_EQUAL(0, numPolls);
+    resultCache_getStats(&cache, &stats);
+    TEST_ASSERT_EQUAL_INT(numInputs + 2, stats.misses);
+    calc_coreBufferTeardown(&calcCore);
+
+    // calc_coreInit detaches the cache.
+    calc_coreInit(&calcCore);
+    TEST_ASSERT_NULL(calcCore.pCacheLookupFun);
+    resultCache_free(&cache);
+}
+
+// This test checks the LRU order and counters of one shard.
+void test_result_cache_lru(void) {
+    calcResultCache_t cache;
+    resultCacheStats_t stats;
+    calcCoreState_t calcCore;
+    calc_coreInit(&calcCore);
+    numberFormat_t *pFormat = &calcCore.numberFormat;
+    SUBRESULT_INT result = 0;
+    calc_funStatus_t status = calc_funStatus_SUCCESS;
+
+    // Two entries per shard. Keys with the same top bits share a shard.
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           resultCache_init(&cache, 2 * RESULT_CACHE_SHARDS));
+    resultCache_store(&cache, 1, pFormat, 10, calc_funStatus_SUCCESS);
+    resultCache_store(&cache, 2, pFormat, 20, calc_funStatus_SUCCESS);
+    // Use 1, so that 2 is the least recently used.
+    TEST_ASSERT_TRUE(resultCache_lookup(&cache, 1, pFormat, &result, &status));
+    TEST_ASSERT_EQUAL_INT64(10, result);
+    resultCache_store(&cache, 3, pFormat, 30,
+                      calc_funStatus_SOLVE_INCOMPLETE);
+    TEST_ASSERT_FALSE(resultCache_lookup(&cache, 2, pFormat, &result, &status));
+    TEST_ASSERT_TRUE(resultCache_lookup(&cache, 1, pFormat, &result, &status));
+    TEST_ASSERT_TRUE(resultCache_lookup(&cache, 3, pFormat, &result, &status));
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SOLVE_INCOMPLETE, status);
+    // Keys of another shard don't evict anything here.
+    resultCache_store(&cache, 1ULL << 60, pFormat, 40,
+                      calc_funStatus_SUCCESS);
+    TEST_ASSERT_TRUE(resultCache_lookup(&cache, 1, pFormat, &result, &status));
+
+    resultCache_getStats(&cache, &stats);
+    TEST_ASSERT_EQUAL_INT(4, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT_EQUAL_INT(1, stats.evictions);
+    TEST_ASSERT_EQUAL_INT(3, stats.numEntries);
+    resultCache_free(&cache);
+}
+
+/**
+ * @brief Arguments and result of one cache thread
+ */
+typedef struct cacheThreadArgs {
+    //! Cache shared by all threads
+    calcResultCache_t *pCache;
+    //! Index of the thread, used to vary the input
+    int threadIdx;
+    //! Number of wrong results seen by the thread
+    int numErrors;
+} cacheThreadArgs_t;
+
+/**
+ * @brief Thread solving overlapping inputs with a shared cache. Unity isn't
+ * thread safe, so errors are counted and checked once joined.
+ * @param pArg Pointer to the cacheThreadArgs_t of the thread
+ * @return NULL
+ */
+static void *cacheThread(void *pArg) {
+    cacheThreadArgs_t *pArgs = (cacheThreadArgs_t *)pArg;
+    calcCoreState_t session;
+    char input[32];
+    for (int i = 0; i < NUM_CACHE_ITERATIONS; i++) {
+        // Every thread solves the same inputs, in a different order.
+        int a = (i * (pArgs->threadIdx + 1)) % 50;
+        snprintf(input, sizeof(input), "%i*(%i+7)", a, a);
+        setInput(&session, input, inputBase_DEC);
+        resultCache_attach(pArgs->pCache, &session);
+        if (calc_solver(&session) != calc_funStatus_SUCCESS ||
+            session.result != a * (a + 7)) {
+            pArgs->numErrors++;
+        }
+        calc_coreBufferTeardown(&session);
+    }
+    return NULL;
+}
+
+// This test checks that threads can share a cache.
+void test_result_cache_threads(void) {
+    calcResultCache_t cache;
+    resultCacheStats_t stats;
+    pthread_t threads[NUM_CACHE_THREADS];
+    cacheThreadArgs_t args[NUM_CACHE_THREADS];
+    // Smaller than the number of inputs, so that entries are evicted.
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           resultCache_init(&cache, 32));
+    for (int i = 0; i < NUM_CACHE_THREADS; i++) {
+        args[i].pCache = &cache;
+        args[i].threadIdx = i;
+        args[i].numErrors = 0;
+        TEST_ASSERT_EQUAL_INT(
+            0, pthread_create(&threads[i], NULL, cacheThread, &args[i]));
+    }
+    for (int i = 0; i < NUM_CACHE_THREADS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, args[i].numErrors,
+                                      "Wrong result in a thread.");
+    }
+    resultCache_getStats(&cache, &stats);
+    TEST_ASSERT_EQUAL_INT(NUM_CACHE_THREADS * NUM_CACHE_ITERATIONS,
+                          stats.hits + stats.misses);
+    resultCache_free(&cache);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024
+ * Oskar von Heideken.
+ *
+ * Unit test for running several calculator states side by side.
+ *
+ *
+ * Requirements:
+ * 1. Calculator states shall not share any mutable state, i.e.
+ *    initializing, editing or tearing down one state shall not affect
+ *    another.
+ * 2. Independent calculator states shall be usable from different threads
+ *    at the same time, without any locking.
+ */
+
+// Standard lib
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_suite.h"
+
+#include "../comSciCalc_lib/comscicalc.h"
+
+#define NUM_SESSION_THREADS 4
+#define NUM_SESSION_ITERATIONS 200
+
+/**
+ * @brief Add a string of input to a calculator state
+ * @param pCalcCoreState Pointer to the calculator state
+ * @param pString Null terminated input
+ * @return Status of the last add
+ */
+static calc_funStatus_t addString(calcCoreState_t *pCalcCoreState,
+                                  const char *pString) {
+    calc_funStatus_t status = calc_funStatus_SUCCESS;
+    while (*pString != '\0' && status == calc_funStatus_SUCCESS) {
+        status = calc_addInput(pCalcCoreState, *pString++);
+    }
+    return status;
+}
+
+// This test checks that two interleaved states keep their own entries.
+void test_interleaved_sessions(void) {
+    calcCoreState_t sessionA;
+    calcCoreState_t sessionB;
+    // calc_printBuffer doesn't terminate the string
+    char buffer[100] = {0};
+    int16_t syntaxIssuePos;
+
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_coreInit(&sessionA));
+    sessionA.numberFormat.inputBase = inputBase_DEC;
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           addString(&sessionA, "12+3"));
+
+    // Initializing another state must not forget the entries of the first.
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_coreInit(&sessionB));
+    sessionB.numberFormat.inputBase = inputBase_DEC;
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS,
+                           addString(&sessionB, "4*5"));
+
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_solver(&sessionA));
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_solver(&sessionB));
+    TEST_ASSERT_EQUAL_INT(15, sessionA.result);
+    TEST_ASSERT_EQUAL_INT(20, sessionB.result);
+
+    // Edit and tear down one state, while the other keeps going.
+    calc_removeInput(&sessionA);
+    calc_coreBufferTeardown(&sessionA);
+    TEST_ASSERT_EQUAL_INT8(0, sessionA.allocCounter);
+    calc_printBuffer(&sessionB, buffer, sizeof(buffer), &syntaxIssuePos);
+    TEST_ASSERT_EQUAL_STRING("4*5", buffer);
+    TEST_ASSERT_EQUAL_INT8(calc_funStatus_SUCCESS, calc_solver(&sessionB));
+    TEST_ASSERT_EQUAL_INT(20, sessionB.result);
+    calc_coreBufferTeardown(&sessionB);
+    TEST_ASSERT_EQUAL_INT8(0, sessionB.allocCounter);
+}
+
+/**
+ * @brief Arguments and result of one session thread
+ */
+typedef struct sessionThreadArgs {
+    //! Index of the thread, used to vary the input
+    int threadIdx;
+    //! Number of wrong results or leaks seen by the thread
+    int numErrors;
+} sessionThreadArgs_t;
+
+/**
+ * @brief Thread running its own calculator state. Unity isn't thread safe,
+ * so errors are counted and checked once the thread has been joined.
+ * @param pArg Pointer to the sessionThreadArgs_t of the thread
+ * @return NULL
+ */
+static void *sessionThread(void *pArg) {
+    sessionThreadArgs_t *pArgs = (sessionThreadArgs_t *)pArg;
+    calcCoreState_t session;
+    char input[32];
+    for (int i = 0; i < NUM_SESSION_ITERATIONS; i++) {
+        int a = pArgs->threadIdx + 1;
+        int b = i;
+        snprintf(input, sizeof(input), "%i*(%i+7)", a, b);
+        calc_coreInit(&session);
+        session.numberFormat.inputBase = inputBase_DEC;
+        if (addString(&session, input) != calc_funStatus_SUCCESS ||
+            calc_solver(&session) != calc_funStatus_SUCCESS ||
+            session.result != a * (b + 7)) {
+            pArgs->numErrors++;
+        }
+        calc_coreBufferTeardown(&session);
+        if (session.allocCounter != 0) {
+            pArgs->numErrors++;
+        }
+    }
+    return NULL;
+}
+
+// This test checks that states can be solved on several threads at once.
+void test_concurrent_sessions(void) {
+    pthread_t threads[NUM_SESSION_THREADS];
+    sessionThreadArgs_t args[NUM_SESSION_THREADS];
+    for (int i = 0; i < NUM_SESSION_THREADS; i++) {
+        args[i].threadIdx = i;
+        args[i].numErrors = 0;
+        TEST_ASSERT_EQUAL_INT(
+            0, pthread_create(&threads[i], NULL, sessionThread, &args[i]));
+    }
+    for (int i = 0; i < NUM_SESSION_THREADS; i++) {
+        TEST_ASSERT_EQUAL_INT(0, pthread_join(threads[i], NULL));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, args[i].numErrors,
+                                      "Wrong result or leak in a thread.");
+    }
+}
@@ -55,5 +55,24 @@ int main(void) {
     RUN_TEST(test_solvable_long_expression);
     RUN_TEST(test_format_conversion);
     RUN_TEST(test_logic_operations);
+    RUN_TEST(test_key_decoder);
+    RUN_TEST(test_solver_cancel);
+    RUN_TEST(test_latency_trace);
+    RUN_TEST(test_logger);
+    RUN_TEST(test_snapshot_restore);
+    RUN_TEST(test_flash_log);
+    RUN_TEST(test_interleaved_sessions);
+    RUN_TEST(test_concurrent_sessions);
+    RUN_TEST(test_eval_string);
+    RUN_TEST(test_eval_string_limits);
+    RUN_TEST(test_eval_batch);
+    RUN_TEST(test_comms_frame);
+    RUN_TEST(test_comms_frame_stream);
+    RUN_TEST(test_result_cache);
+    RUN_TEST(test_result_cache_lru);
+    RUN_TEST(test_result_cache_threads);
+    RUN_TEST(test_input_budget);
+    RUN_TEST(test_solver_budget);
+    RUN_TEST(test_ram_g_alloc);
     return UNITY_END();
 }
\ No newline at end of file
@@ -23,4 +23,23 @@ extern void test_null_pointers(void);
 extern void test_leading_zeros(void);
 extern void test_solvable_long_expression(void);
 extern void test_format_conversion(void);
-extern void test_logic_operations(void);
\ No newline at end of file
+extern void test_logic_operations(void);
+extern void test_key_decoder(void);
+extern void test_solver_cancel(void);
+extern void test_latency_trace(void);
+extern void test_logger(void);
+extern void test_snapshot_restore(void);
+extern void test_flash_log(void);
+extern void test_interleaved_sessions(void);
+extern void test_concurrent_sessions(void);
+extern void test_eval_string(void);
+extern void test_eval_string_limits(void);
+extern void test_eval_batch(void);
+extern void test_comms_frame(void);
+extern void test_comms_frame_stream(void);
+extern void test_result_cache(void);
+extern void test_result_cache_lru(void);
+extern void test_result_cache_threads(void);
+extern void test_input_budget(void);
+extern void test_solver_budget(void);
+extern void test_ram_g_alloc(void);
\ No newline at end of file
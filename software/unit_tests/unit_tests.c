@@ -120,4 +120,24 @@ void calcCoreGetBuffer(calcCoreState_t *pCoreState, char *pOutputString) {
     // Get the output, using the comSciCalc library function
     uint8_t status =
         calc_printBuffer(pCoreState, pOutputString, MAX_STR_LEN, NULL);
-}
\ No newline at end of file
+}
+
+uint32_t countInputEntries(calcCoreState_t *pCoreState) {
+    uint32_t count = 0;
+    for (inputListEntry_t *pEntry = pCoreState->pListEntrypoint;
+         pEntry != NULL; pEntry = pEntry->pNext) {
+        count++;
+    }
+    return count;
+}
+
+uint32_t countOperatorEntries(calcCoreState_t *pCoreState) {
+    uint32_t count = 0;
+    for (inputListEntry_t *pEntry = pCoreState->pListEntrypoint;
+         pEntry != NULL; pEntry = pEntry->pNext) {
+        if (GET_INPUT_TYPE(pEntry->entry.typeFlag) == INPUT_TYPE_OPERATOR) {
+            count++;
+        }
+    }
+    return count;
+}
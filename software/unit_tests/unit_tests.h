@@ -12,6 +12,24 @@
 #include "../comSciCalc_lib/comscicalc.h"
 #include "../comSciCalc_lib/comscicalc_operators.h"
 
+// Assert that a work counter of the calculator core, e.g. numListSteps, is
+// at most max since the last calc_resetCounters.
+#define TEST_ASSERT_BUDGET_MESSAGE(max, pCoreState, counter, message)          \
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE((max),                            \
+                                             (pCoreState)->counters.counter,   \
+                                             (message))
+#define TEST_ASSERT_BUDGET(max, pCoreState, counter)                           \
+    TEST_ASSERT_BUDGET_MESSAGE(max, pCoreState, counter, #counter)
+
+// The counters are only counted with CALC_COUNTERS. Without it, the budget
+// tests are ignored instead of passing on counters that are always 0.
+#if defined(CALC_COUNTERS)
+#define TEST_REQUIRE_COUNTERS()
+#else
+#define TEST_REQUIRE_COUNTERS()                                                \
+    TEST_IGNORE_MESSAGE("Built without CALC_COUNTERS")
+#endif
+
 /* -------------------------------------------
  * ------- ENUMS, TYPEDEFS AND STRUCTS -------
  * -------------------------------------------*/
@@ -40,3 +58,7 @@ void teardownTestStruct(calcCoreState_t *pCoreState);
 // Function to add the input to the calc core.
 void calcCoreAddInput(calcCoreState_t *pCoreState, testParams_t *pTestParams);
 void calcCoreGetBuffer(calcCoreState_t *pCoreState, char *pOutputString);
+
+// Functions to count the entries of the input, for the work budgets.
+uint32_t countInputEntries(calcCoreState_t *pCoreState);
+uint32_t countOperatorEntries(calcCoreState_t *pCoreState);
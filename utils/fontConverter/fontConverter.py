@@ -5,14 +5,125 @@
 # to something usable by the comSciCalc firmware
 import json
 import os
+import re
 import datetime
+import glob
+import struct
+import zlib
 
 # Set this if you want user readable .h files. 
+# Only used if USE_DEFLATE and USE_SUBSET are False.
 USE_RAWH = True
 
+# Set this to only keep the glyphs the calculator renders.
+# The glyphs are packed from FIRST_CHAR, and a char map is
+# generated which the firmware uses to remap the strings.
+USE_SUBSET = True
+
+# Character manifest. If this file exists, all characters in it
+# are kept. Otherwise, they are collected from the sources below.
+CHARSET_MANIFEST = "charset.txt"
+
+# Sources scanned for string and char literals if there is no manifest.
+# Logger calls are ignored.
+CHARSET_SOURCES = [
+    "../../software/comSciCalc_lib/comscicalc_operators.c",
+    "../../software/display/display.c",
+    "../../software/display/menu.c",
+    "../../software/display/fonts/font_library.c",
+]
+
+# The menu draws the font_name of the current font, so the names of the
+# fonts already in the firmware and of the fonts being converted are
+# always kept.
+FONT_NAME_SOURCES = "../../software/display/fonts/*.h"
+FONT_NAME_JSON = "input_files/*.json"
+
+# Characters that are always kept, since they are used when
+# entering and printing numbers.
+BASE_CHARSET = " 0123456789abcdefABCDEFxb.,-()|"
+
+# First char of the font, as given to CMD_SETFONT2
+FIRST_CHAR = 32
+
+# Set this to zlib deflate the glyph bitmaps. The firmware
+# uploads these with CMD_INFLATE, which saves both flash and
+# SPI transfers at boot.
+USE_DEFLATE = True
+
+# Size of the metric block preceding the bitmap.
+# This is never compressed, since the firmware reads the
+# character widths from it.
+METRIC_BLOCK_SIZE = 148
+
+def collectCharset():
+    # Use the manifest if there is one
+    if os.path.exists(CHARSET_MANIFEST):
+        with open(CHARSET_MANIFEST) as f: charset = set(f.read())
+    else:
+        charset = set()
+        for source in CHARSET_SOURCES:
+            with open(source) as f: code = f.read()
+            # Remove comments and logging, which are never displayed
+            code = re.sub(r"/\*.*?\*/", "", code, flags=re.S)
+            code = re.sub(r"//[^\n]*", "", code)
+            code = re.sub(r"(logger|UARTprintf)\(.*?\);", "", code, flags=re.S)
+            code = re.sub(r"#include[^\n]*", "", code)
+            literals = re.findall(r'"((?:[^"\\]|\\.)*)"', code)
+            literals += re.findall(r"'((?:[^'\\]|\\.))'", code)
+            for literal in literals:
+                # Drop escape sequences and format specifiers
+                literal = re.sub(r"\\.", "", literal)
+                literal = re.sub(r"%[-0-9.]*[a-zA-Z]", "", literal)
+                charset |= set(literal)
+    for source in glob.glob(FONT_NAME_SOURCES):
+        with open(source) as f: code = f.read()
+        for name in re.findall(r'\.font_name\s*=\s*"((?:[^"\\]|\\.)*)"', code):
+            charset |= set(re.sub(r"\\.", "", name))
+    for source in glob.glob(FONT_NAME_JSON):
+        with open(source) as f: charset |= set(json.load(f)["name"])
+    charset |= set(BASE_CHARSET)
+    return sorted(c for c in charset if FIRST_CHAR <= ord(c) < 128)
+
+def subsetFont(data, charset):
+    # Build a font only holding the glyphs in charset. The glyph of
+    # the n-th char is placed at FIRST_CHAR + n, and the width table
+    # is remapped accordingly. Returns the new font table and the
+    # char map from ASCII to the new char code.
+    widths = data[:128]
+    font_format, stride, width, height, raw_offset = \
+        struct.unpack("<5I", data[128:METRIC_BLOCK_SIZE])
+    glyph_size = stride * height
+    num_glyphs = (len(data) - METRIC_BLOCK_SIZE) // glyph_size
+    charset = [c for c in charset if ord(c) - FIRST_CHAR < num_glyphs]
+    new_widths = bytearray(128)
+    # Chars that are not in the subset are shown as the first glyph,
+    # which is a space.
+    charmap = [FIRST_CHAR] * 128
+    bitmap = bytearray()
+    for i, c in enumerate(charset):
+        charmap[ord(c)] = FIRST_CHAR + i
+        new_widths[FIRST_CHAR + i] = widths[ord(c)]
+        start = METRIC_BLOCK_SIZE + (ord(c) - FIRST_CHAR) * glyph_size
+        bitmap += data[start:start + glyph_size]
+    print("Kept " + str(len(charset)) + " of " + str(num_glyphs) + " glyphs")
+    return bytes(new_widths) + data[128:METRIC_BLOCK_SIZE] + bytes(bitmap), \
+        charmap
+
+def bytesToString(data):
+    # Format bytes as a comma separated list, 32 per line
+    lines = []
+    for i in range(0, len(data), 32):
+        lines.append(",".join(str(b) for b in data[i:i+32]) + ",\n")
+    return "".join(lines)
+
 with open('h_header.txt') as f: header = f.read()
 with open('h_footer.txt') as f: footer = f.read()
 
+if(USE_SUBSET == True):
+    charset = collectCharset()
+    print("Character set: " + "".join(charset))
+
 # Get a list of all files in the input directory
 listdir = os.listdir("input_files/")
 
@@ -28,8 +139,8 @@ for f in jsonListTemp:
     filename = f.replace(".json", "")
     correlated_raw_filename = ""
     for l in listdir:
-        if "rawh" in l:
-            # Skip the rawh files
+        if "rawh" in l or ".json" in l:
+            # Skip the rawh and json files
             continue
         if filename in l:
             correlated_raw_filename = l
@@ -85,14 +196,38 @@ for correlated_file in correlated_files:
     
     # Open the .raw file
     with open("input_files/" + rawfile, mode='rb') as f: data = f.read()
+    charmap_array = ""
+    if(USE_SUBSET == True):
+        data, charmap = subsetFont(data, charset)
+        charmap_array = "const uint8_t " + fontname + "_charmap [128] = {\n" + \
+            bytesToString(charmap) + "};\n\n"
+        h_footer = h_footer.replace("<CHARMAP>", fontname + "_charmap")
+    else:
+        h_footer = h_footer.replace("<CHARMAP>", "NULL")
     numbytes = len(data)
     h_header = h_header.replace("<NUMBYTES>", str(numbytes))
     h_footer = h_footer.replace("<NUMBYTES>", str(numbytes))
 
-    if(USE_RAWH == True):
+    if(USE_DEFLATE == True):
+        metric_block = data[:METRIC_BLOCK_SIZE]
+        deflated = zlib.compress(data[METRIC_BLOCK_SIZE:], 9)
+        print("Deflated bitmap from " + str(numbytes - METRIC_BLOCK_SIZE) +
+              " to " + str(len(deflated)) + " bytes")
+        h_header = h_header.replace("<ARRAYBYTES>",
+                                    str(METRIC_BLOCK_SIZE + len(deflated)))
+        h_footer = h_footer.replace("<DEFLATEDBYTES>", str(len(deflated)))
+        h_header += "{\n"
+        h_header += "/* Metric block */\n" + bytesToString(metric_block)
+        h_header += "/* Deflated bitmap */\n" + bytesToString(deflated)
+        h_header += "}"
+    elif(USE_RAWH == True and USE_SUBSET == False):
+        h_header = h_header.replace("<ARRAYBYTES>", str(numbytes))
+        h_footer = h_footer.replace("<DEFLATEDBYTES>", "0")
         with open("input_files/" + rawfile + "h") as f: data = f.read()
         h_header = h_header + data + "\n"
     else:
+        h_header = h_header.replace("<ARRAYBYTES>", str(numbytes))
+        h_footer = h_footer.replace("<DEFLATEDBYTES>", "0")
         h_header += "{\n"
         # Convert binary data to a list instead
         bytedata =[]
@@ -108,6 +243,6 @@ for correlated_file in correlated_files:
     #h_header = h_header[:-2]
 
     # Finally, append the footer and write to the new file
-    h_header = h_header + "\n" + h_footer
+    h_header = h_header + "\n" + charmap_array + h_footer
     with open("output_files/" + fontname + ".h", mode='w') as f: f.write(h_header)
     
\ No newline at end of file